@@ -0,0 +1,35 @@
+#include "Benchmark/allocation_counter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+    std::atomic<std::uint64_t> g_allocation_count = 0;
+
+}  // End namespace.
+
+void* operator new(std::size_t size) {
+    g_allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* pointer = std::malloc(size == 0 ? 1 : size)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+namespace darwin {
+
+    std::uint64_t GetAllocationCount() {
+        return g_allocation_count.load(std::memory_order_relaxed);
+    }
+
+}  // End namespace darwin.
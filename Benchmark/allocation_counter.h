@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstdint>
+
+namespace darwin {
+
+    // Number of calls to the global operator new since the start, it is
+    // replaced in the benchmark to count the allocations of a loop:
+    //   const auto allocations = GetAllocationCount();
+    //   ...
+    //   GetAllocationCount() - allocations
+    std::uint64_t GetAllocationCount();
+
+}  // End namespace darwin.
@@ -0,0 +1,62 @@
+#include "benchmark_world.h"
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+
+#include "Common/convert_math.h"
+#include "Common/stl_proto_wrapper.h"
+#include "Common/vector.h"
+
+namespace darwin {
+
+    void FillBenchmarkWorld(
+        WorldState& world_state,
+        std::size_t upgrade_count,
+        std::size_t character_count)
+    {
+        proto::PlayerParameter player_parameter;
+        player_parameter.set_start_mass(10.0);
+        player_parameter.set_victory_size(1'000.0);
+        player_parameter.set_max_upgrade_grow(800.0);
+        player_parameter.set_disconnection_timeout(10.0);
+        player_parameter.add_color_parameters()->mutable_color()->CopyFrom(
+            CreateVector3(0.0, 1.0, 0.0));
+        world_state.SetPlayerParameter(player_parameter);
+        // The default world has 500 entities on a planet of radius 100.
+        const double planet_radius = 100.0 * std::sqrt(
+            std::max<double>(
+                static_cast<double>(upgrade_count + character_count),
+                500.0) / 500.0);
+        world_state.AddElement(
+            CreateBasicElement(
+                "ground",
+                proto::TYPE_GROUND,
+                CreateVector3(0.0, 0.0, 0.0),
+                1'000'000'000.0,
+                planet_radius));
+        world_state.SetUpgradeElement(
+            static_cast<std::uint32_t>(upgrade_count));
+        const double radius = GetRadiusFromVolume(10.0);
+        for (std::size_t i = 0; i < character_count; ++i) {
+            auto character = CreateBasicCharacter(
+                std::format("character{}", i),
+                CreateRandomNormalizedVector3() * (planet_radius + radius),
+                10.0,
+                radius);
+            character.set_status_enum(proto::STATUS_ON_GROUND);
+            world_state.AddCharacter(character);
+        }
+        world_state.Update(1.0);
+    }
+
+    void FillBenchmarkWorld(WorldState& world_state, std::size_t entity_count)
+    {
+        const std::size_t character_count = entity_count / 10;
+        FillBenchmarkWorld(
+            world_state,
+            entity_count - character_count,
+            character_count);
+    }
+
+}  // End namespace darwin.
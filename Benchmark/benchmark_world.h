@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstddef>
+
+#include "Server/world_state.h"
+
+namespace darwin {
+
+    // Generated world: a planet (its radius grows with the entity count to
+    // keep the density of the default world), the upgrades and characters of
+    // the same mass on the ground at random positions.
+    void FillBenchmarkWorld(
+        WorldState& world_state,
+        std::size_t upgrade_count,
+        std::size_t character_count);
+
+    // A world of entity_count entities, a tenth of them characters.
+    void FillBenchmarkWorld(WorldState& world_state, std::size_t entity_count);
+
+}  // End namespace darwin.
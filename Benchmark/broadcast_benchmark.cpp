@@ -0,0 +1,47 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "Benchmark/benchmark_world.h"
+#include "Server/update_writer.h"
+#include "Server/world_state.h"
+
+namespace {
+
+    // Broadcast cost as it was: the response is built once and serialized
+    // by each stream.
+    void BM_BroadcastSerializeEach(benchmark::State& state) {
+        darwin::WorldState world_state;
+        darwin::FillBenchmarkWorld(world_state, 400, 100);
+        std::vector<grpc::ByteBuffer> streams(state.range(0));
+        for (auto _ : state) {
+            proto::UpdateResponse response;
+            world_state.FillUpdateResponse(response);
+            for (auto& stream : streams) {
+                stream = darwin::SerializeUpdateResponse(response);
+            }
+            benchmark::DoNotOptimize(streams.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_BroadcastSerializeEach)->RangeMultiplier(10)->Range(1, 1000);
+
+    // Broadcast cost with the response serialized once and shared.
+    void BM_BroadcastSerializeOnce(benchmark::State& state) {
+        darwin::WorldState world_state;
+        darwin::FillBenchmarkWorld(world_state, 400, 100);
+        std::vector<grpc::ByteBuffer> streams(state.range(0));
+        for (auto _ : state) {
+            proto::UpdateResponse response;
+            world_state.FillUpdateResponse(response);
+            const auto buffer = darwin::SerializeUpdateResponse(response);
+            for (auto& stream : streams) {
+                stream = buffer;
+            }
+            benchmark::DoNotOptimize(streams.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_BroadcastSerializeOnce)->RangeMultiplier(10)->Range(1, 1000);
+
+}  // End anonymous namespace.
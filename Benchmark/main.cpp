@@ -0,0 +1,33 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+// Same as BENCHMARK_MAIN, but the results are also written as JSON (to
+// darwin_benchmark.json unless --benchmark_out is given) to track the
+// regressions between releases.
+int main(int ac, char** av) {
+    std::vector<char*> arguments(av, av + ac);
+    bool has_out = false;
+    for (const std::string argument : arguments) {
+        if (argument.starts_with("--benchmark_out=")) {
+            has_out = true;
+        }
+    }
+    std::string out = "--benchmark_out=darwin_benchmark.json";
+    std::string out_format = "--benchmark_out_format=json";
+    if (!has_out) {
+        arguments.push_back(out.data());
+        arguments.push_back(out_format.data());
+    }
+    int argument_count = static_cast<int>(arguments.size());
+    benchmark::Initialize(&argument_count, arguments.data());
+    if (benchmark::ReportUnrecognizedArguments(
+        argument_count, arguments.data()))
+    {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,420 @@
+#include <benchmark/benchmark.h>
+
+#include <format>
+#include <vector>
+
+#include "Benchmark/allocation_counter.h"
+#include "Common/convert_math.h"
+#include "Common/physic.h"
+#include "Common/physic_batch.h"
+#include "Common/stl_proto_wrapper.h"
+#include "Common/vector.h"
+#include "Common/world_simulator.h"
+
+// The primitives are run over 1e2 to 1e6 entities.
+#define DARWIN_MATH_BENCHMARK(name)                                          \
+    BENCHMARK(name)                                                          \
+        ->RangeMultiplier(10)                                                \
+        ->Range(100, 1'000'000)                                              \
+        ->Unit(benchmark::kMicrosecond)
+
+// The batched primitives are also run for every kernel (see
+// PhysicKernelEnum), the unsupported ones are skipped.
+#define DARWIN_PHYSIC_BATCH_BENCHMARK(name)                                  \
+    BENCHMARK(name)                                                          \
+        ->ArgsProduct({                                                      \
+            benchmark::CreateRange(100, 1'000'000, 10),                      \
+            { 0, 1, 2 } })                                                   \
+        ->Unit(benchmark::kMicrosecond)
+
+namespace {
+
+    using darwin::operator+;
+    using darwin::operator*;
+
+    // Bodies around (and a few in) a planet of radius 100.
+    std::vector<proto::Physic> CreatePhysics(std::size_t count) {
+        std::vector<proto::Physic> physics(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            auto& physic = physics[i];
+            physic.mutable_position()->CopyFrom(
+                darwin::CreateRandomNormalizedVector3() *
+                (99.0 + static_cast<double>(i % 10)));
+            physic.mutable_position_dt()->CopyFrom(
+                darwin::CreateRandomNormalizedVector3());
+            physic.set_mass(10.0);
+            physic.set_radius(1.5);
+        }
+        return physics;
+    }
+
+    std::vector<proto::Vector3> CreateVectors(std::size_t count) {
+        std::vector<proto::Vector3> vectors(count);
+        for (auto& vector : vectors) {
+            vector = darwin::CreateRandomNormalizedVector3() * 10.0;
+        }
+        return vectors;
+    }
+
+    std::vector<darwin::PhysicState> CreatePhysicStates(std::size_t count) {
+        std::vector<darwin::PhysicState> states;
+        states.reserve(count);
+        for (const auto& physic : CreatePhysics(count)) {
+            states.push_back(darwin::GetPhysicState(physic));
+        }
+        return states;
+    }
+
+    // The same bodies as structure of arrays.
+    struct PhysicBodies {
+        std::vector<glm::dvec3> positions;
+        std::vector<glm::dvec3> position_dts;
+        std::vector<double> masses;
+        std::vector<double> radii;
+        std::vector<glm::dvec3> forces;
+        std::vector<proto::StatusEnum> statuses;
+
+        darwin::PhysicBatch GetBatch() {
+            return { positions, position_dts, masses, radii };
+        }
+    };
+
+    PhysicBodies CreatePhysicBodies(std::size_t count) {
+        PhysicBodies bodies;
+        for (const auto& physic : CreatePhysicStates(count)) {
+            bodies.positions.push_back(physic.position);
+            bodies.position_dts.push_back(physic.position_dt);
+            bodies.masses.push_back(physic.mass);
+            bodies.radii.push_back(physic.radius);
+        }
+        bodies.forces.assign(count, glm::dvec3(0.0, 0.0, -1.0));
+        bodies.statuses.resize(count);
+        return bodies;
+    }
+
+    // Select the kernel of the second argument, false if not supported.
+    bool SelectPhysicKernel(benchmark::State& state) {
+        const auto physic_kernel =
+            static_cast<darwin::PhysicKernelEnum>(state.range(1));
+        if (!darwin::SetPhysicKernel(physic_kernel)) {
+            state.SkipWithError("Unsupported kernel.");
+            return false;
+        }
+        state.SetLabel(darwin::GetPhysicKernelName(physic_kernel));
+        return true;
+    }
+
+    // Allocations by iteration since GetAllocationCount was allocations.
+    benchmark::Counter AllocationsSince(std::uint64_t allocations) {
+        return benchmark::Counter(
+            static_cast<double>(darwin::GetAllocationCount() - allocations),
+            benchmark::Counter::kAvgIterations);
+    }
+
+    proto::Element CreatePlanet() {
+        return darwin::CreateBasicElement(
+            "ground",
+            proto::TYPE_GROUND,
+            darwin::CreateVector3(0.0, 0.0, 0.0),
+            1'000'000'000.0,
+            100.0);
+    }
+
+    void BM_VectorAdd(benchmark::State& state) {
+        const auto lefts = CreateVectors(state.range(0));
+        const auto rights = CreateVectors(state.range(0));
+        for (auto _ : state) {
+            for (std::size_t i = 0; i < lefts.size(); ++i) {
+                benchmark::DoNotOptimize(lefts[i] + rights[i]);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    DARWIN_MATH_BENCHMARK(BM_VectorAdd);
+
+    void BM_VectorScale(benchmark::State& state) {
+        const auto vectors = CreateVectors(state.range(0));
+        for (auto _ : state) {
+            for (const auto& vector : vectors) {
+                benchmark::DoNotOptimize(vector * 0.5);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    DARWIN_MATH_BENCHMARK(BM_VectorScale);
+
+    void BM_VectorDot(benchmark::State& state) {
+        const auto lefts = CreateVectors(state.range(0));
+        const auto rights = CreateVectors(state.range(0));
+        for (auto _ : state) {
+            for (std::size_t i = 0; i < lefts.size(); ++i) {
+                benchmark::DoNotOptimize(darwin::Dot(lefts[i], rights[i]));
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    DARWIN_MATH_BENCHMARK(BM_VectorDot);
+
+    void BM_VectorCross(benchmark::State& state) {
+        const auto lefts = CreateVectors(state.range(0));
+        const auto rights = CreateVectors(state.range(0));
+        for (auto _ : state) {
+            for (std::size_t i = 0; i < lefts.size(); ++i) {
+                benchmark::DoNotOptimize(darwin::Cross(lefts[i], rights[i]));
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    DARWIN_MATH_BENCHMARK(BM_VectorCross);
+
+    void BM_VectorNormalize(benchmark::State& state) {
+        const auto vectors = CreateVectors(state.range(0));
+        for (auto _ : state) {
+            for (const auto& vector : vectors) {
+                benchmark::DoNotOptimize(darwin::Normalize(vector));
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    DARWIN_MATH_BENCHMARK(BM_VectorNormalize);
+
+    void BM_VectorProjectOnPlane(benchmark::State& state) {
+        const auto vectors = CreateVectors(state.range(0));
+        const auto normal = darwin::CreateVector3(0.0, 0.0, 1.0);
+        for (auto _ : state) {
+            for (const auto& vector : vectors) {
+                benchmark::DoNotOptimize(
+                    darwin::ProjectOnPlane(vector, normal));
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    DARWIN_MATH_BENCHMARK(BM_VectorProjectOnPlane);
+
+    void BM_ApplyPhysic(benchmark::State& state) {
+        const auto physics = CreatePhysics(state.range(0));
+        const auto planet = CreatePlanet();
+        for (auto _ : state) {
+            for (const auto& physic : physics) {
+                benchmark::DoNotOptimize(
+                    darwin::ApplyPhysic(planet.physic(), physic));
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    DARWIN_MATH_BENCHMARK(BM_ApplyPhysic);
+
+    void BM_ApplyPhysicState(benchmark::State& state) {
+        const auto physics = CreatePhysicStates(state.range(0));
+        const auto planet = darwin::GetPhysicState(CreatePlanet().physic());
+        for (auto _ : state) {
+            for (const auto& physic : physics) {
+                benchmark::DoNotOptimize(darwin::ApplyPhysic(planet, physic));
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    DARWIN_MATH_BENCHMARK(BM_ApplyPhysicState);
+
+    void BM_UpdateObject(benchmark::State& state) {
+        auto physics = CreatePhysics(state.range(0));
+        const glm::dvec3 force(0.0, 0.0, -1.0);
+        const auto allocations = darwin::GetAllocationCount();
+        for (auto _ : state) {
+            for (auto& physic : physics) {
+                benchmark::DoNotOptimize(
+                    darwin::UpdateObject(physic, force, 1.0 / 30.0));
+            }
+        }
+        state.counters["allocations"] = AllocationsSince(allocations);
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    DARWIN_MATH_BENCHMARK(BM_UpdateObject);
+
+    void BM_UpdateObjectState(benchmark::State& state) {
+        auto physics = CreatePhysicStates(state.range(0));
+        const glm::dvec3 force(0.0, 0.0, -1.0);
+        const auto allocations = darwin::GetAllocationCount();
+        for (auto _ : state) {
+            for (auto& physic : physics) {
+                benchmark::DoNotOptimize(
+                    darwin::UpdateObject(physic, force, 1.0 / 30.0));
+            }
+        }
+        state.counters["allocations"] = AllocationsSince(allocations);
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    DARWIN_MATH_BENCHMARK(BM_UpdateObjectState);
+
+    void BM_CorrectSurface(benchmark::State& state) {
+        auto physics = CreatePhysics(state.range(0));
+        const auto planet = CreatePlanet();
+        const auto allocations = darwin::GetAllocationCount();
+        for (auto _ : state) {
+            for (auto& physic : physics) {
+                benchmark::DoNotOptimize(
+                    darwin::CorrectSurface(physic, planet));
+            }
+        }
+        state.counters["allocations"] = AllocationsSince(allocations);
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    DARWIN_MATH_BENCHMARK(BM_CorrectSurface);
+
+    void BM_CorrectSurfaceState(benchmark::State& state) {
+        auto physics = CreatePhysicStates(state.range(0));
+        const auto planet = darwin::GetPhysicState(CreatePlanet().physic());
+        const auto allocations = darwin::GetAllocationCount();
+        for (auto _ : state) {
+            for (auto& physic : physics) {
+                benchmark::DoNotOptimize(
+                    darwin::CorrectSurface(physic, planet));
+            }
+        }
+        state.counters["allocations"] = AllocationsSince(allocations);
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    DARWIN_MATH_BENCHMARK(BM_CorrectSurfaceState);
+
+    void BM_ApplyPhysicBatch(benchmark::State& state) {
+        if (!SelectPhysicKernel(state)) return;
+        auto bodies = CreatePhysicBodies(state.range(0));
+        const auto planet = darwin::GetPhysicState(CreatePlanet().physic());
+        for (auto _ : state) {
+            darwin::ApplyPhysicBatch(
+                planet,
+                bodies.positions,
+                bodies.masses,
+                bodies.forces);
+            benchmark::DoNotOptimize(bodies.forces.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    DARWIN_PHYSIC_BATCH_BENCHMARK(BM_ApplyPhysicBatch);
+
+    void BM_UpdateObjectBatch(benchmark::State& state) {
+        if (!SelectPhysicKernel(state)) return;
+        auto bodies = CreatePhysicBodies(state.range(0));
+        for (auto _ : state) {
+            darwin::UpdateObjectBatch(
+                bodies.GetBatch(),
+                bodies.forces,
+                1.0 / 30.0);
+            benchmark::DoNotOptimize(bodies.positions.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    DARWIN_PHYSIC_BATCH_BENCHMARK(BM_UpdateObjectBatch);
+
+    void BM_CorrectSurfaceBatch(benchmark::State& state) {
+        if (!SelectPhysicKernel(state)) return;
+        auto bodies = CreatePhysicBodies(state.range(0));
+        const auto planet = darwin::GetPhysicState(CreatePlanet().physic());
+        for (auto _ : state) {
+            darwin::CorrectSurfaceBatch(
+                bodies.GetBatch(),
+                planet,
+                bodies.statuses);
+            benchmark::DoNotOptimize(bodies.positions.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    DARWIN_PHYSIC_BATCH_BENCHMARK(BM_CorrectSurfaceBatch);
+
+    // A frame of the client prediction: gravity, integration and ground of
+    // the player character in the world simulator, then its move from the
+    // inputs. Nothing should be allocated.
+    void BM_ClientPredictionFrame(benchmark::State& state) {
+        darwin::WorldSimulator world_simulator;
+        world_simulator.SetUserName("player");
+        std::vector<proto::Element> elements = { CreatePlanet() };
+        for (const auto& physic : CreatePhysics(state.range(0))) {
+            auto element = darwin::CreateBasicElement(
+                std::format("upgrade{}", elements.size()),
+                proto::TYPE_UPGRADE,
+                physic.position(),
+                1.0,
+                1.0);
+            elements.push_back(element);
+        }
+        std::vector<proto::Character> characters = {
+            darwin::CreateBasicCharacter(
+                "player",
+                darwin::CreateVector3(0.0, 0.0, 101.0),
+                10.0,
+                1.5) };
+        world_simulator.UpdateData(elements, characters, 0.0);
+        proto::PlayerParameter player_parameter;
+        player_parameter.set_friction(0.1);
+        player_parameter.set_horizontal_speed(10.0);
+        auto physic = darwin::GetPhysicState(characters[0].physic());
+        const glm::dvec3 normal(0.0, 0.0, 1.0);
+        const glm::dvec3 forward(1.0, 0.0, 0.0);
+        const auto allocations = darwin::GetAllocationCount();
+        for (auto _ : state) {
+            world_simulator.Simulate(1.0 / 60.0);
+            physic.position_dt = darwin::ApplyMove(
+                physic.position_dt,
+                darwin::GetInputDirection(normal, forward, 0.5, 1.0),
+                physic.mass,
+                player_parameter,
+                1.0 / 60.0);
+            benchmark::DoNotOptimize(physic);
+        }
+        state.counters["allocations"] = AllocationsSince(allocations);
+    }
+    BENCHMARK(BM_ClientPredictionFrame)
+        ->RangeMultiplier(10)
+        ->Range(100, 10'000)
+        ->Unit(benchmark::kMicrosecond);
+
+    void BM_ProtoVector2Glm(benchmark::State& state) {
+        const auto vectors = CreateVectors(state.range(0));
+        for (auto _ : state) {
+            for (const auto& vector : vectors) {
+                benchmark::DoNotOptimize(darwin::ProtoVector2Glm(vector));
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    DARWIN_MATH_BENCHMARK(BM_ProtoVector2Glm);
+
+    void BM_Glm2ProtoVector(benchmark::State& state) {
+        std::vector<glm::dvec3> vectors;
+        for (const auto& vector : CreateVectors(state.range(0))) {
+            vectors.push_back(darwin::ProtoVector2Glm(vector));
+        }
+        for (auto _ : state) {
+            for (const auto& vector : vectors) {
+                benchmark::DoNotOptimize(darwin::Glm2ProtoVector(vector));
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    DARWIN_MATH_BENCHMARK(BM_Glm2ProtoVector);
+
+    void BM_IsIntersecting(benchmark::State& state) {
+        const auto physics = CreatePhysics(state.range(0));
+        for (auto _ : state) {
+            for (std::size_t i = 1; i < physics.size(); ++i) {
+                benchmark::DoNotOptimize(
+                    darwin::IsIntersecting(physics[i - 1], physics[i]));
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    DARWIN_MATH_BENCHMARK(BM_IsIntersecting);
+
+    void BM_IsAlmostIntersecting(benchmark::State& state) {
+        const auto physics = CreatePhysics(state.range(0));
+        for (auto _ : state) {
+            for (std::size_t i = 1; i < physics.size(); ++i) {
+                benchmark::DoNotOptimize(
+                    darwin::IsAlmostIntersecting(physics[i - 1], physics[i]));
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    DARWIN_MATH_BENCHMARK(BM_IsAlmostIntersecting);
+
+}  // End anonymous namespace.
@@ -0,0 +1,149 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include "Benchmark/allocation_counter.h"
+#include "Benchmark/benchmark_world.h"
+#include "Server/input_simulator.h"
+#include "Server/tick_profiler.h"
+#include "Server/world_state.h"
+
+namespace {
+
+    constexpr double STEP_PERIOD = 1.0 / 30.0;
+    // The characters eat and grow, the world is generated again (out of the
+    // measured time) after this number of steps.
+    constexpr std::int64_t STEPS_BY_WORLD = 100;
+
+    double SecondsSince(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+    }
+
+    // Each phase of WorldState::Update is reported as a counter (average
+    // time in us by step), CheckIntersectPlayerLocked and the other phases
+    // are private to the world state.
+    void BM_WorldStateUpdate(benchmark::State& state) {
+        constexpr std::array phases = {
+            darwin::TickPhaseEnum::TICK_PHASE_STILL_IN_USE,
+            darwin::TickPhaseEnum::TICK_PHASE_GROUND,
+            darwin::TickPhaseEnum::TICK_PHASE_DEATH,
+            darwin::TickPhaseEnum::TICK_PHASE_VICTORY,
+            darwin::TickPhaseEnum::TICK_PHASE_BUILD_GRIDS,
+            darwin::TickPhaseEnum::TICK_PHASE_DETECT_HITS,
+            darwin::TickPhaseEnum::TICK_PHASE_INTERSECT,
+        };
+        // A window of one sample: the last step.
+        darwin::TickProfiler tick_profiler{ 1 };
+        std::array<double, phases.size()> phase_times{};
+        std::unique_ptr<darwin::WorldState> world_state;
+        double time = 1.0;
+        std::int64_t step = 0;
+        std::uint64_t allocations = 0;
+        for (auto _ : state) {
+            if (step++ % STEPS_BY_WORLD == 0) {
+                world_state = std::make_unique<darwin::WorldState>();
+                darwin::FillBenchmarkWorld(*world_state, state.range(0));
+                world_state->SetTickProfiler(&tick_profiler);
+            }
+            time += STEP_PERIOD;
+            const auto allocation_count = darwin::GetAllocationCount();
+            const auto start = std::chrono::steady_clock::now();
+            world_state->Update(time);
+            state.SetIterationTime(SecondsSince(start));
+            allocations += darwin::GetAllocationCount() - allocation_count;
+            tick_profiler.Flush();
+            for (std::size_t i = 0; i < phases.size(); ++i) {
+                phase_times[i] +=
+                    tick_profiler.GetStatistics(phases[i]).max * 1e6;
+            }
+        }
+        for (std::size_t i = 0; i < phases.size(); ++i) {
+            std::string name = darwin::GetTickPhaseName(phases[i]);
+            name.erase(0, name.find_first_not_of(' '));
+            std::replace(name.begin(), name.end(), ' ', '_');
+            state.counters[name + "_us"] = benchmark::Counter(
+                phase_times[i],
+                benchmark::Counter::kAvgIterations);
+        }
+        state.counters["allocations"] = benchmark::Counter(
+            static_cast<double>(allocations),
+            benchmark::Counter::kAvgIterations);
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_WorldStateUpdate)
+        ->RangeMultiplier(10)
+        ->Range(100, 1'000'000)
+        ->UseManualTime()
+        ->Unit(benchmark::kMicrosecond);
+
+    // FillUpdateResponse replaced FillVectorsLocked.
+    void BM_FillUpdateResponse(benchmark::State& state) {
+        darwin::WorldState world_state;
+        darwin::FillBenchmarkWorld(world_state, state.range(0));
+        for (auto _ : state) {
+            proto::UpdateResponse response;
+            world_state.FillUpdateResponse(response);
+            benchmark::DoNotOptimize(response);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_FillUpdateResponse)
+        ->RangeMultiplier(10)
+        ->Range(100, 1'000'000)
+        ->Unit(benchmark::kMicrosecond);
+
+    void BM_SetUpgradeElement(benchmark::State& state) {
+        for (auto _ : state) {
+            darwin::WorldState world_state;
+            darwin::FillBenchmarkWorld(world_state, 0, 0);
+            const auto start = std::chrono::steady_clock::now();
+            world_state.SetUpgradeElement(
+                static_cast<std::uint32_t>(state.range(0)));
+            state.SetIterationTime(SecondsSince(start));
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_SetUpgradeElement)
+        ->RangeMultiplier(10)
+        ->Range(100, 1'000'000)
+        ->UseManualTime()
+        ->Unit(benchmark::kMicrosecond);
+
+    // A step worth of input commands (4 frames) for every character, the
+    // second argument is the number of worker threads.
+    void BM_SimulateInputs(benchmark::State& state) {
+        darwin::WorldState world_state;
+        darwin::FillBenchmarkWorld(world_state, 0, state.range(0));
+        const darwin::PlayerInput player_input{
+            glm::dvec3(1.0, 0.0, 0.0), false, false, STEP_PERIOD / 4.0 };
+        std::vector<darwin::CharacterInputState> character_input_states;
+        for (const auto& character : world_state.GetCharacters()) {
+            darwin::CharacterInputState character_input_state;
+            character_input_state.name = character.name();
+            character_input_state.player_inputs.assign(4, player_input);
+            character_input_states.push_back(character_input_state);
+        }
+        world_state.GetCharacterInputStates(character_input_states);
+        const auto grounds = world_state.GetGroundStates();
+        const auto player_parameter = world_state.GetPlayerParameter();
+        darwin::WorkerPool worker_pool(state.range(1));
+        darwin::InputSimulator input_simulator(worker_pool);
+        for (auto _ : state) {
+            auto states = character_input_states;
+            const auto start = std::chrono::steady_clock::now();
+            input_simulator.Simulate(states, grounds, player_parameter);
+            state.SetIterationTime(SecondsSince(start));
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_SimulateInputs)
+        ->ArgsProduct({ { 1'000, 10'000, 100'000 }, { 0, 1, 3, 7 } })
+        ->UseManualTime()
+        ->Unit(benchmark::kMicrosecond);
+
+}  // End anonymous namespace.
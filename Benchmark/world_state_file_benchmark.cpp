@@ -0,0 +1,82 @@
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <filesystem>
+#include <string>
+
+#include "Benchmark/benchmark_world.h"
+#include "Server/world_snapshot.h"
+#include "Server/world_state.h"
+#include "Server/world_state_file.h"
+
+namespace {
+
+    void BM_SaveWorldStateToString(benchmark::State& state) {
+        darwin::WorldState world_state;
+        darwin::FillBenchmarkWorld(world_state, state.range(0));
+        for (auto _ : state) {
+            std::string json;
+            darwin::SaveWorldStateToString(json, world_state);
+            benchmark::DoNotOptimize(json.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_SaveWorldStateToString)
+        ->RangeMultiplier(10)
+        ->Range(100, 1'000'000)
+        ->Unit(benchmark::kMillisecond);
+
+    void BM_LoadWorldStateFromString(benchmark::State& state) {
+        std::string json;
+        {
+            darwin::WorldState world_state;
+            darwin::FillBenchmarkWorld(world_state, state.range(0));
+            darwin::SaveWorldStateToString(json, world_state);
+        }
+        for (auto _ : state) {
+            darwin::WorldState world_state;
+            const auto start = std::chrono::steady_clock::now();
+            darwin::LoadWorldStateFromString(world_state, json);
+            state.SetIterationTime(
+                std::chrono::duration<double>(
+                    std::chrono::steady_clock::now() - start).count());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        state.SetBytesProcessed(state.iterations() * json.size());
+    }
+    BENCHMARK(BM_LoadWorldStateFromString)
+        ->RangeMultiplier(10)
+        ->Range(100, 1'000'000)
+        ->UseManualTime()
+        ->Unit(benchmark::kMillisecond);
+
+    // Same world as BM_LoadWorldStateFromString through a mapped snapshot.
+    void BM_LoadWorldStateFromSnapshot(benchmark::State& state) {
+        const auto filename =
+            std::filesystem::temp_directory_path() /
+            "darwin_benchmark_world.bin";
+        {
+            darwin::WorldState world_state;
+            darwin::FillBenchmarkWorld(world_state, state.range(0));
+            darwin::SaveWorldStateToSnapshot(world_state, filename);
+        }
+        for (auto _ : state) {
+            darwin::WorldState world_state;
+            const auto start = std::chrono::steady_clock::now();
+            darwin::LoadWorldStateFromSnapshot(world_state, filename);
+            state.SetIterationTime(
+                std::chrono::duration<double>(
+                    std::chrono::steady_clock::now() - start).count());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        state.SetBytesProcessed(
+            state.iterations() * std::filesystem::file_size(filename));
+        std::filesystem::remove(filename);
+    }
+    BENCHMARK(BM_LoadWorldStateFromSnapshot)
+        ->RangeMultiplier(10)
+        ->Range(100, 1'000'000)
+        ->UseManualTime()
+        ->Unit(benchmark::kMillisecond);
+
+}  // End anonymous namespace.
@@ -9,6 +9,7 @@
 #include "Common/client_parameter.pb.h"
 #include "Common/vector.h"
 #include "Common/convert_math.h"
+#include "Common/update_merge.h"
 #include "frame/file/file_system.h"
 
 namespace darwin {
@@ -105,6 +106,13 @@ namespace darwin {
         report_request_.set_potential_hit(potential_hit);
     }
 
+    void DarwinClient::AddInputCommand(const PlayerInput& player_input) {
+        std::scoped_lock l(mutex_);
+        auto* input_command = report_request_.add_input_commands();
+        input_command->set_sequence(++input_sequence_);
+        SetInputCommand(*input_command, player_input);
+    }
+
     void DarwinClient::SendReportInGame() {
         SendReportInGameSync();
     }
@@ -120,57 +128,83 @@ namespace darwin {
                 character.status_enum());
         report_request_.mutable_special_effect_boost()->CopyFrom(
             character.special_effect_boost());
-        proto::ReportInGameResponse response;
-        grpc::ClientContext context;
-        grpc::Status status = 
-            stub_->ReportInGame(&context, report_request_, &response);
-        if (!status.ok()) {
-            logger_->warn("ReportInGame failed: {}.", status.error_message());
+        if (play_stream_) {
+            proto::PlayRequest request;
+            request.set_sequence(++report_sequence_);
+            request.mutable_report()->CopyFrom(report_request_);
+            if (!play_stream_->Write(request)) {
+                logger_->warn("Play stream report failed.");
+            }
+        }
+        else {
+            proto::ReportInGameResponse response;
+            grpc::ClientContext context;
+            grpc::Status status = 
+                stub_->ReportInGame(&context, report_request_, &response);
+            if (!status.ok()) {
+                logger_->warn(
+                    "ReportInGame failed: {}.",
+                    status.error_message());
+            }
         }
         report_request_.set_potential_hit("");
+        report_request_.clear_input_commands();
     }
 
     void DarwinClient::Update() {
-        proto::UpdateRequest request;
-        request.set_name(name_);
+        proto::PlayRequest request;
+        request.mutable_update_request()->set_name(name_);
+        request.mutable_update_request()->set_delta(true);
+        request.mutable_update_request()->set_handles(true);
 
-        proto::UpdateResponse response;
+        proto::PlayResponse play_response;
         grpc::ClientContext context;
 
-        // The response stream.
-        std::unique_ptr<grpc::ClientReader<proto::UpdateResponse>> 
-            reader(stub_->Update(&context, request));
+        // Updates come down and reports go up on the same stream.
+        auto stream = stub_->Play(&context);
+        if (stream->Write(request)) {
+            std::scoped_lock l(mutex_);
+            play_stream_ = stream.get();
+        }
 
         // Read the stream of responses.
-        while (reader->Read(&response)) {
+        while (stream->Read(&play_response)) {
+            const proto::UpdateResponse& response = play_response.update();
             
             world_simulator_.SetUserName(character_name_);
 
+            // Rebuild the full state from the (delta) update.
+            MergeUpdateResponse(
+                response, 
+                server_names_,
+                server_elements_, 
+                server_characters_);
+            {
+                std::scoped_lock l(mutex_);
+                report_request_.set_acknowledged_sequence(
+                    response.sequence());
+            }
+
             std::vector<proto::Character> characters;
-            for (const auto& character : response.characters()) {
+            for (const auto& [name, character] : server_characters_) {
                 characters.push_back(MergeCharacter(character));
-                previous_characters_.insert({ character.name(), character });
+                previous_characters_.insert({ name, character });
+            }
+            std::vector<proto::Element> elements;
+            for (const auto& [_, element] : server_elements_) {
+                elements.push_back(element);
             }
 
             static std::size_t element_size = 0;
-            if (element_size != response.elements_size()) {
+            if (element_size != elements.size()) {
                 logger_->warn(
                     "Update response elements size: {}", 
-                    response.elements_size());
-                element_size = response.elements_size();
+                    elements.size());
+                element_size = elements.size();
             }
 
             // Update the elements and characters.
-            world_simulator_.UpdateData(
-                {
-                    response.elements().begin(),
-                    response.elements().end()
-                },
-                {
-                    characters.begin(),
-                    characters.end()
-                },
-                response.time());
+            world_simulator_.UpdateData(elements, characters, response.time());
             
             // Update the time.
             server_time_.store(response.time());
@@ -181,15 +215,23 @@ namespace darwin {
             // Check if the end is requested.
             if (end_.load()) {
                 logger_->warn("Force exiting...");
+                std::scoped_lock l(mutex_);
+                play_stream_ = nullptr;
+                context.TryCancel();
                 return;
             }
         }
 
         // Ensure you are at the end.
         end_.store(true);
+        {
+            std::scoped_lock l(mutex_);
+            play_stream_ = nullptr;
+        }
 
         // Finish the stream
-        grpc::Status status = reader->Finish();
+        stream->WritesDone();
+        grpc::Status status = stream->Finish();
         if (!status.ok()) {
             frame::Logger::GetInstance()->warn(
                 "Update stream failed: {}", 
@@ -6,6 +6,7 @@
 #include <string>
 #include <grpcpp/grpcpp.h>
 
+#include "Common/physic.h"
 #include "Common/world_simulator.h"
 #include "Common/darwin_constant.h"
 #include "Common/darwin_service.pb.h"
@@ -26,6 +27,8 @@ namespace darwin {
             const proto::Vector3& color);
         void RemovePreviousCharacter(const std::string& name);
         void ReportHit(const std::string& potential_hit);
+        // Inputs of a frame, sent with the next report.
+        void AddInputCommand(const PlayerInput& player_input);
         void SendReportInGame();
         void Update();
         std::int32_t Ping(std::int32_t val = 45323);
@@ -62,7 +65,16 @@ namespace darwin {
         mutable std::mutex mutex_;
         proto::ClientParameter client_parameter_;
         proto::ReportInGameRequest report_request_;
+        // Reports go on the Play stream when it is open (unary otherwise).
+        grpc::ClientReaderWriter<proto::PlayRequest, proto::PlayResponse>*
+            play_stream_ = nullptr;
+        std::uint64_t report_sequence_ = 0;
+        std::uint32_t input_sequence_ = 0;
         std::map<std::string, proto::Character> previous_characters_;
+        // Server state rebuilt from the (delta) updates, by handle.
+        std::map<std::uint32_t, std::string> server_names_;
+        std::map<std::string, proto::Element> server_elements_;
+        std::map<std::string, proto::Character> server_characters_;
         std::string name_;
         std::string character_name_;
         std::atomic<double> server_time_{ 0.0 };
@@ -9,6 +9,7 @@
 #include "state_victory.h"
 #include "overlay_play.h"
 #include "Common/convert_math.h"
+#include "Common/physic.h"
 #include "Common/vector.h"
 #include "overlay_state.h"
 
@@ -186,9 +187,11 @@ namespace darwin::state {
             proto::PlayerParameter player_parameter =
                 world_simulator_.GetPlayerParameter();
             audio_system_.PlaySound(proto::AUDIO_SOUND_JUMP);
-            physic.mutable_position_dt()->CopyFrom(
-                physic.position_dt() +
-                (character.normal() * player_parameter.vertical_speed()));
+            Glm2ProtoVector(
+                *physic.mutable_position_dt(),
+                ProtoVector2Glm(physic.position_dt()) +
+                ProtoVector2Glm(character.normal()) *
+                player_parameter.vertical_speed());
             character.set_status_enum(proto::STATUS_JUMPING);
             return true;
         }
@@ -203,35 +206,19 @@ namespace darwin::state {
         if (input_acquisition_ptr_->IsMoving()) {
             proto::PlayerParameter player_parameter =
                 world_simulator_.GetPlayerParameter();
-            // calculate the firction for the delta_time
-            double friction_delta_time =
-                player_parameter.friction() *
-                delta_time / std::log(physic.mass());
-            // calculate acceleration from friction and traget terminal 
-            // velocity.
-            double acceleration_delta_time =
-                friction_delta_time *
-                player_parameter.horizontal_speed() *
-                player_parameter.horizontal_speed();
-            // we need to current speed to get the quadratic friction
-            double current_speed = Length(physic.position_dt());
-            // we apply the friction even if we acceletare (accelaration 
-            // doesnt make friction disapear) also we wont end in orbit 
-            // this way.
-            auto friction_vector =
-                Normalize(physic.position_dt()) *
-                friction_delta_time * current_speed * current_speed;
-            auto forward = Normalize(Glm2ProtoVector(character_forward_));
-            auto right =
-                Normalize(Cross(character.normal(), forward));
-            auto direction =
-                Normalize(
-                    right * input_acquisition_ptr_->GetHorizontal() +
-                    forward * input_acquisition_ptr_->GetVertical());
-            // lets apply acceleration and friction
-            physic.mutable_position_dt()->CopyFrom(
-                physic.position_dt() +
-                direction * acceleration_delta_time - friction_vector);
+            auto direction = GetInputDirection(
+                ProtoVector2Glm(character.normal()),
+                glm::dvec3(character_forward_),
+                input_acquisition_ptr_->GetHorizontal(),
+                input_acquisition_ptr_->GetVertical());
+            Glm2ProtoVector(
+                *physic.mutable_position_dt(),
+                ApplyMove(
+                    ProtoVector2Glm(physic.position_dt()),
+                    direction,
+                    physic.mass(),
+                    player_parameter,
+                    delta_time));
             return true;
         }
         return false;
@@ -245,18 +232,15 @@ namespace darwin::state {
             proto::PlayerParameter player_parameter =
                 world_simulator_.GetPlayerParameter();
             logger_->warn(std::format("Boosting!"));
-            auto forward = Normalize(Glm2ProtoVector(character_forward_));
-            auto right =
-                Normalize(Cross(character.normal(), forward));
-            auto input_direction =
-                Normalize(
-                    right * input_acquisition_ptr_->GetHorizontal() +
-                    forward * input_acquisition_ptr_->GetVertical());
-            auto move_direction = Normalize(physic.position_dt());
             auto direction = input_acquisition_ptr_->IsMoving() ?
-                               input_direction :
-                               move_direction;
-            physic.mutable_position_dt()->CopyFrom(
+                GetInputDirection(
+                    ProtoVector2Glm(character.normal()),
+                    glm::dvec3(character_forward_),
+                    input_acquisition_ptr_->GetHorizontal(),
+                    input_acquisition_ptr_->GetVertical()) :
+                glm::normalize(ProtoVector2Glm(physic.position_dt()));
+            Glm2ProtoVector(
+                *physic.mutable_position_dt(),
                 direction * player_parameter.boost_speed());
             character.mutable_special_effect_boost()
                 ->set_special_state_enum(proto::SPECIAL_STATE_ACTIVE);
@@ -272,6 +256,26 @@ namespace darwin::state {
         double now = GetTimeSecondNow();
         double delta_time = now - previous_time;
         previous_time = now;
+        // The server simulates the character from these inputs, a long
+        // frame is split so that none of it is clamped.
+        PlayerInput player_input;
+        if (input_acquisition_ptr_->IsMoving()) {
+            player_input.direction = GetInputDirection(
+                ProtoVector2Glm(character.normal()),
+                glm::dvec3(character_forward_),
+                input_acquisition_ptr_->GetHorizontal(),
+                input_acquisition_ptr_->GetVertical());
+        }
+        player_input.jump = input_acquisition_ptr_->IsJumping();
+        player_input.boost = input_acquisition_ptr_->IsMouseLeft();
+        for (double remaining_time = delta_time; remaining_time > 0.0;) {
+            player_input.duration =
+                std::min(remaining_time, MAX_INPUT_DURATION);
+            remaining_time -= player_input.duration;
+            darwin_client_->AddInputCommand(player_input);
+            player_input.jump = false;
+            player_input.boost = false;
+        }
         if (character.status_enum() == proto::STATUS_ON_GROUND) {
             proto::Physic physic = character.physic();
             const auto planet_physic = world_simulator_.GetPlanet();
@@ -295,15 +299,17 @@ namespace darwin::state {
                 auto next_character = world_simulator_.GetCharacterByName(
                     character.name());
                 auto next_physic = next_character.physic();
-                double current_speed = Length(next_physic.position_dt());
+                auto position_dt = ProtoVector2Glm(next_physic.position_dt());
+                double current_speed = glm::length(position_dt);
                 double friction_delta_time = 
                     player_parameter.friction() * delta_time;
                 // Lets make firction stronger with speed (so we wont end up 
                 // in orbit).
                 double speed_multiply = 
                     1.0 - friction_delta_time * current_speed * current_speed;
-                next_physic.mutable_position_dt()->CopyFrom(
-                    next_physic.position_dt() * speed_multiply);
+                Glm2ProtoVector(
+                    *next_physic.mutable_position_dt(),
+                    position_dt * speed_multiply);
                 next_character.mutable_physic()->CopyFrom(next_physic);
                 world_simulator_.SetCharacter(next_character);
             }
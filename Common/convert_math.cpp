@@ -34,6 +34,12 @@ namespace darwin {
         return result;
     }
 
+    void Glm2ProtoVector(proto::Vector3& result, const glm::dvec3& vector3) {
+        result.set_x(vector3.x);
+        result.set_y(vector3.y);
+        result.set_z(vector3.z);
+    }
+
     proto::Vector4 Glm2ProtoVector(const glm::dquat& vector4) {
         proto::Vector4 result;
         result.set_w(vector4.w);
@@ -75,6 +81,17 @@ namespace darwin {
         return dot > ALMOST_INTERSECT;
     }
 
+    bool IsAlmostIntersecting(
+        const glm::dvec3& character_position,
+        const glm::dvec3& element_position)
+    {
+        auto dot =
+            glm::dot(
+                glm::normalize(character_position),
+                glm::normalize(element_position));
+        return dot > ALMOST_INTERSECT;
+    }
+
     double GetTimeSecondNow() {
         return std::chrono::duration_cast<std::chrono::duration<double>>(
             std::chrono::system_clock::now().time_since_epoch()).count();
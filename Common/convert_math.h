@@ -11,6 +11,8 @@ namespace darwin {
     glm::dquat ProtoVector2Glm(const proto::Vector4& vector4);
     proto::Vector3 Glm2ProtoVector(const glm::dvec3& vector3);
     proto::Vector4 Glm2ProtoVector(const glm::dquat& vector4);
+    // Same in place, without a temporary proto.
+    void Glm2ProtoVector(proto::Vector3& result, const glm::dvec3& vector3);
     glm::vec3 RandomVec3();
     double GetRadiusFromVolume(double volume);
     // Check for exact intersections.
@@ -21,6 +23,9 @@ namespace darwin {
     bool IsAlmostIntersecting(
         const proto::Physic& character,
         const proto::Physic& element);
+    bool IsAlmostIntersecting(
+        const glm::dvec3& character_position,
+        const glm::dvec3& element_position);
     double GetTimeSecondNow();
 
 } // namespace darwin
@@ -8,5 +8,13 @@ namespace darwin {
     constexpr double GRAVITATIONAL_CONSTANT = 6.67430e-11;
     constexpr double PI = 3.14159265358979323846;
     constexpr double ALMOST_INTERSECT = 0.99;
+    // acos(ALMOST_INTERSECT) the angle under which two positions are almost
+    // intersecting.
+    constexpr double ALMOST_INTERSECT_ANGLE = 0.1415394733244273;
+    // Longest frame (in seconds) of an input command.
+    constexpr double MAX_INPUT_DURATION = 0.1;
+    // How far (in seconds) the inputs of a player can lag behind the
+    // server, older frames are dropped.
+    constexpr double MAX_INPUT_LAG = 0.25;
 
 } // namespace darwin.
@@ -70,6 +70,17 @@ class DarwinService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::proto::PingResponse>> PrepareAsyncPing(::grpc::ClientContext* context, const ::proto::PingRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::proto::PingResponse>>(PrepareAsyncPingRaw(context, request, cq));
     }
+    // Reports upstream and updates downstream on one stream, replace the
+    // Update stream plus the ReportInGame calls.
+    std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::proto::PlayRequest, ::proto::PlayResponse>> Play(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::proto::PlayRequest, ::proto::PlayResponse>>(PlayRaw(context));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::proto::PlayRequest, ::proto::PlayResponse>> AsyncPlay(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::proto::PlayRequest, ::proto::PlayResponse>>(AsyncPlayRaw(context, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::proto::PlayRequest, ::proto::PlayResponse>> PrepareAsyncPlay(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::proto::PlayRequest, ::proto::PlayResponse>>(PrepareAsyncPlayRaw(context, cq));
+    }
     class async_interface {
      public:
       virtual ~async_interface() {}
@@ -84,6 +95,9 @@ class DarwinService final {
       // Ping the server.
       virtual void Ping(::grpc::ClientContext* context, const ::proto::PingRequest* request, ::proto::PingResponse* response, std::function<void(::grpc::Status)>) = 0;
       virtual void Ping(::grpc::ClientContext* context, const ::proto::PingRequest* request, ::proto::PingResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // Reports upstream and updates downstream on one stream, replace the
+      // Update stream plus the ReportInGame calls.
+      virtual void Play(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::proto::PlayRequest,::proto::PlayResponse>* reactor) = 0;
     };
     typedef class async_interface experimental_async_interface;
     virtual class async_interface* async() { return nullptr; }
@@ -98,6 +112,9 @@ class DarwinService final {
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::proto::CreateCharacterResponse>* PrepareAsyncCreateCharacterRaw(::grpc::ClientContext* context, const ::proto::CreateCharacterRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::proto::PingResponse>* AsyncPingRaw(::grpc::ClientContext* context, const ::proto::PingRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::proto::PingResponse>* PrepareAsyncPingRaw(::grpc::ClientContext* context, const ::proto::PingRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderWriterInterface< ::proto::PlayRequest, ::proto::PlayResponse>* PlayRaw(::grpc::ClientContext* context) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::proto::PlayRequest, ::proto::PlayResponse>* AsyncPlayRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::proto::PlayRequest, ::proto::PlayResponse>* PrepareAsyncPlayRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
@@ -132,6 +149,15 @@ class DarwinService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::proto::PingResponse>> PrepareAsyncPing(::grpc::ClientContext* context, const ::proto::PingRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::proto::PingResponse>>(PrepareAsyncPingRaw(context, request, cq));
     }
+    std::unique_ptr< ::grpc::ClientReaderWriter< ::proto::PlayRequest, ::proto::PlayResponse>> Play(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriter< ::proto::PlayRequest, ::proto::PlayResponse>>(PlayRaw(context));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::proto::PlayRequest, ::proto::PlayResponse>> AsyncPlay(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::proto::PlayRequest, ::proto::PlayResponse>>(AsyncPlayRaw(context, cq, tag));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::proto::PlayRequest, ::proto::PlayResponse>> PrepareAsyncPlay(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::proto::PlayRequest, ::proto::PlayResponse>>(PrepareAsyncPlayRaw(context, cq));
+    }
     class async final :
       public StubInterface::async_interface {
      public:
@@ -142,6 +168,7 @@ class DarwinService final {
       void CreateCharacter(::grpc::ClientContext* context, const ::proto::CreateCharacterRequest* request, ::proto::CreateCharacterResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
       void Ping(::grpc::ClientContext* context, const ::proto::PingRequest* request, ::proto::PingResponse* response, std::function<void(::grpc::Status)>) override;
       void Ping(::grpc::ClientContext* context, const ::proto::PingRequest* request, ::proto::PingResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void Play(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::proto::PlayRequest,::proto::PlayResponse>* reactor) override;
      private:
       friend class Stub;
       explicit async(Stub* stub): stub_(stub) { }
@@ -162,10 +189,14 @@ class DarwinService final {
     ::grpc::ClientAsyncResponseReader< ::proto::CreateCharacterResponse>* PrepareAsyncCreateCharacterRaw(::grpc::ClientContext* context, const ::proto::CreateCharacterRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::proto::PingResponse>* AsyncPingRaw(::grpc::ClientContext* context, const ::proto::PingRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::proto::PingResponse>* PrepareAsyncPingRaw(::grpc::ClientContext* context, const ::proto::PingRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReaderWriter< ::proto::PlayRequest, ::proto::PlayResponse>* PlayRaw(::grpc::ClientContext* context) override;
+    ::grpc::ClientAsyncReaderWriter< ::proto::PlayRequest, ::proto::PlayResponse>* AsyncPlayRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReaderWriter< ::proto::PlayRequest, ::proto::PlayResponse>* PrepareAsyncPlayRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_Update_;
     const ::grpc::internal::RpcMethod rpcmethod_ReportInGame_;
     const ::grpc::internal::RpcMethod rpcmethod_CreateCharacter_;
     const ::grpc::internal::RpcMethod rpcmethod_Ping_;
+    const ::grpc::internal::RpcMethod rpcmethod_Play_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -181,6 +212,9 @@ class DarwinService final {
     virtual ::grpc::Status CreateCharacter(::grpc::ServerContext* context, const ::proto::CreateCharacterRequest* request, ::proto::CreateCharacterResponse* response);
     // Ping the server.
     virtual ::grpc::Status Ping(::grpc::ServerContext* context, const ::proto::PingRequest* request, ::proto::PingResponse* response);
+    // Reports upstream and updates downstream on one stream, replace the
+    // Update stream plus the ReportInGame calls.
+    virtual ::grpc::Status Play(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::proto::PlayResponse, ::proto::PlayRequest>* stream);
   };
   template <class BaseClass>
   class WithAsyncMethod_Update : public BaseClass {
@@ -262,7 +296,27 @@ class DarwinService final {
       ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_Update<WithAsyncMethod_ReportInGame<WithAsyncMethod_CreateCharacter<WithAsyncMethod_Ping<Service > > > > AsyncService;
+  template <class BaseClass>
+  class WithAsyncMethod_Play : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_Play() {
+      ::grpc::Service::MarkMethodAsync(4);
+    }
+    ~WithAsyncMethod_Play() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Play(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::proto::PlayResponse, ::proto::PlayRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestPlay(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::proto::PlayResponse, ::proto::PlayRequest>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(4, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_Update<WithAsyncMethod_ReportInGame<WithAsyncMethod_CreateCharacter<WithAsyncMethod_Ping<WithAsyncMethod_Play<Service > > > > > AsyncService;
   template <class BaseClass>
   class WithCallbackMethod_Update : public BaseClass {
    private:
@@ -366,7 +420,30 @@ class DarwinService final {
     virtual ::grpc::ServerUnaryReactor* Ping(
       ::grpc::CallbackServerContext* /*context*/, const ::proto::PingRequest* /*request*/, ::proto::PingResponse* /*response*/)  { return nullptr; }
   };
-  typedef WithCallbackMethod_Update<WithCallbackMethod_ReportInGame<WithCallbackMethod_CreateCharacter<WithCallbackMethod_Ping<Service > > > > CallbackService;
+  template <class BaseClass>
+  class WithCallbackMethod_Play : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_Play() {
+      ::grpc::Service::MarkMethodCallback(4,
+          new ::grpc::internal::CallbackBidiHandler< ::proto::PlayRequest, ::proto::PlayResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->Play(context); }));
+    }
+    ~WithCallbackMethod_Play() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Play(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::proto::PlayResponse, ::proto::PlayRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::proto::PlayRequest, ::proto::PlayResponse>* Play(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  typedef WithCallbackMethod_Update<WithCallbackMethod_ReportInGame<WithCallbackMethod_CreateCharacter<WithCallbackMethod_Ping<WithCallbackMethod_Play<Service > > > > > CallbackService;
   typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_Update : public BaseClass {
@@ -437,6 +514,23 @@ class DarwinService final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_Play : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_Play() {
+      ::grpc::Service::MarkMethodGeneric(4);
+    }
+    ~WithGenericMethod_Play() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Play(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::proto::PlayResponse, ::proto::PlayRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_Update : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -517,6 +611,26 @@ class DarwinService final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_Play : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_Play() {
+      ::grpc::Service::MarkMethodRaw(4);
+    }
+    ~WithRawMethod_Play() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Play(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::proto::PlayResponse, ::proto::PlayRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestPlay(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(4, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithRawCallbackMethod_Update : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -605,6 +719,29 @@ class DarwinService final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_Play : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_Play() {
+      ::grpc::Service::MarkMethodRawCallback(4,
+          new ::grpc::internal::CallbackBidiHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->Play(context); }));
+    }
+    ~WithRawCallbackMethod_Play() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Play(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::proto::PlayResponse, ::proto::PlayRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* Play(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_ReportInGame : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -717,6 +854,217 @@ class DarwinService final {
   typedef WithSplitStreamingMethod_Update<WithStreamedUnaryMethod_ReportInGame<WithStreamedUnaryMethod_CreateCharacter<WithStreamedUnaryMethod_Ping<Service > > > > StreamedService;
 };
 
+// Between the servers of the regions of one world.
+class DarwinRegionService final {
+ public:
+  static constexpr char const* service_full_name() {
+    return "proto.DarwinRegionService";
+  }
+  class StubInterface {
+   public:
+    virtual ~StubInterface() {}
+    // Hand off the characters and mirror the border entities.
+    virtual ::grpc::Status Exchange(::grpc::ClientContext* context, const ::proto::RegionExchangeRequest& request, ::proto::RegionExchangeResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::proto::RegionExchangeResponse>> AsyncExchange(::grpc::ClientContext* context, const ::proto::RegionExchangeRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::proto::RegionExchangeResponse>>(AsyncExchangeRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::proto::RegionExchangeResponse>> PrepareAsyncExchange(::grpc::ClientContext* context, const ::proto::RegionExchangeRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::proto::RegionExchangeResponse>>(PrepareAsyncExchangeRaw(context, request, cq));
+    }
+    class async_interface {
+     public:
+      virtual ~async_interface() {}
+      // Hand off the characters and mirror the border entities.
+      virtual void Exchange(::grpc::ClientContext* context, const ::proto::RegionExchangeRequest* request, ::proto::RegionExchangeResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void Exchange(::grpc::ClientContext* context, const ::proto::RegionExchangeRequest* request, ::proto::RegionExchangeResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+    };
+    typedef class async_interface experimental_async_interface;
+    virtual class async_interface* async() { return nullptr; }
+    class async_interface* experimental_async() { return async(); }
+   private:
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::proto::RegionExchangeResponse>* AsyncExchangeRaw(::grpc::ClientContext* context, const ::proto::RegionExchangeRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::proto::RegionExchangeResponse>* PrepareAsyncExchangeRaw(::grpc::ClientContext* context, const ::proto::RegionExchangeRequest& request, ::grpc::CompletionQueue* cq) = 0;
+  };
+  class Stub final : public StubInterface {
+   public:
+    Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
+    ::grpc::Status Exchange(::grpc::ClientContext* context, const ::proto::RegionExchangeRequest& request, ::proto::RegionExchangeResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::proto::RegionExchangeResponse>> AsyncExchange(::grpc::ClientContext* context, const ::proto::RegionExchangeRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::proto::RegionExchangeResponse>>(AsyncExchangeRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::proto::RegionExchangeResponse>> PrepareAsyncExchange(::grpc::ClientContext* context, const ::proto::RegionExchangeRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::proto::RegionExchangeResponse>>(PrepareAsyncExchangeRaw(context, request, cq));
+    }
+    class async final :
+      public StubInterface::async_interface {
+     public:
+      void Exchange(::grpc::ClientContext* context, const ::proto::RegionExchangeRequest* request, ::proto::RegionExchangeResponse* response, std::function<void(::grpc::Status)>) override;
+      void Exchange(::grpc::ClientContext* context, const ::proto::RegionExchangeRequest* request, ::proto::RegionExchangeResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+     private:
+      friend class Stub;
+      explicit async(Stub* stub): stub_(stub) { }
+      Stub* stub() { return stub_; }
+      Stub* stub_;
+    };
+    class async* async() override { return &async_stub_; }
+
+   private:
+    std::shared_ptr< ::grpc::ChannelInterface> channel_;
+    class async async_stub_{this};
+    ::grpc::ClientAsyncResponseReader< ::proto::RegionExchangeResponse>* AsyncExchangeRaw(::grpc::ClientContext* context, const ::proto::RegionExchangeRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::proto::RegionExchangeResponse>* PrepareAsyncExchangeRaw(::grpc::ClientContext* context, const ::proto::RegionExchangeRequest& request, ::grpc::CompletionQueue* cq) override;
+    const ::grpc::internal::RpcMethod rpcmethod_Exchange_;
+  };
+  static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
+
+  class Service : public ::grpc::Service {
+   public:
+    Service();
+    virtual ~Service();
+    // Hand off the characters and mirror the border entities.
+    virtual ::grpc::Status Exchange(::grpc::ServerContext* context, const ::proto::RegionExchangeRequest* request, ::proto::RegionExchangeResponse* response);
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_Exchange : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_Exchange() {
+      ::grpc::Service::MarkMethodAsync(0);
+    }
+    ~WithAsyncMethod_Exchange() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Exchange(::grpc::ServerContext* /*context*/, const ::proto::RegionExchangeRequest* /*request*/, ::proto::RegionExchangeResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestExchange(::grpc::ServerContext* context, ::proto::RegionExchangeRequest* request, ::grpc::ServerAsyncResponseWriter< ::proto::RegionExchangeResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_Exchange<Service > AsyncService;
+  template <class BaseClass>
+  class WithCallbackMethod_Exchange : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_Exchange() {
+      ::grpc::Service::MarkMethodCallback(0,
+          new ::grpc::internal::CallbackUnaryHandler< ::proto::RegionExchangeRequest, ::proto::RegionExchangeResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::proto::RegionExchangeRequest* request, ::proto::RegionExchangeResponse* response) { return this->Exchange(context, request, response); }));}
+    void SetMessageAllocatorFor_Exchange(
+        ::grpc::MessageAllocator< ::proto::RegionExchangeRequest, ::proto::RegionExchangeResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(0);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::proto::RegionExchangeRequest, ::proto::RegionExchangeResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_Exchange() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Exchange(::grpc::ServerContext* /*context*/, const ::proto::RegionExchangeRequest* /*request*/, ::proto::RegionExchangeResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* Exchange(
+      ::grpc::CallbackServerContext* /*context*/, const ::proto::RegionExchangeRequest* /*request*/, ::proto::RegionExchangeResponse* /*response*/)  { return nullptr; }
+  };
+  typedef WithCallbackMethod_Exchange<Service > CallbackService;
+  typedef CallbackService ExperimentalCallbackService;
+  template <class BaseClass>
+  class WithGenericMethod_Exchange : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_Exchange() {
+      ::grpc::Service::MarkMethodGeneric(0);
+    }
+    ~WithGenericMethod_Exchange() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Exchange(::grpc::ServerContext* /*context*/, const ::proto::RegionExchangeRequest* /*request*/, ::proto::RegionExchangeResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_Exchange : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_Exchange() {
+      ::grpc::Service::MarkMethodRaw(0);
+    }
+    ~WithRawMethod_Exchange() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Exchange(::grpc::ServerContext* /*context*/, const ::proto::RegionExchangeRequest* /*request*/, ::proto::RegionExchangeResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestExchange(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_Exchange : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_Exchange() {
+      ::grpc::Service::MarkMethodRawCallback(0,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->Exchange(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_Exchange() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Exchange(::grpc::ServerContext* /*context*/, const ::proto::RegionExchangeRequest* /*request*/, ::proto::RegionExchangeResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* Exchange(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_Exchange : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_Exchange() {
+      ::grpc::Service::MarkMethodStreamed(0,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::proto::RegionExchangeRequest, ::proto::RegionExchangeResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::proto::RegionExchangeRequest, ::proto::RegionExchangeResponse>* streamer) {
+                       return this->StreamedExchange(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_Exchange() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status Exchange(::grpc::ServerContext* /*context*/, const ::proto::RegionExchangeRequest* /*request*/, ::proto::RegionExchangeResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedExchange(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::proto::RegionExchangeRequest,::proto::RegionExchangeResponse>* server_unary_streamer) = 0;
+  };
+  typedef WithStreamedUnaryMethod_Exchange<Service > StreamedUnaryService;
+  typedef Service SplitStreamedService;
+  typedef WithStreamedUnaryMethod_Exchange<Service > StreamedService;
+};
+
 }  // namespace proto
 
 
@@ -30,6 +30,7 @@
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 #include "vector_math.pb.h"
 #include "world_parameter.pb.h"
@@ -54,18 +55,45 @@ extern CreateCharacterRequestDefaultTypeInternal _CreateCharacterRequest_default
 class CreateCharacterResponse;
 struct CreateCharacterResponseDefaultTypeInternal;
 extern CreateCharacterResponseDefaultTypeInternal _CreateCharacterResponse_default_instance_;
+class Handoff;
+struct HandoffDefaultTypeInternal;
+extern HandoffDefaultTypeInternal _Handoff_default_instance_;
+class InputCommand;
+struct InputCommandDefaultTypeInternal;
+extern InputCommandDefaultTypeInternal _InputCommand_default_instance_;
 class PingRequest;
 struct PingRequestDefaultTypeInternal;
 extern PingRequestDefaultTypeInternal _PingRequest_default_instance_;
 class PingResponse;
 struct PingResponseDefaultTypeInternal;
 extern PingResponseDefaultTypeInternal _PingResponse_default_instance_;
+class PlayRequest;
+struct PlayRequestDefaultTypeInternal;
+extern PlayRequestDefaultTypeInternal _PlayRequest_default_instance_;
+class PlayResponse;
+struct PlayResponseDefaultTypeInternal;
+extern PlayResponseDefaultTypeInternal _PlayResponse_default_instance_;
+class RecordedEvent;
+struct RecordedEventDefaultTypeInternal;
+extern RecordedEventDefaultTypeInternal _RecordedEvent_default_instance_;
+class RecordingHeader;
+struct RecordingHeaderDefaultTypeInternal;
+extern RecordingHeaderDefaultTypeInternal _RecordingHeader_default_instance_;
+class RegionExchangeRequest;
+struct RegionExchangeRequestDefaultTypeInternal;
+extern RegionExchangeRequestDefaultTypeInternal _RegionExchangeRequest_default_instance_;
+class RegionExchangeResponse;
+struct RegionExchangeResponseDefaultTypeInternal;
+extern RegionExchangeResponseDefaultTypeInternal _RegionExchangeResponse_default_instance_;
 class ReportInGameRequest;
 struct ReportInGameRequestDefaultTypeInternal;
 extern ReportInGameRequestDefaultTypeInternal _ReportInGameRequest_default_instance_;
 class ReportInGameResponse;
 struct ReportInGameResponseDefaultTypeInternal;
 extern ReportInGameResponseDefaultTypeInternal _ReportInGameResponse_default_instance_;
+class TickStatistics;
+struct TickStatisticsDefaultTypeInternal;
+extern TickStatisticsDefaultTypeInternal _TickStatistics_default_instance_;
 class UpdateRequest;
 struct UpdateRequestDefaultTypeInternal;
 extern UpdateRequestDefaultTypeInternal _UpdateRequest_default_instance_;
@@ -76,15 +104,79 @@ extern UpdateResponseDefaultTypeInternal _UpdateResponse_default_instance_;
 PROTOBUF_NAMESPACE_OPEN
 template<> ::proto::CreateCharacterRequest* Arena::CreateMaybeMessage<::proto::CreateCharacterRequest>(Arena*);
 template<> ::proto::CreateCharacterResponse* Arena::CreateMaybeMessage<::proto::CreateCharacterResponse>(Arena*);
+template<> ::proto::Handoff* Arena::CreateMaybeMessage<::proto::Handoff>(Arena*);
+template<> ::proto::InputCommand* Arena::CreateMaybeMessage<::proto::InputCommand>(Arena*);
 template<> ::proto::PingRequest* Arena::CreateMaybeMessage<::proto::PingRequest>(Arena*);
 template<> ::proto::PingResponse* Arena::CreateMaybeMessage<::proto::PingResponse>(Arena*);
+template<> ::proto::PlayRequest* Arena::CreateMaybeMessage<::proto::PlayRequest>(Arena*);
+template<> ::proto::PlayResponse* Arena::CreateMaybeMessage<::proto::PlayResponse>(Arena*);
+template<> ::proto::RecordedEvent* Arena::CreateMaybeMessage<::proto::RecordedEvent>(Arena*);
+template<> ::proto::RecordingHeader* Arena::CreateMaybeMessage<::proto::RecordingHeader>(Arena*);
+template<> ::proto::RegionExchangeRequest* Arena::CreateMaybeMessage<::proto::RegionExchangeRequest>(Arena*);
+template<> ::proto::RegionExchangeResponse* Arena::CreateMaybeMessage<::proto::RegionExchangeResponse>(Arena*);
 template<> ::proto::ReportInGameRequest* Arena::CreateMaybeMessage<::proto::ReportInGameRequest>(Arena*);
 template<> ::proto::ReportInGameResponse* Arena::CreateMaybeMessage<::proto::ReportInGameResponse>(Arena*);
+template<> ::proto::TickStatistics* Arena::CreateMaybeMessage<::proto::TickStatistics>(Arena*);
 template<> ::proto::UpdateRequest* Arena::CreateMaybeMessage<::proto::UpdateRequest>(Arena*);
 template<> ::proto::UpdateResponse* Arena::CreateMaybeMessage<::proto::UpdateResponse>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace proto {
 
+enum InputFlagEnum : int {
+  INPUT_FLAG_NONE = 0,
+  INPUT_FLAG_JUMP = 1,
+  INPUT_FLAG_BOOST = 2,
+  InputFlagEnum_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  InputFlagEnum_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool InputFlagEnum_IsValid(int value);
+constexpr InputFlagEnum InputFlagEnum_MIN = INPUT_FLAG_NONE;
+constexpr InputFlagEnum InputFlagEnum_MAX = INPUT_FLAG_BOOST;
+constexpr int InputFlagEnum_ARRAYSIZE = InputFlagEnum_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* InputFlagEnum_descriptor();
+template<typename T>
+inline const std::string& InputFlagEnum_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, InputFlagEnum>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function InputFlagEnum_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    InputFlagEnum_descriptor(), enum_t_value);
+}
+inline bool InputFlagEnum_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, InputFlagEnum* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<InputFlagEnum>(
+    InputFlagEnum_descriptor(), name, value);
+}
+enum RecordedEventEnum : int {
+  RECORDED_EVENT_UNKNOWN = 0,
+  RECORDED_EVENT_CREATE_CHARACTER = 1,
+  RECORDED_EVENT_REPORT_IN_GAME = 2,
+  RECORDED_EVENT_PLAY_REPORT = 3,
+  RECORDED_EVENT_DISCONNECT = 4,
+  RECORDED_EVENT_STEP = 5,
+  RecordedEventEnum_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  RecordedEventEnum_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool RecordedEventEnum_IsValid(int value);
+constexpr RecordedEventEnum RecordedEventEnum_MIN = RECORDED_EVENT_UNKNOWN;
+constexpr RecordedEventEnum RecordedEventEnum_MAX = RECORDED_EVENT_STEP;
+constexpr int RecordedEventEnum_ARRAYSIZE = RecordedEventEnum_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RecordedEventEnum_descriptor();
+template<typename T>
+inline const std::string& RecordedEventEnum_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, RecordedEventEnum>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function RecordedEventEnum_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    RecordedEventEnum_descriptor(), enum_t_value);
+}
+inline bool RecordedEventEnum_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, RecordedEventEnum* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<RecordedEventEnum>(
+    RecordedEventEnum_descriptor(), name, value);
+}
 // ===================================================================
 
 class UpdateRequest final :
@@ -209,6 +301,8 @@ class UpdateRequest final :
 
   enum : int {
     kNameFieldNumber = 1,
+    kDeltaFieldNumber = 2,
+    kHandlesFieldNumber = 3,
   };
   // string name = 1;
   void clear_name();
@@ -224,6 +318,24 @@ class UpdateRequest final :
   std::string* _internal_mutable_name();
   public:
 
+  // bool delta = 2;
+  void clear_delta();
+  bool delta() const;
+  void set_delta(bool value);
+  private:
+  bool _internal_delta() const;
+  void _internal_set_delta(bool value);
+  public:
+
+  // bool handles = 3;
+  void clear_handles();
+  bool handles() const;
+  void set_handles(bool value);
+  private:
+  bool _internal_handles() const;
+  void _internal_set_handles(bool value);
+  public:
+
   // @@protoc_insertion_point(class_scope:proto.UpdateRequest)
  private:
   class _Internal;
@@ -233,6 +345,177 @@ class UpdateRequest final :
   typedef void DestructorSkippable_;
   struct Impl_ {
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    bool delta_;
+    bool handles_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_darwin_5fservice_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Handoff final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.Handoff) */ {
+ public:
+  inline Handoff() : Handoff(nullptr) {}
+  ~Handoff() override;
+  explicit PROTOBUF_CONSTEXPR Handoff(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Handoff(const Handoff& from);
+  Handoff(Handoff&& from) noexcept
+    : Handoff() {
+    *this = ::std::move(from);
+  }
+
+  inline Handoff& operator=(const Handoff& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Handoff& operator=(Handoff&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Handoff& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Handoff* internal_default_instance() {
+    return reinterpret_cast<const Handoff*>(
+               &_Handoff_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Handoff& a, Handoff& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Handoff* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Handoff* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Handoff* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Handoff>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Handoff& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Handoff& from) {
+    Handoff::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Handoff* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto.Handoff";
+  }
+  protected:
+  explicit Handoff(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kServerNameFieldNumber = 2,
+  };
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // string server_name = 2;
+  void clear_server_name();
+  const std::string& server_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_server_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_server_name();
+  PROTOBUF_NODISCARD std::string* release_server_name();
+  void set_allocated_server_name(std::string* server_name);
+  private:
+  const std::string& _internal_server_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_server_name(const std::string& value);
+  std::string* _internal_mutable_server_name();
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto.Handoff)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr server_name_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -288,7 +571,7 @@ class UpdateResponse final :
                &_UpdateResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    1;
+    2;
 
   friend void swap(UpdateResponse& a, UpdateResponse& b) {
     a.Swap(&b);
@@ -363,7 +646,14 @@ class UpdateResponse final :
   enum : int {
     kCharactersFieldNumber = 1,
     kElementsFieldNumber = 2,
+    kRemovedCharactersFieldNumber = 6,
+    kRemovedElementsFieldNumber = 7,
+    kHandoffsFieldNumber = 8,
+    kRemovedCharacterHandlesFieldNumber = 9,
+    kRemovedElementHandlesFieldNumber = 10,
     kTimeFieldNumber = 3,
+    kSequenceFieldNumber = 4,
+    kBaselineSequenceFieldNumber = 5,
   };
   // repeated .proto.Character characters = 1;
   int characters_size() const;
@@ -401,6 +691,116 @@ class UpdateResponse final :
   const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Element >&
       elements() const;
 
+  // repeated string removed_characters = 6;
+  int removed_characters_size() const;
+  private:
+  int _internal_removed_characters_size() const;
+  public:
+  void clear_removed_characters();
+  const std::string& removed_characters(int index) const;
+  std::string* mutable_removed_characters(int index);
+  void set_removed_characters(int index, const std::string& value);
+  void set_removed_characters(int index, std::string&& value);
+  void set_removed_characters(int index, const char* value);
+  void set_removed_characters(int index, const char* value, size_t size);
+  std::string* add_removed_characters();
+  void add_removed_characters(const std::string& value);
+  void add_removed_characters(std::string&& value);
+  void add_removed_characters(const char* value);
+  void add_removed_characters(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& removed_characters() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_removed_characters();
+  private:
+  const std::string& _internal_removed_characters(int index) const;
+  std::string* _internal_add_removed_characters();
+  public:
+
+  // repeated string removed_elements = 7;
+  int removed_elements_size() const;
+  private:
+  int _internal_removed_elements_size() const;
+  public:
+  void clear_removed_elements();
+  const std::string& removed_elements(int index) const;
+  std::string* mutable_removed_elements(int index);
+  void set_removed_elements(int index, const std::string& value);
+  void set_removed_elements(int index, std::string&& value);
+  void set_removed_elements(int index, const char* value);
+  void set_removed_elements(int index, const char* value, size_t size);
+  std::string* add_removed_elements();
+  void add_removed_elements(const std::string& value);
+  void add_removed_elements(std::string&& value);
+  void add_removed_elements(const char* value);
+  void add_removed_elements(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& removed_elements() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_removed_elements();
+  private:
+  const std::string& _internal_removed_elements(int index) const;
+  std::string* _internal_add_removed_elements();
+  public:
+
+  // repeated .proto.Handoff handoffs = 8;
+  int handoffs_size() const;
+  private:
+  int _internal_handoffs_size() const;
+  public:
+  void clear_handoffs();
+  ::proto::Handoff* mutable_handoffs(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Handoff >*
+      mutable_handoffs();
+  private:
+  const ::proto::Handoff& _internal_handoffs(int index) const;
+  ::proto::Handoff* _internal_add_handoffs();
+  public:
+  const ::proto::Handoff& handoffs(int index) const;
+  ::proto::Handoff* add_handoffs();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Handoff >&
+      handoffs() const;
+
+  // repeated uint32 removed_character_handles = 9;
+  int removed_character_handles_size() const;
+  private:
+  int _internal_removed_character_handles_size() const;
+  public:
+  void clear_removed_character_handles();
+  private:
+  uint32_t _internal_removed_character_handles(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_removed_character_handles() const;
+  void _internal_add_removed_character_handles(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_removed_character_handles();
+  public:
+  uint32_t removed_character_handles(int index) const;
+  void set_removed_character_handles(int index, uint32_t value);
+  void add_removed_character_handles(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      removed_character_handles() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_removed_character_handles();
+
+  // repeated uint32 removed_element_handles = 10;
+  int removed_element_handles_size() const;
+  private:
+  int _internal_removed_element_handles_size() const;
+  public:
+  void clear_removed_element_handles();
+  private:
+  uint32_t _internal_removed_element_handles(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_removed_element_handles() const;
+  void _internal_add_removed_element_handles(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_removed_element_handles();
+  public:
+  uint32_t removed_element_handles(int index) const;
+  void set_removed_element_handles(int index, uint32_t value);
+  void add_removed_element_handles(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      removed_element_handles() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_removed_element_handles();
+
   // double time = 3;
   void clear_time();
   double time() const;
@@ -410,6 +810,24 @@ class UpdateResponse final :
   void _internal_set_time(double value);
   public:
 
+  // uint64 sequence = 4;
+  void clear_sequence();
+  uint64_t sequence() const;
+  void set_sequence(uint64_t value);
+  private:
+  uint64_t _internal_sequence() const;
+  void _internal_set_sequence(uint64_t value);
+  public:
+
+  // uint64 baseline_sequence = 5;
+  void clear_baseline_sequence();
+  uint64_t baseline_sequence() const;
+  void set_baseline_sequence(uint64_t value);
+  private:
+  uint64_t _internal_baseline_sequence() const;
+  void _internal_set_baseline_sequence(uint64_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:proto.UpdateResponse)
  private:
   class _Internal;
@@ -420,7 +838,16 @@ class UpdateResponse final :
   struct Impl_ {
     ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Character > characters_;
     ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Element > elements_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> removed_characters_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> removed_elements_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Handoff > handoffs_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > removed_character_handles_;
+    mutable std::atomic<int> _removed_character_handles_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > removed_element_handles_;
+    mutable std::atomic<int> _removed_element_handles_cached_byte_size_;
     double time_;
+    uint64_t sequence_;
+    uint64_t baseline_sequence_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -428,24 +855,24 @@ class UpdateResponse final :
 };
 // -------------------------------------------------------------------
 
-class ReportInGameRequest final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.ReportInGameRequest) */ {
+class InputCommand final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.InputCommand) */ {
  public:
-  inline ReportInGameRequest() : ReportInGameRequest(nullptr) {}
-  ~ReportInGameRequest() override;
-  explicit PROTOBUF_CONSTEXPR ReportInGameRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline InputCommand() : InputCommand(nullptr) {}
+  ~InputCommand() override;
+  explicit PROTOBUF_CONSTEXPR InputCommand(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ReportInGameRequest(const ReportInGameRequest& from);
-  ReportInGameRequest(ReportInGameRequest&& from) noexcept
-    : ReportInGameRequest() {
+  InputCommand(const InputCommand& from);
+  InputCommand(InputCommand&& from) noexcept
+    : InputCommand() {
     *this = ::std::move(from);
   }
 
-  inline ReportInGameRequest& operator=(const ReportInGameRequest& from) {
+  inline InputCommand& operator=(const InputCommand& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ReportInGameRequest& operator=(ReportInGameRequest&& from) noexcept {
+  inline InputCommand& operator=(InputCommand&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -468,20 +895,20 @@ class ReportInGameRequest final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ReportInGameRequest& default_instance() {
+  static const InputCommand& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ReportInGameRequest* internal_default_instance() {
-    return reinterpret_cast<const ReportInGameRequest*>(
-               &_ReportInGameRequest_default_instance_);
+  static inline const InputCommand* internal_default_instance() {
+    return reinterpret_cast<const InputCommand*>(
+               &_InputCommand_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    2;
+    3;
 
-  friend void swap(ReportInGameRequest& a, ReportInGameRequest& b) {
+  friend void swap(InputCommand& a, InputCommand& b) {
     a.Swap(&b);
   }
-  inline void Swap(ReportInGameRequest* other) {
+  inline void Swap(InputCommand* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -494,7 +921,7 @@ class ReportInGameRequest final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ReportInGameRequest* other) {
+  void UnsafeArenaSwap(InputCommand* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -502,14 +929,14 @@ class ReportInGameRequest final :
 
   // implements Message ----------------------------------------------
 
-  ReportInGameRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ReportInGameRequest>(arena);
+  InputCommand* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<InputCommand>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ReportInGameRequest& from);
+  void CopyFrom(const InputCommand& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const ReportInGameRequest& from) {
-    ReportInGameRequest::MergeImpl(*this, from);
+  void MergeFrom( const InputCommand& from) {
+    InputCommand::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -527,15 +954,15 @@ class ReportInGameRequest final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ReportInGameRequest* other);
+  void InternalSwap(InputCommand* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "proto.ReportInGameRequest";
+    return "proto.InputCommand";
   }
   protected:
-  explicit ReportInGameRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit InputCommand(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -549,76 +976,308 @@ class ReportInGameRequest final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kNameFieldNumber = 1,
-    kPotentialHitFieldNumber = 3,
-    kPhysicFieldNumber = 2,
-    kSpecialEffectBoostFieldNumber = 5,
-    kStatusEnumFieldNumber = 4,
+    kSequenceFieldNumber = 1,
+    kDirectionXFieldNumber = 2,
+    kDirectionYFieldNumber = 3,
+    kDirectionZFieldNumber = 4,
+    kInputFlagsFieldNumber = 5,
+    kDurationFieldNumber = 6,
   };
-  // string name = 1;
-  void clear_name();
-  const std::string& name() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_name(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_name();
-  PROTOBUF_NODISCARD std::string* release_name();
-  void set_allocated_name(std::string* name);
+  // uint32 sequence = 1;
+  void clear_sequence();
+  uint32_t sequence() const;
+  void set_sequence(uint32_t value);
   private:
-  const std::string& _internal_name() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
-  std::string* _internal_mutable_name();
+  uint32_t _internal_sequence() const;
+  void _internal_set_sequence(uint32_t value);
   public:
 
-  // string potential_hit = 3;
-  void clear_potential_hit();
-  const std::string& potential_hit() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_potential_hit(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_potential_hit();
-  PROTOBUF_NODISCARD std::string* release_potential_hit();
-  void set_allocated_potential_hit(std::string* potential_hit);
+  // float direction_x = 2;
+  void clear_direction_x();
+  float direction_x() const;
+  void set_direction_x(float value);
   private:
-  const std::string& _internal_potential_hit() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_potential_hit(const std::string& value);
-  std::string* _internal_mutable_potential_hit();
+  float _internal_direction_x() const;
+  void _internal_set_direction_x(float value);
   public:
 
-  // .proto.Physic physic = 2;
-  bool has_physic() const;
+  // float direction_y = 3;
+  void clear_direction_y();
+  float direction_y() const;
+  void set_direction_y(float value);
   private:
-  bool _internal_has_physic() const;
+  float _internal_direction_y() const;
+  void _internal_set_direction_y(float value);
   public:
-  void clear_physic();
-  const ::proto::Physic& physic() const;
-  PROTOBUF_NODISCARD ::proto::Physic* release_physic();
-  ::proto::Physic* mutable_physic();
-  void set_allocated_physic(::proto::Physic* physic);
+
+  // float direction_z = 4;
+  void clear_direction_z();
+  float direction_z() const;
+  void set_direction_z(float value);
   private:
-  const ::proto::Physic& _internal_physic() const;
-  ::proto::Physic* _internal_mutable_physic();
+  float _internal_direction_z() const;
+  void _internal_set_direction_z(float value);
   public:
-  void unsafe_arena_set_allocated_physic(
-      ::proto::Physic* physic);
-  ::proto::Physic* unsafe_arena_release_physic();
 
-  // .proto.SpecialEffectParameter special_effect_boost = 5;
-  bool has_special_effect_boost() const;
+  // uint32 input_flags = 5;
+  void clear_input_flags();
+  uint32_t input_flags() const;
+  void set_input_flags(uint32_t value);
   private:
-  bool _internal_has_special_effect_boost() const;
+  uint32_t _internal_input_flags() const;
+  void _internal_set_input_flags(uint32_t value);
   public:
-  void clear_special_effect_boost();
-  const ::proto::SpecialEffectParameter& special_effect_boost() const;
-  PROTOBUF_NODISCARD ::proto::SpecialEffectParameter* release_special_effect_boost();
-  ::proto::SpecialEffectParameter* mutable_special_effect_boost();
-  void set_allocated_special_effect_boost(::proto::SpecialEffectParameter* special_effect_boost);
+
+  // float duration = 6;
+  void clear_duration();
+  float duration() const;
+  void set_duration(float value);
   private:
-  const ::proto::SpecialEffectParameter& _internal_special_effect_boost() const;
-  ::proto::SpecialEffectParameter* _internal_mutable_special_effect_boost();
+  float _internal_duration() const;
+  void _internal_set_duration(float value);
   public:
-  void unsafe_arena_set_allocated_special_effect_boost(
-      ::proto::SpecialEffectParameter* special_effect_boost);
+
+  // @@protoc_insertion_point(class_scope:proto.InputCommand)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t sequence_;
+    float direction_x_;
+    float direction_y_;
+    float direction_z_;
+    uint32_t input_flags_;
+    float duration_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_darwin_5fservice_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReportInGameRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.ReportInGameRequest) */ {
+ public:
+  inline ReportInGameRequest() : ReportInGameRequest(nullptr) {}
+  ~ReportInGameRequest() override;
+  explicit PROTOBUF_CONSTEXPR ReportInGameRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReportInGameRequest(const ReportInGameRequest& from);
+  ReportInGameRequest(ReportInGameRequest&& from) noexcept
+    : ReportInGameRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ReportInGameRequest& operator=(const ReportInGameRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReportInGameRequest& operator=(ReportInGameRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReportInGameRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReportInGameRequest* internal_default_instance() {
+    return reinterpret_cast<const ReportInGameRequest*>(
+               &_ReportInGameRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(ReportInGameRequest& a, ReportInGameRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReportInGameRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReportInGameRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReportInGameRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReportInGameRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReportInGameRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReportInGameRequest& from) {
+    ReportInGameRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReportInGameRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto.ReportInGameRequest";
+  }
+  protected:
+  explicit ReportInGameRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kInputCommandsFieldNumber = 7,
+    kNameFieldNumber = 1,
+    kPotentialHitFieldNumber = 3,
+    kPhysicFieldNumber = 2,
+    kSpecialEffectBoostFieldNumber = 5,
+    kAcknowledgedSequenceFieldNumber = 6,
+    kStatusEnumFieldNumber = 4,
+  };
+  // repeated .proto.InputCommand input_commands = 7;
+  int input_commands_size() const;
+  private:
+  int _internal_input_commands_size() const;
+  public:
+  void clear_input_commands();
+  ::proto::InputCommand* mutable_input_commands(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::InputCommand >*
+      mutable_input_commands();
+  private:
+  const ::proto::InputCommand& _internal_input_commands(int index) const;
+  ::proto::InputCommand* _internal_add_input_commands();
+  public:
+  const ::proto::InputCommand& input_commands(int index) const;
+  ::proto::InputCommand* add_input_commands();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::InputCommand >&
+      input_commands() const;
+
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // string potential_hit = 3;
+  void clear_potential_hit();
+  const std::string& potential_hit() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_potential_hit(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_potential_hit();
+  PROTOBUF_NODISCARD std::string* release_potential_hit();
+  void set_allocated_potential_hit(std::string* potential_hit);
+  private:
+  const std::string& _internal_potential_hit() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_potential_hit(const std::string& value);
+  std::string* _internal_mutable_potential_hit();
+  public:
+
+  // .proto.Physic physic = 2;
+  bool has_physic() const;
+  private:
+  bool _internal_has_physic() const;
+  public:
+  void clear_physic();
+  const ::proto::Physic& physic() const;
+  PROTOBUF_NODISCARD ::proto::Physic* release_physic();
+  ::proto::Physic* mutable_physic();
+  void set_allocated_physic(::proto::Physic* physic);
+  private:
+  const ::proto::Physic& _internal_physic() const;
+  ::proto::Physic* _internal_mutable_physic();
+  public:
+  void unsafe_arena_set_allocated_physic(
+      ::proto::Physic* physic);
+  ::proto::Physic* unsafe_arena_release_physic();
+
+  // .proto.SpecialEffectParameter special_effect_boost = 5;
+  bool has_special_effect_boost() const;
+  private:
+  bool _internal_has_special_effect_boost() const;
+  public:
+  void clear_special_effect_boost();
+  const ::proto::SpecialEffectParameter& special_effect_boost() const;
+  PROTOBUF_NODISCARD ::proto::SpecialEffectParameter* release_special_effect_boost();
+  ::proto::SpecialEffectParameter* mutable_special_effect_boost();
+  void set_allocated_special_effect_boost(::proto::SpecialEffectParameter* special_effect_boost);
+  private:
+  const ::proto::SpecialEffectParameter& _internal_special_effect_boost() const;
+  ::proto::SpecialEffectParameter* _internal_mutable_special_effect_boost();
+  public:
+  void unsafe_arena_set_allocated_special_effect_boost(
+      ::proto::SpecialEffectParameter* special_effect_boost);
   ::proto::SpecialEffectParameter* unsafe_arena_release_special_effect_boost();
 
+  // uint64 acknowledged_sequence = 6;
+  void clear_acknowledged_sequence();
+  uint64_t acknowledged_sequence() const;
+  void set_acknowledged_sequence(uint64_t value);
+  private:
+  uint64_t _internal_acknowledged_sequence() const;
+  void _internal_set_acknowledged_sequence(uint64_t value);
+  public:
+
   // .proto.StatusEnum status_enum = 4;
   void clear_status_enum();
   ::proto::StatusEnum status_enum() const;
@@ -636,10 +1295,12 @@ class ReportInGameRequest final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::InputCommand > input_commands_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr potential_hit_;
     ::proto::Physic* physic_;
     ::proto::SpecialEffectParameter* special_effect_boost_;
+    uint64_t acknowledged_sequence_;
     int status_enum_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
@@ -695,7 +1356,7 @@ class ReportInGameResponse final :
                &_ReportInGameResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    3;
+    5;
 
   friend void swap(ReportInGameResponse& a, ReportInGameResponse& b) {
     a.Swap(&b);
@@ -814,7 +1475,7 @@ class CreateCharacterRequest final :
                &_CreateCharacterRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    4;
+    6;
 
   friend void swap(CreateCharacterRequest& a, CreateCharacterRequest& b) {
     a.Swap(&b);
@@ -987,7 +1648,7 @@ class CreateCharacterResponse final :
                &_CreateCharacterResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    5;
+    7;
 
   friend void swap(CreateCharacterResponse& a, CreateCharacterResponse& b) {
     a.Swap(&b);
@@ -1135,7 +1796,7 @@ class PingRequest final :
                &_PingRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    6;
+    8;
 
   friend void swap(PingRequest& a, PingRequest& b) {
     a.Swap(&b);
@@ -1235,24 +1896,24 @@ class PingRequest final :
 };
 // -------------------------------------------------------------------
 
-class PingResponse final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.PingResponse) */ {
+class TickStatistics final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.TickStatistics) */ {
  public:
-  inline PingResponse() : PingResponse(nullptr) {}
-  ~PingResponse() override;
-  explicit PROTOBUF_CONSTEXPR PingResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline TickStatistics() : TickStatistics(nullptr) {}
+  ~TickStatistics() override;
+  explicit PROTOBUF_CONSTEXPR TickStatistics(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  PingResponse(const PingResponse& from);
-  PingResponse(PingResponse&& from) noexcept
-    : PingResponse() {
+  TickStatistics(const TickStatistics& from);
+  TickStatistics(TickStatistics&& from) noexcept
+    : TickStatistics() {
     *this = ::std::move(from);
   }
 
-  inline PingResponse& operator=(const PingResponse& from) {
+  inline TickStatistics& operator=(const TickStatistics& from) {
     CopyFrom(from);
     return *this;
   }
-  inline PingResponse& operator=(PingResponse&& from) noexcept {
+  inline TickStatistics& operator=(TickStatistics&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1275,20 +1936,20 @@ class PingResponse final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const PingResponse& default_instance() {
+  static const TickStatistics& default_instance() {
     return *internal_default_instance();
   }
-  static inline const PingResponse* internal_default_instance() {
-    return reinterpret_cast<const PingResponse*>(
-               &_PingResponse_default_instance_);
+  static inline const TickStatistics* internal_default_instance() {
+    return reinterpret_cast<const TickStatistics*>(
+               &_TickStatistics_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    7;
+    9;
 
-  friend void swap(PingResponse& a, PingResponse& b) {
+  friend void swap(TickStatistics& a, TickStatistics& b) {
     a.Swap(&b);
   }
-  inline void Swap(PingResponse* other) {
+  inline void Swap(TickStatistics* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1301,7 +1962,7 @@ class PingResponse final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(PingResponse* other) {
+  void UnsafeArenaSwap(TickStatistics* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1309,14 +1970,14 @@ class PingResponse final :
 
   // implements Message ----------------------------------------------
 
-  PingResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<PingResponse>(arena);
+  TickStatistics* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TickStatistics>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const PingResponse& from);
+  void CopyFrom(const TickStatistics& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const PingResponse& from) {
-    PingResponse::MergeImpl(*this, from);
+  void MergeFrom( const TickStatistics& from) {
+    TickStatistics::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -1334,15 +1995,15 @@ class PingResponse final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(PingResponse* other);
+  void InternalSwap(TickStatistics* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "proto.PingResponse";
+    return "proto.TickStatistics";
   }
   protected:
-  explicit PingResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit TickStatistics(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -1356,20 +2017,224 @@ class PingResponse final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kPlayerParameterFieldNumber = 3,
-    kTimeFieldNumber = 2,
-    kValueFieldNumber = 1,
+    kStepP50FieldNumber = 1,
+    kStepP99FieldNumber = 2,
+    kStepMaxFieldNumber = 3,
+    kBroadcastP50FieldNumber = 4,
+    kBroadcastP99FieldNumber = 5,
+    kBroadcastMaxFieldNumber = 6,
   };
-  // .proto.PlayerParameter player_parameter = 3;
-  bool has_player_parameter() const;
+  // double step_p50 = 1;
+  void clear_step_p50();
+  double step_p50() const;
+  void set_step_p50(double value);
   private:
-  bool _internal_has_player_parameter() const;
+  double _internal_step_p50() const;
+  void _internal_set_step_p50(double value);
   public:
-  void clear_player_parameter();
-  const ::proto::PlayerParameter& player_parameter() const;
-  PROTOBUF_NODISCARD ::proto::PlayerParameter* release_player_parameter();
-  ::proto::PlayerParameter* mutable_player_parameter();
-  void set_allocated_player_parameter(::proto::PlayerParameter* player_parameter);
+
+  // double step_p99 = 2;
+  void clear_step_p99();
+  double step_p99() const;
+  void set_step_p99(double value);
+  private:
+  double _internal_step_p99() const;
+  void _internal_set_step_p99(double value);
+  public:
+
+  // double step_max = 3;
+  void clear_step_max();
+  double step_max() const;
+  void set_step_max(double value);
+  private:
+  double _internal_step_max() const;
+  void _internal_set_step_max(double value);
+  public:
+
+  // double broadcast_p50 = 4;
+  void clear_broadcast_p50();
+  double broadcast_p50() const;
+  void set_broadcast_p50(double value);
+  private:
+  double _internal_broadcast_p50() const;
+  void _internal_set_broadcast_p50(double value);
+  public:
+
+  // double broadcast_p99 = 5;
+  void clear_broadcast_p99();
+  double broadcast_p99() const;
+  void set_broadcast_p99(double value);
+  private:
+  double _internal_broadcast_p99() const;
+  void _internal_set_broadcast_p99(double value);
+  public:
+
+  // double broadcast_max = 6;
+  void clear_broadcast_max();
+  double broadcast_max() const;
+  void set_broadcast_max(double value);
+  private:
+  double _internal_broadcast_max() const;
+  void _internal_set_broadcast_max(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto.TickStatistics)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    double step_p50_;
+    double step_p99_;
+    double step_max_;
+    double broadcast_p50_;
+    double broadcast_p99_;
+    double broadcast_max_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_darwin_5fservice_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PingResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.PingResponse) */ {
+ public:
+  inline PingResponse() : PingResponse(nullptr) {}
+  ~PingResponse() override;
+  explicit PROTOBUF_CONSTEXPR PingResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PingResponse(const PingResponse& from);
+  PingResponse(PingResponse&& from) noexcept
+    : PingResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline PingResponse& operator=(const PingResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PingResponse& operator=(PingResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PingResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PingResponse* internal_default_instance() {
+    return reinterpret_cast<const PingResponse*>(
+               &_PingResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(PingResponse& a, PingResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PingResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PingResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PingResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PingResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PingResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PingResponse& from) {
+    PingResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PingResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto.PingResponse";
+  }
+  protected:
+  explicit PingResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPlayerParameterFieldNumber = 3,
+    kTickStatisticsFieldNumber = 4,
+    kTimeFieldNumber = 2,
+    kValueFieldNumber = 1,
+  };
+  // .proto.PlayerParameter player_parameter = 3;
+  bool has_player_parameter() const;
+  private:
+  bool _internal_has_player_parameter() const;
+  public:
+  void clear_player_parameter();
+  const ::proto::PlayerParameter& player_parameter() const;
+  PROTOBUF_NODISCARD ::proto::PlayerParameter* release_player_parameter();
+  ::proto::PlayerParameter* mutable_player_parameter();
+  void set_allocated_player_parameter(::proto::PlayerParameter* player_parameter);
   private:
   const ::proto::PlayerParameter& _internal_player_parameter() const;
   ::proto::PlayerParameter* _internal_mutable_player_parameter();
@@ -1378,6 +2243,24 @@ class PingResponse final :
       ::proto::PlayerParameter* player_parameter);
   ::proto::PlayerParameter* unsafe_arena_release_player_parameter();
 
+  // .proto.TickStatistics tick_statistics = 4;
+  bool has_tick_statistics() const;
+  private:
+  bool _internal_has_tick_statistics() const;
+  public:
+  void clear_tick_statistics();
+  const ::proto::TickStatistics& tick_statistics() const;
+  PROTOBUF_NODISCARD ::proto::TickStatistics* release_tick_statistics();
+  ::proto::TickStatistics* mutable_tick_statistics();
+  void set_allocated_tick_statistics(::proto::TickStatistics* tick_statistics);
+  private:
+  const ::proto::TickStatistics& _internal_tick_statistics() const;
+  ::proto::TickStatistics* _internal_mutable_tick_statistics();
+  public:
+  void unsafe_arena_set_allocated_tick_statistics(
+      ::proto::TickStatistics* tick_statistics);
+  ::proto::TickStatistics* unsafe_arena_release_tick_statistics();
+
   // double time = 2;
   void clear_time();
   double time() const;
@@ -1387,78 +2270,2359 @@ class PingResponse final :
   void _internal_set_time(double value);
   public:
 
-  // int32 value = 1;
-  void clear_value();
-  int32_t value() const;
-  void set_value(int32_t value);
-  private:
-  int32_t _internal_value() const;
-  void _internal_set_value(int32_t value);
-  public:
+  // int32 value = 1;
+  void clear_value();
+  int32_t value() const;
+  void set_value(int32_t value);
+  private:
+  int32_t _internal_value() const;
+  void _internal_set_value(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto.PingResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::proto::PlayerParameter* player_parameter_;
+    ::proto::TickStatistics* tick_statistics_;
+    double time_;
+    int32_t value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_darwin_5fservice_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PlayRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.PlayRequest) */ {
+ public:
+  inline PlayRequest() : PlayRequest(nullptr) {}
+  ~PlayRequest() override;
+  explicit PROTOBUF_CONSTEXPR PlayRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PlayRequest(const PlayRequest& from);
+  PlayRequest(PlayRequest&& from) noexcept
+    : PlayRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline PlayRequest& operator=(const PlayRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PlayRequest& operator=(PlayRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PlayRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PlayRequest* internal_default_instance() {
+    return reinterpret_cast<const PlayRequest*>(
+               &_PlayRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(PlayRequest& a, PlayRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PlayRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PlayRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PlayRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PlayRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PlayRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PlayRequest& from) {
+    PlayRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PlayRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto.PlayRequest";
+  }
+  protected:
+  explicit PlayRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUpdateRequestFieldNumber = 2,
+    kReportFieldNumber = 3,
+    kSequenceFieldNumber = 1,
+  };
+  // .proto.UpdateRequest update_request = 2;
+  bool has_update_request() const;
+  private:
+  bool _internal_has_update_request() const;
+  public:
+  void clear_update_request();
+  const ::proto::UpdateRequest& update_request() const;
+  PROTOBUF_NODISCARD ::proto::UpdateRequest* release_update_request();
+  ::proto::UpdateRequest* mutable_update_request();
+  void set_allocated_update_request(::proto::UpdateRequest* update_request);
+  private:
+  const ::proto::UpdateRequest& _internal_update_request() const;
+  ::proto::UpdateRequest* _internal_mutable_update_request();
+  public:
+  void unsafe_arena_set_allocated_update_request(
+      ::proto::UpdateRequest* update_request);
+  ::proto::UpdateRequest* unsafe_arena_release_update_request();
+
+  // .proto.ReportInGameRequest report = 3;
+  bool has_report() const;
+  private:
+  bool _internal_has_report() const;
+  public:
+  void clear_report();
+  const ::proto::ReportInGameRequest& report() const;
+  PROTOBUF_NODISCARD ::proto::ReportInGameRequest* release_report();
+  ::proto::ReportInGameRequest* mutable_report();
+  void set_allocated_report(::proto::ReportInGameRequest* report);
+  private:
+  const ::proto::ReportInGameRequest& _internal_report() const;
+  ::proto::ReportInGameRequest* _internal_mutable_report();
+  public:
+  void unsafe_arena_set_allocated_report(
+      ::proto::ReportInGameRequest* report);
+  ::proto::ReportInGameRequest* unsafe_arena_release_report();
+
+  // uint64 sequence = 1;
+  void clear_sequence();
+  uint64_t sequence() const;
+  void set_sequence(uint64_t value);
+  private:
+  uint64_t _internal_sequence() const;
+  void _internal_set_sequence(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto.PlayRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::proto::UpdateRequest* update_request_;
+    ::proto::ReportInGameRequest* report_;
+    uint64_t sequence_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_darwin_5fservice_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PlayResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.PlayResponse) */ {
+ public:
+  inline PlayResponse() : PlayResponse(nullptr) {}
+  ~PlayResponse() override;
+  explicit PROTOBUF_CONSTEXPR PlayResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PlayResponse(const PlayResponse& from);
+  PlayResponse(PlayResponse&& from) noexcept
+    : PlayResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline PlayResponse& operator=(const PlayResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PlayResponse& operator=(PlayResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PlayResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PlayResponse* internal_default_instance() {
+    return reinterpret_cast<const PlayResponse*>(
+               &_PlayResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(PlayResponse& a, PlayResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PlayResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PlayResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PlayResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PlayResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PlayResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PlayResponse& from) {
+    PlayResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PlayResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto.PlayResponse";
+  }
+  protected:
+  explicit PlayResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUpdateFieldNumber = 2,
+    kReportSequenceFieldNumber = 1,
+  };
+  // .proto.UpdateResponse update = 2;
+  bool has_update() const;
+  private:
+  bool _internal_has_update() const;
+  public:
+  void clear_update();
+  const ::proto::UpdateResponse& update() const;
+  PROTOBUF_NODISCARD ::proto::UpdateResponse* release_update();
+  ::proto::UpdateResponse* mutable_update();
+  void set_allocated_update(::proto::UpdateResponse* update);
+  private:
+  const ::proto::UpdateResponse& _internal_update() const;
+  ::proto::UpdateResponse* _internal_mutable_update();
+  public:
+  void unsafe_arena_set_allocated_update(
+      ::proto::UpdateResponse* update);
+  ::proto::UpdateResponse* unsafe_arena_release_update();
+
+  // uint64 report_sequence = 1;
+  void clear_report_sequence();
+  uint64_t report_sequence() const;
+  void set_report_sequence(uint64_t value);
+  private:
+  uint64_t _internal_report_sequence() const;
+  void _internal_set_report_sequence(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto.PlayResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::proto::UpdateResponse* update_;
+    uint64_t report_sequence_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_darwin_5fservice_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RecordedEvent final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.RecordedEvent) */ {
+ public:
+  inline RecordedEvent() : RecordedEvent(nullptr) {}
+  ~RecordedEvent() override;
+  explicit PROTOBUF_CONSTEXPR RecordedEvent(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RecordedEvent(const RecordedEvent& from);
+  RecordedEvent(RecordedEvent&& from) noexcept
+    : RecordedEvent() {
+    *this = ::std::move(from);
+  }
+
+  inline RecordedEvent& operator=(const RecordedEvent& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RecordedEvent& operator=(RecordedEvent&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RecordedEvent& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RecordedEvent* internal_default_instance() {
+    return reinterpret_cast<const RecordedEvent*>(
+               &_RecordedEvent_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(RecordedEvent& a, RecordedEvent& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RecordedEvent* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RecordedEvent* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RecordedEvent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RecordedEvent>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RecordedEvent& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RecordedEvent& from) {
+    RecordedEvent::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RecordedEvent* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto.RecordedEvent";
+  }
+  protected:
+  explicit RecordedEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPeerFieldNumber = 3,
+    kCreateCharacterFieldNumber = 4,
+    kReportFieldNumber = 5,
+    kTimeFieldNumber = 1,
+    kReportSequenceFieldNumber = 6,
+    kRecordedEventEnumFieldNumber = 2,
+  };
+  // string peer = 3;
+  void clear_peer();
+  const std::string& peer() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_peer(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_peer();
+  PROTOBUF_NODISCARD std::string* release_peer();
+  void set_allocated_peer(std::string* peer);
+  private:
+  const std::string& _internal_peer() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_peer(const std::string& value);
+  std::string* _internal_mutable_peer();
+  public:
+
+  // .proto.CreateCharacterRequest create_character = 4;
+  bool has_create_character() const;
+  private:
+  bool _internal_has_create_character() const;
+  public:
+  void clear_create_character();
+  const ::proto::CreateCharacterRequest& create_character() const;
+  PROTOBUF_NODISCARD ::proto::CreateCharacterRequest* release_create_character();
+  ::proto::CreateCharacterRequest* mutable_create_character();
+  void set_allocated_create_character(::proto::CreateCharacterRequest* create_character);
+  private:
+  const ::proto::CreateCharacterRequest& _internal_create_character() const;
+  ::proto::CreateCharacterRequest* _internal_mutable_create_character();
+  public:
+  void unsafe_arena_set_allocated_create_character(
+      ::proto::CreateCharacterRequest* create_character);
+  ::proto::CreateCharacterRequest* unsafe_arena_release_create_character();
+
+  // .proto.ReportInGameRequest report = 5;
+  bool has_report() const;
+  private:
+  bool _internal_has_report() const;
+  public:
+  void clear_report();
+  const ::proto::ReportInGameRequest& report() const;
+  PROTOBUF_NODISCARD ::proto::ReportInGameRequest* release_report();
+  ::proto::ReportInGameRequest* mutable_report();
+  void set_allocated_report(::proto::ReportInGameRequest* report);
+  private:
+  const ::proto::ReportInGameRequest& _internal_report() const;
+  ::proto::ReportInGameRequest* _internal_mutable_report();
+  public:
+  void unsafe_arena_set_allocated_report(
+      ::proto::ReportInGameRequest* report);
+  ::proto::ReportInGameRequest* unsafe_arena_release_report();
+
+  // double time = 1;
+  void clear_time();
+  double time() const;
+  void set_time(double value);
+  private:
+  double _internal_time() const;
+  void _internal_set_time(double value);
+  public:
+
+  // uint64 report_sequence = 6;
+  void clear_report_sequence();
+  uint64_t report_sequence() const;
+  void set_report_sequence(uint64_t value);
+  private:
+  uint64_t _internal_report_sequence() const;
+  void _internal_set_report_sequence(uint64_t value);
+  public:
+
+  // .proto.RecordedEventEnum recorded_event_enum = 2;
+  void clear_recorded_event_enum();
+  ::proto::RecordedEventEnum recorded_event_enum() const;
+  void set_recorded_event_enum(::proto::RecordedEventEnum value);
+  private:
+  ::proto::RecordedEventEnum _internal_recorded_event_enum() const;
+  void _internal_set_recorded_event_enum(::proto::RecordedEventEnum value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto.RecordedEvent)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr peer_;
+    ::proto::CreateCharacterRequest* create_character_;
+    ::proto::ReportInGameRequest* report_;
+    double time_;
+    uint64_t report_sequence_;
+    int recorded_event_enum_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_darwin_5fservice_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RecordingHeader final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.RecordingHeader) */ {
+ public:
+  inline RecordingHeader() : RecordingHeader(nullptr) {}
+  ~RecordingHeader() override;
+  explicit PROTOBUF_CONSTEXPR RecordingHeader(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RecordingHeader(const RecordingHeader& from);
+  RecordingHeader(RecordingHeader&& from) noexcept
+    : RecordingHeader() {
+    *this = ::std::move(from);
+  }
+
+  inline RecordingHeader& operator=(const RecordingHeader& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RecordingHeader& operator=(RecordingHeader&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RecordingHeader& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RecordingHeader* internal_default_instance() {
+    return reinterpret_cast<const RecordingHeader*>(
+               &_RecordingHeader_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(RecordingHeader& a, RecordingHeader& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RecordingHeader* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RecordingHeader* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RecordingHeader* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RecordingHeader>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RecordingHeader& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RecordingHeader& from) {
+    RecordingHeader::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RecordingHeader* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto.RecordingHeader";
+  }
+  protected:
+  explicit RecordingHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kWorldFieldNumber = 7,
+    kRandomSeedFieldNumber = 2,
+    kStepPeriodFieldNumber = 3,
+    kVersionFieldNumber = 1,
+    kUpgradeCountFieldNumber = 5,
+    kBroadcastPeriodFieldNumber = 4,
+    kServerHitDetectionFieldNumber = 6,
+  };
+  // .proto.WorldDatabase world = 7;
+  bool has_world() const;
+  private:
+  bool _internal_has_world() const;
+  public:
+  void clear_world();
+  const ::proto::WorldDatabase& world() const;
+  PROTOBUF_NODISCARD ::proto::WorldDatabase* release_world();
+  ::proto::WorldDatabase* mutable_world();
+  void set_allocated_world(::proto::WorldDatabase* world);
+  private:
+  const ::proto::WorldDatabase& _internal_world() const;
+  ::proto::WorldDatabase* _internal_mutable_world();
+  public:
+  void unsafe_arena_set_allocated_world(
+      ::proto::WorldDatabase* world);
+  ::proto::WorldDatabase* unsafe_arena_release_world();
+
+  // uint64 random_seed = 2;
+  void clear_random_seed();
+  uint64_t random_seed() const;
+  void set_random_seed(uint64_t value);
+  private:
+  uint64_t _internal_random_seed() const;
+  void _internal_set_random_seed(uint64_t value);
+  public:
+
+  // double step_period = 3;
+  void clear_step_period();
+  double step_period() const;
+  void set_step_period(double value);
+  private:
+  double _internal_step_period() const;
+  void _internal_set_step_period(double value);
+  public:
+
+  // uint32 version = 1;
+  void clear_version();
+  uint32_t version() const;
+  void set_version(uint32_t value);
+  private:
+  uint32_t _internal_version() const;
+  void _internal_set_version(uint32_t value);
+  public:
+
+  // uint32 upgrade_count = 5;
+  void clear_upgrade_count();
+  uint32_t upgrade_count() const;
+  void set_upgrade_count(uint32_t value);
+  private:
+  uint32_t _internal_upgrade_count() const;
+  void _internal_set_upgrade_count(uint32_t value);
+  public:
+
+  // double broadcast_period = 4;
+  void clear_broadcast_period();
+  double broadcast_period() const;
+  void set_broadcast_period(double value);
+  private:
+  double _internal_broadcast_period() const;
+  void _internal_set_broadcast_period(double value);
+  public:
+
+  // bool server_hit_detection = 6;
+  void clear_server_hit_detection();
+  bool server_hit_detection() const;
+  void set_server_hit_detection(bool value);
+  private:
+  bool _internal_server_hit_detection() const;
+  void _internal_set_server_hit_detection(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto.RecordingHeader)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::proto::WorldDatabase* world_;
+    uint64_t random_seed_;
+    double step_period_;
+    uint32_t version_;
+    uint32_t upgrade_count_;
+    double broadcast_period_;
+    bool server_hit_detection_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_darwin_5fservice_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RegionExchangeRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.RegionExchangeRequest) */ {
+ public:
+  inline RegionExchangeRequest() : RegionExchangeRequest(nullptr) {}
+  ~RegionExchangeRequest() override;
+  explicit PROTOBUF_CONSTEXPR RegionExchangeRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RegionExchangeRequest(const RegionExchangeRequest& from);
+  RegionExchangeRequest(RegionExchangeRequest&& from) noexcept
+    : RegionExchangeRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline RegionExchangeRequest& operator=(const RegionExchangeRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RegionExchangeRequest& operator=(RegionExchangeRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RegionExchangeRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RegionExchangeRequest* internal_default_instance() {
+    return reinterpret_cast<const RegionExchangeRequest*>(
+               &_RegionExchangeRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(RegionExchangeRequest& a, RegionExchangeRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RegionExchangeRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RegionExchangeRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RegionExchangeRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RegionExchangeRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RegionExchangeRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RegionExchangeRequest& from) {
+    RegionExchangeRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RegionExchangeRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto.RegionExchangeRequest";
+  }
+  protected:
+  explicit RegionExchangeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kHandoffCharactersFieldNumber = 3,
+    kMirroredCharactersFieldNumber = 4,
+    kMirroredElementsFieldNumber = 5,
+    kHandoffIdsFieldNumber = 6,
+    kTimeFieldNumber = 2,
+    kHandoffFloorFieldNumber = 7,
+    kRegionFieldNumber = 1,
+  };
+  // repeated .proto.Character handoff_characters = 3;
+  int handoff_characters_size() const;
+  private:
+  int _internal_handoff_characters_size() const;
+  public:
+  void clear_handoff_characters();
+  ::proto::Character* mutable_handoff_characters(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Character >*
+      mutable_handoff_characters();
+  private:
+  const ::proto::Character& _internal_handoff_characters(int index) const;
+  ::proto::Character* _internal_add_handoff_characters();
+  public:
+  const ::proto::Character& handoff_characters(int index) const;
+  ::proto::Character* add_handoff_characters();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Character >&
+      handoff_characters() const;
+
+  // repeated .proto.Character mirrored_characters = 4;
+  int mirrored_characters_size() const;
+  private:
+  int _internal_mirrored_characters_size() const;
+  public:
+  void clear_mirrored_characters();
+  ::proto::Character* mutable_mirrored_characters(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Character >*
+      mutable_mirrored_characters();
+  private:
+  const ::proto::Character& _internal_mirrored_characters(int index) const;
+  ::proto::Character* _internal_add_mirrored_characters();
+  public:
+  const ::proto::Character& mirrored_characters(int index) const;
+  ::proto::Character* add_mirrored_characters();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Character >&
+      mirrored_characters() const;
+
+  // repeated .proto.Element mirrored_elements = 5;
+  int mirrored_elements_size() const;
+  private:
+  int _internal_mirrored_elements_size() const;
+  public:
+  void clear_mirrored_elements();
+  ::proto::Element* mutable_mirrored_elements(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Element >*
+      mutable_mirrored_elements();
+  private:
+  const ::proto::Element& _internal_mirrored_elements(int index) const;
+  ::proto::Element* _internal_add_mirrored_elements();
+  public:
+  const ::proto::Element& mirrored_elements(int index) const;
+  ::proto::Element* add_mirrored_elements();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Element >&
+      mirrored_elements() const;
+
+  // repeated uint64 handoff_ids = 6;
+  int handoff_ids_size() const;
+  private:
+  int _internal_handoff_ids_size() const;
+  public:
+  void clear_handoff_ids();
+  private:
+  uint64_t _internal_handoff_ids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_handoff_ids() const;
+  void _internal_add_handoff_ids(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_handoff_ids();
+  public:
+  uint64_t handoff_ids(int index) const;
+  void set_handoff_ids(int index, uint64_t value);
+  void add_handoff_ids(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      handoff_ids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_handoff_ids();
+
+  // double time = 2;
+  void clear_time();
+  double time() const;
+  void set_time(double value);
+  private:
+  double _internal_time() const;
+  void _internal_set_time(double value);
+  public:
+
+  // uint64 handoff_floor = 7;
+  void clear_handoff_floor();
+  uint64_t handoff_floor() const;
+  void set_handoff_floor(uint64_t value);
+  private:
+  uint64_t _internal_handoff_floor() const;
+  void _internal_set_handoff_floor(uint64_t value);
+  public:
+
+  // uint32 region = 1;
+  void clear_region();
+  uint32_t region() const;
+  void set_region(uint32_t value);
+  private:
+  uint32_t _internal_region() const;
+  void _internal_set_region(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto.RegionExchangeRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Character > handoff_characters_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Character > mirrored_characters_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Element > mirrored_elements_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > handoff_ids_;
+    mutable std::atomic<int> _handoff_ids_cached_byte_size_;
+    double time_;
+    uint64_t handoff_floor_;
+    uint32_t region_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_darwin_5fservice_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RegionExchangeResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:proto.RegionExchangeResponse) */ {
+ public:
+  inline RegionExchangeResponse() : RegionExchangeResponse(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR RegionExchangeResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RegionExchangeResponse(const RegionExchangeResponse& from);
+  RegionExchangeResponse(RegionExchangeResponse&& from) noexcept
+    : RegionExchangeResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline RegionExchangeResponse& operator=(const RegionExchangeResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RegionExchangeResponse& operator=(RegionExchangeResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RegionExchangeResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RegionExchangeResponse* internal_default_instance() {
+    return reinterpret_cast<const RegionExchangeResponse*>(
+               &_RegionExchangeResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(RegionExchangeResponse& a, RegionExchangeResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RegionExchangeResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RegionExchangeResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RegionExchangeResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RegionExchangeResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const RegionExchangeResponse& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const RegionExchangeResponse& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto.RegionExchangeResponse";
+  }
+  protected:
+  explicit RegionExchangeResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:proto.RegionExchangeResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_darwin_5fservice_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// UpdateRequest
+
+// string name = 1;
+inline void UpdateRequest::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& UpdateRequest::name() const {
+  // @@protoc_insertion_point(field_get:proto.UpdateRequest.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UpdateRequest::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:proto.UpdateRequest.name)
+}
+inline std::string* UpdateRequest::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:proto.UpdateRequest.name)
+  return _s;
+}
+inline const std::string& UpdateRequest::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void UpdateRequest::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UpdateRequest::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UpdateRequest::release_name() {
+  // @@protoc_insertion_point(field_release:proto.UpdateRequest.name)
+  return _impl_.name_.Release();
+}
+inline void UpdateRequest::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto.UpdateRequest.name)
+}
+
+// bool delta = 2;
+inline void UpdateRequest::clear_delta() {
+  _impl_.delta_ = false;
+}
+inline bool UpdateRequest::_internal_delta() const {
+  return _impl_.delta_;
+}
+inline bool UpdateRequest::delta() const {
+  // @@protoc_insertion_point(field_get:proto.UpdateRequest.delta)
+  return _internal_delta();
+}
+inline void UpdateRequest::_internal_set_delta(bool value) {
+  
+  _impl_.delta_ = value;
+}
+inline void UpdateRequest::set_delta(bool value) {
+  _internal_set_delta(value);
+  // @@protoc_insertion_point(field_set:proto.UpdateRequest.delta)
+}
+
+// bool handles = 3;
+inline void UpdateRequest::clear_handles() {
+  _impl_.handles_ = false;
+}
+inline bool UpdateRequest::_internal_handles() const {
+  return _impl_.handles_;
+}
+inline bool UpdateRequest::handles() const {
+  // @@protoc_insertion_point(field_get:proto.UpdateRequest.handles)
+  return _internal_handles();
+}
+inline void UpdateRequest::_internal_set_handles(bool value) {
+  
+  _impl_.handles_ = value;
+}
+inline void UpdateRequest::set_handles(bool value) {
+  _internal_set_handles(value);
+  // @@protoc_insertion_point(field_set:proto.UpdateRequest.handles)
+}
+
+// -------------------------------------------------------------------
+
+// Handoff
+
+// string name = 1;
+inline void Handoff::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& Handoff::name() const {
+  // @@protoc_insertion_point(field_get:proto.Handoff.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Handoff::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:proto.Handoff.name)
+}
+inline std::string* Handoff::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:proto.Handoff.name)
+  return _s;
+}
+inline const std::string& Handoff::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void Handoff::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Handoff::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Handoff::release_name() {
+  // @@protoc_insertion_point(field_release:proto.Handoff.name)
+  return _impl_.name_.Release();
+}
+inline void Handoff::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto.Handoff.name)
+}
+
+// string server_name = 2;
+inline void Handoff::clear_server_name() {
+  _impl_.server_name_.ClearToEmpty();
+}
+inline const std::string& Handoff::server_name() const {
+  // @@protoc_insertion_point(field_get:proto.Handoff.server_name)
+  return _internal_server_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Handoff::set_server_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.server_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:proto.Handoff.server_name)
+}
+inline std::string* Handoff::mutable_server_name() {
+  std::string* _s = _internal_mutable_server_name();
+  // @@protoc_insertion_point(field_mutable:proto.Handoff.server_name)
+  return _s;
+}
+inline const std::string& Handoff::_internal_server_name() const {
+  return _impl_.server_name_.Get();
+}
+inline void Handoff::_internal_set_server_name(const std::string& value) {
+  
+  _impl_.server_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Handoff::_internal_mutable_server_name() {
+  
+  return _impl_.server_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Handoff::release_server_name() {
+  // @@protoc_insertion_point(field_release:proto.Handoff.server_name)
+  return _impl_.server_name_.Release();
+}
+inline void Handoff::set_allocated_server_name(std::string* server_name) {
+  if (server_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.server_name_.SetAllocated(server_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.server_name_.IsDefault()) {
+    _impl_.server_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto.Handoff.server_name)
+}
+
+// -------------------------------------------------------------------
+
+// UpdateResponse
+
+// repeated .proto.Character characters = 1;
+inline int UpdateResponse::_internal_characters_size() const {
+  return _impl_.characters_.size();
+}
+inline int UpdateResponse::characters_size() const {
+  return _internal_characters_size();
+}
+inline ::proto::Character* UpdateResponse::mutable_characters(int index) {
+  // @@protoc_insertion_point(field_mutable:proto.UpdateResponse.characters)
+  return _impl_.characters_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Character >*
+UpdateResponse::mutable_characters() {
+  // @@protoc_insertion_point(field_mutable_list:proto.UpdateResponse.characters)
+  return &_impl_.characters_;
+}
+inline const ::proto::Character& UpdateResponse::_internal_characters(int index) const {
+  return _impl_.characters_.Get(index);
+}
+inline const ::proto::Character& UpdateResponse::characters(int index) const {
+  // @@protoc_insertion_point(field_get:proto.UpdateResponse.characters)
+  return _internal_characters(index);
+}
+inline ::proto::Character* UpdateResponse::_internal_add_characters() {
+  return _impl_.characters_.Add();
+}
+inline ::proto::Character* UpdateResponse::add_characters() {
+  ::proto::Character* _add = _internal_add_characters();
+  // @@protoc_insertion_point(field_add:proto.UpdateResponse.characters)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Character >&
+UpdateResponse::characters() const {
+  // @@protoc_insertion_point(field_list:proto.UpdateResponse.characters)
+  return _impl_.characters_;
+}
+
+// repeated .proto.Element elements = 2;
+inline int UpdateResponse::_internal_elements_size() const {
+  return _impl_.elements_.size();
+}
+inline int UpdateResponse::elements_size() const {
+  return _internal_elements_size();
+}
+inline ::proto::Element* UpdateResponse::mutable_elements(int index) {
+  // @@protoc_insertion_point(field_mutable:proto.UpdateResponse.elements)
+  return _impl_.elements_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Element >*
+UpdateResponse::mutable_elements() {
+  // @@protoc_insertion_point(field_mutable_list:proto.UpdateResponse.elements)
+  return &_impl_.elements_;
+}
+inline const ::proto::Element& UpdateResponse::_internal_elements(int index) const {
+  return _impl_.elements_.Get(index);
+}
+inline const ::proto::Element& UpdateResponse::elements(int index) const {
+  // @@protoc_insertion_point(field_get:proto.UpdateResponse.elements)
+  return _internal_elements(index);
+}
+inline ::proto::Element* UpdateResponse::_internal_add_elements() {
+  return _impl_.elements_.Add();
+}
+inline ::proto::Element* UpdateResponse::add_elements() {
+  ::proto::Element* _add = _internal_add_elements();
+  // @@protoc_insertion_point(field_add:proto.UpdateResponse.elements)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Element >&
+UpdateResponse::elements() const {
+  // @@protoc_insertion_point(field_list:proto.UpdateResponse.elements)
+  return _impl_.elements_;
+}
+
+// double time = 3;
+inline void UpdateResponse::clear_time() {
+  _impl_.time_ = 0;
+}
+inline double UpdateResponse::_internal_time() const {
+  return _impl_.time_;
+}
+inline double UpdateResponse::time() const {
+  // @@protoc_insertion_point(field_get:proto.UpdateResponse.time)
+  return _internal_time();
+}
+inline void UpdateResponse::_internal_set_time(double value) {
+  
+  _impl_.time_ = value;
+}
+inline void UpdateResponse::set_time(double value) {
+  _internal_set_time(value);
+  // @@protoc_insertion_point(field_set:proto.UpdateResponse.time)
+}
+
+// uint64 sequence = 4;
+inline void UpdateResponse::clear_sequence() {
+  _impl_.sequence_ = uint64_t{0u};
+}
+inline uint64_t UpdateResponse::_internal_sequence() const {
+  return _impl_.sequence_;
+}
+inline uint64_t UpdateResponse::sequence() const {
+  // @@protoc_insertion_point(field_get:proto.UpdateResponse.sequence)
+  return _internal_sequence();
+}
+inline void UpdateResponse::_internal_set_sequence(uint64_t value) {
+  
+  _impl_.sequence_ = value;
+}
+inline void UpdateResponse::set_sequence(uint64_t value) {
+  _internal_set_sequence(value);
+  // @@protoc_insertion_point(field_set:proto.UpdateResponse.sequence)
+}
+
+// uint64 baseline_sequence = 5;
+inline void UpdateResponse::clear_baseline_sequence() {
+  _impl_.baseline_sequence_ = uint64_t{0u};
+}
+inline uint64_t UpdateResponse::_internal_baseline_sequence() const {
+  return _impl_.baseline_sequence_;
+}
+inline uint64_t UpdateResponse::baseline_sequence() const {
+  // @@protoc_insertion_point(field_get:proto.UpdateResponse.baseline_sequence)
+  return _internal_baseline_sequence();
+}
+inline void UpdateResponse::_internal_set_baseline_sequence(uint64_t value) {
+  
+  _impl_.baseline_sequence_ = value;
+}
+inline void UpdateResponse::set_baseline_sequence(uint64_t value) {
+  _internal_set_baseline_sequence(value);
+  // @@protoc_insertion_point(field_set:proto.UpdateResponse.baseline_sequence)
+}
+
+// repeated string removed_characters = 6;
+inline int UpdateResponse::_internal_removed_characters_size() const {
+  return _impl_.removed_characters_.size();
+}
+inline int UpdateResponse::removed_characters_size() const {
+  return _internal_removed_characters_size();
+}
+inline void UpdateResponse::clear_removed_characters() {
+  _impl_.removed_characters_.Clear();
+}
+inline std::string* UpdateResponse::add_removed_characters() {
+  std::string* _s = _internal_add_removed_characters();
+  // @@protoc_insertion_point(field_add_mutable:proto.UpdateResponse.removed_characters)
+  return _s;
+}
+inline const std::string& UpdateResponse::_internal_removed_characters(int index) const {
+  return _impl_.removed_characters_.Get(index);
+}
+inline const std::string& UpdateResponse::removed_characters(int index) const {
+  // @@protoc_insertion_point(field_get:proto.UpdateResponse.removed_characters)
+  return _internal_removed_characters(index);
+}
+inline std::string* UpdateResponse::mutable_removed_characters(int index) {
+  // @@protoc_insertion_point(field_mutable:proto.UpdateResponse.removed_characters)
+  return _impl_.removed_characters_.Mutable(index);
+}
+inline void UpdateResponse::set_removed_characters(int index, const std::string& value) {
+  _impl_.removed_characters_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:proto.UpdateResponse.removed_characters)
+}
+inline void UpdateResponse::set_removed_characters(int index, std::string&& value) {
+  _impl_.removed_characters_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:proto.UpdateResponse.removed_characters)
+}
+inline void UpdateResponse::set_removed_characters(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.removed_characters_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proto.UpdateResponse.removed_characters)
+}
+inline void UpdateResponse::set_removed_characters(int index, const char* value, size_t size) {
+  _impl_.removed_characters_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proto.UpdateResponse.removed_characters)
+}
+inline std::string* UpdateResponse::_internal_add_removed_characters() {
+  return _impl_.removed_characters_.Add();
+}
+inline void UpdateResponse::add_removed_characters(const std::string& value) {
+  _impl_.removed_characters_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proto.UpdateResponse.removed_characters)
+}
+inline void UpdateResponse::add_removed_characters(std::string&& value) {
+  _impl_.removed_characters_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proto.UpdateResponse.removed_characters)
+}
+inline void UpdateResponse::add_removed_characters(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.removed_characters_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proto.UpdateResponse.removed_characters)
+}
+inline void UpdateResponse::add_removed_characters(const char* value, size_t size) {
+  _impl_.removed_characters_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proto.UpdateResponse.removed_characters)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+UpdateResponse::removed_characters() const {
+  // @@protoc_insertion_point(field_list:proto.UpdateResponse.removed_characters)
+  return _impl_.removed_characters_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+UpdateResponse::mutable_removed_characters() {
+  // @@protoc_insertion_point(field_mutable_list:proto.UpdateResponse.removed_characters)
+  return &_impl_.removed_characters_;
+}
+
+// repeated string removed_elements = 7;
+inline int UpdateResponse::_internal_removed_elements_size() const {
+  return _impl_.removed_elements_.size();
+}
+inline int UpdateResponse::removed_elements_size() const {
+  return _internal_removed_elements_size();
+}
+inline void UpdateResponse::clear_removed_elements() {
+  _impl_.removed_elements_.Clear();
+}
+inline std::string* UpdateResponse::add_removed_elements() {
+  std::string* _s = _internal_add_removed_elements();
+  // @@protoc_insertion_point(field_add_mutable:proto.UpdateResponse.removed_elements)
+  return _s;
+}
+inline const std::string& UpdateResponse::_internal_removed_elements(int index) const {
+  return _impl_.removed_elements_.Get(index);
+}
+inline const std::string& UpdateResponse::removed_elements(int index) const {
+  // @@protoc_insertion_point(field_get:proto.UpdateResponse.removed_elements)
+  return _internal_removed_elements(index);
+}
+inline std::string* UpdateResponse::mutable_removed_elements(int index) {
+  // @@protoc_insertion_point(field_mutable:proto.UpdateResponse.removed_elements)
+  return _impl_.removed_elements_.Mutable(index);
+}
+inline void UpdateResponse::set_removed_elements(int index, const std::string& value) {
+  _impl_.removed_elements_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:proto.UpdateResponse.removed_elements)
+}
+inline void UpdateResponse::set_removed_elements(int index, std::string&& value) {
+  _impl_.removed_elements_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:proto.UpdateResponse.removed_elements)
+}
+inline void UpdateResponse::set_removed_elements(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.removed_elements_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proto.UpdateResponse.removed_elements)
+}
+inline void UpdateResponse::set_removed_elements(int index, const char* value, size_t size) {
+  _impl_.removed_elements_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proto.UpdateResponse.removed_elements)
+}
+inline std::string* UpdateResponse::_internal_add_removed_elements() {
+  return _impl_.removed_elements_.Add();
+}
+inline void UpdateResponse::add_removed_elements(const std::string& value) {
+  _impl_.removed_elements_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proto.UpdateResponse.removed_elements)
+}
+inline void UpdateResponse::add_removed_elements(std::string&& value) {
+  _impl_.removed_elements_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proto.UpdateResponse.removed_elements)
+}
+inline void UpdateResponse::add_removed_elements(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.removed_elements_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proto.UpdateResponse.removed_elements)
+}
+inline void UpdateResponse::add_removed_elements(const char* value, size_t size) {
+  _impl_.removed_elements_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proto.UpdateResponse.removed_elements)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+UpdateResponse::removed_elements() const {
+  // @@protoc_insertion_point(field_list:proto.UpdateResponse.removed_elements)
+  return _impl_.removed_elements_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+UpdateResponse::mutable_removed_elements() {
+  // @@protoc_insertion_point(field_mutable_list:proto.UpdateResponse.removed_elements)
+  return &_impl_.removed_elements_;
+}
+
+// repeated .proto.Handoff handoffs = 8;
+inline int UpdateResponse::_internal_handoffs_size() const {
+  return _impl_.handoffs_.size();
+}
+inline int UpdateResponse::handoffs_size() const {
+  return _internal_handoffs_size();
+}
+inline void UpdateResponse::clear_handoffs() {
+  _impl_.handoffs_.Clear();
+}
+inline ::proto::Handoff* UpdateResponse::mutable_handoffs(int index) {
+  // @@protoc_insertion_point(field_mutable:proto.UpdateResponse.handoffs)
+  return _impl_.handoffs_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Handoff >*
+UpdateResponse::mutable_handoffs() {
+  // @@protoc_insertion_point(field_mutable_list:proto.UpdateResponse.handoffs)
+  return &_impl_.handoffs_;
+}
+inline const ::proto::Handoff& UpdateResponse::_internal_handoffs(int index) const {
+  return _impl_.handoffs_.Get(index);
+}
+inline const ::proto::Handoff& UpdateResponse::handoffs(int index) const {
+  // @@protoc_insertion_point(field_get:proto.UpdateResponse.handoffs)
+  return _internal_handoffs(index);
+}
+inline ::proto::Handoff* UpdateResponse::_internal_add_handoffs() {
+  return _impl_.handoffs_.Add();
+}
+inline ::proto::Handoff* UpdateResponse::add_handoffs() {
+  ::proto::Handoff* _add = _internal_add_handoffs();
+  // @@protoc_insertion_point(field_add:proto.UpdateResponse.handoffs)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Handoff >&
+UpdateResponse::handoffs() const {
+  // @@protoc_insertion_point(field_list:proto.UpdateResponse.handoffs)
+  return _impl_.handoffs_;
+}
+
+// repeated uint32 removed_character_handles = 9;
+inline int UpdateResponse::_internal_removed_character_handles_size() const {
+  return _impl_.removed_character_handles_.size();
+}
+inline int UpdateResponse::removed_character_handles_size() const {
+  return _internal_removed_character_handles_size();
+}
+inline void UpdateResponse::clear_removed_character_handles() {
+  _impl_.removed_character_handles_.Clear();
+}
+inline uint32_t UpdateResponse::_internal_removed_character_handles(int index) const {
+  return _impl_.removed_character_handles_.Get(index);
+}
+inline uint32_t UpdateResponse::removed_character_handles(int index) const {
+  // @@protoc_insertion_point(field_get:proto.UpdateResponse.removed_character_handles)
+  return _internal_removed_character_handles(index);
+}
+inline void UpdateResponse::set_removed_character_handles(int index, uint32_t value) {
+  _impl_.removed_character_handles_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto.UpdateResponse.removed_character_handles)
+}
+inline void UpdateResponse::_internal_add_removed_character_handles(uint32_t value) {
+  _impl_.removed_character_handles_.Add(value);
+}
+inline void UpdateResponse::add_removed_character_handles(uint32_t value) {
+  _internal_add_removed_character_handles(value);
+  // @@protoc_insertion_point(field_add:proto.UpdateResponse.removed_character_handles)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+UpdateResponse::_internal_removed_character_handles() const {
+  return _impl_.removed_character_handles_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+UpdateResponse::removed_character_handles() const {
+  // @@protoc_insertion_point(field_list:proto.UpdateResponse.removed_character_handles)
+  return _internal_removed_character_handles();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+UpdateResponse::_internal_mutable_removed_character_handles() {
+  return &_impl_.removed_character_handles_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+UpdateResponse::mutable_removed_character_handles() {
+  // @@protoc_insertion_point(field_mutable_list:proto.UpdateResponse.removed_character_handles)
+  return _internal_mutable_removed_character_handles();
+}
+
+// repeated uint32 removed_element_handles = 10;
+inline int UpdateResponse::_internal_removed_element_handles_size() const {
+  return _impl_.removed_element_handles_.size();
+}
+inline int UpdateResponse::removed_element_handles_size() const {
+  return _internal_removed_element_handles_size();
+}
+inline void UpdateResponse::clear_removed_element_handles() {
+  _impl_.removed_element_handles_.Clear();
+}
+inline uint32_t UpdateResponse::_internal_removed_element_handles(int index) const {
+  return _impl_.removed_element_handles_.Get(index);
+}
+inline uint32_t UpdateResponse::removed_element_handles(int index) const {
+  // @@protoc_insertion_point(field_get:proto.UpdateResponse.removed_element_handles)
+  return _internal_removed_element_handles(index);
+}
+inline void UpdateResponse::set_removed_element_handles(int index, uint32_t value) {
+  _impl_.removed_element_handles_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto.UpdateResponse.removed_element_handles)
+}
+inline void UpdateResponse::_internal_add_removed_element_handles(uint32_t value) {
+  _impl_.removed_element_handles_.Add(value);
+}
+inline void UpdateResponse::add_removed_element_handles(uint32_t value) {
+  _internal_add_removed_element_handles(value);
+  // @@protoc_insertion_point(field_add:proto.UpdateResponse.removed_element_handles)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+UpdateResponse::_internal_removed_element_handles() const {
+  return _impl_.removed_element_handles_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+UpdateResponse::removed_element_handles() const {
+  // @@protoc_insertion_point(field_list:proto.UpdateResponse.removed_element_handles)
+  return _internal_removed_element_handles();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+UpdateResponse::_internal_mutable_removed_element_handles() {
+  return &_impl_.removed_element_handles_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+UpdateResponse::mutable_removed_element_handles() {
+  // @@protoc_insertion_point(field_mutable_list:proto.UpdateResponse.removed_element_handles)
+  return _internal_mutable_removed_element_handles();
+}
+
+// -------------------------------------------------------------------
+
+// InputCommand
+
+// uint32 sequence = 1;
+inline void InputCommand::clear_sequence() {
+  _impl_.sequence_ = 0u;
+}
+inline uint32_t InputCommand::_internal_sequence() const {
+  return _impl_.sequence_;
+}
+inline uint32_t InputCommand::sequence() const {
+  // @@protoc_insertion_point(field_get:proto.InputCommand.sequence)
+  return _internal_sequence();
+}
+inline void InputCommand::_internal_set_sequence(uint32_t value) {
+  
+  _impl_.sequence_ = value;
+}
+inline void InputCommand::set_sequence(uint32_t value) {
+  _internal_set_sequence(value);
+  // @@protoc_insertion_point(field_set:proto.InputCommand.sequence)
+}
+
+// float direction_x = 2;
+inline void InputCommand::clear_direction_x() {
+  _impl_.direction_x_ = 0;
+}
+inline float InputCommand::_internal_direction_x() const {
+  return _impl_.direction_x_;
+}
+inline float InputCommand::direction_x() const {
+  // @@protoc_insertion_point(field_get:proto.InputCommand.direction_x)
+  return _internal_direction_x();
+}
+inline void InputCommand::_internal_set_direction_x(float value) {
+  
+  _impl_.direction_x_ = value;
+}
+inline void InputCommand::set_direction_x(float value) {
+  _internal_set_direction_x(value);
+  // @@protoc_insertion_point(field_set:proto.InputCommand.direction_x)
+}
+
+// float direction_y = 3;
+inline void InputCommand::clear_direction_y() {
+  _impl_.direction_y_ = 0;
+}
+inline float InputCommand::_internal_direction_y() const {
+  return _impl_.direction_y_;
+}
+inline float InputCommand::direction_y() const {
+  // @@protoc_insertion_point(field_get:proto.InputCommand.direction_y)
+  return _internal_direction_y();
+}
+inline void InputCommand::_internal_set_direction_y(float value) {
+  
+  _impl_.direction_y_ = value;
+}
+inline void InputCommand::set_direction_y(float value) {
+  _internal_set_direction_y(value);
+  // @@protoc_insertion_point(field_set:proto.InputCommand.direction_y)
+}
+
+// float direction_z = 4;
+inline void InputCommand::clear_direction_z() {
+  _impl_.direction_z_ = 0;
+}
+inline float InputCommand::_internal_direction_z() const {
+  return _impl_.direction_z_;
+}
+inline float InputCommand::direction_z() const {
+  // @@protoc_insertion_point(field_get:proto.InputCommand.direction_z)
+  return _internal_direction_z();
+}
+inline void InputCommand::_internal_set_direction_z(float value) {
+  
+  _impl_.direction_z_ = value;
+}
+inline void InputCommand::set_direction_z(float value) {
+  _internal_set_direction_z(value);
+  // @@protoc_insertion_point(field_set:proto.InputCommand.direction_z)
+}
+
+// uint32 input_flags = 5;
+inline void InputCommand::clear_input_flags() {
+  _impl_.input_flags_ = 0u;
+}
+inline uint32_t InputCommand::_internal_input_flags() const {
+  return _impl_.input_flags_;
+}
+inline uint32_t InputCommand::input_flags() const {
+  // @@protoc_insertion_point(field_get:proto.InputCommand.input_flags)
+  return _internal_input_flags();
+}
+inline void InputCommand::_internal_set_input_flags(uint32_t value) {
+  
+  _impl_.input_flags_ = value;
+}
+inline void InputCommand::set_input_flags(uint32_t value) {
+  _internal_set_input_flags(value);
+  // @@protoc_insertion_point(field_set:proto.InputCommand.input_flags)
+}
+
+// float duration = 6;
+inline void InputCommand::clear_duration() {
+  _impl_.duration_ = 0;
+}
+inline float InputCommand::_internal_duration() const {
+  return _impl_.duration_;
+}
+inline float InputCommand::duration() const {
+  // @@protoc_insertion_point(field_get:proto.InputCommand.duration)
+  return _internal_duration();
+}
+inline void InputCommand::_internal_set_duration(float value) {
+  
+  _impl_.duration_ = value;
+}
+inline void InputCommand::set_duration(float value) {
+  _internal_set_duration(value);
+  // @@protoc_insertion_point(field_set:proto.InputCommand.duration)
+}
+
+// -------------------------------------------------------------------
+
+// ReportInGameRequest
+
+// string name = 1;
+inline void ReportInGameRequest::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& ReportInGameRequest::name() const {
+  // @@protoc_insertion_point(field_get:proto.ReportInGameRequest.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ReportInGameRequest::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:proto.ReportInGameRequest.name)
+}
+inline std::string* ReportInGameRequest::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:proto.ReportInGameRequest.name)
+  return _s;
+}
+inline const std::string& ReportInGameRequest::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void ReportInGameRequest::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ReportInGameRequest::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ReportInGameRequest::release_name() {
+  // @@protoc_insertion_point(field_release:proto.ReportInGameRequest.name)
+  return _impl_.name_.Release();
+}
+inline void ReportInGameRequest::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto.ReportInGameRequest.name)
+}
+
+// .proto.Physic physic = 2;
+inline bool ReportInGameRequest::_internal_has_physic() const {
+  return this != internal_default_instance() && _impl_.physic_ != nullptr;
+}
+inline bool ReportInGameRequest::has_physic() const {
+  return _internal_has_physic();
+}
+inline const ::proto::Physic& ReportInGameRequest::_internal_physic() const {
+  const ::proto::Physic* p = _impl_.physic_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto::Physic&>(
+      ::proto::_Physic_default_instance_);
+}
+inline const ::proto::Physic& ReportInGameRequest::physic() const {
+  // @@protoc_insertion_point(field_get:proto.ReportInGameRequest.physic)
+  return _internal_physic();
+}
+inline void ReportInGameRequest::unsafe_arena_set_allocated_physic(
+    ::proto::Physic* physic) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.physic_);
+  }
+  _impl_.physic_ = physic;
+  if (physic) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto.ReportInGameRequest.physic)
+}
+inline ::proto::Physic* ReportInGameRequest::release_physic() {
+  
+  ::proto::Physic* temp = _impl_.physic_;
+  _impl_.physic_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::proto::Physic* ReportInGameRequest::unsafe_arena_release_physic() {
+  // @@protoc_insertion_point(field_release:proto.ReportInGameRequest.physic)
+  
+  ::proto::Physic* temp = _impl_.physic_;
+  _impl_.physic_ = nullptr;
+  return temp;
+}
+inline ::proto::Physic* ReportInGameRequest::_internal_mutable_physic() {
+  
+  if (_impl_.physic_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto::Physic>(GetArenaForAllocation());
+    _impl_.physic_ = p;
+  }
+  return _impl_.physic_;
+}
+inline ::proto::Physic* ReportInGameRequest::mutable_physic() {
+  ::proto::Physic* _msg = _internal_mutable_physic();
+  // @@protoc_insertion_point(field_mutable:proto.ReportInGameRequest.physic)
+  return _msg;
+}
+inline void ReportInGameRequest::set_allocated_physic(::proto::Physic* physic) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.physic_);
+  }
+  if (physic) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(physic));
+    if (message_arena != submessage_arena) {
+      physic = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, physic, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.physic_ = physic;
+  // @@protoc_insertion_point(field_set_allocated:proto.ReportInGameRequest.physic)
+}
+
+// string potential_hit = 3;
+inline void ReportInGameRequest::clear_potential_hit() {
+  _impl_.potential_hit_.ClearToEmpty();
+}
+inline const std::string& ReportInGameRequest::potential_hit() const {
+  // @@protoc_insertion_point(field_get:proto.ReportInGameRequest.potential_hit)
+  return _internal_potential_hit();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ReportInGameRequest::set_potential_hit(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.potential_hit_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:proto.ReportInGameRequest.potential_hit)
+}
+inline std::string* ReportInGameRequest::mutable_potential_hit() {
+  std::string* _s = _internal_mutable_potential_hit();
+  // @@protoc_insertion_point(field_mutable:proto.ReportInGameRequest.potential_hit)
+  return _s;
+}
+inline const std::string& ReportInGameRequest::_internal_potential_hit() const {
+  return _impl_.potential_hit_.Get();
+}
+inline void ReportInGameRequest::_internal_set_potential_hit(const std::string& value) {
+  
+  _impl_.potential_hit_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ReportInGameRequest::_internal_mutable_potential_hit() {
+  
+  return _impl_.potential_hit_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ReportInGameRequest::release_potential_hit() {
+  // @@protoc_insertion_point(field_release:proto.ReportInGameRequest.potential_hit)
+  return _impl_.potential_hit_.Release();
+}
+inline void ReportInGameRequest::set_allocated_potential_hit(std::string* potential_hit) {
+  if (potential_hit != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.potential_hit_.SetAllocated(potential_hit, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.potential_hit_.IsDefault()) {
+    _impl_.potential_hit_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto.ReportInGameRequest.potential_hit)
+}
+
+// .proto.StatusEnum status_enum = 4;
+inline void ReportInGameRequest::clear_status_enum() {
+  _impl_.status_enum_ = 0;
+}
+inline ::proto::StatusEnum ReportInGameRequest::_internal_status_enum() const {
+  return static_cast< ::proto::StatusEnum >(_impl_.status_enum_);
+}
+inline ::proto::StatusEnum ReportInGameRequest::status_enum() const {
+  // @@protoc_insertion_point(field_get:proto.ReportInGameRequest.status_enum)
+  return _internal_status_enum();
+}
+inline void ReportInGameRequest::_internal_set_status_enum(::proto::StatusEnum value) {
+  
+  _impl_.status_enum_ = value;
+}
+inline void ReportInGameRequest::set_status_enum(::proto::StatusEnum value) {
+  _internal_set_status_enum(value);
+  // @@protoc_insertion_point(field_set:proto.ReportInGameRequest.status_enum)
+}
+
+// .proto.SpecialEffectParameter special_effect_boost = 5;
+inline bool ReportInGameRequest::_internal_has_special_effect_boost() const {
+  return this != internal_default_instance() && _impl_.special_effect_boost_ != nullptr;
+}
+inline bool ReportInGameRequest::has_special_effect_boost() const {
+  return _internal_has_special_effect_boost();
+}
+inline const ::proto::SpecialEffectParameter& ReportInGameRequest::_internal_special_effect_boost() const {
+  const ::proto::SpecialEffectParameter* p = _impl_.special_effect_boost_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto::SpecialEffectParameter&>(
+      ::proto::_SpecialEffectParameter_default_instance_);
+}
+inline const ::proto::SpecialEffectParameter& ReportInGameRequest::special_effect_boost() const {
+  // @@protoc_insertion_point(field_get:proto.ReportInGameRequest.special_effect_boost)
+  return _internal_special_effect_boost();
+}
+inline void ReportInGameRequest::unsafe_arena_set_allocated_special_effect_boost(
+    ::proto::SpecialEffectParameter* special_effect_boost) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.special_effect_boost_);
+  }
+  _impl_.special_effect_boost_ = special_effect_boost;
+  if (special_effect_boost) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto.ReportInGameRequest.special_effect_boost)
+}
+inline ::proto::SpecialEffectParameter* ReportInGameRequest::release_special_effect_boost() {
+  
+  ::proto::SpecialEffectParameter* temp = _impl_.special_effect_boost_;
+  _impl_.special_effect_boost_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::proto::SpecialEffectParameter* ReportInGameRequest::unsafe_arena_release_special_effect_boost() {
+  // @@protoc_insertion_point(field_release:proto.ReportInGameRequest.special_effect_boost)
+  
+  ::proto::SpecialEffectParameter* temp = _impl_.special_effect_boost_;
+  _impl_.special_effect_boost_ = nullptr;
+  return temp;
+}
+inline ::proto::SpecialEffectParameter* ReportInGameRequest::_internal_mutable_special_effect_boost() {
+  
+  if (_impl_.special_effect_boost_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto::SpecialEffectParameter>(GetArenaForAllocation());
+    _impl_.special_effect_boost_ = p;
+  }
+  return _impl_.special_effect_boost_;
+}
+inline ::proto::SpecialEffectParameter* ReportInGameRequest::mutable_special_effect_boost() {
+  ::proto::SpecialEffectParameter* _msg = _internal_mutable_special_effect_boost();
+  // @@protoc_insertion_point(field_mutable:proto.ReportInGameRequest.special_effect_boost)
+  return _msg;
+}
+inline void ReportInGameRequest::set_allocated_special_effect_boost(::proto::SpecialEffectParameter* special_effect_boost) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.special_effect_boost_);
+  }
+  if (special_effect_boost) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(special_effect_boost));
+    if (message_arena != submessage_arena) {
+      special_effect_boost = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, special_effect_boost, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.special_effect_boost_ = special_effect_boost;
+  // @@protoc_insertion_point(field_set_allocated:proto.ReportInGameRequest.special_effect_boost)
+}
+
+// uint64 acknowledged_sequence = 6;
+inline void ReportInGameRequest::clear_acknowledged_sequence() {
+  _impl_.acknowledged_sequence_ = uint64_t{0u};
+}
+inline uint64_t ReportInGameRequest::_internal_acknowledged_sequence() const {
+  return _impl_.acknowledged_sequence_;
+}
+inline uint64_t ReportInGameRequest::acknowledged_sequence() const {
+  // @@protoc_insertion_point(field_get:proto.ReportInGameRequest.acknowledged_sequence)
+  return _internal_acknowledged_sequence();
+}
+inline void ReportInGameRequest::_internal_set_acknowledged_sequence(uint64_t value) {
+  
+  _impl_.acknowledged_sequence_ = value;
+}
+inline void ReportInGameRequest::set_acknowledged_sequence(uint64_t value) {
+  _internal_set_acknowledged_sequence(value);
+  // @@protoc_insertion_point(field_set:proto.ReportInGameRequest.acknowledged_sequence)
+}
 
-  // @@protoc_insertion_point(class_scope:proto.PingResponse)
- private:
-  class _Internal;
+// repeated .proto.InputCommand input_commands = 7;
+inline int ReportInGameRequest::_internal_input_commands_size() const {
+  return _impl_.input_commands_.size();
+}
+inline int ReportInGameRequest::input_commands_size() const {
+  return _internal_input_commands_size();
+}
+inline void ReportInGameRequest::clear_input_commands() {
+  _impl_.input_commands_.Clear();
+}
+inline ::proto::InputCommand* ReportInGameRequest::mutable_input_commands(int index) {
+  // @@protoc_insertion_point(field_mutable:proto.ReportInGameRequest.input_commands)
+  return _impl_.input_commands_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::InputCommand >*
+ReportInGameRequest::mutable_input_commands() {
+  // @@protoc_insertion_point(field_mutable_list:proto.ReportInGameRequest.input_commands)
+  return &_impl_.input_commands_;
+}
+inline const ::proto::InputCommand& ReportInGameRequest::_internal_input_commands(int index) const {
+  return _impl_.input_commands_.Get(index);
+}
+inline const ::proto::InputCommand& ReportInGameRequest::input_commands(int index) const {
+  // @@protoc_insertion_point(field_get:proto.ReportInGameRequest.input_commands)
+  return _internal_input_commands(index);
+}
+inline ::proto::InputCommand* ReportInGameRequest::_internal_add_input_commands() {
+  return _impl_.input_commands_.Add();
+}
+inline ::proto::InputCommand* ReportInGameRequest::add_input_commands() {
+  ::proto::InputCommand* _add = _internal_add_input_commands();
+  // @@protoc_insertion_point(field_add:proto.ReportInGameRequest.input_commands)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::InputCommand >&
+ReportInGameRequest::input_commands() const {
+  // @@protoc_insertion_point(field_list:proto.ReportInGameRequest.input_commands)
+  return _impl_.input_commands_;
+}
 
-  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
-  typedef void InternalArenaConstructable_;
-  typedef void DestructorSkippable_;
-  struct Impl_ {
-    ::proto::PlayerParameter* player_parameter_;
-    double time_;
-    int32_t value_;
-    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_darwin_5fservice_2eproto;
-};
-// ===================================================================
+// -------------------------------------------------------------------
 
+// ReportInGameResponse
 
-// ===================================================================
+// -------------------------------------------------------------------
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// UpdateRequest
+// CreateCharacterRequest
 
 // string name = 1;
-inline void UpdateRequest::clear_name() {
+inline void CreateCharacterRequest::clear_name() {
   _impl_.name_.ClearToEmpty();
 }
-inline const std::string& UpdateRequest::name() const {
-  // @@protoc_insertion_point(field_get:proto.UpdateRequest.name)
+inline const std::string& CreateCharacterRequest::name() const {
+  // @@protoc_insertion_point(field_get:proto.CreateCharacterRequest.name)
   return _internal_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void UpdateRequest::set_name(ArgT0&& arg0, ArgT... args) {
+void CreateCharacterRequest::set_name(ArgT0&& arg0, ArgT... args) {
  
  _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:proto.UpdateRequest.name)
+  // @@protoc_insertion_point(field_set:proto.CreateCharacterRequest.name)
 }
-inline std::string* UpdateRequest::mutable_name() {
+inline std::string* CreateCharacterRequest::mutable_name() {
   std::string* _s = _internal_mutable_name();
-  // @@protoc_insertion_point(field_mutable:proto.UpdateRequest.name)
+  // @@protoc_insertion_point(field_mutable:proto.CreateCharacterRequest.name)
   return _s;
 }
-inline const std::string& UpdateRequest::_internal_name() const {
+inline const std::string& CreateCharacterRequest::_internal_name() const {
   return _impl_.name_.Get();
 }
-inline void UpdateRequest::_internal_set_name(const std::string& value) {
+inline void CreateCharacterRequest::_internal_set_name(const std::string& value) {
   
   _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* UpdateRequest::_internal_mutable_name() {
+inline std::string* CreateCharacterRequest::_internal_mutable_name() {
   
   return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* UpdateRequest::release_name() {
-  // @@protoc_insertion_point(field_release:proto.UpdateRequest.name)
+inline std::string* CreateCharacterRequest::release_name() {
+  // @@protoc_insertion_point(field_release:proto.CreateCharacterRequest.name)
   return _impl_.name_.Release();
 }
-inline void UpdateRequest::set_allocated_name(std::string* name) {
+inline void CreateCharacterRequest::set_allocated_name(std::string* name) {
   if (name != nullptr) {
     
   } else {
@@ -1470,194 +4634,548 @@ inline void UpdateRequest::set_allocated_name(std::string* name) {
     _impl_.name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:proto.UpdateRequest.name)
+  // @@protoc_insertion_point(field_set_allocated:proto.CreateCharacterRequest.name)
+}
+
+// .proto.Vector3 color = 2;
+inline bool CreateCharacterRequest::_internal_has_color() const {
+  return this != internal_default_instance() && _impl_.color_ != nullptr;
+}
+inline bool CreateCharacterRequest::has_color() const {
+  return _internal_has_color();
+}
+inline const ::proto::Vector3& CreateCharacterRequest::_internal_color() const {
+  const ::proto::Vector3* p = _impl_.color_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto::Vector3&>(
+      ::proto::_Vector3_default_instance_);
+}
+inline const ::proto::Vector3& CreateCharacterRequest::color() const {
+  // @@protoc_insertion_point(field_get:proto.CreateCharacterRequest.color)
+  return _internal_color();
+}
+inline void CreateCharacterRequest::unsafe_arena_set_allocated_color(
+    ::proto::Vector3* color) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.color_);
+  }
+  _impl_.color_ = color;
+  if (color) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto.CreateCharacterRequest.color)
+}
+inline ::proto::Vector3* CreateCharacterRequest::release_color() {
+  
+  ::proto::Vector3* temp = _impl_.color_;
+  _impl_.color_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::proto::Vector3* CreateCharacterRequest::unsafe_arena_release_color() {
+  // @@protoc_insertion_point(field_release:proto.CreateCharacterRequest.color)
+  
+  ::proto::Vector3* temp = _impl_.color_;
+  _impl_.color_ = nullptr;
+  return temp;
+}
+inline ::proto::Vector3* CreateCharacterRequest::_internal_mutable_color() {
+  
+  if (_impl_.color_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto::Vector3>(GetArenaForAllocation());
+    _impl_.color_ = p;
+  }
+  return _impl_.color_;
+}
+inline ::proto::Vector3* CreateCharacterRequest::mutable_color() {
+  ::proto::Vector3* _msg = _internal_mutable_color();
+  // @@protoc_insertion_point(field_mutable:proto.CreateCharacterRequest.color)
+  return _msg;
+}
+inline void CreateCharacterRequest::set_allocated_color(::proto::Vector3* color) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.color_);
+  }
+  if (color) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(color));
+    if (message_arena != submessage_arena) {
+      color = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, color, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.color_ = color;
+  // @@protoc_insertion_point(field_set_allocated:proto.CreateCharacterRequest.color)
 }
 
 // -------------------------------------------------------------------
 
-// UpdateResponse
+// CreateCharacterResponse
 
-// repeated .proto.Character characters = 1;
-inline int UpdateResponse::_internal_characters_size() const {
-  return _impl_.characters_.size();
+// .proto.ReturnEnum return_enum = 1;
+inline void CreateCharacterResponse::clear_return_enum() {
+  _impl_.return_enum_ = 0;
 }
-inline int UpdateResponse::characters_size() const {
-  return _internal_characters_size();
+inline ::proto::ReturnEnum CreateCharacterResponse::_internal_return_enum() const {
+  return static_cast< ::proto::ReturnEnum >(_impl_.return_enum_);
 }
-inline ::proto::Character* UpdateResponse::mutable_characters(int index) {
-  // @@protoc_insertion_point(field_mutable:proto.UpdateResponse.characters)
-  return _impl_.characters_.Mutable(index);
+inline ::proto::ReturnEnum CreateCharacterResponse::return_enum() const {
+  // @@protoc_insertion_point(field_get:proto.CreateCharacterResponse.return_enum)
+  return _internal_return_enum();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Character >*
-UpdateResponse::mutable_characters() {
-  // @@protoc_insertion_point(field_mutable_list:proto.UpdateResponse.characters)
-  return &_impl_.characters_;
+inline void CreateCharacterResponse::_internal_set_return_enum(::proto::ReturnEnum value) {
+  
+  _impl_.return_enum_ = value;
 }
-inline const ::proto::Character& UpdateResponse::_internal_characters(int index) const {
-  return _impl_.characters_.Get(index);
+inline void CreateCharacterResponse::set_return_enum(::proto::ReturnEnum value) {
+  _internal_set_return_enum(value);
+  // @@protoc_insertion_point(field_set:proto.CreateCharacterResponse.return_enum)
 }
-inline const ::proto::Character& UpdateResponse::characters(int index) const {
-  // @@protoc_insertion_point(field_get:proto.UpdateResponse.characters)
-  return _internal_characters(index);
+
+// -------------------------------------------------------------------
+
+// PingRequest
+
+// int32 value = 1;
+inline void PingRequest::clear_value() {
+  _impl_.value_ = 0;
+}
+inline int32_t PingRequest::_internal_value() const {
+  return _impl_.value_;
+}
+inline int32_t PingRequest::value() const {
+  // @@protoc_insertion_point(field_get:proto.PingRequest.value)
+  return _internal_value();
+}
+inline void PingRequest::_internal_set_value(int32_t value) {
+  
+  _impl_.value_ = value;
+}
+inline void PingRequest::set_value(int32_t value) {
+  _internal_set_value(value);
+  // @@protoc_insertion_point(field_set:proto.PingRequest.value)
+}
+
+// -------------------------------------------------------------------
+
+// TickStatistics
+
+// double step_p50 = 1;
+inline void TickStatistics::clear_step_p50() {
+  _impl_.step_p50_ = 0;
+}
+inline double TickStatistics::_internal_step_p50() const {
+  return _impl_.step_p50_;
+}
+inline double TickStatistics::step_p50() const {
+  // @@protoc_insertion_point(field_get:proto.TickStatistics.step_p50)
+  return _internal_step_p50();
+}
+inline void TickStatistics::_internal_set_step_p50(double value) {
+  
+  _impl_.step_p50_ = value;
+}
+inline void TickStatistics::set_step_p50(double value) {
+  _internal_set_step_p50(value);
+  // @@protoc_insertion_point(field_set:proto.TickStatistics.step_p50)
+}
+
+// double step_p99 = 2;
+inline void TickStatistics::clear_step_p99() {
+  _impl_.step_p99_ = 0;
+}
+inline double TickStatistics::_internal_step_p99() const {
+  return _impl_.step_p99_;
+}
+inline double TickStatistics::step_p99() const {
+  // @@protoc_insertion_point(field_get:proto.TickStatistics.step_p99)
+  return _internal_step_p99();
+}
+inline void TickStatistics::_internal_set_step_p99(double value) {
+  
+  _impl_.step_p99_ = value;
+}
+inline void TickStatistics::set_step_p99(double value) {
+  _internal_set_step_p99(value);
+  // @@protoc_insertion_point(field_set:proto.TickStatistics.step_p99)
+}
+
+// double step_max = 3;
+inline void TickStatistics::clear_step_max() {
+  _impl_.step_max_ = 0;
+}
+inline double TickStatistics::_internal_step_max() const {
+  return _impl_.step_max_;
+}
+inline double TickStatistics::step_max() const {
+  // @@protoc_insertion_point(field_get:proto.TickStatistics.step_max)
+  return _internal_step_max();
+}
+inline void TickStatistics::_internal_set_step_max(double value) {
+  
+  _impl_.step_max_ = value;
+}
+inline void TickStatistics::set_step_max(double value) {
+  _internal_set_step_max(value);
+  // @@protoc_insertion_point(field_set:proto.TickStatistics.step_max)
+}
+
+// double broadcast_p50 = 4;
+inline void TickStatistics::clear_broadcast_p50() {
+  _impl_.broadcast_p50_ = 0;
+}
+inline double TickStatistics::_internal_broadcast_p50() const {
+  return _impl_.broadcast_p50_;
+}
+inline double TickStatistics::broadcast_p50() const {
+  // @@protoc_insertion_point(field_get:proto.TickStatistics.broadcast_p50)
+  return _internal_broadcast_p50();
+}
+inline void TickStatistics::_internal_set_broadcast_p50(double value) {
+  
+  _impl_.broadcast_p50_ = value;
+}
+inline void TickStatistics::set_broadcast_p50(double value) {
+  _internal_set_broadcast_p50(value);
+  // @@protoc_insertion_point(field_set:proto.TickStatistics.broadcast_p50)
+}
+
+// double broadcast_p99 = 5;
+inline void TickStatistics::clear_broadcast_p99() {
+  _impl_.broadcast_p99_ = 0;
 }
-inline ::proto::Character* UpdateResponse::_internal_add_characters() {
-  return _impl_.characters_.Add();
+inline double TickStatistics::_internal_broadcast_p99() const {
+  return _impl_.broadcast_p99_;
 }
-inline ::proto::Character* UpdateResponse::add_characters() {
-  ::proto::Character* _add = _internal_add_characters();
-  // @@protoc_insertion_point(field_add:proto.UpdateResponse.characters)
-  return _add;
+inline double TickStatistics::broadcast_p99() const {
+  // @@protoc_insertion_point(field_get:proto.TickStatistics.broadcast_p99)
+  return _internal_broadcast_p99();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Character >&
-UpdateResponse::characters() const {
-  // @@protoc_insertion_point(field_list:proto.UpdateResponse.characters)
-  return _impl_.characters_;
+inline void TickStatistics::_internal_set_broadcast_p99(double value) {
+  
+  _impl_.broadcast_p99_ = value;
+}
+inline void TickStatistics::set_broadcast_p99(double value) {
+  _internal_set_broadcast_p99(value);
+  // @@protoc_insertion_point(field_set:proto.TickStatistics.broadcast_p99)
 }
 
-// repeated .proto.Element elements = 2;
-inline int UpdateResponse::_internal_elements_size() const {
-  return _impl_.elements_.size();
+// double broadcast_max = 6;
+inline void TickStatistics::clear_broadcast_max() {
+  _impl_.broadcast_max_ = 0;
 }
-inline int UpdateResponse::elements_size() const {
-  return _internal_elements_size();
+inline double TickStatistics::_internal_broadcast_max() const {
+  return _impl_.broadcast_max_;
 }
-inline ::proto::Element* UpdateResponse::mutable_elements(int index) {
-  // @@protoc_insertion_point(field_mutable:proto.UpdateResponse.elements)
-  return _impl_.elements_.Mutable(index);
+inline double TickStatistics::broadcast_max() const {
+  // @@protoc_insertion_point(field_get:proto.TickStatistics.broadcast_max)
+  return _internal_broadcast_max();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Element >*
-UpdateResponse::mutable_elements() {
-  // @@protoc_insertion_point(field_mutable_list:proto.UpdateResponse.elements)
-  return &_impl_.elements_;
+inline void TickStatistics::_internal_set_broadcast_max(double value) {
+  
+  _impl_.broadcast_max_ = value;
 }
-inline const ::proto::Element& UpdateResponse::_internal_elements(int index) const {
-  return _impl_.elements_.Get(index);
+inline void TickStatistics::set_broadcast_max(double value) {
+  _internal_set_broadcast_max(value);
+  // @@protoc_insertion_point(field_set:proto.TickStatistics.broadcast_max)
 }
-inline const ::proto::Element& UpdateResponse::elements(int index) const {
-  // @@protoc_insertion_point(field_get:proto.UpdateResponse.elements)
-  return _internal_elements(index);
+
+// -------------------------------------------------------------------
+
+// PingResponse
+
+// int32 value = 1;
+inline void PingResponse::clear_value() {
+  _impl_.value_ = 0;
 }
-inline ::proto::Element* UpdateResponse::_internal_add_elements() {
-  return _impl_.elements_.Add();
+inline int32_t PingResponse::_internal_value() const {
+  return _impl_.value_;
 }
-inline ::proto::Element* UpdateResponse::add_elements() {
-  ::proto::Element* _add = _internal_add_elements();
-  // @@protoc_insertion_point(field_add:proto.UpdateResponse.elements)
-  return _add;
+inline int32_t PingResponse::value() const {
+  // @@protoc_insertion_point(field_get:proto.PingResponse.value)
+  return _internal_value();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Element >&
-UpdateResponse::elements() const {
-  // @@protoc_insertion_point(field_list:proto.UpdateResponse.elements)
-  return _impl_.elements_;
+inline void PingResponse::_internal_set_value(int32_t value) {
+  
+  _impl_.value_ = value;
+}
+inline void PingResponse::set_value(int32_t value) {
+  _internal_set_value(value);
+  // @@protoc_insertion_point(field_set:proto.PingResponse.value)
 }
 
-// double time = 3;
-inline void UpdateResponse::clear_time() {
+// double time = 2;
+inline void PingResponse::clear_time() {
   _impl_.time_ = 0;
 }
-inline double UpdateResponse::_internal_time() const {
+inline double PingResponse::_internal_time() const {
   return _impl_.time_;
 }
-inline double UpdateResponse::time() const {
-  // @@protoc_insertion_point(field_get:proto.UpdateResponse.time)
+inline double PingResponse::time() const {
+  // @@protoc_insertion_point(field_get:proto.PingResponse.time)
   return _internal_time();
 }
-inline void UpdateResponse::_internal_set_time(double value) {
+inline void PingResponse::_internal_set_time(double value) {
   
   _impl_.time_ = value;
 }
-inline void UpdateResponse::set_time(double value) {
+inline void PingResponse::set_time(double value) {
   _internal_set_time(value);
-  // @@protoc_insertion_point(field_set:proto.UpdateResponse.time)
+  // @@protoc_insertion_point(field_set:proto.PingResponse.time)
 }
 
-// -------------------------------------------------------------------
-
-// ReportInGameRequest
-
-// string name = 1;
-inline void ReportInGameRequest::clear_name() {
-  _impl_.name_.ClearToEmpty();
+// .proto.PlayerParameter player_parameter = 3;
+inline bool PingResponse::_internal_has_player_parameter() const {
+  return this != internal_default_instance() && _impl_.player_parameter_ != nullptr;
 }
-inline const std::string& ReportInGameRequest::name() const {
-  // @@protoc_insertion_point(field_get:proto.ReportInGameRequest.name)
-  return _internal_name();
+inline bool PingResponse::has_player_parameter() const {
+  return _internal_has_player_parameter();
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void ReportInGameRequest::set_name(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:proto.ReportInGameRequest.name)
+inline const ::proto::PlayerParameter& PingResponse::_internal_player_parameter() const {
+  const ::proto::PlayerParameter* p = _impl_.player_parameter_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto::PlayerParameter&>(
+      ::proto::_PlayerParameter_default_instance_);
 }
-inline std::string* ReportInGameRequest::mutable_name() {
-  std::string* _s = _internal_mutable_name();
-  // @@protoc_insertion_point(field_mutable:proto.ReportInGameRequest.name)
-  return _s;
+inline const ::proto::PlayerParameter& PingResponse::player_parameter() const {
+  // @@protoc_insertion_point(field_get:proto.PingResponse.player_parameter)
+  return _internal_player_parameter();
 }
-inline const std::string& ReportInGameRequest::_internal_name() const {
-  return _impl_.name_.Get();
+inline void PingResponse::unsafe_arena_set_allocated_player_parameter(
+    ::proto::PlayerParameter* player_parameter) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.player_parameter_);
+  }
+  _impl_.player_parameter_ = player_parameter;
+  if (player_parameter) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto.PingResponse.player_parameter)
 }
-inline void ReportInGameRequest::_internal_set_name(const std::string& value) {
+inline ::proto::PlayerParameter* PingResponse::release_player_parameter() {
   
-  _impl_.name_.Set(value, GetArenaForAllocation());
+  ::proto::PlayerParameter* temp = _impl_.player_parameter_;
+  _impl_.player_parameter_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline std::string* ReportInGameRequest::_internal_mutable_name() {
+inline ::proto::PlayerParameter* PingResponse::unsafe_arena_release_player_parameter() {
+  // @@protoc_insertion_point(field_release:proto.PingResponse.player_parameter)
   
-  return _impl_.name_.Mutable(GetArenaForAllocation());
+  ::proto::PlayerParameter* temp = _impl_.player_parameter_;
+  _impl_.player_parameter_ = nullptr;
+  return temp;
 }
-inline std::string* ReportInGameRequest::release_name() {
-  // @@protoc_insertion_point(field_release:proto.ReportInGameRequest.name)
-  return _impl_.name_.Release();
+inline ::proto::PlayerParameter* PingResponse::_internal_mutable_player_parameter() {
+  
+  if (_impl_.player_parameter_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto::PlayerParameter>(GetArenaForAllocation());
+    _impl_.player_parameter_ = p;
+  }
+  return _impl_.player_parameter_;
 }
-inline void ReportInGameRequest::set_allocated_name(std::string* name) {
-  if (name != nullptr) {
+inline ::proto::PlayerParameter* PingResponse::mutable_player_parameter() {
+  ::proto::PlayerParameter* _msg = _internal_mutable_player_parameter();
+  // @@protoc_insertion_point(field_mutable:proto.PingResponse.player_parameter)
+  return _msg;
+}
+inline void PingResponse::set_allocated_player_parameter(::proto::PlayerParameter* player_parameter) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.player_parameter_);
+  }
+  if (player_parameter) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(player_parameter));
+    if (message_arena != submessage_arena) {
+      player_parameter = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, player_parameter, submessage_arena);
+    }
     
   } else {
     
   }
-  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.name_.IsDefault()) {
-    _impl_.name_.Set("", GetArenaForAllocation());
+  _impl_.player_parameter_ = player_parameter;
+  // @@protoc_insertion_point(field_set_allocated:proto.PingResponse.player_parameter)
+}
+
+// .proto.TickStatistics tick_statistics = 4;
+inline bool PingResponse::_internal_has_tick_statistics() const {
+  return this != internal_default_instance() && _impl_.tick_statistics_ != nullptr;
+}
+inline bool PingResponse::has_tick_statistics() const {
+  return _internal_has_tick_statistics();
+}
+inline void PingResponse::clear_tick_statistics() {
+  if (GetArenaForAllocation() == nullptr && _impl_.tick_statistics_ != nullptr) {
+    delete _impl_.tick_statistics_;
   }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:proto.ReportInGameRequest.name)
+  _impl_.tick_statistics_ = nullptr;
+}
+inline const ::proto::TickStatistics& PingResponse::_internal_tick_statistics() const {
+  const ::proto::TickStatistics* p = _impl_.tick_statistics_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto::TickStatistics&>(
+      ::proto::_TickStatistics_default_instance_);
+}
+inline const ::proto::TickStatistics& PingResponse::tick_statistics() const {
+  // @@protoc_insertion_point(field_get:proto.PingResponse.tick_statistics)
+  return _internal_tick_statistics();
+}
+inline void PingResponse::unsafe_arena_set_allocated_tick_statistics(
+    ::proto::TickStatistics* tick_statistics) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.tick_statistics_);
+  }
+  _impl_.tick_statistics_ = tick_statistics;
+  if (tick_statistics) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto.PingResponse.tick_statistics)
+}
+inline ::proto::TickStatistics* PingResponse::release_tick_statistics() {
+  
+  ::proto::TickStatistics* temp = _impl_.tick_statistics_;
+  _impl_.tick_statistics_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::proto::TickStatistics* PingResponse::unsafe_arena_release_tick_statistics() {
+  // @@protoc_insertion_point(field_release:proto.PingResponse.tick_statistics)
+  
+  ::proto::TickStatistics* temp = _impl_.tick_statistics_;
+  _impl_.tick_statistics_ = nullptr;
+  return temp;
+}
+inline ::proto::TickStatistics* PingResponse::_internal_mutable_tick_statistics() {
+  
+  if (_impl_.tick_statistics_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto::TickStatistics>(GetArenaForAllocation());
+    _impl_.tick_statistics_ = p;
+  }
+  return _impl_.tick_statistics_;
+}
+inline ::proto::TickStatistics* PingResponse::mutable_tick_statistics() {
+  ::proto::TickStatistics* _msg = _internal_mutable_tick_statistics();
+  // @@protoc_insertion_point(field_mutable:proto.PingResponse.tick_statistics)
+  return _msg;
+}
+inline void PingResponse::set_allocated_tick_statistics(::proto::TickStatistics* tick_statistics) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.tick_statistics_;
+  }
+  if (tick_statistics) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(tick_statistics);
+    if (message_arena != submessage_arena) {
+      tick_statistics = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, tick_statistics, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.tick_statistics_ = tick_statistics;
+  // @@protoc_insertion_point(field_set_allocated:proto.PingResponse.tick_statistics)
 }
 
-// .proto.Physic physic = 2;
-inline bool ReportInGameRequest::_internal_has_physic() const {
-  return this != internal_default_instance() && _impl_.physic_ != nullptr;
+// -------------------------------------------------------------------
+
+// PlayRequest
+
+// uint64 sequence = 1;
+inline void PlayRequest::clear_sequence() {
+  _impl_.sequence_ = uint64_t{0u};
 }
-inline bool ReportInGameRequest::has_physic() const {
-  return _internal_has_physic();
+inline uint64_t PlayRequest::_internal_sequence() const {
+  return _impl_.sequence_;
 }
-inline const ::proto::Physic& ReportInGameRequest::_internal_physic() const {
-  const ::proto::Physic* p = _impl_.physic_;
-  return p != nullptr ? *p : reinterpret_cast<const ::proto::Physic&>(
-      ::proto::_Physic_default_instance_);
+inline uint64_t PlayRequest::sequence() const {
+  // @@protoc_insertion_point(field_get:proto.PlayRequest.sequence)
+  return _internal_sequence();
 }
-inline const ::proto::Physic& ReportInGameRequest::physic() const {
-  // @@protoc_insertion_point(field_get:proto.ReportInGameRequest.physic)
-  return _internal_physic();
+inline void PlayRequest::_internal_set_sequence(uint64_t value) {
+  
+  _impl_.sequence_ = value;
 }
-inline void ReportInGameRequest::unsafe_arena_set_allocated_physic(
-    ::proto::Physic* physic) {
+inline void PlayRequest::set_sequence(uint64_t value) {
+  _internal_set_sequence(value);
+  // @@protoc_insertion_point(field_set:proto.PlayRequest.sequence)
+}
+
+// .proto.UpdateRequest update_request = 2;
+inline bool PlayRequest::_internal_has_update_request() const {
+  return this != internal_default_instance() && _impl_.update_request_ != nullptr;
+}
+inline bool PlayRequest::has_update_request() const {
+  return _internal_has_update_request();
+}
+inline void PlayRequest::clear_update_request() {
+  if (GetArenaForAllocation() == nullptr && _impl_.update_request_ != nullptr) {
+    delete _impl_.update_request_;
+  }
+  _impl_.update_request_ = nullptr;
+}
+inline const ::proto::UpdateRequest& PlayRequest::_internal_update_request() const {
+  const ::proto::UpdateRequest* p = _impl_.update_request_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto::UpdateRequest&>(
+      ::proto::_UpdateRequest_default_instance_);
+}
+inline const ::proto::UpdateRequest& PlayRequest::update_request() const {
+  // @@protoc_insertion_point(field_get:proto.PlayRequest.update_request)
+  return _internal_update_request();
+}
+inline void PlayRequest::unsafe_arena_set_allocated_update_request(
+    ::proto::UpdateRequest* update_request) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.physic_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.update_request_);
   }
-  _impl_.physic_ = physic;
-  if (physic) {
+  _impl_.update_request_ = update_request;
+  if (update_request) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto.ReportInGameRequest.physic)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto.PlayRequest.update_request)
 }
-inline ::proto::Physic* ReportInGameRequest::release_physic() {
+inline ::proto::UpdateRequest* PlayRequest::release_update_request() {
   
-  ::proto::Physic* temp = _impl_.physic_;
-  _impl_.physic_ = nullptr;
+  ::proto::UpdateRequest* temp = _impl_.update_request_;
+  _impl_.update_request_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -1669,150 +5187,199 @@ inline ::proto::Physic* ReportInGameRequest::release_physic() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::proto::Physic* ReportInGameRequest::unsafe_arena_release_physic() {
-  // @@protoc_insertion_point(field_release:proto.ReportInGameRequest.physic)
+inline ::proto::UpdateRequest* PlayRequest::unsafe_arena_release_update_request() {
+  // @@protoc_insertion_point(field_release:proto.PlayRequest.update_request)
   
-  ::proto::Physic* temp = _impl_.physic_;
-  _impl_.physic_ = nullptr;
+  ::proto::UpdateRequest* temp = _impl_.update_request_;
+  _impl_.update_request_ = nullptr;
   return temp;
 }
-inline ::proto::Physic* ReportInGameRequest::_internal_mutable_physic() {
+inline ::proto::UpdateRequest* PlayRequest::_internal_mutable_update_request() {
   
-  if (_impl_.physic_ == nullptr) {
-    auto* p = CreateMaybeMessage<::proto::Physic>(GetArenaForAllocation());
-    _impl_.physic_ = p;
+  if (_impl_.update_request_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto::UpdateRequest>(GetArenaForAllocation());
+    _impl_.update_request_ = p;
   }
-  return _impl_.physic_;
+  return _impl_.update_request_;
 }
-inline ::proto::Physic* ReportInGameRequest::mutable_physic() {
-  ::proto::Physic* _msg = _internal_mutable_physic();
-  // @@protoc_insertion_point(field_mutable:proto.ReportInGameRequest.physic)
+inline ::proto::UpdateRequest* PlayRequest::mutable_update_request() {
+  ::proto::UpdateRequest* _msg = _internal_mutable_update_request();
+  // @@protoc_insertion_point(field_mutable:proto.PlayRequest.update_request)
   return _msg;
 }
-inline void ReportInGameRequest::set_allocated_physic(::proto::Physic* physic) {
+inline void PlayRequest::set_allocated_update_request(::proto::UpdateRequest* update_request) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.physic_);
+    delete _impl_.update_request_;
   }
-  if (physic) {
+  if (update_request) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(physic));
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(update_request);
     if (message_arena != submessage_arena) {
-      physic = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, physic, submessage_arena);
+      update_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, update_request, submessage_arena);
     }
     
   } else {
     
   }
-  _impl_.physic_ = physic;
-  // @@protoc_insertion_point(field_set_allocated:proto.ReportInGameRequest.physic)
+  _impl_.update_request_ = update_request;
+  // @@protoc_insertion_point(field_set_allocated:proto.PlayRequest.update_request)
 }
 
-// string potential_hit = 3;
-inline void ReportInGameRequest::clear_potential_hit() {
-  _impl_.potential_hit_.ClearToEmpty();
+// .proto.ReportInGameRequest report = 3;
+inline bool PlayRequest::_internal_has_report() const {
+  return this != internal_default_instance() && _impl_.report_ != nullptr;
 }
-inline const std::string& ReportInGameRequest::potential_hit() const {
-  // @@protoc_insertion_point(field_get:proto.ReportInGameRequest.potential_hit)
-  return _internal_potential_hit();
+inline bool PlayRequest::has_report() const {
+  return _internal_has_report();
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void ReportInGameRequest::set_potential_hit(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.potential_hit_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:proto.ReportInGameRequest.potential_hit)
+inline void PlayRequest::clear_report() {
+  if (GetArenaForAllocation() == nullptr && _impl_.report_ != nullptr) {
+    delete _impl_.report_;
+  }
+  _impl_.report_ = nullptr;
 }
-inline std::string* ReportInGameRequest::mutable_potential_hit() {
-  std::string* _s = _internal_mutable_potential_hit();
-  // @@protoc_insertion_point(field_mutable:proto.ReportInGameRequest.potential_hit)
-  return _s;
+inline const ::proto::ReportInGameRequest& PlayRequest::_internal_report() const {
+  const ::proto::ReportInGameRequest* p = _impl_.report_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto::ReportInGameRequest&>(
+      ::proto::_ReportInGameRequest_default_instance_);
 }
-inline const std::string& ReportInGameRequest::_internal_potential_hit() const {
-  return _impl_.potential_hit_.Get();
+inline const ::proto::ReportInGameRequest& PlayRequest::report() const {
+  // @@protoc_insertion_point(field_get:proto.PlayRequest.report)
+  return _internal_report();
 }
-inline void ReportInGameRequest::_internal_set_potential_hit(const std::string& value) {
+inline void PlayRequest::unsafe_arena_set_allocated_report(
+    ::proto::ReportInGameRequest* report) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.report_);
+  }
+  _impl_.report_ = report;
+  if (report) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto.PlayRequest.report)
+}
+inline ::proto::ReportInGameRequest* PlayRequest::release_report() {
   
-  _impl_.potential_hit_.Set(value, GetArenaForAllocation());
+  ::proto::ReportInGameRequest* temp = _impl_.report_;
+  _impl_.report_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline std::string* ReportInGameRequest::_internal_mutable_potential_hit() {
+inline ::proto::ReportInGameRequest* PlayRequest::unsafe_arena_release_report() {
+  // @@protoc_insertion_point(field_release:proto.PlayRequest.report)
   
-  return _impl_.potential_hit_.Mutable(GetArenaForAllocation());
+  ::proto::ReportInGameRequest* temp = _impl_.report_;
+  _impl_.report_ = nullptr;
+  return temp;
 }
-inline std::string* ReportInGameRequest::release_potential_hit() {
-  // @@protoc_insertion_point(field_release:proto.ReportInGameRequest.potential_hit)
-  return _impl_.potential_hit_.Release();
+inline ::proto::ReportInGameRequest* PlayRequest::_internal_mutable_report() {
+  
+  if (_impl_.report_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto::ReportInGameRequest>(GetArenaForAllocation());
+    _impl_.report_ = p;
+  }
+  return _impl_.report_;
 }
-inline void ReportInGameRequest::set_allocated_potential_hit(std::string* potential_hit) {
-  if (potential_hit != nullptr) {
+inline ::proto::ReportInGameRequest* PlayRequest::mutable_report() {
+  ::proto::ReportInGameRequest* _msg = _internal_mutable_report();
+  // @@protoc_insertion_point(field_mutable:proto.PlayRequest.report)
+  return _msg;
+}
+inline void PlayRequest::set_allocated_report(::proto::ReportInGameRequest* report) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.report_;
+  }
+  if (report) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(report);
+    if (message_arena != submessage_arena) {
+      report = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, report, submessage_arena);
+    }
     
   } else {
     
   }
-  _impl_.potential_hit_.SetAllocated(potential_hit, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.potential_hit_.IsDefault()) {
-    _impl_.potential_hit_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:proto.ReportInGameRequest.potential_hit)
+  _impl_.report_ = report;
+  // @@protoc_insertion_point(field_set_allocated:proto.PlayRequest.report)
 }
 
-// .proto.StatusEnum status_enum = 4;
-inline void ReportInGameRequest::clear_status_enum() {
-  _impl_.status_enum_ = 0;
+// -------------------------------------------------------------------
+
+// PlayResponse
+
+// uint64 report_sequence = 1;
+inline void PlayResponse::clear_report_sequence() {
+  _impl_.report_sequence_ = uint64_t{0u};
 }
-inline ::proto::StatusEnum ReportInGameRequest::_internal_status_enum() const {
-  return static_cast< ::proto::StatusEnum >(_impl_.status_enum_);
+inline uint64_t PlayResponse::_internal_report_sequence() const {
+  return _impl_.report_sequence_;
 }
-inline ::proto::StatusEnum ReportInGameRequest::status_enum() const {
-  // @@protoc_insertion_point(field_get:proto.ReportInGameRequest.status_enum)
-  return _internal_status_enum();
+inline uint64_t PlayResponse::report_sequence() const {
+  // @@protoc_insertion_point(field_get:proto.PlayResponse.report_sequence)
+  return _internal_report_sequence();
 }
-inline void ReportInGameRequest::_internal_set_status_enum(::proto::StatusEnum value) {
+inline void PlayResponse::_internal_set_report_sequence(uint64_t value) {
   
-  _impl_.status_enum_ = value;
+  _impl_.report_sequence_ = value;
 }
-inline void ReportInGameRequest::set_status_enum(::proto::StatusEnum value) {
-  _internal_set_status_enum(value);
-  // @@protoc_insertion_point(field_set:proto.ReportInGameRequest.status_enum)
+inline void PlayResponse::set_report_sequence(uint64_t value) {
+  _internal_set_report_sequence(value);
+  // @@protoc_insertion_point(field_set:proto.PlayResponse.report_sequence)
 }
 
-// .proto.SpecialEffectParameter special_effect_boost = 5;
-inline bool ReportInGameRequest::_internal_has_special_effect_boost() const {
-  return this != internal_default_instance() && _impl_.special_effect_boost_ != nullptr;
+// .proto.UpdateResponse update = 2;
+inline bool PlayResponse::_internal_has_update() const {
+  return this != internal_default_instance() && _impl_.update_ != nullptr;
 }
-inline bool ReportInGameRequest::has_special_effect_boost() const {
-  return _internal_has_special_effect_boost();
+inline bool PlayResponse::has_update() const {
+  return _internal_has_update();
 }
-inline const ::proto::SpecialEffectParameter& ReportInGameRequest::_internal_special_effect_boost() const {
-  const ::proto::SpecialEffectParameter* p = _impl_.special_effect_boost_;
-  return p != nullptr ? *p : reinterpret_cast<const ::proto::SpecialEffectParameter&>(
-      ::proto::_SpecialEffectParameter_default_instance_);
+inline void PlayResponse::clear_update() {
+  if (GetArenaForAllocation() == nullptr && _impl_.update_ != nullptr) {
+    delete _impl_.update_;
+  }
+  _impl_.update_ = nullptr;
 }
-inline const ::proto::SpecialEffectParameter& ReportInGameRequest::special_effect_boost() const {
-  // @@protoc_insertion_point(field_get:proto.ReportInGameRequest.special_effect_boost)
-  return _internal_special_effect_boost();
+inline const ::proto::UpdateResponse& PlayResponse::_internal_update() const {
+  const ::proto::UpdateResponse* p = _impl_.update_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto::UpdateResponse&>(
+      ::proto::_UpdateResponse_default_instance_);
 }
-inline void ReportInGameRequest::unsafe_arena_set_allocated_special_effect_boost(
-    ::proto::SpecialEffectParameter* special_effect_boost) {
+inline const ::proto::UpdateResponse& PlayResponse::update() const {
+  // @@protoc_insertion_point(field_get:proto.PlayResponse.update)
+  return _internal_update();
+}
+inline void PlayResponse::unsafe_arena_set_allocated_update(
+    ::proto::UpdateResponse* update) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.special_effect_boost_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.update_);
   }
-  _impl_.special_effect_boost_ = special_effect_boost;
-  if (special_effect_boost) {
+  _impl_.update_ = update;
+  if (update) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto.ReportInGameRequest.special_effect_boost)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto.PlayResponse.update)
 }
-inline ::proto::SpecialEffectParameter* ReportInGameRequest::release_special_effect_boost() {
+inline ::proto::UpdateResponse* PlayResponse::release_update() {
   
-  ::proto::SpecialEffectParameter* temp = _impl_.special_effect_boost_;
-  _impl_.special_effect_boost_ = nullptr;
+  ::proto::UpdateResponse* temp = _impl_.update_;
+  _impl_.update_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -1824,138 +5391,269 @@ inline ::proto::SpecialEffectParameter* ReportInGameRequest::release_special_eff
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::proto::SpecialEffectParameter* ReportInGameRequest::unsafe_arena_release_special_effect_boost() {
-  // @@protoc_insertion_point(field_release:proto.ReportInGameRequest.special_effect_boost)
+inline ::proto::UpdateResponse* PlayResponse::unsafe_arena_release_update() {
+  // @@protoc_insertion_point(field_release:proto.PlayResponse.update)
   
-  ::proto::SpecialEffectParameter* temp = _impl_.special_effect_boost_;
-  _impl_.special_effect_boost_ = nullptr;
+  ::proto::UpdateResponse* temp = _impl_.update_;
+  _impl_.update_ = nullptr;
   return temp;
 }
-inline ::proto::SpecialEffectParameter* ReportInGameRequest::_internal_mutable_special_effect_boost() {
+inline ::proto::UpdateResponse* PlayResponse::_internal_mutable_update() {
   
-  if (_impl_.special_effect_boost_ == nullptr) {
-    auto* p = CreateMaybeMessage<::proto::SpecialEffectParameter>(GetArenaForAllocation());
-    _impl_.special_effect_boost_ = p;
+  if (_impl_.update_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto::UpdateResponse>(GetArenaForAllocation());
+    _impl_.update_ = p;
   }
-  return _impl_.special_effect_boost_;
+  return _impl_.update_;
 }
-inline ::proto::SpecialEffectParameter* ReportInGameRequest::mutable_special_effect_boost() {
-  ::proto::SpecialEffectParameter* _msg = _internal_mutable_special_effect_boost();
-  // @@protoc_insertion_point(field_mutable:proto.ReportInGameRequest.special_effect_boost)
+inline ::proto::UpdateResponse* PlayResponse::mutable_update() {
+  ::proto::UpdateResponse* _msg = _internal_mutable_update();
+  // @@protoc_insertion_point(field_mutable:proto.PlayResponse.update)
   return _msg;
 }
-inline void ReportInGameRequest::set_allocated_special_effect_boost(::proto::SpecialEffectParameter* special_effect_boost) {
+inline void PlayResponse::set_allocated_update(::proto::UpdateResponse* update) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.special_effect_boost_);
+    delete _impl_.update_;
   }
-  if (special_effect_boost) {
+  if (update) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(special_effect_boost));
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(update);
     if (message_arena != submessage_arena) {
-      special_effect_boost = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, special_effect_boost, submessage_arena);
+      update = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, update, submessage_arena);
     }
     
   } else {
     
   }
-  _impl_.special_effect_boost_ = special_effect_boost;
-  // @@protoc_insertion_point(field_set_allocated:proto.ReportInGameRequest.special_effect_boost)
+  _impl_.update_ = update;
+  // @@protoc_insertion_point(field_set_allocated:proto.PlayResponse.update)
 }
 
 // -------------------------------------------------------------------
 
-// ReportInGameResponse
+// RecordedEvent
 
-// -------------------------------------------------------------------
+// double time = 1;
+inline void RecordedEvent::clear_time() {
+  _impl_.time_ = 0;
+}
+inline double RecordedEvent::_internal_time() const {
+  return _impl_.time_;
+}
+inline double RecordedEvent::time() const {
+  // @@protoc_insertion_point(field_get:proto.RecordedEvent.time)
+  return _internal_time();
+}
+inline void RecordedEvent::_internal_set_time(double value) {
+  
+  _impl_.time_ = value;
+}
+inline void RecordedEvent::set_time(double value) {
+  _internal_set_time(value);
+  // @@protoc_insertion_point(field_set:proto.RecordedEvent.time)
+}
 
-// CreateCharacterRequest
+// .proto.RecordedEventEnum recorded_event_enum = 2;
+inline void RecordedEvent::clear_recorded_event_enum() {
+  _impl_.recorded_event_enum_ = 0;
+}
+inline ::proto::RecordedEventEnum RecordedEvent::_internal_recorded_event_enum() const {
+  return static_cast< ::proto::RecordedEventEnum >(_impl_.recorded_event_enum_);
+}
+inline ::proto::RecordedEventEnum RecordedEvent::recorded_event_enum() const {
+  // @@protoc_insertion_point(field_get:proto.RecordedEvent.recorded_event_enum)
+  return _internal_recorded_event_enum();
+}
+inline void RecordedEvent::_internal_set_recorded_event_enum(::proto::RecordedEventEnum value) {
+  
+  _impl_.recorded_event_enum_ = value;
+}
+inline void RecordedEvent::set_recorded_event_enum(::proto::RecordedEventEnum value) {
+  _internal_set_recorded_event_enum(value);
+  // @@protoc_insertion_point(field_set:proto.RecordedEvent.recorded_event_enum)
+}
 
-// string name = 1;
-inline void CreateCharacterRequest::clear_name() {
-  _impl_.name_.ClearToEmpty();
+// string peer = 3;
+inline void RecordedEvent::clear_peer() {
+  _impl_.peer_.ClearToEmpty();
 }
-inline const std::string& CreateCharacterRequest::name() const {
-  // @@protoc_insertion_point(field_get:proto.CreateCharacterRequest.name)
-  return _internal_name();
+inline const std::string& RecordedEvent::peer() const {
+  // @@protoc_insertion_point(field_get:proto.RecordedEvent.peer)
+  return _internal_peer();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void CreateCharacterRequest::set_name(ArgT0&& arg0, ArgT... args) {
+void RecordedEvent::set_peer(ArgT0&& arg0, ArgT... args) {
  
- _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:proto.CreateCharacterRequest.name)
+ _impl_.peer_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:proto.RecordedEvent.peer)
 }
-inline std::string* CreateCharacterRequest::mutable_name() {
-  std::string* _s = _internal_mutable_name();
-  // @@protoc_insertion_point(field_mutable:proto.CreateCharacterRequest.name)
+inline std::string* RecordedEvent::mutable_peer() {
+  std::string* _s = _internal_mutable_peer();
+  // @@protoc_insertion_point(field_mutable:proto.RecordedEvent.peer)
   return _s;
 }
-inline const std::string& CreateCharacterRequest::_internal_name() const {
-  return _impl_.name_.Get();
+inline const std::string& RecordedEvent::_internal_peer() const {
+  return _impl_.peer_.Get();
 }
-inline void CreateCharacterRequest::_internal_set_name(const std::string& value) {
+inline void RecordedEvent::_internal_set_peer(const std::string& value) {
   
-  _impl_.name_.Set(value, GetArenaForAllocation());
+  _impl_.peer_.Set(value, GetArenaForAllocation());
 }
-inline std::string* CreateCharacterRequest::_internal_mutable_name() {
+inline std::string* RecordedEvent::_internal_mutable_peer() {
   
-  return _impl_.name_.Mutable(GetArenaForAllocation());
+  return _impl_.peer_.Mutable(GetArenaForAllocation());
 }
-inline std::string* CreateCharacterRequest::release_name() {
-  // @@protoc_insertion_point(field_release:proto.CreateCharacterRequest.name)
-  return _impl_.name_.Release();
+inline std::string* RecordedEvent::release_peer() {
+  // @@protoc_insertion_point(field_release:proto.RecordedEvent.peer)
+  return _impl_.peer_.Release();
 }
-inline void CreateCharacterRequest::set_allocated_name(std::string* name) {
-  if (name != nullptr) {
+inline void RecordedEvent::set_allocated_peer(std::string* peer) {
+  if (peer != nullptr) {
     
   } else {
     
   }
-  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+  _impl_.peer_.SetAllocated(peer, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.name_.IsDefault()) {
-    _impl_.name_.Set("", GetArenaForAllocation());
+  if (_impl_.peer_.IsDefault()) {
+    _impl_.peer_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:proto.CreateCharacterRequest.name)
+  // @@protoc_insertion_point(field_set_allocated:proto.RecordedEvent.peer)
 }
 
-// .proto.Vector3 color = 2;
-inline bool CreateCharacterRequest::_internal_has_color() const {
-  return this != internal_default_instance() && _impl_.color_ != nullptr;
+// .proto.CreateCharacterRequest create_character = 4;
+inline bool RecordedEvent::_internal_has_create_character() const {
+  return this != internal_default_instance() && _impl_.create_character_ != nullptr;
 }
-inline bool CreateCharacterRequest::has_color() const {
-  return _internal_has_color();
+inline bool RecordedEvent::has_create_character() const {
+  return _internal_has_create_character();
 }
-inline const ::proto::Vector3& CreateCharacterRequest::_internal_color() const {
-  const ::proto::Vector3* p = _impl_.color_;
-  return p != nullptr ? *p : reinterpret_cast<const ::proto::Vector3&>(
-      ::proto::_Vector3_default_instance_);
+inline void RecordedEvent::clear_create_character() {
+  if (GetArenaForAllocation() == nullptr && _impl_.create_character_ != nullptr) {
+    delete _impl_.create_character_;
+  }
+  _impl_.create_character_ = nullptr;
 }
-inline const ::proto::Vector3& CreateCharacterRequest::color() const {
-  // @@protoc_insertion_point(field_get:proto.CreateCharacterRequest.color)
-  return _internal_color();
+inline const ::proto::CreateCharacterRequest& RecordedEvent::_internal_create_character() const {
+  const ::proto::CreateCharacterRequest* p = _impl_.create_character_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto::CreateCharacterRequest&>(
+      ::proto::_CreateCharacterRequest_default_instance_);
 }
-inline void CreateCharacterRequest::unsafe_arena_set_allocated_color(
-    ::proto::Vector3* color) {
+inline const ::proto::CreateCharacterRequest& RecordedEvent::create_character() const {
+  // @@protoc_insertion_point(field_get:proto.RecordedEvent.create_character)
+  return _internal_create_character();
+}
+inline void RecordedEvent::unsafe_arena_set_allocated_create_character(
+    ::proto::CreateCharacterRequest* create_character) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.color_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.create_character_);
+  }
+  _impl_.create_character_ = create_character;
+  if (create_character) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto.RecordedEvent.create_character)
+}
+inline ::proto::CreateCharacterRequest* RecordedEvent::release_create_character() {
+  
+  ::proto::CreateCharacterRequest* temp = _impl_.create_character_;
+  _impl_.create_character_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::proto::CreateCharacterRequest* RecordedEvent::unsafe_arena_release_create_character() {
+  // @@protoc_insertion_point(field_release:proto.RecordedEvent.create_character)
+  
+  ::proto::CreateCharacterRequest* temp = _impl_.create_character_;
+  _impl_.create_character_ = nullptr;
+  return temp;
+}
+inline ::proto::CreateCharacterRequest* RecordedEvent::_internal_mutable_create_character() {
+  
+  if (_impl_.create_character_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto::CreateCharacterRequest>(GetArenaForAllocation());
+    _impl_.create_character_ = p;
+  }
+  return _impl_.create_character_;
+}
+inline ::proto::CreateCharacterRequest* RecordedEvent::mutable_create_character() {
+  ::proto::CreateCharacterRequest* _msg = _internal_mutable_create_character();
+  // @@protoc_insertion_point(field_mutable:proto.RecordedEvent.create_character)
+  return _msg;
+}
+inline void RecordedEvent::set_allocated_create_character(::proto::CreateCharacterRequest* create_character) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.create_character_;
+  }
+  if (create_character) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(create_character);
+    if (message_arena != submessage_arena) {
+      create_character = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, create_character, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.create_character_ = create_character;
+  // @@protoc_insertion_point(field_set_allocated:proto.RecordedEvent.create_character)
+}
+
+// .proto.ReportInGameRequest report = 5;
+inline bool RecordedEvent::_internal_has_report() const {
+  return this != internal_default_instance() && _impl_.report_ != nullptr;
+}
+inline bool RecordedEvent::has_report() const {
+  return _internal_has_report();
+}
+inline void RecordedEvent::clear_report() {
+  if (GetArenaForAllocation() == nullptr && _impl_.report_ != nullptr) {
+    delete _impl_.report_;
+  }
+  _impl_.report_ = nullptr;
+}
+inline const ::proto::ReportInGameRequest& RecordedEvent::_internal_report() const {
+  const ::proto::ReportInGameRequest* p = _impl_.report_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto::ReportInGameRequest&>(
+      ::proto::_ReportInGameRequest_default_instance_);
+}
+inline const ::proto::ReportInGameRequest& RecordedEvent::report() const {
+  // @@protoc_insertion_point(field_get:proto.RecordedEvent.report)
+  return _internal_report();
+}
+inline void RecordedEvent::unsafe_arena_set_allocated_report(
+    ::proto::ReportInGameRequest* report) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.report_);
   }
-  _impl_.color_ = color;
-  if (color) {
+  _impl_.report_ = report;
+  if (report) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto.CreateCharacterRequest.color)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto.RecordedEvent.report)
 }
-inline ::proto::Vector3* CreateCharacterRequest::release_color() {
+inline ::proto::ReportInGameRequest* RecordedEvent::release_report() {
   
-  ::proto::Vector3* temp = _impl_.color_;
-  _impl_.color_ = nullptr;
+  ::proto::ReportInGameRequest* temp = _impl_.report_;
+  _impl_.report_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -1967,172 +5665,223 @@ inline ::proto::Vector3* CreateCharacterRequest::release_color() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::proto::Vector3* CreateCharacterRequest::unsafe_arena_release_color() {
-  // @@protoc_insertion_point(field_release:proto.CreateCharacterRequest.color)
+inline ::proto::ReportInGameRequest* RecordedEvent::unsafe_arena_release_report() {
+  // @@protoc_insertion_point(field_release:proto.RecordedEvent.report)
   
-  ::proto::Vector3* temp = _impl_.color_;
-  _impl_.color_ = nullptr;
+  ::proto::ReportInGameRequest* temp = _impl_.report_;
+  _impl_.report_ = nullptr;
   return temp;
 }
-inline ::proto::Vector3* CreateCharacterRequest::_internal_mutable_color() {
+inline ::proto::ReportInGameRequest* RecordedEvent::_internal_mutable_report() {
   
-  if (_impl_.color_ == nullptr) {
-    auto* p = CreateMaybeMessage<::proto::Vector3>(GetArenaForAllocation());
-    _impl_.color_ = p;
+  if (_impl_.report_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto::ReportInGameRequest>(GetArenaForAllocation());
+    _impl_.report_ = p;
   }
-  return _impl_.color_;
+  return _impl_.report_;
 }
-inline ::proto::Vector3* CreateCharacterRequest::mutable_color() {
-  ::proto::Vector3* _msg = _internal_mutable_color();
-  // @@protoc_insertion_point(field_mutable:proto.CreateCharacterRequest.color)
+inline ::proto::ReportInGameRequest* RecordedEvent::mutable_report() {
+  ::proto::ReportInGameRequest* _msg = _internal_mutable_report();
+  // @@protoc_insertion_point(field_mutable:proto.RecordedEvent.report)
   return _msg;
 }
-inline void CreateCharacterRequest::set_allocated_color(::proto::Vector3* color) {
+inline void RecordedEvent::set_allocated_report(::proto::ReportInGameRequest* report) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.color_);
+    delete _impl_.report_;
   }
-  if (color) {
+  if (report) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(color));
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(report);
     if (message_arena != submessage_arena) {
-      color = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, color, submessage_arena);
+      report = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, report, submessage_arena);
     }
     
   } else {
     
   }
-  _impl_.color_ = color;
-  // @@protoc_insertion_point(field_set_allocated:proto.CreateCharacterRequest.color)
+  _impl_.report_ = report;
+  // @@protoc_insertion_point(field_set_allocated:proto.RecordedEvent.report)
 }
 
-// -------------------------------------------------------------------
-
-// CreateCharacterResponse
-
-// .proto.ReturnEnum return_enum = 1;
-inline void CreateCharacterResponse::clear_return_enum() {
-  _impl_.return_enum_ = 0;
+// uint64 report_sequence = 6;
+inline void RecordedEvent::clear_report_sequence() {
+  _impl_.report_sequence_ = uint64_t{0u};
 }
-inline ::proto::ReturnEnum CreateCharacterResponse::_internal_return_enum() const {
-  return static_cast< ::proto::ReturnEnum >(_impl_.return_enum_);
+inline uint64_t RecordedEvent::_internal_report_sequence() const {
+  return _impl_.report_sequence_;
 }
-inline ::proto::ReturnEnum CreateCharacterResponse::return_enum() const {
-  // @@protoc_insertion_point(field_get:proto.CreateCharacterResponse.return_enum)
-  return _internal_return_enum();
+inline uint64_t RecordedEvent::report_sequence() const {
+  // @@protoc_insertion_point(field_get:proto.RecordedEvent.report_sequence)
+  return _internal_report_sequence();
 }
-inline void CreateCharacterResponse::_internal_set_return_enum(::proto::ReturnEnum value) {
+inline void RecordedEvent::_internal_set_report_sequence(uint64_t value) {
   
-  _impl_.return_enum_ = value;
+  _impl_.report_sequence_ = value;
 }
-inline void CreateCharacterResponse::set_return_enum(::proto::ReturnEnum value) {
-  _internal_set_return_enum(value);
-  // @@protoc_insertion_point(field_set:proto.CreateCharacterResponse.return_enum)
+inline void RecordedEvent::set_report_sequence(uint64_t value) {
+  _internal_set_report_sequence(value);
+  // @@protoc_insertion_point(field_set:proto.RecordedEvent.report_sequence)
 }
 
 // -------------------------------------------------------------------
 
-// PingRequest
+// RecordingHeader
 
-// int32 value = 1;
-inline void PingRequest::clear_value() {
-  _impl_.value_ = 0;
+// uint32 version = 1;
+inline void RecordingHeader::clear_version() {
+  _impl_.version_ = 0u;
 }
-inline int32_t PingRequest::_internal_value() const {
-  return _impl_.value_;
+inline uint32_t RecordingHeader::_internal_version() const {
+  return _impl_.version_;
 }
-inline int32_t PingRequest::value() const {
-  // @@protoc_insertion_point(field_get:proto.PingRequest.value)
-  return _internal_value();
+inline uint32_t RecordingHeader::version() const {
+  // @@protoc_insertion_point(field_get:proto.RecordingHeader.version)
+  return _internal_version();
 }
-inline void PingRequest::_internal_set_value(int32_t value) {
+inline void RecordingHeader::_internal_set_version(uint32_t value) {
   
-  _impl_.value_ = value;
+  _impl_.version_ = value;
 }
-inline void PingRequest::set_value(int32_t value) {
-  _internal_set_value(value);
-  // @@protoc_insertion_point(field_set:proto.PingRequest.value)
+inline void RecordingHeader::set_version(uint32_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:proto.RecordingHeader.version)
 }
 
-// -------------------------------------------------------------------
+// uint64 random_seed = 2;
+inline void RecordingHeader::clear_random_seed() {
+  _impl_.random_seed_ = uint64_t{0u};
+}
+inline uint64_t RecordingHeader::_internal_random_seed() const {
+  return _impl_.random_seed_;
+}
+inline uint64_t RecordingHeader::random_seed() const {
+  // @@protoc_insertion_point(field_get:proto.RecordingHeader.random_seed)
+  return _internal_random_seed();
+}
+inline void RecordingHeader::_internal_set_random_seed(uint64_t value) {
+  
+  _impl_.random_seed_ = value;
+}
+inline void RecordingHeader::set_random_seed(uint64_t value) {
+  _internal_set_random_seed(value);
+  // @@protoc_insertion_point(field_set:proto.RecordingHeader.random_seed)
+}
 
-// PingResponse
+// double step_period = 3;
+inline void RecordingHeader::clear_step_period() {
+  _impl_.step_period_ = 0;
+}
+inline double RecordingHeader::_internal_step_period() const {
+  return _impl_.step_period_;
+}
+inline double RecordingHeader::step_period() const {
+  // @@protoc_insertion_point(field_get:proto.RecordingHeader.step_period)
+  return _internal_step_period();
+}
+inline void RecordingHeader::_internal_set_step_period(double value) {
+  
+  _impl_.step_period_ = value;
+}
+inline void RecordingHeader::set_step_period(double value) {
+  _internal_set_step_period(value);
+  // @@protoc_insertion_point(field_set:proto.RecordingHeader.step_period)
+}
 
-// int32 value = 1;
-inline void PingResponse::clear_value() {
-  _impl_.value_ = 0;
+// double broadcast_period = 4;
+inline void RecordingHeader::clear_broadcast_period() {
+  _impl_.broadcast_period_ = 0;
 }
-inline int32_t PingResponse::_internal_value() const {
-  return _impl_.value_;
+inline double RecordingHeader::_internal_broadcast_period() const {
+  return _impl_.broadcast_period_;
 }
-inline int32_t PingResponse::value() const {
-  // @@protoc_insertion_point(field_get:proto.PingResponse.value)
-  return _internal_value();
+inline double RecordingHeader::broadcast_period() const {
+  // @@protoc_insertion_point(field_get:proto.RecordingHeader.broadcast_period)
+  return _internal_broadcast_period();
 }
-inline void PingResponse::_internal_set_value(int32_t value) {
+inline void RecordingHeader::_internal_set_broadcast_period(double value) {
   
-  _impl_.value_ = value;
+  _impl_.broadcast_period_ = value;
 }
-inline void PingResponse::set_value(int32_t value) {
-  _internal_set_value(value);
-  // @@protoc_insertion_point(field_set:proto.PingResponse.value)
+inline void RecordingHeader::set_broadcast_period(double value) {
+  _internal_set_broadcast_period(value);
+  // @@protoc_insertion_point(field_set:proto.RecordingHeader.broadcast_period)
 }
 
-// double time = 2;
-inline void PingResponse::clear_time() {
-  _impl_.time_ = 0;
+// uint32 upgrade_count = 5;
+inline void RecordingHeader::clear_upgrade_count() {
+  _impl_.upgrade_count_ = 0u;
 }
-inline double PingResponse::_internal_time() const {
-  return _impl_.time_;
+inline uint32_t RecordingHeader::_internal_upgrade_count() const {
+  return _impl_.upgrade_count_;
 }
-inline double PingResponse::time() const {
-  // @@protoc_insertion_point(field_get:proto.PingResponse.time)
-  return _internal_time();
+inline uint32_t RecordingHeader::upgrade_count() const {
+  // @@protoc_insertion_point(field_get:proto.RecordingHeader.upgrade_count)
+  return _internal_upgrade_count();
 }
-inline void PingResponse::_internal_set_time(double value) {
+inline void RecordingHeader::_internal_set_upgrade_count(uint32_t value) {
   
-  _impl_.time_ = value;
+  _impl_.upgrade_count_ = value;
 }
-inline void PingResponse::set_time(double value) {
-  _internal_set_time(value);
-  // @@protoc_insertion_point(field_set:proto.PingResponse.time)
+inline void RecordingHeader::set_upgrade_count(uint32_t value) {
+  _internal_set_upgrade_count(value);
+  // @@protoc_insertion_point(field_set:proto.RecordingHeader.upgrade_count)
 }
 
-// .proto.PlayerParameter player_parameter = 3;
-inline bool PingResponse::_internal_has_player_parameter() const {
-  return this != internal_default_instance() && _impl_.player_parameter_ != nullptr;
+// bool server_hit_detection = 6;
+inline void RecordingHeader::clear_server_hit_detection() {
+  _impl_.server_hit_detection_ = false;
 }
-inline bool PingResponse::has_player_parameter() const {
-  return _internal_has_player_parameter();
+inline bool RecordingHeader::_internal_server_hit_detection() const {
+  return _impl_.server_hit_detection_;
 }
-inline const ::proto::PlayerParameter& PingResponse::_internal_player_parameter() const {
-  const ::proto::PlayerParameter* p = _impl_.player_parameter_;
-  return p != nullptr ? *p : reinterpret_cast<const ::proto::PlayerParameter&>(
-      ::proto::_PlayerParameter_default_instance_);
+inline bool RecordingHeader::server_hit_detection() const {
+  // @@protoc_insertion_point(field_get:proto.RecordingHeader.server_hit_detection)
+  return _internal_server_hit_detection();
 }
-inline const ::proto::PlayerParameter& PingResponse::player_parameter() const {
-  // @@protoc_insertion_point(field_get:proto.PingResponse.player_parameter)
-  return _internal_player_parameter();
+inline void RecordingHeader::_internal_set_server_hit_detection(bool value) {
+  
+  _impl_.server_hit_detection_ = value;
 }
-inline void PingResponse::unsafe_arena_set_allocated_player_parameter(
-    ::proto::PlayerParameter* player_parameter) {
+inline void RecordingHeader::set_server_hit_detection(bool value) {
+  _internal_set_server_hit_detection(value);
+  // @@protoc_insertion_point(field_set:proto.RecordingHeader.server_hit_detection)
+}
+
+// .proto.WorldDatabase world = 7;
+inline bool RecordingHeader::_internal_has_world() const {
+  return this != internal_default_instance() && _impl_.world_ != nullptr;
+}
+inline bool RecordingHeader::has_world() const {
+  return _internal_has_world();
+}
+inline const ::proto::WorldDatabase& RecordingHeader::_internal_world() const {
+  const ::proto::WorldDatabase* p = _impl_.world_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto::WorldDatabase&>(
+      ::proto::_WorldDatabase_default_instance_);
+}
+inline const ::proto::WorldDatabase& RecordingHeader::world() const {
+  // @@protoc_insertion_point(field_get:proto.RecordingHeader.world)
+  return _internal_world();
+}
+inline void RecordingHeader::unsafe_arena_set_allocated_world(
+    ::proto::WorldDatabase* world) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.player_parameter_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.world_);
   }
-  _impl_.player_parameter_ = player_parameter;
-  if (player_parameter) {
+  _impl_.world_ = world;
+  if (world) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto.PingResponse.player_parameter)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto.RecordingHeader.world)
 }
-inline ::proto::PlayerParameter* PingResponse::release_player_parameter() {
+inline ::proto::WorldDatabase* RecordingHeader::release_world() {
   
-  ::proto::PlayerParameter* temp = _impl_.player_parameter_;
-  _impl_.player_parameter_ = nullptr;
+  ::proto::WorldDatabase* temp = _impl_.world_;
+  _impl_.world_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -2144,47 +5893,273 @@ inline ::proto::PlayerParameter* PingResponse::release_player_parameter() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::proto::PlayerParameter* PingResponse::unsafe_arena_release_player_parameter() {
-  // @@protoc_insertion_point(field_release:proto.PingResponse.player_parameter)
+inline ::proto::WorldDatabase* RecordingHeader::unsafe_arena_release_world() {
+  // @@protoc_insertion_point(field_release:proto.RecordingHeader.world)
   
-  ::proto::PlayerParameter* temp = _impl_.player_parameter_;
-  _impl_.player_parameter_ = nullptr;
+  ::proto::WorldDatabase* temp = _impl_.world_;
+  _impl_.world_ = nullptr;
   return temp;
 }
-inline ::proto::PlayerParameter* PingResponse::_internal_mutable_player_parameter() {
+inline ::proto::WorldDatabase* RecordingHeader::_internal_mutable_world() {
   
-  if (_impl_.player_parameter_ == nullptr) {
-    auto* p = CreateMaybeMessage<::proto::PlayerParameter>(GetArenaForAllocation());
-    _impl_.player_parameter_ = p;
+  if (_impl_.world_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto::WorldDatabase>(GetArenaForAllocation());
+    _impl_.world_ = p;
   }
-  return _impl_.player_parameter_;
+  return _impl_.world_;
 }
-inline ::proto::PlayerParameter* PingResponse::mutable_player_parameter() {
-  ::proto::PlayerParameter* _msg = _internal_mutable_player_parameter();
-  // @@protoc_insertion_point(field_mutable:proto.PingResponse.player_parameter)
+inline ::proto::WorldDatabase* RecordingHeader::mutable_world() {
+  ::proto::WorldDatabase* _msg = _internal_mutable_world();
+  // @@protoc_insertion_point(field_mutable:proto.RecordingHeader.world)
   return _msg;
 }
-inline void PingResponse::set_allocated_player_parameter(::proto::PlayerParameter* player_parameter) {
+inline void RecordingHeader::set_allocated_world(::proto::WorldDatabase* world) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.player_parameter_);
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.world_);
   }
-  if (player_parameter) {
+  if (world) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
         ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(player_parameter));
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(world));
     if (message_arena != submessage_arena) {
-      player_parameter = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, player_parameter, submessage_arena);
+      world = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, world, submessage_arena);
     }
     
   } else {
     
   }
-  _impl_.player_parameter_ = player_parameter;
-  // @@protoc_insertion_point(field_set_allocated:proto.PingResponse.player_parameter)
+  _impl_.world_ = world;
+  // @@protoc_insertion_point(field_set_allocated:proto.RecordingHeader.world)
+}
+
+// -------------------------------------------------------------------
+
+// RegionExchangeRequest
+
+// uint32 region = 1;
+inline void RegionExchangeRequest::clear_region() {
+  _impl_.region_ = 0u;
+}
+inline uint32_t RegionExchangeRequest::_internal_region() const {
+  return _impl_.region_;
+}
+inline uint32_t RegionExchangeRequest::region() const {
+  // @@protoc_insertion_point(field_get:proto.RegionExchangeRequest.region)
+  return _internal_region();
+}
+inline void RegionExchangeRequest::_internal_set_region(uint32_t value) {
+  
+  _impl_.region_ = value;
+}
+inline void RegionExchangeRequest::set_region(uint32_t value) {
+  _internal_set_region(value);
+  // @@protoc_insertion_point(field_set:proto.RegionExchangeRequest.region)
+}
+
+// double time = 2;
+inline void RegionExchangeRequest::clear_time() {
+  _impl_.time_ = 0;
+}
+inline double RegionExchangeRequest::_internal_time() const {
+  return _impl_.time_;
+}
+inline double RegionExchangeRequest::time() const {
+  // @@protoc_insertion_point(field_get:proto.RegionExchangeRequest.time)
+  return _internal_time();
+}
+inline void RegionExchangeRequest::_internal_set_time(double value) {
+  
+  _impl_.time_ = value;
+}
+inline void RegionExchangeRequest::set_time(double value) {
+  _internal_set_time(value);
+  // @@protoc_insertion_point(field_set:proto.RegionExchangeRequest.time)
+}
+
+// repeated .proto.Character handoff_characters = 3;
+inline int RegionExchangeRequest::_internal_handoff_characters_size() const {
+  return _impl_.handoff_characters_.size();
+}
+inline int RegionExchangeRequest::handoff_characters_size() const {
+  return _internal_handoff_characters_size();
+}
+inline ::proto::Character* RegionExchangeRequest::mutable_handoff_characters(int index) {
+  // @@protoc_insertion_point(field_mutable:proto.RegionExchangeRequest.handoff_characters)
+  return _impl_.handoff_characters_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Character >*
+RegionExchangeRequest::mutable_handoff_characters() {
+  // @@protoc_insertion_point(field_mutable_list:proto.RegionExchangeRequest.handoff_characters)
+  return &_impl_.handoff_characters_;
+}
+inline const ::proto::Character& RegionExchangeRequest::_internal_handoff_characters(int index) const {
+  return _impl_.handoff_characters_.Get(index);
+}
+inline const ::proto::Character& RegionExchangeRequest::handoff_characters(int index) const {
+  // @@protoc_insertion_point(field_get:proto.RegionExchangeRequest.handoff_characters)
+  return _internal_handoff_characters(index);
+}
+inline ::proto::Character* RegionExchangeRequest::_internal_add_handoff_characters() {
+  return _impl_.handoff_characters_.Add();
+}
+inline ::proto::Character* RegionExchangeRequest::add_handoff_characters() {
+  ::proto::Character* _add = _internal_add_handoff_characters();
+  // @@protoc_insertion_point(field_add:proto.RegionExchangeRequest.handoff_characters)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Character >&
+RegionExchangeRequest::handoff_characters() const {
+  // @@protoc_insertion_point(field_list:proto.RegionExchangeRequest.handoff_characters)
+  return _impl_.handoff_characters_;
+}
+
+// repeated .proto.Character mirrored_characters = 4;
+inline int RegionExchangeRequest::_internal_mirrored_characters_size() const {
+  return _impl_.mirrored_characters_.size();
+}
+inline int RegionExchangeRequest::mirrored_characters_size() const {
+  return _internal_mirrored_characters_size();
+}
+inline ::proto::Character* RegionExchangeRequest::mutable_mirrored_characters(int index) {
+  // @@protoc_insertion_point(field_mutable:proto.RegionExchangeRequest.mirrored_characters)
+  return _impl_.mirrored_characters_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Character >*
+RegionExchangeRequest::mutable_mirrored_characters() {
+  // @@protoc_insertion_point(field_mutable_list:proto.RegionExchangeRequest.mirrored_characters)
+  return &_impl_.mirrored_characters_;
+}
+inline const ::proto::Character& RegionExchangeRequest::_internal_mirrored_characters(int index) const {
+  return _impl_.mirrored_characters_.Get(index);
+}
+inline const ::proto::Character& RegionExchangeRequest::mirrored_characters(int index) const {
+  // @@protoc_insertion_point(field_get:proto.RegionExchangeRequest.mirrored_characters)
+  return _internal_mirrored_characters(index);
+}
+inline ::proto::Character* RegionExchangeRequest::_internal_add_mirrored_characters() {
+  return _impl_.mirrored_characters_.Add();
+}
+inline ::proto::Character* RegionExchangeRequest::add_mirrored_characters() {
+  ::proto::Character* _add = _internal_add_mirrored_characters();
+  // @@protoc_insertion_point(field_add:proto.RegionExchangeRequest.mirrored_characters)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Character >&
+RegionExchangeRequest::mirrored_characters() const {
+  // @@protoc_insertion_point(field_list:proto.RegionExchangeRequest.mirrored_characters)
+  return _impl_.mirrored_characters_;
+}
+
+// repeated .proto.Element mirrored_elements = 5;
+inline int RegionExchangeRequest::_internal_mirrored_elements_size() const {
+  return _impl_.mirrored_elements_.size();
+}
+inline int RegionExchangeRequest::mirrored_elements_size() const {
+  return _internal_mirrored_elements_size();
+}
+inline ::proto::Element* RegionExchangeRequest::mutable_mirrored_elements(int index) {
+  // @@protoc_insertion_point(field_mutable:proto.RegionExchangeRequest.mirrored_elements)
+  return _impl_.mirrored_elements_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Element >*
+RegionExchangeRequest::mutable_mirrored_elements() {
+  // @@protoc_insertion_point(field_mutable_list:proto.RegionExchangeRequest.mirrored_elements)
+  return &_impl_.mirrored_elements_;
+}
+inline const ::proto::Element& RegionExchangeRequest::_internal_mirrored_elements(int index) const {
+  return _impl_.mirrored_elements_.Get(index);
+}
+inline const ::proto::Element& RegionExchangeRequest::mirrored_elements(int index) const {
+  // @@protoc_insertion_point(field_get:proto.RegionExchangeRequest.mirrored_elements)
+  return _internal_mirrored_elements(index);
+}
+inline ::proto::Element* RegionExchangeRequest::_internal_add_mirrored_elements() {
+  return _impl_.mirrored_elements_.Add();
+}
+inline ::proto::Element* RegionExchangeRequest::add_mirrored_elements() {
+  ::proto::Element* _add = _internal_add_mirrored_elements();
+  // @@protoc_insertion_point(field_add:proto.RegionExchangeRequest.mirrored_elements)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Element >&
+RegionExchangeRequest::mirrored_elements() const {
+  // @@protoc_insertion_point(field_list:proto.RegionExchangeRequest.mirrored_elements)
+  return _impl_.mirrored_elements_;
+}
+
+// repeated uint64 handoff_ids = 6;
+inline int RegionExchangeRequest::_internal_handoff_ids_size() const {
+  return _impl_.handoff_ids_.size();
+}
+inline int RegionExchangeRequest::handoff_ids_size() const {
+  return _internal_handoff_ids_size();
+}
+inline void RegionExchangeRequest::clear_handoff_ids() {
+  _impl_.handoff_ids_.Clear();
+}
+inline uint64_t RegionExchangeRequest::_internal_handoff_ids(int index) const {
+  return _impl_.handoff_ids_.Get(index);
+}
+inline uint64_t RegionExchangeRequest::handoff_ids(int index) const {
+  // @@protoc_insertion_point(field_get:proto.RegionExchangeRequest.handoff_ids)
+  return _internal_handoff_ids(index);
+}
+inline void RegionExchangeRequest::set_handoff_ids(int index, uint64_t value) {
+  _impl_.handoff_ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto.RegionExchangeRequest.handoff_ids)
+}
+inline void RegionExchangeRequest::_internal_add_handoff_ids(uint64_t value) {
+  _impl_.handoff_ids_.Add(value);
+}
+inline void RegionExchangeRequest::add_handoff_ids(uint64_t value) {
+  _internal_add_handoff_ids(value);
+  // @@protoc_insertion_point(field_add:proto.RegionExchangeRequest.handoff_ids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+RegionExchangeRequest::_internal_handoff_ids() const {
+  return _impl_.handoff_ids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+RegionExchangeRequest::handoff_ids() const {
+  // @@protoc_insertion_point(field_list:proto.RegionExchangeRequest.handoff_ids)
+  return _internal_handoff_ids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+RegionExchangeRequest::_internal_mutable_handoff_ids() {
+  return &_impl_.handoff_ids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+RegionExchangeRequest::mutable_handoff_ids() {
+  // @@protoc_insertion_point(field_mutable_list:proto.RegionExchangeRequest.handoff_ids)
+  return _internal_mutable_handoff_ids();
+}
+
+// uint64 handoff_floor = 7;
+inline void RegionExchangeRequest::clear_handoff_floor() {
+  _impl_.handoff_floor_ = uint64_t{0u};
+}
+inline uint64_t RegionExchangeRequest::_internal_handoff_floor() const {
+  return _impl_.handoff_floor_;
+}
+inline uint64_t RegionExchangeRequest::handoff_floor() const {
+  // @@protoc_insertion_point(field_get:proto.RegionExchangeRequest.handoff_floor)
+  return _internal_handoff_floor();
+}
+inline void RegionExchangeRequest::_internal_set_handoff_floor(uint64_t value) {
+  
+  _impl_.handoff_floor_ = value;
+}
+inline void RegionExchangeRequest::set_handoff_floor(uint64_t value) {
+  _internal_set_handoff_floor(value);
+  // @@protoc_insertion_point(field_set:proto.RegionExchangeRequest.handoff_floor)
 }
 
+// -------------------------------------------------------------------
+
+// RegionExchangeResponse
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -2202,11 +6177,44 @@ inline void PingResponse::set_allocated_player_parameter(::proto::PlayerParamete
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace proto
 
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::proto::InputFlagEnum> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::proto::InputFlagEnum>() {
+  return ::proto::InputFlagEnum_descriptor();
+}
+template <> struct is_proto_enum< ::proto::RecordedEventEnum> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::proto::RecordedEventEnum>() {
+  return ::proto::RecordedEventEnum_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
 // @@protoc_insertion_point(global_scope)
 
 #include <google/protobuf/port_undef.inc>
@@ -1,23 +1,47 @@
 #include "Common/physic.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "Common/vector.h"
 #include "Common/convert_math.h"
 
 namespace darwin {
 
+    PhysicState GetPhysicState(const proto::Physic& physic) {
+        return {
+            ProtoVector2Glm(physic.position()),
+            ProtoVector2Glm(physic.position_dt()),
+            physic.mass(),
+            physic.radius() };
+    }
+
+    void SetPhysicState(proto::Physic& physic, const PhysicState& state) {
+        Glm2ProtoVector(*physic.mutable_position(), state.position);
+        Glm2ProtoVector(*physic.mutable_position_dt(), state.position_dt);
+        physic.set_mass(state.mass);
+        physic.set_radius(state.radius);
+    }
+
     glm::dvec3 ApplyPhysic(
         const proto::Physic& physic_source,
         const proto::Physic& physic_target) 
     {
-        glm::dvec3 distance_vector = 
-            ProtoVector2Glm(physic_source.position()) - 
-            ProtoVector2Glm(physic_target.position());
-        double distance = glm::distance(
-            ProtoVector2Glm(physic_source.position()),
-            ProtoVector2Glm(physic_target.position()));
+        return ApplyPhysic(
+            GetPhysicState(physic_source),
+            GetPhysicState(physic_target));
+    }
+
+    glm::dvec3 ApplyPhysic(
+        const PhysicState& physic_source,
+        const PhysicState& physic_target)
+    {
+        glm::dvec3 distance_vector =
+            physic_source.position - physic_target.position;
+        double distance = glm::length(distance_vector);
         double force_magnitude = 
             GRAVITATIONAL_CONSTANT * 
-            (physic_source.mass() * physic_target.mass()) /
+            (physic_source.mass * physic_target.mass) /
             (distance * distance);
         glm::dvec3 force_direction = glm::normalize(distance_vector);
         return force_direction * force_magnitude;
@@ -27,25 +51,30 @@ namespace darwin {
         proto::Physic& physic,
         glm::dvec3 force,
         double delta_time)
+    {
+        auto state = GetPhysicState(physic);
+        double acceleration = UpdateObject(state, force, delta_time);
+        SetPhysicState(physic, state);
+        return acceleration;
+    }
+
+    double UpdateObject(
+        PhysicState& physic,
+        const glm::dvec3& force,
+        double delta_time)
     {
         // Compute the acceleration vector.
         // a = F / m
-        glm::dvec3 acceleration = force / physic.mass();
-        // Update the speed.
-        // v(t) = v0 + at
-        auto updated_speed = 
-            ProtoVector2Glm(physic.position_dt()) + acceleration * delta_time;
+        glm::dvec3 acceleration = force / physic.mass;
         // Update the position.
         // x(t) = x0 + v0t + 0.5at^2
-        auto updated_position = 
-            ProtoVector2Glm(physic.position_dt()) * delta_time +
+        physic.position +=
+            physic.position_dt * delta_time +
             acceleration * (delta_time * delta_time * 0.5);
         // Update the speed.
-        physic.mutable_position_dt()->CopyFrom(Glm2ProtoVector(updated_speed));
-        // Update the position.
-        physic.mutable_position()->CopyFrom(
-            physic.position() + Glm2ProtoVector(updated_position));
-        return acceleration.length();
+        // v(t) = v0 + at
+        physic.position_dt += acceleration * delta_time;
+        return glm::length(acceleration);
     }
 
     glm::dvec3 CancelVerticalComponent(
@@ -68,28 +97,154 @@ namespace darwin {
         const proto::Element& element)
     {
         if (element.type_enum() == proto::TYPE_GROUND) {
-            auto distance =
-                glm::distance(
-                    ProtoVector2Glm(physic.position()), 
-                    ProtoVector2Glm(element.physic().position()));
-            if (distance < (physic.radius() + element.physic().radius())) {
-                auto normal = 
-                    glm::normalize(
-                        ProtoVector2Glm(physic.position()) - 
-                        ProtoVector2Glm(element.physic().position()));
-                auto new_position = 
-                    normal * (physic.radius() + element.physic().radius());
-                physic.mutable_position()->CopyFrom(
-                    Glm2ProtoVector(new_position));
-                // Cancel the vertical component of the velocity.
-                physic.mutable_position_dt()->CopyFrom(
-                    Glm2ProtoVector(CancelVerticalComponent(
-                        ProtoVector2Glm(physic.position_dt()), normal)));
-                return proto::STATUS_ON_GROUND;
+            auto state = GetPhysicState(physic);
+            auto status =
+                CorrectSurface(state, GetPhysicState(element.physic()));
+            if (status == proto::STATUS_ON_GROUND) {
+                SetPhysicState(physic, state);
             }
-            return proto::STATUS_JUMPING;
+            return status;
         }
         return proto::STATUS_UNKNOWN;
     }
 
+    proto::StatusEnum CorrectSurface(
+        PhysicState& physic,
+        const PhysicState& ground)
+    {
+        auto distance = glm::distance(physic.position, ground.position);
+        if (distance < (physic.radius + ground.radius)) {
+            auto normal = glm::normalize(physic.position - ground.position);
+            physic.position = normal * (physic.radius + ground.radius);
+            // Cancel the vertical component of the velocity.
+            physic.position_dt =
+                CancelVerticalComponent(physic.position_dt, normal);
+            return proto::STATUS_ON_GROUND;
+        }
+        return proto::STATUS_JUMPING;
+    }
+
+    glm::dvec3 GetInputDirection(
+        const glm::dvec3& normal,
+        const glm::dvec3& forward,
+        double horizontal,
+        double vertical)
+    {
+        auto normalized_forward = glm::normalize(forward);
+        auto right = glm::normalize(glm::cross(normal, normalized_forward));
+        return glm::normalize(
+            right * horizontal + normalized_forward * vertical);
+    }
+
+    glm::dvec3 ApplyMove(
+        const glm::dvec3& position_dt,
+        const glm::dvec3& direction,
+        double mass,
+        const proto::PlayerParameter& player_parameter,
+        double delta_time)
+    {
+        // calculate the firction for the delta_time
+        double friction_delta_time =
+            player_parameter.friction() * delta_time / std::log(mass);
+        // calculate acceleration from friction and traget terminal 
+        // velocity.
+        double acceleration_delta_time =
+            friction_delta_time *
+            player_parameter.horizontal_speed() *
+            player_parameter.horizontal_speed();
+        // we need to current speed to get the quadratic friction
+        double current_speed = glm::length(position_dt);
+        if (current_speed == 0.0) {
+            return direction * acceleration_delta_time;
+        }
+        // we apply the friction even if we acceletare (accelaration 
+        // doesnt make friction disapear) also we wont end in orbit 
+        // this way.
+        auto friction_vector =
+            glm::normalize(position_dt) *
+            friction_delta_time * current_speed * current_speed;
+        // lets apply acceleration and friction
+        return position_dt +
+            direction * acceleration_delta_time - friction_vector;
+    }
+
+    PlayerInput GetPlayerInput(const proto::InputCommand& input_command) {
+        PlayerInput player_input;
+        const glm::dvec3 direction(
+            input_command.direction_x(),
+            input_command.direction_y(),
+            input_command.direction_z());
+        // Anything too short (or NaN) is not a move.
+        if (glm::length(direction) > 0.5) {
+            player_input.direction = glm::normalize(direction);
+        }
+        const std::uint32_t input_flags = input_command.input_flags();
+        player_input.jump = input_flags & proto::INPUT_FLAG_JUMP;
+        player_input.boost = input_flags & proto::INPUT_FLAG_BOOST;
+        const double duration = input_command.duration();
+        player_input.duration = (duration > 0.0) ?
+            std::min(duration, MAX_INPUT_DURATION) :
+            0.0;
+        return player_input;
+    }
+
+    void SetInputCommand(
+        proto::InputCommand& input_command,
+        const PlayerInput& player_input)
+    {
+        input_command.set_direction_x(
+            static_cast<float>(player_input.direction.x));
+        input_command.set_direction_y(
+            static_cast<float>(player_input.direction.y));
+        input_command.set_direction_z(
+            static_cast<float>(player_input.direction.z));
+        input_command.set_input_flags(
+            (player_input.jump ? proto::INPUT_FLAG_JUMP : 0) |
+            (player_input.boost ? proto::INPUT_FLAG_BOOST : 0));
+        input_command.set_duration(
+            static_cast<float>(player_input.duration));
+    }
+
+    proto::StatusEnum ApplyPlayerInput(
+        PhysicState& physic,
+        proto::StatusEnum status,
+        const glm::dvec3& normal,
+        const PlayerInput& player_input,
+        const proto::PlayerParameter& player_parameter)
+    {
+        if (status != proto::STATUS_ON_GROUND) {
+            return status;
+        }
+        const bool is_moving = player_input.direction != glm::dvec3(0.0);
+        if (player_input.jump) {
+            physic.position_dt += normal * player_parameter.vertical_speed();
+            status = proto::STATUS_JUMPING;
+        }
+        if (is_moving) {
+            physic.position_dt = ApplyMove(
+                physic.position_dt,
+                player_input.direction,
+                physic.mass,
+                player_parameter,
+                player_input.duration);
+        }
+        if (player_input.boost) {
+            const glm::dvec3 direction = is_moving ?
+                player_input.direction :
+                glm::normalize(physic.position_dt);
+            if (!glm::any(glm::isnan(direction))) {
+                physic.position_dt =
+                    direction * player_parameter.boost_speed();
+            }
+        }
+        if (!player_input.jump && !is_moving && !player_input.boost) {
+            // Friction stronger with speed (so we wont end up in orbit).
+            const double current_speed = glm::length(physic.position_dt);
+            physic.position_dt *=
+                1.0 - player_parameter.friction() * player_input.duration *
+                    current_speed * current_speed;
+        }
+        return status;
+    }
+
 } // namespace darwin.
@@ -7,14 +7,45 @@
 
 namespace darwin {
 
+    // Plain copy of the simulated part of a physic, the simulation and the
+    // client prediction work on it, the proto is only read and written
+    // around them (see GetPhysicState and SetPhysicState).
+    struct PhysicState {
+        glm::dvec3 position = glm::dvec3(0.0);
+        glm::dvec3 position_dt = glm::dvec3(0.0);
+        double mass = 0.0;
+        double radius = 0.0;
+    };
+
+    // Inputs of a player for one frame (see proto::InputCommand).
+    struct PlayerInput {
+        // Move direction, unit length or zero if not moving.
+        glm::dvec3 direction = glm::dvec3(0.0);
+        bool jump = false;
+        bool boost = false;
+        double duration = 0.0;
+    };
+
+    PhysicState GetPhysicState(const proto::Physic& physic);
+    // Write the state back in place.
+    void SetPhysicState(proto::Physic& physic, const PhysicState& state);
+
     glm::dvec3 ApplyPhysic(
         const proto::Physic& physic_source, 
         const proto::Physic& physic_target);
+    glm::dvec3 ApplyPhysic(
+        const PhysicState& physic_source,
+        const PhysicState& physic_target);
 
+    // Return the magnitude of the acceleration.
     double UpdateObject(
         proto::Physic& physic, 
         glm::dvec3 force, 
         double delta_time);
+    double UpdateObject(
+        PhysicState& physic,
+        const glm::dvec3& force,
+        double delta_time);
 
     // Function to cancel the vertical component of the velocity vector.
     glm::dvec3 CancelVerticalComponent(
@@ -24,5 +55,40 @@ namespace darwin {
     proto::StatusEnum CorrectSurface(
         proto::Physic& physic, 
         const proto::Element& element);
+    // Same with the physic of a ground element.
+    proto::StatusEnum CorrectSurface(
+        PhysicState& physic,
+        const PhysicState& ground);
+
+    // Direction of a move in the plane of normal from the inputs (right and
+    // forward).
+    glm::dvec3 GetInputDirection(
+        const glm::dvec3& normal,
+        const glm::dvec3& forward,
+        double horizontal,
+        double vertical);
+    // Speed after accelerating toward direction, with a quadratic friction.
+    glm::dvec3 ApplyMove(
+        const glm::dvec3& position_dt,
+        const glm::dvec3& direction,
+        double mass,
+        const proto::PlayerParameter& player_parameter,
+        double delta_time);
+
+    // Sanitized, the direction is normalized (or zero) and the duration is
+    // clamped to [0, MAX_INPUT_DURATION].
+    PlayerInput GetPlayerInput(const proto::InputCommand& input_command);
+    void SetInputCommand(
+        proto::InputCommand& input_command,
+        const PlayerInput& player_input);
+    // Speed of a character on the ground after the inputs of a frame: jump,
+    // move then boost, or the friction if idle. Nothing happens off the
+    // ground. Return the new status (jumping after a jump).
+    proto::StatusEnum ApplyPlayerInput(
+        PhysicState& physic,
+        proto::StatusEnum status,
+        const glm::dvec3& normal,
+        const PlayerInput& player_input,
+        const proto::PlayerParameter& player_parameter);
 
 } // namespace darwin.
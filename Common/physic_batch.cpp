@@ -0,0 +1,558 @@
+#include "Common/physic_batch.h"
+
+#include <atomic>
+#include <cassert>
+#include <cmath>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define DARWIN_PHYSIC_AVX2
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+#define DARWIN_PHYSIC_NEON
+#include <arm_neon.h>
+#endif
+
+// Only avx2 (not fma) so that the multiply-add are not fused, as in the
+// scalar code.
+#if defined(DARWIN_PHYSIC_AVX2) && (defined(__GNUC__) || defined(__clang__))
+#define DARWIN_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define DARWIN_TARGET_AVX2
+#endif
+
+namespace darwin {
+
+    namespace {
+
+        bool IsPhysicKernelSupported(PhysicKernelEnum physic_kernel) {
+            switch (physic_kernel) {
+                case PhysicKernelEnum::PHYSIC_KERNEL_SCALAR:
+                    return true;
+                case PhysicKernelEnum::PHYSIC_KERNEL_AVX2: {
+#if defined(DARWIN_PHYSIC_AVX2) && defined(_MSC_VER)
+                    int info[4];
+                    __cpuid(info, 1);
+                    // The OS saves the ymm registers.
+                    const bool os_avx = (info[2] & (1 << 27)) &&
+                        (_xgetbv(0) & 0x6) == 0x6;
+                    __cpuidex(info, 7, 0);
+                    return os_avx && (info[1] & (1 << 5));
+#elif defined(DARWIN_PHYSIC_AVX2)
+                    return __builtin_cpu_supports("avx2");
+#else
+                    return false;
+#endif
+                }
+                case PhysicKernelEnum::PHYSIC_KERNEL_NEON:
+#if defined(DARWIN_PHYSIC_NEON)
+                    return true;
+#else
+                    return false;
+#endif
+            }
+            return false;
+        }
+
+        PhysicKernelEnum DetectPhysicKernel() {
+            for (auto physic_kernel : {
+                PhysicKernelEnum::PHYSIC_KERNEL_AVX2,
+                PhysicKernelEnum::PHYSIC_KERNEL_NEON })
+            {
+                if (IsPhysicKernelSupported(physic_kernel)) {
+                    return physic_kernel;
+                }
+            }
+            return PhysicKernelEnum::PHYSIC_KERNEL_SCALAR;
+        }
+
+        std::atomic<PhysicKernelEnum> g_physic_kernel = DetectPhysicKernel();
+
+        // Scalar kernels, from begin to the end (the tail of the vector
+        // kernels).
+
+        void ApplyPhysicScalar(
+            const PhysicState& source,
+            std::span<const glm::dvec3> positions,
+            std::span<const double> masses,
+            std::span<glm::dvec3> forces,
+            std::size_t begin)
+        {
+            for (std::size_t i = begin; i < positions.size(); ++i) {
+                PhysicState target;
+                target.position = positions[i];
+                target.mass = masses[i];
+                forces[i] += ApplyPhysic(source, target);
+            }
+        }
+
+        void UpdateObjectScalar(
+            const PhysicBatch& bodies,
+            std::span<const glm::dvec3> forces,
+            double delta_time,
+            std::size_t begin)
+        {
+            for (std::size_t i = begin; i < bodies.positions.size(); ++i) {
+                glm::dvec3 acceleration = forces[i] / bodies.masses[i];
+                bodies.positions[i] +=
+                    bodies.position_dts[i] * delta_time +
+                    acceleration * (delta_time * delta_time * 0.5);
+                bodies.position_dts[i] += acceleration * delta_time;
+            }
+        }
+
+        void CorrectSurfaceScalar(
+            const PhysicBatch& bodies,
+            const PhysicState& ground,
+            std::span<proto::StatusEnum> statuses,
+            std::size_t begin)
+        {
+            for (std::size_t i = begin; i < bodies.positions.size(); ++i) {
+                PhysicState physic{
+                    bodies.positions[i],
+                    bodies.position_dts[i],
+                    bodies.masses[i],
+                    bodies.radii[i] };
+                statuses[i] = CorrectSurface(physic, ground);
+                bodies.positions[i] = physic.position;
+                bodies.position_dts[i] = physic.position_dt;
+            }
+        }
+
+#if defined(DARWIN_PHYSIC_AVX2)
+
+        // 4 bodies (12 doubles) to and from one register by coordinate.
+        DARWIN_TARGET_AVX2 void LoadAvx2(
+            const glm::dvec3* vectors,
+            __m256d& x,
+            __m256d& y,
+            __m256d& z)
+        {
+            const double* data = &vectors[0].x;
+            // [x0 y0 z0 x1] [y1 z1 x2 y2] [z2 x3 y3 z3]
+            const __m256d a = _mm256_loadu_pd(data);
+            const __m256d b = _mm256_loadu_pd(data + 4);
+            const __m256d c = _mm256_loadu_pd(data + 8);
+            // [x0 y0 x2 y2] [y1 z1 y3 z3] [z0 x1 z2 x3]
+            const __m256d t0 = _mm256_blend_pd(a, b, 0b1100);
+            const __m256d t1 = _mm256_blend_pd(b, c, 0b1100);
+            const __m256d t2 = _mm256_permute2f128_pd(a, c, 0x21);
+            x = _mm256_blend_pd(t0, t2, 0b1010);
+            y = _mm256_shuffle_pd(t0, t1, 0b0101);
+            z = _mm256_shuffle_pd(t2, t1, 0b1010);
+        }
+
+        DARWIN_TARGET_AVX2 void StoreAvx2(
+            glm::dvec3* vectors,
+            __m256d x,
+            __m256d y,
+            __m256d z)
+        {
+            double* data = &vectors[0].x;
+            const __m256d t0 = _mm256_shuffle_pd(x, y, 0b0000);
+            const __m256d t1 = _mm256_shuffle_pd(y, z, 0b1111);
+            const __m256d t2 = _mm256_shuffle_pd(z, x, 0b1010);
+            _mm256_storeu_pd(data, _mm256_permute2f128_pd(t0, t2, 0x20));
+            _mm256_storeu_pd(data + 4, _mm256_blend_pd(t1, t0, 0b1100));
+            _mm256_storeu_pd(data + 8, _mm256_permute2f128_pd(t2, t1, 0x31));
+        }
+
+        DARWIN_TARGET_AVX2 __m256d DotAvx2(
+            __m256d ax,
+            __m256d ay,
+            __m256d az,
+            __m256d bx,
+            __m256d by,
+            __m256d bz)
+        {
+            return _mm256_add_pd(
+                _mm256_add_pd(_mm256_mul_pd(ax, bx), _mm256_mul_pd(ay, by)),
+                _mm256_mul_pd(az, bz));
+        }
+
+        DARWIN_TARGET_AVX2 std::size_t ApplyPhysicAvx2(
+            const PhysicState& source,
+            std::span<const glm::dvec3> positions,
+            std::span<const double> masses,
+            std::span<glm::dvec3> forces)
+        {
+            const __m256d sx = _mm256_set1_pd(source.position.x);
+            const __m256d sy = _mm256_set1_pd(source.position.y);
+            const __m256d sz = _mm256_set1_pd(source.position.z);
+            const __m256d source_mass = _mm256_set1_pd(source.mass);
+            const __m256d gravitational_constant =
+                _mm256_set1_pd(GRAVITATIONAL_CONSTANT);
+            const __m256d one = _mm256_set1_pd(1.0);
+            std::size_t i = 0;
+            for (; i + 4 <= positions.size(); i += 4) {
+                __m256d px, py, pz;
+                LoadAvx2(&positions[i], px, py, pz);
+                const __m256d dx = _mm256_sub_pd(sx, px);
+                const __m256d dy = _mm256_sub_pd(sy, py);
+                const __m256d dz = _mm256_sub_pd(sz, pz);
+                const __m256d dot = DotAvx2(dx, dy, dz, dx, dy, dz);
+                const __m256d distance = _mm256_sqrt_pd(dot);
+                const __m256d magnitude = _mm256_div_pd(
+                    _mm256_mul_pd(
+                        gravitational_constant,
+                        _mm256_mul_pd(
+                            source_mass,
+                            _mm256_loadu_pd(&masses[i]))),
+                    _mm256_mul_pd(distance, distance));
+                const __m256d inverse_length = _mm256_div_pd(one, distance);
+                __m256d fx, fy, fz;
+                LoadAvx2(&forces[i], fx, fy, fz);
+                fx = _mm256_add_pd(fx, _mm256_mul_pd(
+                    _mm256_mul_pd(dx, inverse_length), magnitude));
+                fy = _mm256_add_pd(fy, _mm256_mul_pd(
+                    _mm256_mul_pd(dy, inverse_length), magnitude));
+                fz = _mm256_add_pd(fz, _mm256_mul_pd(
+                    _mm256_mul_pd(dz, inverse_length), magnitude));
+                StoreAvx2(&forces[i], fx, fy, fz);
+            }
+            return i;
+        }
+
+        DARWIN_TARGET_AVX2 std::size_t UpdateObjectAvx2(
+            const PhysicBatch& bodies,
+            std::span<const glm::dvec3> forces,
+            double delta_time)
+        {
+            const __m256d dt = _mm256_set1_pd(delta_time);
+            const __m256d half_dt2 =
+                _mm256_set1_pd(delta_time * delta_time * 0.5);
+            std::size_t i = 0;
+            for (; i + 4 <= bodies.positions.size(); i += 4) {
+                __m256d fx, fy, fz, px, py, pz, vx, vy, vz;
+                LoadAvx2(&forces[i], fx, fy, fz);
+                LoadAvx2(&bodies.positions[i], px, py, pz);
+                LoadAvx2(&bodies.position_dts[i], vx, vy, vz);
+                const __m256d mass = _mm256_loadu_pd(&bodies.masses[i]);
+                const __m256d ax = _mm256_div_pd(fx, mass);
+                const __m256d ay = _mm256_div_pd(fy, mass);
+                const __m256d az = _mm256_div_pd(fz, mass);
+                px = _mm256_add_pd(px, _mm256_add_pd(
+                    _mm256_mul_pd(vx, dt), _mm256_mul_pd(ax, half_dt2)));
+                py = _mm256_add_pd(py, _mm256_add_pd(
+                    _mm256_mul_pd(vy, dt), _mm256_mul_pd(ay, half_dt2)));
+                pz = _mm256_add_pd(pz, _mm256_add_pd(
+                    _mm256_mul_pd(vz, dt), _mm256_mul_pd(az, half_dt2)));
+                vx = _mm256_add_pd(vx, _mm256_mul_pd(ax, dt));
+                vy = _mm256_add_pd(vy, _mm256_mul_pd(ay, dt));
+                vz = _mm256_add_pd(vz, _mm256_mul_pd(az, dt));
+                StoreAvx2(&bodies.positions[i], px, py, pz);
+                StoreAvx2(&bodies.position_dts[i], vx, vy, vz);
+            }
+            return i;
+        }
+
+        DARWIN_TARGET_AVX2 std::size_t CorrectSurfaceAvx2(
+            const PhysicBatch& bodies,
+            const PhysicState& ground,
+            std::span<proto::StatusEnum> statuses)
+        {
+            const __m256d gx = _mm256_set1_pd(ground.position.x);
+            const __m256d gy = _mm256_set1_pd(ground.position.y);
+            const __m256d gz = _mm256_set1_pd(ground.position.z);
+            const __m256d ground_radius = _mm256_set1_pd(ground.radius);
+            const __m256d one = _mm256_set1_pd(1.0);
+            std::size_t i = 0;
+            for (; i + 4 <= bodies.positions.size(); i += 4) {
+                __m256d px, py, pz, vx, vy, vz;
+                LoadAvx2(&bodies.positions[i], px, py, pz);
+                LoadAvx2(&bodies.position_dts[i], vx, vy, vz);
+                const __m256d radius = _mm256_add_pd(
+                    _mm256_loadu_pd(&bodies.radii[i]),
+                    ground_radius);
+                const __m256d dx = _mm256_sub_pd(px, gx);
+                const __m256d dy = _mm256_sub_pd(py, gy);
+                const __m256d dz = _mm256_sub_pd(pz, gz);
+                const __m256d dot = DotAvx2(dx, dy, dz, dx, dy, dz);
+                const __m256d distance = _mm256_sqrt_pd(dot);
+                const __m256d on_ground =
+                    _mm256_cmp_pd(distance, radius, _CMP_LT_OQ);
+                const int on_ground_mask = _mm256_movemask_pd(on_ground);
+                for (int j = 0; j < 4; ++j) {
+                    statuses[i + j] = (on_ground_mask & (1 << j)) ?
+                        proto::STATUS_ON_GROUND :
+                        proto::STATUS_JUMPING;
+                }
+                if (on_ground_mask == 0) {
+                    continue;
+                }
+                const __m256d inverse_length = _mm256_div_pd(one, distance);
+                const __m256d nx = _mm256_mul_pd(dx, inverse_length);
+                const __m256d ny = _mm256_mul_pd(dy, inverse_length);
+                const __m256d nz = _mm256_mul_pd(dz, inverse_length);
+                // Cancel the vertical component of the velocity.
+                const __m256d projection_length = _mm256_div_pd(
+                    DotAvx2(vx, vy, vz, nx, ny, nz),
+                    DotAvx2(nx, ny, nz, nx, ny, nz));
+                px = _mm256_blendv_pd(px, _mm256_mul_pd(nx, radius), on_ground);
+                py = _mm256_blendv_pd(py, _mm256_mul_pd(ny, radius), on_ground);
+                pz = _mm256_blendv_pd(pz, _mm256_mul_pd(nz, radius), on_ground);
+                vx = _mm256_blendv_pd(vx, _mm256_sub_pd(
+                    vx, _mm256_mul_pd(nx, projection_length)), on_ground);
+                vy = _mm256_blendv_pd(vy, _mm256_sub_pd(
+                    vy, _mm256_mul_pd(ny, projection_length)), on_ground);
+                vz = _mm256_blendv_pd(vz, _mm256_sub_pd(
+                    vz, _mm256_mul_pd(nz, projection_length)), on_ground);
+                StoreAvx2(&bodies.positions[i], px, py, pz);
+                StoreAvx2(&bodies.position_dts[i], vx, vy, vz);
+            }
+            return i;
+        }
+
+#endif // DARWIN_PHYSIC_AVX2
+
+#if defined(DARWIN_PHYSIC_NEON)
+
+        // 2 bodies by iteration, vld3q_f64 splits the coordinates.
+
+        float64x2_t DotNeon(const float64x2x3_t& a, const float64x2x3_t& b) {
+            return vaddq_f64(
+                vaddq_f64(
+                    vmulq_f64(a.val[0], b.val[0]),
+                    vmulq_f64(a.val[1], b.val[1])),
+                vmulq_f64(a.val[2], b.val[2]));
+        }
+
+        std::size_t ApplyPhysicNeon(
+            const PhysicState& source,
+            std::span<const glm::dvec3> positions,
+            std::span<const double> masses,
+            std::span<glm::dvec3> forces)
+        {
+            const float64x2_t source_mass = vdupq_n_f64(source.mass);
+            const float64x2_t gravitational_constant =
+                vdupq_n_f64(GRAVITATIONAL_CONSTANT);
+            const float64x2_t one = vdupq_n_f64(1.0);
+            std::size_t i = 0;
+            for (; i + 2 <= positions.size(); i += 2) {
+                const float64x2x3_t position = vld3q_f64(&positions[i].x);
+                float64x2x3_t d;
+                for (int k = 0; k < 3; ++k) {
+                    d.val[k] = vsubq_f64(
+                        vdupq_n_f64(source.position[k]),
+                        position.val[k]);
+                }
+                const float64x2_t distance = vsqrtq_f64(DotNeon(d, d));
+                const float64x2_t magnitude = vdivq_f64(
+                    vmulq_f64(
+                        gravitational_constant,
+                        vmulq_f64(source_mass, vld1q_f64(&masses[i]))),
+                    vmulq_f64(distance, distance));
+                const float64x2_t inverse_length = vdivq_f64(one, distance);
+                float64x2x3_t force = vld3q_f64(&forces[i].x);
+                for (int k = 0; k < 3; ++k) {
+                    force.val[k] = vaddq_f64(
+                        force.val[k],
+                        vmulq_f64(
+                            vmulq_f64(d.val[k], inverse_length),
+                            magnitude));
+                }
+                vst3q_f64(&forces[i].x, force);
+            }
+            return i;
+        }
+
+        std::size_t UpdateObjectNeon(
+            const PhysicBatch& bodies,
+            std::span<const glm::dvec3> forces,
+            double delta_time)
+        {
+            const float64x2_t dt = vdupq_n_f64(delta_time);
+            const float64x2_t half_dt2 =
+                vdupq_n_f64(delta_time * delta_time * 0.5);
+            std::size_t i = 0;
+            for (; i + 2 <= bodies.positions.size(); i += 2) {
+                const float64x2x3_t force = vld3q_f64(&forces[i].x);
+                float64x2x3_t position = vld3q_f64(&bodies.positions[i].x);
+                float64x2x3_t position_dt =
+                    vld3q_f64(&bodies.position_dts[i].x);
+                const float64x2_t mass = vld1q_f64(&bodies.masses[i]);
+                for (int k = 0; k < 3; ++k) {
+                    const float64x2_t acceleration =
+                        vdivq_f64(force.val[k], mass);
+                    position.val[k] = vaddq_f64(
+                        position.val[k],
+                        vaddq_f64(
+                            vmulq_f64(position_dt.val[k], dt),
+                            vmulq_f64(acceleration, half_dt2)));
+                    position_dt.val[k] = vaddq_f64(
+                        position_dt.val[k],
+                        vmulq_f64(acceleration, dt));
+                }
+                vst3q_f64(&bodies.positions[i].x, position);
+                vst3q_f64(&bodies.position_dts[i].x, position_dt);
+            }
+            return i;
+        }
+
+        std::size_t CorrectSurfaceNeon(
+            const PhysicBatch& bodies,
+            const PhysicState& ground,
+            std::span<proto::StatusEnum> statuses)
+        {
+            const float64x2_t ground_radius = vdupq_n_f64(ground.radius);
+            const float64x2_t one = vdupq_n_f64(1.0);
+            std::size_t i = 0;
+            for (; i + 2 <= bodies.positions.size(); i += 2) {
+                float64x2x3_t position = vld3q_f64(&bodies.positions[i].x);
+                float64x2x3_t position_dt =
+                    vld3q_f64(&bodies.position_dts[i].x);
+                const float64x2_t radius =
+                    vaddq_f64(vld1q_f64(&bodies.radii[i]), ground_radius);
+                float64x2x3_t d;
+                for (int k = 0; k < 3; ++k) {
+                    d.val[k] = vsubq_f64(
+                        position.val[k],
+                        vdupq_n_f64(ground.position[k]));
+                }
+                const float64x2_t distance = vsqrtq_f64(DotNeon(d, d));
+                const uint64x2_t on_ground = vcltq_f64(distance, radius);
+                for (int j = 0; j < 2; ++j) {
+                    statuses[i + j] =
+                        vgetq_lane_u64(on_ground, 0) && j == 0 ||
+                        vgetq_lane_u64(on_ground, 1) && j == 1 ?
+                            proto::STATUS_ON_GROUND :
+                            proto::STATUS_JUMPING;
+                }
+                const float64x2_t inverse_length = vdivq_f64(one, distance);
+                float64x2x3_t normal;
+                for (int k = 0; k < 3; ++k) {
+                    normal.val[k] = vmulq_f64(d.val[k], inverse_length);
+                }
+                // Cancel the vertical component of the velocity.
+                const float64x2_t projection_length = vdivq_f64(
+                    DotNeon(position_dt, normal),
+                    DotNeon(normal, normal));
+                for (int k = 0; k < 3; ++k) {
+                    position.val[k] = vbslq_f64(
+                        on_ground,
+                        vmulq_f64(normal.val[k], radius),
+                        position.val[k]);
+                    position_dt.val[k] = vbslq_f64(
+                        on_ground,
+                        vsubq_f64(
+                            position_dt.val[k],
+                            vmulq_f64(normal.val[k], projection_length)),
+                        position_dt.val[k]);
+                }
+                vst3q_f64(&bodies.positions[i].x, position);
+                vst3q_f64(&bodies.position_dts[i].x, position_dt);
+            }
+            return i;
+        }
+
+#endif // DARWIN_PHYSIC_NEON
+
+    }  // End namespace.
+
+    PhysicKernelEnum GetPhysicKernel() {
+        return g_physic_kernel.load(std::memory_order_relaxed);
+    }
+
+    bool SetPhysicKernel(PhysicKernelEnum physic_kernel) {
+        if (!IsPhysicKernelSupported(physic_kernel)) {
+            return false;
+        }
+        g_physic_kernel.store(physic_kernel, std::memory_order_relaxed);
+        return true;
+    }
+
+    const char* GetPhysicKernelName(PhysicKernelEnum physic_kernel) {
+        switch (physic_kernel) {
+            case PhysicKernelEnum::PHYSIC_KERNEL_SCALAR:
+                return "scalar";
+            case PhysicKernelEnum::PHYSIC_KERNEL_AVX2:
+                return "avx2";
+            case PhysicKernelEnum::PHYSIC_KERNEL_NEON:
+                return "neon";
+        }
+        return "unknown";
+    }
+
+    void ApplyPhysicBatch(
+        const PhysicState& source,
+        std::span<const glm::dvec3> positions,
+        std::span<const double> masses,
+        std::span<glm::dvec3> forces)
+    {
+        assert(masses.size() == positions.size());
+        assert(forces.size() == positions.size());
+        std::size_t begin = 0;
+        switch (GetPhysicKernel()) {
+#if defined(DARWIN_PHYSIC_AVX2)
+            case PhysicKernelEnum::PHYSIC_KERNEL_AVX2:
+                begin = ApplyPhysicAvx2(source, positions, masses, forces);
+                break;
+#endif
+#if defined(DARWIN_PHYSIC_NEON)
+            case PhysicKernelEnum::PHYSIC_KERNEL_NEON:
+                begin = ApplyPhysicNeon(source, positions, masses, forces);
+                break;
+#endif
+            default:
+                break;
+        }
+        ApplyPhysicScalar(source, positions, masses, forces, begin);
+    }
+
+    void UpdateObjectBatch(
+        const PhysicBatch& bodies,
+        std::span<const glm::dvec3> forces,
+        double delta_time)
+    {
+        assert(bodies.position_dts.size() == bodies.positions.size());
+        assert(bodies.masses.size() == bodies.positions.size());
+        assert(forces.size() == bodies.positions.size());
+        std::size_t begin = 0;
+        switch (GetPhysicKernel()) {
+#if defined(DARWIN_PHYSIC_AVX2)
+            case PhysicKernelEnum::PHYSIC_KERNEL_AVX2:
+                begin = UpdateObjectAvx2(bodies, forces, delta_time);
+                break;
+#endif
+#if defined(DARWIN_PHYSIC_NEON)
+            case PhysicKernelEnum::PHYSIC_KERNEL_NEON:
+                begin = UpdateObjectNeon(bodies, forces, delta_time);
+                break;
+#endif
+            default:
+                break;
+        }
+        UpdateObjectScalar(bodies, forces, delta_time, begin);
+    }
+
+    void CorrectSurfaceBatch(
+        const PhysicBatch& bodies,
+        const PhysicState& ground,
+        std::span<proto::StatusEnum> statuses)
+    {
+        assert(bodies.position_dts.size() == bodies.positions.size());
+        assert(bodies.radii.size() == bodies.positions.size());
+        assert(statuses.size() == bodies.positions.size());
+        std::size_t begin = 0;
+        switch (GetPhysicKernel()) {
+#if defined(DARWIN_PHYSIC_AVX2)
+            case PhysicKernelEnum::PHYSIC_KERNEL_AVX2:
+                begin = CorrectSurfaceAvx2(bodies, ground, statuses);
+                break;
+#endif
+#if defined(DARWIN_PHYSIC_NEON)
+            case PhysicKernelEnum::PHYSIC_KERNEL_NEON:
+                begin = CorrectSurfaceNeon(bodies, ground, statuses);
+                break;
+#endif
+            default:
+                break;
+        }
+        CorrectSurfaceScalar(bodies, ground, statuses, begin);
+    }
+
+} // namespace darwin.
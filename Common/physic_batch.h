@@ -0,0 +1,50 @@
+#pragma once
+
+#include <span>
+#include <glm/glm.hpp>
+
+#include "Common/physic.h"
+
+namespace darwin {
+
+    // Bodies as structure of arrays, all the spans have the same size.
+    struct PhysicBatch {
+        std::span<glm::dvec3> positions;
+        std::span<glm::dvec3> position_dts;
+        std::span<const double> masses;
+        std::span<const double> radii;
+    };
+
+    // Kernels of the batched functions, the best one the CPU supports is
+    // chosen at startup. They all give the same results (no fused
+    // multiply-add) as the PhysicState functions.
+    enum class PhysicKernelEnum {
+        PHYSIC_KERNEL_SCALAR,
+        PHYSIC_KERNEL_AVX2,
+        PHYSIC_KERNEL_NEON,
+    };
+
+    PhysicKernelEnum GetPhysicKernel();
+    // Return false (and keep the kernel) if the CPU doesn't support it.
+    bool SetPhysicKernel(PhysicKernelEnum physic_kernel);
+    const char* GetPhysicKernelName(PhysicKernelEnum physic_kernel);
+
+    // Add the gravity of source to the forces of the bodies.
+    void ApplyPhysicBatch(
+        const PhysicState& source,
+        std::span<const glm::dvec3> positions,
+        std::span<const double> masses,
+        std::span<glm::dvec3> forces);
+    // Integrate the forces over delta_time (see UpdateObject).
+    void UpdateObjectBatch(
+        const PhysicBatch& bodies,
+        std::span<const glm::dvec3> forces,
+        double delta_time);
+    // Put the bodies under the ground back on it (see CorrectSurface), the
+    // statuses are set to STATUS_ON_GROUND or STATUS_JUMPING.
+    void CorrectSurfaceBatch(
+        const PhysicBatch& bodies,
+        const PhysicState& ground,
+        std::span<proto::StatusEnum> statuses);
+
+} // namespace darwin.
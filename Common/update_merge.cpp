@@ -0,0 +1,123 @@
+#include "Common/update_merge.h"
+
+namespace darwin {
+
+    namespace {
+
+        void MergeElement(
+            const proto::Element& delta,
+            proto::Element& element)
+        {
+            if (delta.has_physic()) {
+                element.mutable_physic()->CopyFrom(delta.physic());
+            }
+            if (delta.has_color()) {
+                element.mutable_color()->CopyFrom(delta.color());
+                element.set_type_enum(delta.type_enum());
+            }
+        }
+
+        void MergeCharacter(
+            const proto::Character& delta,
+            proto::Character& character)
+        {
+            if (delta.has_physic()) {
+                character.mutable_physic()->CopyFrom(delta.physic());
+            }
+            if (delta.has_color()) {
+                character.mutable_color()->CopyFrom(delta.color());
+                character.set_character_type(delta.character_type());
+            }
+            if (delta.has_special_effect_boost()) {
+                character.mutable_g_force()->CopyFrom(delta.g_force());
+                character.mutable_normal()->CopyFrom(delta.normal());
+                character.set_status_enum(delta.status_enum());
+                character.mutable_special_effect_boost()->CopyFrom(
+                    delta.special_effect_boost());
+            }
+        }
+
+    }  // End anonymous namespace.
+
+    void MergeUpdateResponse(
+        const proto::UpdateResponse& response,
+        std::map<std::string, proto::Element>& elements,
+        std::map<std::string, proto::Character>& characters)
+    {
+        // Entities named in every update, no handle to remember.
+        std::map<std::uint32_t, std::string> names;
+        MergeUpdateResponse(response, names, elements, characters);
+    }
+
+    void MergeUpdateResponse(
+        const proto::UpdateResponse& response,
+        std::map<std::uint32_t, std::string>& names,
+        std::map<std::string, proto::Element>& elements,
+        std::map<std::string, proto::Character>& characters)
+    {
+        if (response.baseline_sequence() == 0) {
+            names.clear();
+            elements.clear();
+            characters.clear();
+        }
+        // Removal first, a name can be removed and added again.
+        for (const auto& name : response.removed_elements()) {
+            elements.erase(name);
+        }
+        for (const auto& name : response.removed_characters()) {
+            characters.erase(name);
+        }
+        auto erase_handle = [&names](std::uint32_t handle, auto& entities) {
+            auto it = names.find(handle);
+            if (it != names.end()) {
+                entities.erase(it->second);
+                names.erase(it);
+            }
+        };
+        for (const auto handle : response.removed_element_handles()) {
+            erase_handle(handle, elements);
+        }
+        for (const auto handle : response.removed_character_handles()) {
+            erase_handle(handle, characters);
+        }
+        // Name of an entity, an entity with a handle is named only when it
+        // is introduced (nullptr if the handle is unknown).
+        auto get_name = [&names](const auto& entity) -> const std::string* {
+            if (entity.handle() == 0) {
+                return &entity.name();
+            }
+            if (!entity.name().empty()) {
+                return &(names[entity.handle()] = entity.name());
+            }
+            auto it = names.find(entity.handle());
+            return it != names.end() ? &it->second : nullptr;
+        };
+        for (const auto& element : response.elements()) {
+            const std::string* name = get_name(element);
+            if (!name) {
+                continue;
+            }
+            auto it = elements.find(*name);
+            if (it == elements.end()) {
+                elements.insert({ *name, element });
+            }
+            else {
+                MergeElement(element, it->second);
+            }
+        }
+        for (const auto& character : response.characters()) {
+            const std::string* name = get_name(character);
+            if (!name) {
+                continue;
+            }
+            auto it = characters.find(*name);
+            if (it == characters.end()) {
+                characters.insert({ *name, character });
+            }
+            else {
+                MergeCharacter(character, it->second);
+            }
+        }
+    }
+
+} // End namespace darwin.
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+#include "darwin_service.pb.h"
+
+namespace darwin {
+
+    // Apply an update response (full or delta) to the known entities by
+    // name. A full update (baseline_sequence == 0) replace everything.
+    void MergeUpdateResponse(
+        const proto::UpdateResponse& response,
+        std::map<std::string, proto::Element>& elements,
+        std::map<std::string, proto::Character>& characters);
+    // Same for the updates that identify the entities by handle (see
+    // UpdateRequest.handles), names holds the name of every known handle.
+    void MergeUpdateResponse(
+        const proto::UpdateResponse& response,
+        std::map<std::uint32_t, std::string>& names,
+        std::map<std::string, proto::Element>& elements,
+        std::map<std::string, proto::Character>& characters);
+
+} // End namespace darwin.
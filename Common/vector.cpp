@@ -2,9 +2,19 @@
 
 #include <random>
 #include <array>
+#include <mutex>
 
 namespace darwin {
 
+    namespace {
+
+        // Shared by every thread (characters are created on the service
+        // threads, upgrades on the tick).
+        std::mutex g_random_mutex;
+        std::mt19937_64 g_random_engine{ std::random_device{}() };
+
+    }  // End namespace.
+
     proto::Vector2 CreateVector2(
         double x,
         double y)
@@ -112,15 +122,22 @@ namespace darwin {
         return normalized_vector3;
     }
 
+    void SetRandomSeed(std::uint64_t seed)
+    {
+        std::scoped_lock l(g_random_mutex);
+        g_random_engine.seed(seed);
+    }
+
     proto::Vector3 CreateRandomNormalizedVector3()
     {
-        std::random_device rd;
-        std::mt19937 gen(rd());
         std::uniform_real_distribution<double> dis(-1.0, 1.0);
         proto::Vector3 vector3{};
-        vector3.set_x(dis(gen));
-        vector3.set_y(dis(gen));
-        vector3.set_z(dis(gen));
+        {
+            std::scoped_lock l(g_random_mutex);
+            vector3.set_x(dis(g_random_engine));
+            vector3.set_y(dis(g_random_engine));
+            vector3.set_z(dis(g_random_engine));
+        }
         return Normalize(vector3);
     }
 
@@ -128,11 +145,14 @@ namespace darwin {
         std::vector<proto::Vector3>::const_iterator color_begin,
         std::vector<proto::Vector3>::const_iterator color_end)
     {
-        std::random_device rd;
-        std::mt19937 gen(rd());
         auto distance = std::distance(color_begin, color_end);
         std::uniform_int_distribution<int> dis(0, distance - 1);
-        return Normalize(*(color_begin + dis(gen)));
+        int index = 0;
+        {
+            std::scoped_lock l(g_random_mutex);
+            index = dis(g_random_engine);
+        }
+        return Normalize(*(color_begin + index));
     }
 
     bool IsInColorRange(
@@ -24,6 +24,9 @@ namespace darwin {
         const proto::Vector3& vector3_left,
         const proto::Vector3& vector3_right);
     proto::Vector3 Normalize(const proto::Vector3& vector3);
+    // Seed the generator of the random functions (seeded from the device
+    // by default), the same seed gives the same draws.
+    void SetRandomSeed(std::uint64_t seed);
     proto::Vector3 CreateRandomNormalizedVector3();
     proto::Vector3 CreateRandomNormalizedColor(
         std::vector<proto::Vector3>::const_iterator color_begin,
@@ -68,6 +68,9 @@ extern SpecialEffectParameterDefaultTypeInternal _SpecialEffectParameter_default
 class WorldDatabase;
 struct WorldDatabaseDefaultTypeInternal;
 extern WorldDatabaseDefaultTypeInternal _WorldDatabase_default_instance_;
+class WorldJournalEntry;
+struct WorldJournalEntryDefaultTypeInternal;
+extern WorldJournalEntryDefaultTypeInternal _WorldJournalEntry_default_instance_;
 }  // namespace proto
 PROTOBUF_NAMESPACE_OPEN
 template<> ::proto::Character* Arena::CreateMaybeMessage<::proto::Character>(Arena*);
@@ -77,6 +80,7 @@ template<> ::proto::Physic* Arena::CreateMaybeMessage<::proto::Physic>(Arena*);
 template<> ::proto::PlayerParameter* Arena::CreateMaybeMessage<::proto::PlayerParameter>(Arena*);
 template<> ::proto::SpecialEffectParameter* Arena::CreateMaybeMessage<::proto::SpecialEffectParameter>(Arena*);
 template<> ::proto::WorldDatabase* Arena::CreateMaybeMessage<::proto::WorldDatabase>(Arena*);
+template<> ::proto::WorldJournalEntry* Arena::CreateMaybeMessage<::proto::WorldJournalEntry>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace proto {
 
@@ -791,6 +795,7 @@ class Element final :
     kColorFieldNumber = 2,
     kPhysicFieldNumber = 3,
     kTypeEnumFieldNumber = 4,
+    kHandleFieldNumber = 5,
   };
   // string name = 1;
   void clear_name();
@@ -851,6 +856,15 @@ class Element final :
   void _internal_set_type_enum(::proto::TypeEnum value);
   public:
 
+  // uint32 handle = 5;
+  void clear_handle();
+  uint32_t handle() const;
+  void set_handle(uint32_t value);
+  private:
+  uint32_t _internal_handle() const;
+  void _internal_set_handle(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:proto.Element)
  private:
   class _Internal;
@@ -863,6 +877,7 @@ class Element final :
     ::proto::Vector3* color_;
     ::proto::Physic* physic_;
     int type_enum_;
+    uint32_t handle_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -999,6 +1014,7 @@ class Character final :
     kSpecialEffectBoostFieldNumber = 7,
     kStatusEnumFieldNumber = 6,
     kCharacterTypeFieldNumber = 8,
+    kHandleFieldNumber = 9,
   };
   // string name = 1;
   void clear_name();
@@ -1122,6 +1138,15 @@ class Character final :
   void _internal_set_character_type(::proto::CharacterTypeEnum value);
   public:
 
+  // uint32 handle = 9;
+  void clear_handle();
+  uint32_t handle() const;
+  void set_handle(uint32_t value);
+  private:
+  uint32_t _internal_handle() const;
+  void _internal_set_handle(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:proto.Character)
  private:
   class _Internal;
@@ -1138,6 +1163,7 @@ class Character final :
     ::proto::SpecialEffectParameter* special_effect_boost_;
     int status_enum_;
     int character_type_;
+    uint32_t handle_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -1833,6 +1859,246 @@ class WorldDatabase final :
   union { Impl_ _impl_; };
   friend struct ::TableStruct_world_5fparameter_2eproto;
 };
+// -------------------------------------------------------------------
+
+class WorldJournalEntry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.WorldJournalEntry) */ {
+ public:
+  inline WorldJournalEntry() : WorldJournalEntry(nullptr) {}
+  ~WorldJournalEntry() override;
+  explicit PROTOBUF_CONSTEXPR WorldJournalEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WorldJournalEntry(const WorldJournalEntry& from);
+  WorldJournalEntry(WorldJournalEntry&& from) noexcept
+    : WorldJournalEntry() {
+    *this = ::std::move(from);
+  }
+
+  inline WorldJournalEntry& operator=(const WorldJournalEntry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WorldJournalEntry& operator=(WorldJournalEntry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WorldJournalEntry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WorldJournalEntry* internal_default_instance() {
+    return reinterpret_cast<const WorldJournalEntry*>(
+               &_WorldJournalEntry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(WorldJournalEntry& a, WorldJournalEntry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WorldJournalEntry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WorldJournalEntry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WorldJournalEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WorldJournalEntry>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WorldJournalEntry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WorldJournalEntry& from) {
+    WorldJournalEntry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WorldJournalEntry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto.WorldJournalEntry";
+  }
+  protected:
+  explicit WorldJournalEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kElementsFieldNumber = 2,
+    kRemovedElementsFieldNumber = 3,
+    kCharactersFieldNumber = 4,
+    kRemovedCharactersFieldNumber = 5,
+    kTimeFieldNumber = 1,
+  };
+  // repeated .proto.Element elements = 2;
+  int elements_size() const;
+  private:
+  int _internal_elements_size() const;
+  public:
+  void clear_elements();
+  ::proto::Element* mutable_elements(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Element >*
+      mutable_elements();
+  private:
+  const ::proto::Element& _internal_elements(int index) const;
+  ::proto::Element* _internal_add_elements();
+  public:
+  const ::proto::Element& elements(int index) const;
+  ::proto::Element* add_elements();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Element >&
+      elements() const;
+
+  // repeated string removed_elements = 3;
+  int removed_elements_size() const;
+  private:
+  int _internal_removed_elements_size() const;
+  public:
+  void clear_removed_elements();
+  const std::string& removed_elements(int index) const;
+  std::string* mutable_removed_elements(int index);
+  void set_removed_elements(int index, const std::string& value);
+  void set_removed_elements(int index, std::string&& value);
+  void set_removed_elements(int index, const char* value);
+  void set_removed_elements(int index, const char* value, size_t size);
+  std::string* add_removed_elements();
+  void add_removed_elements(const std::string& value);
+  void add_removed_elements(std::string&& value);
+  void add_removed_elements(const char* value);
+  void add_removed_elements(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& removed_elements() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_removed_elements();
+  private:
+  const std::string& _internal_removed_elements(int index) const;
+  std::string* _internal_add_removed_elements();
+  public:
+
+  // repeated .proto.Character characters = 4;
+  int characters_size() const;
+  private:
+  int _internal_characters_size() const;
+  public:
+  void clear_characters();
+  ::proto::Character* mutable_characters(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Character >*
+      mutable_characters();
+  private:
+  const ::proto::Character& _internal_characters(int index) const;
+  ::proto::Character* _internal_add_characters();
+  public:
+  const ::proto::Character& characters(int index) const;
+  ::proto::Character* add_characters();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Character >&
+      characters() const;
+
+  // repeated string removed_characters = 5;
+  int removed_characters_size() const;
+  private:
+  int _internal_removed_characters_size() const;
+  public:
+  void clear_removed_characters();
+  const std::string& removed_characters(int index) const;
+  std::string* mutable_removed_characters(int index);
+  void set_removed_characters(int index, const std::string& value);
+  void set_removed_characters(int index, std::string&& value);
+  void set_removed_characters(int index, const char* value);
+  void set_removed_characters(int index, const char* value, size_t size);
+  std::string* add_removed_characters();
+  void add_removed_characters(const std::string& value);
+  void add_removed_characters(std::string&& value);
+  void add_removed_characters(const char* value);
+  void add_removed_characters(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& removed_characters() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_removed_characters();
+  private:
+  const std::string& _internal_removed_characters(int index) const;
+  std::string* _internal_add_removed_characters();
+  public:
+
+  // double time = 1;
+  void clear_time();
+  double time() const;
+  void set_time(double value);
+  private:
+  double _internal_time() const;
+  void _internal_set_time(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto.WorldJournalEntry)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Element > elements_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> removed_elements_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Character > characters_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> removed_characters_;
+    double time_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_world_5fparameter_2eproto;
+};
 // ===================================================================
 
 
@@ -2557,6 +2823,26 @@ inline void Element::set_type_enum(::proto::TypeEnum value) {
   // @@protoc_insertion_point(field_set:proto.Element.type_enum)
 }
 
+// uint32 handle = 5;
+inline void Element::clear_handle() {
+  _impl_.handle_ = 0u;
+}
+inline uint32_t Element::_internal_handle() const {
+  return _impl_.handle_;
+}
+inline uint32_t Element::handle() const {
+  // @@protoc_insertion_point(field_get:proto.Element.handle)
+  return _internal_handle();
+}
+inline void Element::_internal_set_handle(uint32_t value) {
+  
+  _impl_.handle_ = value;
+}
+inline void Element::set_handle(uint32_t value) {
+  _internal_set_handle(value);
+  // @@protoc_insertion_point(field_set:proto.Element.handle)
+}
+
 // -------------------------------------------------------------------
 
 // Character
@@ -3086,6 +3372,26 @@ inline void Character::set_character_type(::proto::CharacterTypeEnum value) {
   // @@protoc_insertion_point(field_set:proto.Character.character_type)
 }
 
+// uint32 handle = 9;
+inline void Character::clear_handle() {
+  _impl_.handle_ = 0u;
+}
+inline uint32_t Character::_internal_handle() const {
+  return _impl_.handle_;
+}
+inline uint32_t Character::handle() const {
+  // @@protoc_insertion_point(field_get:proto.Character.handle)
+  return _internal_handle();
+}
+inline void Character::_internal_set_handle(uint32_t value) {
+  
+  _impl_.handle_ = value;
+}
+inline void Character::set_handle(uint32_t value) {
+  _internal_set_handle(value);
+  // @@protoc_insertion_point(field_set:proto.Character.handle)
+}
+
 // -------------------------------------------------------------------
 
 // ColorParameter
@@ -3793,6 +4099,260 @@ inline void WorldDatabase::set_allocated_player_parameter(::proto::PlayerParamet
   // @@protoc_insertion_point(field_set_allocated:proto.WorldDatabase.player_parameter)
 }
 
+// -------------------------------------------------------------------
+
+// WorldJournalEntry
+
+// double time = 1;
+inline void WorldJournalEntry::clear_time() {
+  _impl_.time_ = 0;
+}
+inline double WorldJournalEntry::_internal_time() const {
+  return _impl_.time_;
+}
+inline double WorldJournalEntry::time() const {
+  // @@protoc_insertion_point(field_get:proto.WorldJournalEntry.time)
+  return _internal_time();
+}
+inline void WorldJournalEntry::_internal_set_time(double value) {
+  
+  _impl_.time_ = value;
+}
+inline void WorldJournalEntry::set_time(double value) {
+  _internal_set_time(value);
+  // @@protoc_insertion_point(field_set:proto.WorldJournalEntry.time)
+}
+
+// repeated .proto.Element elements = 2;
+inline int WorldJournalEntry::_internal_elements_size() const {
+  return _impl_.elements_.size();
+}
+inline int WorldJournalEntry::elements_size() const {
+  return _internal_elements_size();
+}
+inline void WorldJournalEntry::clear_elements() {
+  _impl_.elements_.Clear();
+}
+inline ::proto::Element* WorldJournalEntry::mutable_elements(int index) {
+  // @@protoc_insertion_point(field_mutable:proto.WorldJournalEntry.elements)
+  return _impl_.elements_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Element >*
+WorldJournalEntry::mutable_elements() {
+  // @@protoc_insertion_point(field_mutable_list:proto.WorldJournalEntry.elements)
+  return &_impl_.elements_;
+}
+inline const ::proto::Element& WorldJournalEntry::_internal_elements(int index) const {
+  return _impl_.elements_.Get(index);
+}
+inline const ::proto::Element& WorldJournalEntry::elements(int index) const {
+  // @@protoc_insertion_point(field_get:proto.WorldJournalEntry.elements)
+  return _internal_elements(index);
+}
+inline ::proto::Element* WorldJournalEntry::_internal_add_elements() {
+  return _impl_.elements_.Add();
+}
+inline ::proto::Element* WorldJournalEntry::add_elements() {
+  ::proto::Element* _add = _internal_add_elements();
+  // @@protoc_insertion_point(field_add:proto.WorldJournalEntry.elements)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Element >&
+WorldJournalEntry::elements() const {
+  // @@protoc_insertion_point(field_list:proto.WorldJournalEntry.elements)
+  return _impl_.elements_;
+}
+
+// repeated string removed_elements = 3;
+inline int WorldJournalEntry::_internal_removed_elements_size() const {
+  return _impl_.removed_elements_.size();
+}
+inline int WorldJournalEntry::removed_elements_size() const {
+  return _internal_removed_elements_size();
+}
+inline void WorldJournalEntry::clear_removed_elements() {
+  _impl_.removed_elements_.Clear();
+}
+inline std::string* WorldJournalEntry::add_removed_elements() {
+  std::string* _s = _internal_add_removed_elements();
+  // @@protoc_insertion_point(field_add_mutable:proto.WorldJournalEntry.removed_elements)
+  return _s;
+}
+inline const std::string& WorldJournalEntry::_internal_removed_elements(int index) const {
+  return _impl_.removed_elements_.Get(index);
+}
+inline const std::string& WorldJournalEntry::removed_elements(int index) const {
+  // @@protoc_insertion_point(field_get:proto.WorldJournalEntry.removed_elements)
+  return _internal_removed_elements(index);
+}
+inline std::string* WorldJournalEntry::mutable_removed_elements(int index) {
+  // @@protoc_insertion_point(field_mutable:proto.WorldJournalEntry.removed_elements)
+  return _impl_.removed_elements_.Mutable(index);
+}
+inline void WorldJournalEntry::set_removed_elements(int index, const std::string& value) {
+  _impl_.removed_elements_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:proto.WorldJournalEntry.removed_elements)
+}
+inline void WorldJournalEntry::set_removed_elements(int index, std::string&& value) {
+  _impl_.removed_elements_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:proto.WorldJournalEntry.removed_elements)
+}
+inline void WorldJournalEntry::set_removed_elements(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.removed_elements_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proto.WorldJournalEntry.removed_elements)
+}
+inline void WorldJournalEntry::set_removed_elements(int index, const char* value, size_t size) {
+  _impl_.removed_elements_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proto.WorldJournalEntry.removed_elements)
+}
+inline std::string* WorldJournalEntry::_internal_add_removed_elements() {
+  return _impl_.removed_elements_.Add();
+}
+inline void WorldJournalEntry::add_removed_elements(const std::string& value) {
+  _impl_.removed_elements_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proto.WorldJournalEntry.removed_elements)
+}
+inline void WorldJournalEntry::add_removed_elements(std::string&& value) {
+  _impl_.removed_elements_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proto.WorldJournalEntry.removed_elements)
+}
+inline void WorldJournalEntry::add_removed_elements(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.removed_elements_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proto.WorldJournalEntry.removed_elements)
+}
+inline void WorldJournalEntry::add_removed_elements(const char* value, size_t size) {
+  _impl_.removed_elements_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proto.WorldJournalEntry.removed_elements)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+WorldJournalEntry::removed_elements() const {
+  // @@protoc_insertion_point(field_list:proto.WorldJournalEntry.removed_elements)
+  return _impl_.removed_elements_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+WorldJournalEntry::mutable_removed_elements() {
+  // @@protoc_insertion_point(field_mutable_list:proto.WorldJournalEntry.removed_elements)
+  return &_impl_.removed_elements_;
+}
+
+// repeated .proto.Character characters = 4;
+inline int WorldJournalEntry::_internal_characters_size() const {
+  return _impl_.characters_.size();
+}
+inline int WorldJournalEntry::characters_size() const {
+  return _internal_characters_size();
+}
+inline void WorldJournalEntry::clear_characters() {
+  _impl_.characters_.Clear();
+}
+inline ::proto::Character* WorldJournalEntry::mutable_characters(int index) {
+  // @@protoc_insertion_point(field_mutable:proto.WorldJournalEntry.characters)
+  return _impl_.characters_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Character >*
+WorldJournalEntry::mutable_characters() {
+  // @@protoc_insertion_point(field_mutable_list:proto.WorldJournalEntry.characters)
+  return &_impl_.characters_;
+}
+inline const ::proto::Character& WorldJournalEntry::_internal_characters(int index) const {
+  return _impl_.characters_.Get(index);
+}
+inline const ::proto::Character& WorldJournalEntry::characters(int index) const {
+  // @@protoc_insertion_point(field_get:proto.WorldJournalEntry.characters)
+  return _internal_characters(index);
+}
+inline ::proto::Character* WorldJournalEntry::_internal_add_characters() {
+  return _impl_.characters_.Add();
+}
+inline ::proto::Character* WorldJournalEntry::add_characters() {
+  ::proto::Character* _add = _internal_add_characters();
+  // @@protoc_insertion_point(field_add:proto.WorldJournalEntry.characters)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Character >&
+WorldJournalEntry::characters() const {
+  // @@protoc_insertion_point(field_list:proto.WorldJournalEntry.characters)
+  return _impl_.characters_;
+}
+
+// repeated string removed_characters = 5;
+inline int WorldJournalEntry::_internal_removed_characters_size() const {
+  return _impl_.removed_characters_.size();
+}
+inline int WorldJournalEntry::removed_characters_size() const {
+  return _internal_removed_characters_size();
+}
+inline void WorldJournalEntry::clear_removed_characters() {
+  _impl_.removed_characters_.Clear();
+}
+inline std::string* WorldJournalEntry::add_removed_characters() {
+  std::string* _s = _internal_add_removed_characters();
+  // @@protoc_insertion_point(field_add_mutable:proto.WorldJournalEntry.removed_characters)
+  return _s;
+}
+inline const std::string& WorldJournalEntry::_internal_removed_characters(int index) const {
+  return _impl_.removed_characters_.Get(index);
+}
+inline const std::string& WorldJournalEntry::removed_characters(int index) const {
+  // @@protoc_insertion_point(field_get:proto.WorldJournalEntry.removed_characters)
+  return _internal_removed_characters(index);
+}
+inline std::string* WorldJournalEntry::mutable_removed_characters(int index) {
+  // @@protoc_insertion_point(field_mutable:proto.WorldJournalEntry.removed_characters)
+  return _impl_.removed_characters_.Mutable(index);
+}
+inline void WorldJournalEntry::set_removed_characters(int index, const std::string& value) {
+  _impl_.removed_characters_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:proto.WorldJournalEntry.removed_characters)
+}
+inline void WorldJournalEntry::set_removed_characters(int index, std::string&& value) {
+  _impl_.removed_characters_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:proto.WorldJournalEntry.removed_characters)
+}
+inline void WorldJournalEntry::set_removed_characters(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.removed_characters_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proto.WorldJournalEntry.removed_characters)
+}
+inline void WorldJournalEntry::set_removed_characters(int index, const char* value, size_t size) {
+  _impl_.removed_characters_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proto.WorldJournalEntry.removed_characters)
+}
+inline std::string* WorldJournalEntry::_internal_add_removed_characters() {
+  return _impl_.removed_characters_.Add();
+}
+inline void WorldJournalEntry::add_removed_characters(const std::string& value) {
+  _impl_.removed_characters_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proto.WorldJournalEntry.removed_characters)
+}
+inline void WorldJournalEntry::add_removed_characters(std::string&& value) {
+  _impl_.removed_characters_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proto.WorldJournalEntry.removed_characters)
+}
+inline void WorldJournalEntry::add_removed_characters(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.removed_characters_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proto.WorldJournalEntry.removed_characters)
+}
+inline void WorldJournalEntry::add_removed_characters(const char* value, size_t size) {
+  _impl_.removed_characters_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proto.WorldJournalEntry.removed_characters)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+WorldJournalEntry::removed_characters() const {
+  // @@protoc_insertion_point(field_list:proto.WorldJournalEntry.removed_characters)
+  return _impl_.removed_characters_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+WorldJournalEntry::mutable_removed_characters() {
+  // @@protoc_insertion_point(field_mutable_list:proto.WorldJournalEntry.removed_characters)
+  return &_impl_.removed_characters_;
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -3808,6 +4368,8 @@ inline void WorldDatabase::set_allocated_player_parameter(::proto::PlayerParamet
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
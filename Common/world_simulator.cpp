@@ -31,52 +31,66 @@ namespace darwin {
                 std::chrono::system_clock::now().time_since_epoch()).count();
     }
 
-    std::vector<proto::Element> WorldSimulator::GetGForceElementsLocked() {
-        std::vector<proto::Element> result;
-        for (auto& element : elements_) {
+    void WorldSimulator::UpdateGroundStatesLocked() {
+        ground_states_.clear();
+        for (const auto& element : elements_) {
             if (element.type_enum() == proto::TYPE_GROUND) {
-                result.push_back(element);
+                ground_states_.push_back(GetPhysicState(element.physic()));
             }
         }
-        return result;
     }
 
     void WorldSimulator::ApplyGForceAndSpeedToCharacterLocked(
-        const std::vector<proto::Element>& static_elements,
         double delta_time)
     {
         if ((delta_time < 0.0001) || (delta_time > 1.0)) return;
-        // Apply it to characters.
+        simulated_.clear();
+        positions_.clear();
+        position_dts_.clear();
+        masses_.clear();
+        radii_.clear();
         for (auto& character : characters_) {
             // TODO(anirul): Temporary hack.
             if (character.name() != name_) continue;
-            glm::dvec3 force = glm::dvec3(0.0);
-            // Add all gravity forces.
-            for (const auto& element : static_elements) {
-                auto result = ApplyPhysic(
-                    element.physic(),
-                    character.physic());
-                force = force + result;
-            }
+            auto physic = GetPhysicState(character.physic());
+            simulated_.push_back(&character);
+            positions_.push_back(physic.position);
+            position_dts_.push_back(physic.position_dt);
+            masses_.push_back(physic.mass);
+            radii_.push_back(physic.radius);
+        }
+        forces_.assign(simulated_.size(), glm::dvec3(0.0));
+        statuses_.resize(simulated_.size());
+        PhysicBatch bodies{ positions_, position_dts_, masses_, radii_ };
+        // Add all gravity forces.
+        for (const auto& ground : ground_states_) {
+            ApplyPhysicBatch(ground, positions_, masses_, forces_);
+        }
+        // Update the physic part of the characters.
+        UpdateObjectBatch(bodies, forces_, delta_time);
+        // Correct the surface, the last ground gives the status.
+        for (const auto& ground : ground_states_) {
+            CorrectSurfaceBatch(bodies, ground, statuses_);
+        }
+        for (std::size_t i = 0; i < simulated_.size(); ++i) {
+            auto& character = *simulated_[i];
             // Update the g part of the character.
-            character.mutable_g_force()->CopyFrom(
-                Glm2ProtoVector(force));
-            character.mutable_normal()->CopyFrom(
-                Glm2ProtoVector(glm::normalize(-force)));
-            // Update the physic part of the character.
-            UpdateObject(
-                *character.mutable_physic(),
-                force,
-                delta_time);
-            // Correct the surface.
-            for (auto& element : static_elements) {
-                auto status_result = CorrectSurface(
-                    *character.mutable_physic(),
-                    element);
-                if (status_result != character.status_enum()) {
-                    character.set_status_enum(status_result);
-                }
+            Glm2ProtoVector(*character.mutable_g_force(), forces_[i]);
+            Glm2ProtoVector(
+                *character.mutable_normal(),
+                glm::normalize(-forces_[i]));
+            if (!ground_states_.empty() &&
+                statuses_[i] != character.status_enum())
+            {
+                character.set_status_enum(statuses_[i]);
             }
+            SetPhysicState(
+                *character.mutable_physic(),
+                PhysicState{
+                    positions_[i],
+                    position_dts_[i],
+                    masses_[i],
+                    radii_[i] });
         }
     }
 
@@ -90,10 +104,16 @@ namespace darwin {
         time_ += elapsed_seconds;
         last_time_ = now;
         // Get gravity forces.
-        std::vector<proto::Element> static_elements = 
-            GetGForceElementsLocked();
+        UpdateGroundStatesLocked();
         // Apply gravity forces to characters.
-        ApplyGForceAndSpeedToCharacterLocked(static_elements, elapsed_seconds);
+        ApplyGForceAndSpeedToCharacterLocked(elapsed_seconds);
+    }
+
+    void WorldSimulator::Simulate(double delta_time) {
+        std::lock_guard l(mutex_);
+        time_ += delta_time;
+        UpdateGroundStatesLocked();
+        ApplyGForceAndSpeedToCharacterLocked(delta_time);
     }
 
     UniformEnum WorldSimulator::GetUniforms() const {
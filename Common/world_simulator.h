@@ -3,6 +3,8 @@
 #include <vector>
 #include <glm/glm.hpp>
 #include "darwin_service.pb.h"
+#include "physic.h"
+#include "physic_batch.h"
 
 namespace darwin {
 
@@ -26,6 +28,9 @@ namespace darwin {
             const std::vector<proto::Character>& characters,
             double time);
         void UpdateTime();
+        // Move the player character forward by delta_time (s), UpdateTime
+        // does it with the time elapsed since the previous call.
+        void Simulate(double delta_time);
         UniformEnum GetUniforms() const;
         UniformEnum GetCloseUniforms(
             const proto::Vector3& normal, 
@@ -84,10 +89,8 @@ namespace darwin {
             double delta_time) const;
         glm::vec4 GetColor(const proto::Element& element) const;
         glm::vec4 GetColor(const proto::Character& character) const;
-        std::vector<proto::Element> GetGForceElementsLocked();
-        void ApplyGForceAndSpeedToCharacterLocked(
-            const std::vector<proto::Element>& static_elements,
-            double delta_time);
+        void UpdateGroundStatesLocked();
+        void ApplyGForceAndSpeedToCharacterLocked(double delta_time);
 
     private:
         std::string name_;
@@ -95,6 +98,18 @@ namespace darwin {
         mutable std::mutex mutex_;
         std::vector<proto::Element> elements_;
         std::vector<proto::Character> characters_;
+        // Physic of the ground elements, refilled every frame (the capacity
+        // is kept).
+        std::vector<PhysicState> ground_states_;
+        // Simulated characters as structure of arrays for the batched
+        // physic, also refilled every frame.
+        std::vector<proto::Character*> simulated_;
+        std::vector<glm::dvec3> positions_;
+        std::vector<glm::dvec3> position_dts_;
+        std::vector<double> masses_;
+        std::vector<double> radii_;
+        std::vector<glm::dvec3> forces_;
+        std::vector<proto::StatusEnum> statuses_;
         proto::Character player_character_;
         double time_;
         double last_server_update_time_;
@@ -0,0 +1,47 @@
+#include <chrono>
+#include <format>
+#include <iostream>
+#include <absl/flags/flag.h>
+#include <absl/flags/parse.h>
+
+#include "Server/world_snapshot.h"
+
+ABSL_FLAG(
+    std::string,
+    input,
+    "world_db.json",
+    "The world database to convert (json or binary snapshot).");
+ABSL_FLAG(
+    std::string,
+    output,
+    "world_db.bin",
+    "The converted world database, a json extension means json.");
+
+int main(int ac, char** av) try {
+    absl::ParseCommandLine(ac, av);
+    const std::filesystem::path input = absl::GetFlag(FLAGS_input);
+    const std::filesystem::path output = absl::GetFlag(FLAGS_output);
+    const bool input_json = input.extension() == ".json";
+    const bool output_json = output.extension() == ".json";
+    if (input_json == output_json) {
+        throw std::runtime_error(
+            "One (and only one) of input and output should be json.");
+    }
+    const auto start = std::chrono::steady_clock::now();
+    if (input_json) {
+        darwin::ConvertJsonToSnapshot(input, output);
+    }
+    else {
+        darwin::ConvertSnapshotToJson(input, output);
+    }
+    std::cout << std::format(
+        "converted {} to {} in {:.3f}s\n",
+        input.string(),
+        output.string(),
+        std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count());
+    return 0;
+} catch (const std::exception& e) {
+    std::cerr << "Error: " << e.what() << std::endl;
+    return 1;
+}
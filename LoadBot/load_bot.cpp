@@ -0,0 +1,399 @@
+#include "load_bot.h"
+
+#include <cmath>
+#include <numbers>
+
+#include "Common/convert_math.h"
+#include "Common/darwin_constant.h"
+#include "Common/update_merge.h"
+#include "Common/vector.h"
+
+namespace darwin {
+
+    namespace {
+
+        double SecondsSince(std::chrono::steady_clock::time_point start) {
+            return std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - start).count();
+        }
+
+    }  // End namespace.
+
+    LoadBot::LoadBot(
+        const std::string& server_name,
+        const std::string& name,
+        LoadStatistics& statistics,
+        std::uint32_t seed) :
+        name_(name),
+        statistics_(statistics),
+        random_engine_(seed)
+    {
+        // A channel (and a connection) by bot, the server knows the players
+        // by peer.
+        grpc::ChannelArguments arguments;
+        arguments.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+        stub_ = proto::DarwinService::NewStub(
+            grpc::CreateCustomChannel(
+                server_name,
+                grpc::InsecureChannelCredentials(),
+                arguments));
+        heading_ = std::uniform_real_distribution<double>(
+            0.0, 2.0 * std::numbers::pi)(random_engine_);
+    }
+
+    void LoadBot::Start() {
+        ping_request_.set_value(1);
+        const auto start = Clock::now();
+        stub_->async()->Ping(
+            &ping_context_,
+            &ping_request_,
+            &ping_response_,
+            [this, start](grpc::Status status) {
+                statistics_.ping_latency.Add(SecondsSince(start));
+                if (!status.ok()) {
+                    {
+                        std::scoped_lock l(mutex_);
+                        FinishLocked(
+                            LoadBotStatusEnum::LOAD_BOT_STATUS_FAILED);
+                    }
+                    SetDone();
+                    return;
+                }
+                {
+                    std::scoped_lock l(mutex_);
+                    player_parameter_ = ping_response_.player_parameter();
+                    world_simulator_.SetPlayerParameter(player_parameter_);
+                }
+                CreateCharacter();
+            });
+    }
+
+    void LoadBot::CreateCharacter() {
+        bool stop_requested = false;
+        {
+            std::scoped_lock l(mutex_);
+            stop_requested = stop_requested_;
+        }
+        if (stop_requested) {
+            SetDone();
+            return;
+        }
+        create_request_.set_name(name_);
+        create_request_.mutable_color()->CopyFrom(
+            CreateRandomNormalizedVector3());
+        const auto start = Clock::now();
+        stub_->async()->CreateCharacter(
+            &create_context_,
+            &create_request_,
+            &create_response_,
+            [this, start](grpc::Status status) {
+                statistics_.create_character_latency.Add(
+                    SecondsSince(start));
+                if (status.ok()) {
+                    StartPlay();
+                    return;
+                }
+                {
+                    std::scoped_lock l(mutex_);
+                    FinishLocked(LoadBotStatusEnum::LOAD_BOT_STATUS_FAILED);
+                }
+                SetDone();
+            });
+    }
+
+    void LoadBot::StartPlay() {
+        {
+            std::scoped_lock l(mutex_);
+            if (!stop_requested_) {
+                status_ = LoadBotStatusEnum::LOAD_BOT_STATUS_PLAYING;
+                play_started_ = true;
+                stub_->async()->Play(&play_context_, this);
+                proto::PlayRequest request;
+                request.mutable_update_request()->set_name(name_);
+                request.mutable_update_request()->set_delta(true);
+                request.mutable_update_request()->set_handles(true);
+                StartWriteLocked(request);
+                StartRead(&play_response_);
+                StartCall();
+                return;
+            }
+        }
+        SetDone();
+    }
+
+    void LoadBot::Stop() {
+        std::scoped_lock l(mutex_);
+        stop_requested_ = true;
+        ping_context_.TryCancel();
+        create_context_.TryCancel();
+        if (play_started_) {
+            play_context_.TryCancel();
+        }
+    }
+
+    bool LoadBot::IsDone() const {
+        return done_;
+    }
+
+    LoadBotStatusEnum LoadBot::GetStatus() const {
+        std::scoped_lock l(mutex_);
+        return status_;
+    }
+
+    void LoadBot::OnReadDone(bool ok) {
+        if (!ok) {
+            return;
+        }
+        std::scoped_lock l(mutex_);
+        const auto now = Clock::now();
+        double delta_time = 0.0;
+        if (last_update_ != Clock::time_point{}) {
+            delta_time =
+                std::chrono::duration<double>(now - last_update_).count();
+            statistics_.update_interval.Add(delta_time);
+            if (last_interval_ != 0.0) {
+                statistics_.update_jitter.Add(
+                    std::abs(delta_time - last_interval_));
+            }
+            last_interval_ = delta_time;
+        }
+        last_update_ = now;
+        // Reports applied by the server since the last update.
+        while (!sent_reports_.empty() &&
+            sent_reports_.front().first <= play_response_.report_sequence())
+        {
+            statistics_.report_latency.Add(
+                std::chrono::duration<double>(
+                    now - sent_reports_.front().second).count());
+            sent_reports_.pop_front();
+        }
+        const proto::UpdateResponse& response = play_response_.update();
+        MergeUpdateResponse(response, names_, elements_, characters_);
+        if (status_ == LoadBotStatusEnum::LOAD_BOT_STATUS_PLAYING) {
+            auto it = characters_.find(name_);
+            if (it != characters_.end()) {
+                has_character_ = true;
+            }
+            if (it == characters_.end() && has_character_) {
+                FinishLocked(LoadBotStatusEnum::LOAD_BOT_STATUS_DEAD);
+            }
+            else if (it != characters_.end() &&
+                it->second.status_enum() == proto::STATUS_DEAD)
+            {
+                FinishLocked(
+                    it->second.physic().mass() >=
+                        player_parameter_.victory_size() ?
+                    LoadBotStatusEnum::LOAD_BOT_STATUS_VICTORY :
+                    LoadBotStatusEnum::LOAD_BOT_STATUS_DEAD);
+            }
+            else {
+                std::vector<proto::Element> elements;
+                elements.reserve(elements_.size());
+                for (const auto& [_, element] : elements_) {
+                    elements.push_back(element);
+                }
+                std::vector<proto::Character> characters;
+                characters.reserve(characters_.size());
+                for (const auto& [_, character] : characters_) {
+                    characters.push_back(character);
+                }
+                world_simulator_.SetUserName(name_);
+                world_simulator_.UpdateData(
+                    elements,
+                    characters,
+                    response.time());
+                if (has_character_) {
+                    SimulateLocked(delta_time);
+                }
+                SendReportLocked(response.sequence());
+            }
+        }
+        StartRead(&play_response_);
+    }
+
+    void LoadBot::SimulateLocked(double delta_time) {
+        world_simulator_.UpdateTime();
+        auto character = world_simulator_.GetCharacterByName(name_);
+        PlayerInput player_input;
+        if (character.status_enum() == proto::STATUS_ON_GROUND) {
+            std::uniform_real_distribution<double> uniform(0.0, 1.0);
+            proto::Physic physic = character.physic();
+            // Wander: the heading slowly turns.
+            heading_ += (uniform(random_engine_) - 0.5) * delta_time * 4.0;
+            const auto normal = Normalize(character.normal());
+            auto east = Cross(CreateVector3(0.0, 0.0, 1.0), normal);
+            if (Length(east) < 1e-6) {
+                east = CreateVector3(1.0, 0.0, 0.0);
+            }
+            east = Normalize(east);
+            const auto north = Cross(normal, east);
+            const auto direction = Normalize(
+                north * std::cos(heading_) + east * std::sin(heading_));
+            player_input.direction = ProtoVector2Glm(direction);
+            // Same acceleration and friction as the client.
+            const double friction_delta_time =
+                player_parameter_.friction() *
+                delta_time / std::log(std::max(physic.mass(), 2.0));
+            const double acceleration_delta_time =
+                friction_delta_time *
+                player_parameter_.horizontal_speed() *
+                player_parameter_.horizontal_speed();
+            const double current_speed = Length(physic.position_dt());
+            auto position_dt =
+                physic.position_dt() +
+                direction * acceleration_delta_time;
+            if (current_speed > 0.0) {
+                position_dt = position_dt -
+                    Normalize(physic.position_dt()) *
+                    friction_delta_time * current_speed * current_speed;
+            }
+            // Jump now and then.
+            if (uniform(random_engine_) < 0.02) {
+                position_dt = position_dt +
+                    normal * player_parameter_.vertical_speed();
+                character.set_status_enum(proto::STATUS_JUMPING);
+                player_input.jump = true;
+            }
+            // Hold the boost a few updates now and then.
+            if (boost_updates_ == 0 && uniform(random_engine_) < 0.01) {
+                boost_updates_ = 5;
+            }
+            if (boost_updates_ > 0) {
+                --boost_updates_;
+                position_dt = direction * player_parameter_.boost_speed();
+                player_input.boost = true;
+                character.mutable_special_effect_boost()
+                    ->set_special_state_enum(proto::SPECIAL_STATE_ACTIVE);
+            }
+            else {
+                character.mutable_special_effect_boost()
+                    ->set_special_state_enum(proto::SPECIAL_STATE_WAIT);
+            }
+            physic.mutable_position_dt()->CopyFrom(position_dt);
+            character.mutable_physic()->CopyFrom(physic);
+            world_simulator_.SetCharacter(character);
+        }
+        // The same inputs for the server, split in frames it accepts.
+        for (double remaining_time = delta_time; remaining_time > 0.0;) {
+            player_input.duration =
+                std::min(remaining_time, MAX_INPUT_DURATION);
+            remaining_time -= player_input.duration;
+            auto* input_command = input_commands_.Add();
+            input_command->set_sequence(++input_sequence_);
+            SetInputCommand(*input_command, player_input);
+            player_input.jump = false;
+        }
+        const auto hit = world_simulator_.GetPotentialHit(character);
+        if (!hit.empty() && hit != "earth") {
+            potential_hit_ = hit;
+        }
+    }
+
+    void LoadBot::SendReportLocked(std::uint64_t acknowledged_sequence) {
+        proto::PlayRequest request;
+        request.set_sequence(++report_sequence_);
+        auto* report = request.mutable_report();
+        report->set_name(has_character_ ? name_ : "");
+        report->set_acknowledged_sequence(acknowledged_sequence);
+        if (has_character_) {
+            const auto character = world_simulator_.GetCharacterByName(name_);
+            report->mutable_physic()->CopyFrom(character.physic());
+            report->set_status_enum(
+                character.status_enum() == proto::STATUS_LOADING ?
+                    proto::STATUS_JUMPING :
+                    character.status_enum());
+            report->mutable_special_effect_boost()->CopyFrom(
+                character.special_effect_boost());
+            report->set_potential_hit(potential_hit_);
+            potential_hit_.clear();
+            report->mutable_input_commands()->Swap(&input_commands_);
+            input_commands_.Clear();
+        }
+        sent_reports_.push_back({ report_sequence_, Clock::now() });
+        StartWriteLocked(request);
+    }
+
+    void LoadBot::StartWriteLocked(const proto::PlayRequest& request) {
+        if (writes_done_) {
+            return;
+        }
+        // Only the newest report waits for the write in flight.
+        if (write_in_flight_) {
+            // The inputs of a replaced report are still to be simulated.
+            google::protobuf::RepeatedPtrField<proto::InputCommand>
+                input_commands;
+            if (has_pending_request_) {
+                input_commands.Swap(
+                    pending_request_.mutable_report()
+                        ->mutable_input_commands());
+            }
+            pending_request_ = request;
+            auto* report = pending_request_.mutable_report();
+            input_commands.MergeFrom(report->input_commands());
+            report->mutable_input_commands()->Swap(&input_commands);
+            has_pending_request_ = true;
+            return;
+        }
+        write_request_ = request;
+        write_in_flight_ = true;
+        StartWrite(&write_request_);
+    }
+
+    void LoadBot::OnWriteDone(bool ok) {
+        std::scoped_lock l(mutex_);
+        write_in_flight_ = false;
+        if (!ok) {
+            return;
+        }
+        if (has_pending_request_) {
+            has_pending_request_ = false;
+            write_request_ = std::move(pending_request_);
+            write_in_flight_ = true;
+            StartWrite(&write_request_);
+            return;
+        }
+        if (status_ != LoadBotStatusEnum::LOAD_BOT_STATUS_PLAYING &&
+            !writes_done_)
+        {
+            writes_done_ = true;
+            StartWritesDone();
+        }
+    }
+
+    void LoadBot::FinishLocked(LoadBotStatusEnum status) {
+        if (status_ != LoadBotStatusEnum::LOAD_BOT_STATUS_PLAYING &&
+            status_ != LoadBotStatusEnum::LOAD_BOT_STATUS_STARTING)
+        {
+            return;
+        }
+        if (stop_requested_ &&
+            status == LoadBotStatusEnum::LOAD_BOT_STATUS_FAILED)
+        {
+            return;
+        }
+        status_ = status;
+        has_pending_request_ = false;
+        // Close the stream once the last write is done.
+        if (play_started_ && !write_in_flight_ && !writes_done_) {
+            writes_done_ = true;
+            StartWritesDone();
+        }
+    }
+
+    void LoadBot::SetDone() {
+        done_ = true;
+    }
+
+    void LoadBot::OnDone(const grpc::Status& status) {
+        {
+            std::scoped_lock l(mutex_);
+            if (status_ == LoadBotStatusEnum::LOAD_BOT_STATUS_PLAYING &&
+                !stop_requested_)
+            {
+                status_ = LoadBotStatusEnum::LOAD_BOT_STATUS_FAILED;
+            }
+        }
+        SetDone();
+    }
+
+}  // End namespace darwin.
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <grpc++/grpc++.h>
+
+#include "Common/darwin_service.grpc.pb.h"
+#include "Common/physic.h"
+#include "Common/world_simulator.h"
+#include "LoadBot/load_statistics.h"
+
+namespace darwin {
+
+    enum class LoadBotStatusEnum {
+        LOAD_BOT_STATUS_STARTING,
+        LOAD_BOT_STATUS_PLAYING,
+        LOAD_BOT_STATUS_DEAD,
+        LOAD_BOT_STATUS_VICTORY,
+        LOAD_BOT_STATUS_FAILED,
+    };
+
+    // A headless player: Ping, CreateCharacter, then a Play stream where
+    // every update steps a WorldSimulator and sends back a report (moves,
+    // jumps, boosts and hits) until the character dies or wins. Each bot has
+    // its own channel so that the server sees a peer by bot. Everything runs
+    // on the gRPC callback threads.
+    class LoadBot :
+        public grpc::ClientBidiReactor<proto::PlayRequest, proto::PlayResponse>
+    {
+    public:
+        LoadBot(
+            const std::string& server_name,
+            const std::string& name,
+            LoadStatistics& statistics,
+            std::uint32_t seed);
+
+    public:
+        void Start();
+        // Cancel the calls, the bot is done once IsDone.
+        void Stop();
+        bool IsDone() const;
+        LoadBotStatusEnum GetStatus() const;
+
+    public:
+        void OnReadDone(bool ok) override;
+        void OnWriteDone(bool ok) override;
+        void OnDone(const grpc::Status& status) override;
+
+    protected:
+        void CreateCharacter();
+        void StartPlay();
+        // Move, jump, boost and look for a hit like a player would.
+        void SimulateLocked(double delta_time);
+        void SendReportLocked(std::uint64_t acknowledged_sequence);
+        void StartWriteLocked(const proto::PlayRequest& request);
+        void FinishLocked(LoadBotStatusEnum status);
+        // Last call of a bot, it can be deleted right after.
+        void SetDone();
+
+    private:
+        using Clock = std::chrono::steady_clock;
+        std::unique_ptr<proto::DarwinService::Stub> stub_;
+        std::string name_;
+        LoadStatistics& statistics_;
+        std::mt19937 random_engine_;
+        mutable std::mutex mutex_;
+        LoadBotStatusEnum status_ =
+            LoadBotStatusEnum::LOAD_BOT_STATUS_STARTING;
+        bool stop_requested_ = false;
+        std::atomic<bool> done_ = false;
+        // Unary calls.
+        grpc::ClientContext ping_context_;
+        proto::PingRequest ping_request_;
+        proto::PingResponse ping_response_;
+        grpc::ClientContext create_context_;
+        proto::CreateCharacterRequest create_request_;
+        proto::CreateCharacterResponse create_response_;
+        // Play stream.
+        grpc::ClientContext play_context_;
+        bool play_started_ = false;
+        proto::PlayResponse play_response_;
+        // The request being written and the newest one waiting for it.
+        proto::PlayRequest write_request_;
+        proto::PlayRequest pending_request_;
+        bool write_in_flight_ = false;
+        bool has_pending_request_ = false;
+        bool writes_done_ = false;
+        std::uint64_t report_sequence_ = 0;
+        std::deque<std::pair<std::uint64_t, Clock::time_point>> sent_reports_;
+        // World as seen by the bot.
+        WorldSimulator world_simulator_;
+        proto::PlayerParameter player_parameter_;
+        // Entity names by handle (the updates are by handle).
+        std::map<std::uint32_t, std::string> names_;
+        std::map<std::string, proto::Element> elements_;
+        std::map<std::string, proto::Character> characters_;
+        bool has_character_ = false;
+        Clock::time_point last_update_;
+        double last_interval_ = 0.0;
+        // Inputs.
+        double heading_ = 0.0;
+        int boost_updates_ = 0;
+        std::string potential_hit_;
+        // Inputs since the last report.
+        google::protobuf::RepeatedPtrField<proto::InputCommand>
+            input_commands_;
+        std::uint32_t input_sequence_ = 0;
+    };
+
+}  // End namespace darwin.
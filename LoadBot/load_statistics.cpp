@@ -0,0 +1,47 @@
+#include "load_statistics.h"
+
+#include <algorithm>
+
+namespace darwin {
+
+    void SampleRecorder::Add(double sample) {
+        std::scoped_lock l(mutex_);
+        samples_.push_back(sample);
+    }
+
+    void SampleRecorder::Clear() {
+        std::scoped_lock l(mutex_);
+        samples_.clear();
+    }
+
+    Percentiles SampleRecorder::GetPercentiles() const {
+        std::vector<double> samples;
+        {
+            std::scoped_lock l(mutex_);
+            samples = samples_;
+        }
+        Percentiles percentiles;
+        percentiles.count = samples.size();
+        if (samples.empty()) {
+            return percentiles;
+        }
+        std::sort(samples.begin(), samples.end());
+        auto at = [&samples](double ratio) {
+            return samples[static_cast<std::size_t>(
+                ratio * static_cast<double>(samples.size() - 1) + 0.5)];
+        };
+        percentiles.p50 = at(0.5);
+        percentiles.p99 = at(0.99);
+        percentiles.max = samples.back();
+        return percentiles;
+    }
+
+    void LoadStatistics::Clear() {
+        update_interval.Clear();
+        update_jitter.Clear();
+        report_latency.Clear();
+        create_character_latency.Clear();
+        ping_latency.Clear();
+    }
+
+}  // End namespace darwin.
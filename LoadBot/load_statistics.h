@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace darwin {
+
+    // Percentiles of samples (in seconds).
+    struct Percentiles {
+        std::size_t count = 0;
+        double p50 = 0.0;
+        double p99 = 0.0;
+        double max = 0.0;
+    };
+
+    // Samples added by all the bots, cleared at each stage of the ramp.
+    class SampleRecorder {
+    public:
+        void Add(double sample);
+        void Clear();
+        Percentiles GetPercentiles() const;
+
+    private:
+        mutable std::mutex mutex_;
+        std::vector<double> samples_;
+    };
+
+    struct LoadStatistics {
+        // Time between two updates received by a bot.
+        SampleRecorder update_interval;
+        // Difference between two consecutive update intervals.
+        SampleRecorder update_jitter;
+        // From a report to the first update that applied it.
+        SampleRecorder report_latency;
+        SampleRecorder create_character_latency;
+        SampleRecorder ping_latency;
+
+        void Clear();
+    };
+
+}  // End namespace darwin.
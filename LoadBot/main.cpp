@@ -0,0 +1,186 @@
+#include <grpc++/grpc++.h>
+
+#include <chrono>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <thread>
+#include <absl/flags/flag.h>
+#include <absl/flags/parse.h>
+
+#include "Common/darwin_service.grpc.pb.h"
+#include "LoadBot/load_bot.h"
+#include "LoadBot/load_statistics.h"
+
+ABSL_FLAG(
+    std::string,
+    server_name,
+    "localhost:45323",
+    "The name of the server to connect to.");
+ABSL_FLAG(
+    std::vector<std::string>,
+    player_counts,
+    std::vector<std::string>(
+        { "10", "20", "50", "100", "200", "500", "1000", "2000", "5000" }),
+    "The number of players at each stage of the ramp.");
+ABSL_FLAG(
+    double,
+    stage_duration,
+    10.0,
+    "The time in seconds each stage of the ramp is measured.");
+ABSL_FLAG(
+    double,
+    ping_period,
+    1.0,
+    "The time in seconds between each ping for the server tick time.");
+ABSL_FLAG(
+    std::string,
+    result_file,
+    "",
+    "The file the results are also written to.");
+
+namespace {
+
+    std::string FormatPercentiles(const darwin::Percentiles& percentiles) {
+        return std::format(
+            "{:>9.2f}{:>9.2f}{:>9.2f}",
+            percentiles.p50 * 1000.0,
+            percentiles.p99 * 1000.0,
+            percentiles.max * 1000.0);
+    }
+
+}  // End namespace.
+
+int main(int ac, char** av) try {
+    absl::ParseCommandLine(ac, av);
+    gpr_set_log_verbosity(GPR_LOG_SEVERITY_ERROR);
+
+    const std::string server_name = absl::GetFlag(FLAGS_server_name);
+    auto stub = proto::DarwinService::NewStub(
+        grpc::CreateChannel(server_name, grpc::InsecureChannelCredentials()));
+    darwin::LoadStatistics statistics;
+    std::list<std::unique_ptr<darwin::LoadBot>> bots;
+    std::uint32_t next_bot = 0;
+    std::uint64_t dead_count = 0;
+    std::uint64_t victory_count = 0;
+    std::uint64_t failed_count = 0;
+    std::ofstream result_file;
+    if (!absl::GetFlag(FLAGS_result_file).empty()) {
+        result_file.open(absl::GetFlag(FLAGS_result_file));
+    }
+    auto print = [&result_file](const std::string& line) {
+        std::cout << line << std::flush;
+        if (result_file.is_open()) {
+            result_file << line << std::flush;
+        }
+    };
+    print(std::format(
+        "{:>7}{:>7}{:>7}{:>7}{:>7} | {:^27} | {:^27} | {:^27} | {:^27} | "
+        "{:^27}\n",
+        "players",
+        "alive",
+        "dead",
+        "won",
+        "failed",
+        "server step (ms)",
+        "update interval (ms)",
+        "update jitter (ms)",
+        "report latency (ms)",
+        "create character (ms)"));
+
+    const auto stage_duration = std::chrono::duration<double>(
+        absl::GetFlag(FLAGS_stage_duration));
+    const auto ping_period = std::chrono::duration<double>(
+        absl::GetFlag(FLAGS_ping_period));
+    for (const auto& player_count_string :
+        absl::GetFlag(FLAGS_player_counts))
+    {
+        const std::size_t player_count = std::stoul(player_count_string);
+        // Replace the bots that died or won, and grow to the stage count.
+        statistics.Clear();
+        while (bots.size() < player_count) {
+            bots.push_back(
+                std::make_unique<darwin::LoadBot>(
+                    server_name,
+                    std::format("bot_{}", next_bot),
+                    statistics,
+                    next_bot));
+            bots.back()->Start();
+            ++next_bot;
+        }
+        // Measure the stage and keep the server tick time.
+        proto::TickStatistics tick_statistics;
+        const auto stage_end =
+            std::chrono::steady_clock::now() + stage_duration;
+        while (std::chrono::steady_clock::now() < stage_end) {
+            proto::PingRequest request;
+            proto::PingResponse response;
+            grpc::ClientContext context;
+            request.set_value(0);
+            if (stub->Ping(&context, request, &response).ok()) {
+                tick_statistics = response.tick_statistics();
+            }
+            std::this_thread::sleep_for(ping_period);
+        }
+        // Count and drop the bots that are done.
+        std::size_t alive = 0;
+        for (auto it = bots.begin(); it != bots.end();) {
+            if (!(*it)->IsDone()) {
+                if ((*it)->GetStatus() ==
+                    darwin::LoadBotStatusEnum::LOAD_BOT_STATUS_PLAYING)
+                {
+                    ++alive;
+                }
+                ++it;
+                continue;
+            }
+            switch ((*it)->GetStatus()) {
+            case darwin::LoadBotStatusEnum::LOAD_BOT_STATUS_DEAD:
+                ++dead_count;
+                break;
+            case darwin::LoadBotStatusEnum::LOAD_BOT_STATUS_VICTORY:
+                ++victory_count;
+                break;
+            case darwin::LoadBotStatusEnum::LOAD_BOT_STATUS_FAILED:
+                ++failed_count;
+                break;
+            default:
+                break;
+            }
+            it = bots.erase(it);
+        }
+        print(std::format(
+            "{:>7}{:>7}{:>7}{:>7}{:>7} | {:>9.2f}{:>9.2f}{:>9.2f} | {} | {} "
+            "| {} | {}\n",
+            player_count,
+            alive,
+            dead_count,
+            victory_count,
+            failed_count,
+            tick_statistics.step_p50() * 1000.0,
+            tick_statistics.step_p99() * 1000.0,
+            tick_statistics.step_max() * 1000.0,
+            FormatPercentiles(statistics.update_interval.GetPercentiles()),
+            FormatPercentiles(statistics.update_jitter.GetPercentiles()),
+            FormatPercentiles(statistics.report_latency.GetPercentiles()),
+            FormatPercentiles(
+                statistics.create_character_latency.GetPercentiles())));
+    }
+
+    // Wait for all the calls to be cancelled before the bots go away.
+    for (auto& bot : bots) {
+        bot->Stop();
+    }
+    for (auto& bot : bots) {
+        while (!bot->IsDone()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+    bots.clear();
+    return 0;
+} catch (const std::exception& e) {
+    std::cerr << "Error: " << e.what() << std::endl;
+    return 1;
+}
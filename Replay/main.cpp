@@ -0,0 +1,90 @@
+#include <algorithm>
+#include <format>
+#include <iostream>
+#include <optional>
+#include <absl/flags/flag.h>
+#include <absl/flags/parse.h>
+
+#include "Server/world_recorder.h"
+#include "Server/world_replay.h"
+#include "Server/world_snapshot.h"
+#include "Server/world_state_file.h"
+
+ABSL_FLAG(
+    std::string,
+    input,
+    "world_recording.bin",
+    "The recording to replay (see the record_file flag of the server).");
+ABSL_FLAG(
+    std::uint32_t,
+    repeat,
+    1,
+    "The number of replays, each one in a fresh world.");
+ABSL_FLAG(
+    std::string,
+    expected_hash,
+    "",
+    "The hash (hexadecimal) the world should end with, from a previous "
+    "replay (not checked if empty).");
+ABSL_FLAG(
+    std::string,
+    output,
+    "",
+    "The file the world is saved to at the end, a json extension means "
+    "json (not saved if empty).");
+
+int main(int ac, char** av) try {
+    absl::ParseCommandLine(ac, av);
+    const std::filesystem::path input = absl::GetFlag(FLAGS_input);
+    proto::RecordingHeader header;
+    std::vector<proto::RecordedEvent> events;
+    darwin::LoadWorldRecording(input, header, events);
+    std::cout << std::format(
+        "loaded {} events from {} (random seed: {})\n",
+        events.size(),
+        input.string(),
+        header.random_seed());
+    std::optional<std::uint64_t> world_hash;
+    const std::uint32_t repeat = std::max(absl::GetFlag(FLAGS_repeat), 1u);
+    for (std::uint32_t i = 0; i < repeat; ++i) {
+        darwin::WorldState world_state;
+        const auto result =
+            darwin::ReplayWorldRecording(world_state, header, events);
+        std::cout << std::format(
+            "replay {}: steps: {} events: {} duration: {:.3f}s "
+            "steps/s: {:.1f} hash: {:016x}\n",
+            i,
+            result.step_count,
+            result.event_count,
+            result.duration,
+            result.duration > 0.0 ? result.step_count / result.duration : 0.0,
+            result.world_hash);
+        if (world_hash && *world_hash != result.world_hash) {
+            throw std::runtime_error("The replays ended on different worlds.");
+        }
+        world_hash = result.world_hash;
+        const std::filesystem::path output = absl::GetFlag(FLAGS_output);
+        if (i == 0 && !output.empty()) {
+            if (output.extension() == ".json") {
+                darwin::SaveWorldStateToFile(world_state, output);
+            }
+            else {
+                darwin::SaveWorldStateToSnapshot(world_state, output);
+            }
+        }
+    }
+    const std::string expected_hash = absl::GetFlag(FLAGS_expected_hash);
+    if (!expected_hash.empty() &&
+        std::stoull(expected_hash, nullptr, 16) != *world_hash)
+    {
+        std::cerr << std::format(
+            "Error: world hash {:016x} expected {}\n",
+            *world_hash,
+            expected_hash);
+        return 1;
+    }
+    return 0;
+} catch (const std::exception& e) {
+    std::cerr << "Error: " << e.what() << std::endl;
+    return 1;
+}
@@ -1,6 +1,11 @@
 #pragma once
 
+#include <string>
+#include <vector>
+
 #include "Common/darwin_service.grpc.pb.h"
+#include "Common/physic.h"
+#include "Server/entity_store.h"
 
 namespace darwin {
 
@@ -9,4 +14,21 @@ namespace darwin {
         proto::Character character;
     };
 
+    // Character simulated on the server from the inputs of its player.
+    struct CharacterInputState {
+        std::string name;
+        // Frames to simulate, in order.
+        std::vector<PlayerInput> player_inputs;
+        // Mass spent (living cost and boost) by the reports.
+        double mass_cost = 0.0;
+        // Read from the world state, simulated and written back.
+        PhysicState physic;
+        proto::StatusEnum status_enum = proto::STATUS_UNKNOWN;
+        glm::dvec3 normal = glm::dvec3(0.0);
+        glm::dvec3 g_force = glm::dvec3(0.0);
+        // Read from the world state too, run by the frames (the boost of a
+        // frame is only asked for) and written back.
+        SpecialEffect special_effect_boost;
+    };
+
 }  // End namespace darwin.
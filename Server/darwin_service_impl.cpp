@@ -11,49 +11,171 @@
 
 namespace darwin {
 
-    grpc::Status DarwinServiceImpl::Update(
-        grpc::ServerContext* context,
-        const proto::UpdateRequest* request,
-        grpc::ServerWriter<proto::UpdateResponse>* writer)
+    namespace {
+
+        grpc::ServerUnaryReactor* FinishUnary(
+            grpc::CallbackServerContext* context,
+            const grpc::Status& status)
+        {
+            auto* reactor = context->DefaultReactor();
+            reactor->Finish(status);
+            return reactor;
+        }
+
+        proto::RecordedEvent CreateRecordedEvent(
+            proto::RecordedEventEnum recorded_event_enum,
+            const std::string& peer)
+        {
+            proto::RecordedEvent event;
+            event.set_time(GetTimeSecondNow());
+            event.set_recorded_event_enum(recorded_event_enum);
+            event.set_peer(peer);
+            return event;
+        }
+
+        WireIdEnum GetWireId(const proto::UpdateRequest& update_request) {
+            return update_request.handles() ?
+                WireIdEnum::WIRE_ID_HANDLE :
+                WireIdEnum::WIRE_ID_NAME;
+        }
+
+    }  // End anonymous namespace.
+
+    DarwinServiceImpl::~DarwinServiceImpl() {
+        // The world state outlives the service and its worker pool.
+        world_state_.SetWorkerPool(nullptr);
+    }
+
+    grpc::ServerWriteReactor<grpc::ByteBuffer>* DarwinServiceImpl::Update(
+        grpc::CallbackServerContext* context,
+        const grpc::ByteBuffer* request)
     {
+        const std::string peer = context->peer();
+        auto* writer = new UpdateWriter([this, peer](UpdateWriter* writer) {
+            RemoveUpdateStream(writer, peer);
+            delete writer;
+        });
+        proto::UpdateRequest update_request;
+        grpc::ByteBuffer request_buffer(*request);
+        auto status =
+            grpc::SerializationTraits<proto::UpdateRequest>::Deserialize(
+                &request_buffer,
+                &update_request);
+        if (!status.ok()) {
+            writer->Close(status);
+            return writer;
+        }
 #ifdef _DEBUG
         std::cout <<
             std::format(
                 "[{}] Added a writer {}\n",
-                context->peer(),
-                request->name());
+                peer,
+                update_request.name());
 #endif
+        std::lock_guard<std::mutex> lock(writers_mutex_);
+        writers_.push_back({
+            peer,
+            writer,
+            update_request.delta(),
+            GetWireId(update_request) });
+        return writer;
+    }
+
+    grpc::ServerBidiReactor<grpc::ByteBuffer, grpc::ByteBuffer>*
+        DarwinServiceImpl::Play(grpc::CallbackServerContext* context)
+    {
+        const std::string peer = context->peer();
+        return new PlayStream(
+            [this, peer](PlayStream* stream, const proto::PlayRequest& request)
+            {
+                if (request.has_update_request()) {
+                    std::lock_guard<std::mutex> lock(writers_mutex_);
+                    const bool is_subscribed = std::any_of(
+                        writers_.begin(),
+                        writers_.end(),
+                        [stream](const UpdateSubscriber& subscriber) {
+                            return subscriber.writer == stream;
+                        });
+                    if (!is_subscribed) {
+                        writers_.push_back({
+                            peer,
+                            stream,
+                            request.update_request().delta(),
+                            GetWireId(request.update_request()) });
+                    }
+                }
+                if (!request.has_report()) {
+                    return;
+                }
+                PushPlayReport(peer, request.report(), request.sequence());
+            },
+            [this, peer](PlayStream* stream) {
+                RemoveUpdateStream(stream, peer);
+                delete stream;
+            });
+    }
+
+    void DarwinServiceImpl::PushPlayReport(
+        const std::string& peer,
+        const proto::ReportInGameRequest& report,
+        std::uint64_t report_sequence)
+    {
+        PlayerReport player_report;
+        // Not in game, the update is still acknowledged.
+        BuildPlayerReport(
+            *world_state_.GetView(),
+            peer,
+            report,
+            report_sequence,
+            true,
+            player_report);
+        player_report.request = report;
+        reports_.Push(std::move(player_report));
+    }
+
+    void DarwinServiceImpl::RemoveUpdateStream(
+        UpdateStream* stream,
+        const std::string& peer)
+    {
         {
             std::lock_guard<std::mutex> lock(writers_mutex_);
-            writers_.push_back(writer);
-        }
-        // This will block the connection, you can use a condition variable to
-        // detect disconnect or a keep-alive mechanism.
-        while (!context->IsCancelled()) {
-            std::this_thread::sleep_for(
-                std::chrono::milliseconds(100));  // Just an example
+            writers_.remove_if([stream](const UpdateSubscriber& subscriber) {
+                return subscriber.writer == stream;
+            });
         }
 #ifdef _DEBUG
-        std::cout <<
-            std::format(
-                "[{}] Removed a writer {}\n", 
-                context->peer(),
-                request->name());
+        std::cout << std::format("[{}] Removed a writer\n", peer);
 #endif // _DEBUG
-        auto character_name = world_state_.RemovePeer(context->peer());
-        world_state_.RemoveCharacter(character_name);
+        RemovePeer(peer);
+    }
+
+    void DarwinServiceImpl::RemovePeer(const std::string& peer) {
+        std::string character_name;
+        {
+            // Recorded and applied between two steps.
+            std::lock_guard<std::mutex> lock(writers_mutex_);
+            if (world_recorder_) {
+                world_recorder_->Record(
+                    CreateRecordedEvent(
+                        proto::RECORDED_EVENT_DISCONNECT,
+                        peer));
+            }
+            character_name = world_state_.RemovePeer(peer);
+            world_state_.RemoveCharacter(character_name);
+            input_times_.erase(character_name);
+        }
+        if (peer_removed_) {
+            peer_removed_(peer);
+        }
 #ifdef _DEBUG
         if (!character_name.empty()) {
             std::cout <<
                 std::format(
                     "[{}] Removed character {}\n",
-                    context->peer(),
+                    peer,
                     character_name);
         }
 #endif // _DEBUG
-        std::lock_guard<std::mutex> lock(writers_mutex_);
-        writers_.remove(writer);
-        return grpc::Status::OK;
     }
 
     proto::SpecialEffectParameter DarwinServiceImpl::UpdateSpecialEffectBoost(
@@ -62,7 +184,8 @@ namespace darwin {
     {
         auto effect_parameter = special_effect;
         auto player_boost =
-            world_state_.GetPlayerParameter().special_effect_boost();
+            world_state_.GetView()->GetPlayerParameter()
+                .special_effect_boost();
         effect_parameter.set_cooldown_duration(
             player_boost.cooldown_duration());
         effect_parameter.set_effect_duration(
@@ -111,76 +234,130 @@ namespace darwin {
         return effect_parameter;
     }
 
-    grpc::Status DarwinServiceImpl::ReportInGame(
-        grpc::ServerContext* context,
+    grpc::ServerUnaryReactor* DarwinServiceImpl::ReportInGame(
+        grpc::CallbackServerContext* context,
         const proto::ReportInGameRequest* request,
         proto::ReportInGameResponse* response)
     {
-        std::lock_guard<std::mutex> lock(writers_mutex_);
+        return FinishUnary(context, PushReport(context->peer(), *request));
+    }
+
+    grpc::Status DarwinServiceImpl::PushReport(
+        const std::string& peer,
+        const proto::ReportInGameRequest& report)
+    {
+        // Checked against the last tick, without blocking the next one.
+        PlayerReport player_report;
+        auto status = BuildPlayerReport(
+            *world_state_.GetView(),
+            peer,
+            report,
+            0,
+            false,
+            player_report);
+        if (!status.ok()) {
+            return status;
+        }
+        player_report.request = report;
+        // Handed to the tick, which keeps only the newest report.
+        reports_.Push(std::move(player_report));
+        return grpc::Status::OK;
+    }
+
+    grpc::Status DarwinServiceImpl::BuildPlayerReport(
+        const WorldView& view,
+        const std::string& peer,
+        const proto::ReportInGameRequest& report,
+        std::uint64_t report_sequence,
+        bool is_play_report,
+        PlayerReport& player_report)
+    {
+        player_report = {};
+        player_report.peer = peer;
+        player_report.acknowledged_sequence = report.acknowledged_sequence();
+        player_report.report_sequence = report_sequence;
+        player_report.is_play_report = is_play_report;
+        player_report.view_sequence = view.GetSequence();
         // Empty name check.
-        if (request->name() == "") {
+        if (report.name() == "") {
             return grpc::Status(
                 grpc::StatusCode::INVALID_ARGUMENT,
                 std::format("[{}]:{} Name is empty?",
-                    context->peer(),
-                    world_state_.GetLastUpdated()));
+                    peer,
+                    view.GetTime()));
         }
         // Check if character is own by this peer.
         std::optional<proto::Character> maybe_character =
-            world_state_.GetCharacterOwnedByPeer(
-                context->peer(), 
-                request->name());
+            view.GetCharacterOwnedByPeer(peer, report.name());
         if (!maybe_character) {
             return grpc::Status(
                 grpc::StatusCode::FAILED_PRECONDITION, 
-                std::format("character {} don't exist?", request->name()));
-        }
-        // Update the physic.
-        proto::Physic physic = UpdatePhysic(
-            maybe_character.value().physic(),
-            request->physic());
-        maybe_character.value().mutable_physic()->CopyFrom(physic);
-        maybe_character.value().set_status_enum(request->status_enum());
-        maybe_character.value().mutable_physic()->set_mass(
-            maybe_character.value().physic().mass() -
-            world_state_.GetPlayerParameter().living_cost());
-        auto now = std::chrono::system_clock::now();
-        double time =
-            std::chrono::duration_cast<std::chrono::duration<double>>(
-                now.time_since_epoch())
-            .count();
-        // Fill the special effect boost.
-        auto special_effect_boost = request->special_effect_boost();
-        // For a weird reason the special_effect_boost counter is not updated.
-        special_effect_boost.set_counter(
-            maybe_character.value().special_effect_boost().counter());
-        CheckNewBoost(maybe_character.value(), special_effect_boost);
-        special_effect_boost = 
-            UpdateSpecialEffectBoost(special_effect_boost, loop_timer_);
-        maybe_character.value().mutable_special_effect_boost()->CopyFrom(
-            special_effect_boost);
-        // Update the character.
-        characters_.push_back(maybe_character.value());
-        // Potential hit.
-        if (!request->potential_hit().empty()) {
+                std::format(
+                    "character {} don't exist?",
+                    report.name()));
+        }
+        auto& character = maybe_character.value();
+        std::vector<PlayerInput> player_inputs;
+        player_inputs.reserve(report.input_commands_size());
+        for (const auto& input_command : report.input_commands()) {
+            player_inputs.push_back(GetPlayerInput(input_command));
+        }
+        if (player_inputs.empty()) {
+            // Update the physic.
+            proto::Physic physic = UpdatePhysic(
+                character.physic(),
+                report.physic());
+            character.mutable_physic()->CopyFrom(physic);
+            character.set_status_enum(report.status_enum());
+        }
+        const double mass = character.physic().mass();
+        character.mutable_physic()->set_mass(
+            mass - view.GetPlayerParameter().living_cost());
+        // Simulated on the server with the inputs, from the boost of the
+        // character (see SimulateCharacterInputs).
+        if (player_inputs.empty()) {
+            // Fill the special effect boost.
+            auto special_effect_boost = report.special_effect_boost();
+            // For a weird reason the special_effect_boost counter is not
+            // updated.
+            special_effect_boost.set_counter(
+                character.special_effect_boost().counter());
+            CheckNewBoost(character, special_effect_boost);
+            special_effect_boost = 
+                UpdateSpecialEffectBoost(
+                    special_effect_boost,
+                    tick_scheduler_.GetBroadcastPeriod());
+            character.mutable_special_effect_boost()->CopyFrom(
+                special_effect_boost);
+        }
+        const double mass_cost = mass - character.physic().mass();
+        // Potential hit, as handles (never reused) so that the tick doesn't
+        // look the names up.
+        if (!report.potential_hit().empty()) {
+            auto maybe_eater = view.FindHandle(report.name());
+            auto maybe_target = view.FindHandle(report.potential_hit());
+            if (maybe_eater && maybe_target) {
+                // Ordered when drained.
+                player_report.hit = { *maybe_eater, *maybe_target, 0 };
+            }
+        }
 #ifdef _DEBUG
+        if (!report.potential_hit().empty()) {
             std::cout << std::format(
                 "[{}]:{} Got a potential hit from {}\n",
-                context->peer(),
-                world_state_.GetLastUpdated(),
-                request->potential_hit());
-#endif // _DEBUG
-            if (!request->name().empty()) {
-                character_hits_.insert(
-                    { maybe_character.value(), request->potential_hit()});
-            }
+                peer,
+                view.GetTime(),
+                report.potential_hit());
         }
-        world_state_.UpdatePing(request->name());
+#endif // _DEBUG
+        player_report.character = std::move(character);
+        player_report.player_inputs = std::move(player_inputs);
+        player_report.mass_cost = mass_cost;
         return grpc::Status::OK;
     }
 
-    grpc::Status DarwinServiceImpl::CreateCharacter(
-        grpc::ServerContext* context,
+    grpc::ServerUnaryReactor* DarwinServiceImpl::CreateCharacter(
+        grpc::CallbackServerContext* context,
         const proto::CreateCharacterRequest* request,
         proto::CreateCharacterResponse* response)
     {
@@ -191,44 +368,65 @@ namespace darwin {
                 context->peer(),
                 request->name());
 #endif // _DEBUG
-        const auto player_parameter = world_state_.GetPlayerParameter();
+        return FinishUnary(
+            context,
+            CreateCharacterForPeer(context->peer(), *request, *response));
+    }
+
+    grpc::Status DarwinServiceImpl::CreateCharacterForPeer(
+        const std::string& peer,
+        const proto::CreateCharacterRequest& request,
+        proto::CreateCharacterResponse& response)
+    {
+        // Recorded and applied between two steps.
+        std::lock_guard<std::mutex> lock(writers_mutex_);
+        if (world_recorder_) {
+            auto event = CreateRecordedEvent(
+                proto::RECORDED_EVENT_CREATE_CHARACTER,
+                peer);
+            event.mutable_create_character()->CopyFrom(request);
+            world_recorder_->Record(event);
+        }
+        const auto view = world_state_.GetView();
         bool found = false;
-        for (const auto& color : player_parameter.color_parameters()) {
+        for (const auto& color :
+            view->GetPlayerParameter().color_parameters())
+        {
             if (Dot(
                     Normalize(color.color()), 
-                    Normalize(request->color())) <= 0.99) 
+                    Normalize(request.color())) <= 0.99) 
             {
                 found = true;
                 break;
             }
         }
         if (!found) {
-            response->set_return_enum(proto::RETURN_REJECTED);
+            response.set_return_enum(proto::RETURN_REJECTED);
             return grpc::Status(
                 grpc::StatusCode::INVALID_ARGUMENT,
                 std::format(
                     "Color [{}] is not valid.", 
-                    request->color().DebugString()));
+                    request.color().DebugString()));
         }
         if (world_state_.CreateCharacter(
-            context->peer(),
-            request->name(),
-            request->color()))
+            peer,
+            request.name(),
+            request.color()))
         {
-            response->set_return_enum(proto::RETURN_OK);
+            response.set_return_enum(proto::RETURN_OK);
             return grpc::Status::OK;
         }
         else
         {
-            response->set_return_enum(proto::RETURN_REJECTED);
+            response.set_return_enum(proto::RETURN_REJECTED);
             return grpc::Status(
                 grpc::StatusCode::INVALID_ARGUMENT, 
-                "Name [" + request->name() + "] is already in game.");
+                "Name [" + request.name() + "] is already in game.");
         }
     }
 
-    grpc::Status DarwinServiceImpl::Ping(
-        grpc::ServerContext* context,
+    grpc::ServerUnaryReactor* DarwinServiceImpl::Ping(
+        grpc::CallbackServerContext* context,
         const proto::PingRequest* request,
         proto::PingResponse* response)
     {
@@ -246,82 +444,486 @@ namespace darwin {
                 now.time_since_epoch())
             .count();
         response->mutable_player_parameter()->CopyFrom(
-            world_state_.GetPlayerParameter());
+            world_state_.GetView()->GetPlayerParameter());
         response->set_time(time);
-        return grpc::Status::OK;
+        const auto step = tick_profiler_.GetStatistics(
+            TickPhaseEnum::TICK_PHASE_STEP);
+        const auto broadcast = tick_profiler_.GetStatistics(
+            TickPhaseEnum::TICK_PHASE_BROADCAST);
+        auto* tick_statistics = response->mutable_tick_statistics();
+        tick_statistics->set_step_p50(step.p50);
+        tick_statistics->set_step_p99(step.p99);
+        tick_statistics->set_step_max(step.max);
+        tick_statistics->set_broadcast_p50(broadcast.p50);
+        tick_statistics->set_broadcast_p99(broadcast.p99);
+        tick_statistics->set_broadcast_max(broadcast.max);
+        return FinishUnary(context, grpc::Status::OK);
     }
 
-    void DarwinServiceImpl::BroadcastUpdateLocked(
-        const proto::UpdateResponse& response)
+    void DarwinServiceImpl::SetKeyframeInterval(
+        std::uint64_t keyframe_interval)
     {
-        for (auto writer : writers_) {
-            writer->Write(response);
-        }
+        std::lock_guard<std::mutex> lock(writers_mutex_);
+        keyframe_interval_ = keyframe_interval;
+        world_state_.SetDeltaHistory(keyframe_interval);
     }
 
-    std::vector<proto::Character>& DarwinServiceImpl::GetCharacters()
-    {
-        return characters_;
+    void DarwinServiceImpl::SetInterestAngle(double interest_angle) {
+        std::lock_guard<std::mutex> lock(writers_mutex_);
+        interest_angle_ = interest_angle;
+    }
+
+    void DarwinServiceImpl::BroadcastUpdateLocked(double time) {
+        // One view for the whole broadcast, the world is not locked.
+        const auto view = world_state_.GetView();
+        const std::uint64_t sequence = view->GetSequence();
+        // Responses by baseline sequence (0 is the full update) and wire id,
+        // built and serialized once for all the subscribers that share them.
+        struct EncodedUpdate {
+            bool is_keyframe;
+            grpc::ByteBuffer buffer;
+        };
+        std::map<std::pair<std::uint64_t, WireIdEnum>, EncodedUpdate>
+            updates;
+        for (auto& subscriber : writers_) {
+            std::uint64_t baseline_sequence = 0;
+            if (subscriber.delta &&
+                subscriber.acknowledged_sequence != 0 &&
+                subscriber.keyframe_sequence + keyframe_interval_ > sequence)
+            {
+                baseline_sequence = subscriber.acknowledged_sequence;
+            }
+            std::optional<std::vector<EntityHandle>> maybe_visible;
+            if (interest_angle_ > 0.0) {
+                ScopedPhaseTimer timer(
+                    &tick_profiler_,
+                    TickPhaseEnum::TICK_PHASE_FILL_RESPONSE);
+                maybe_visible = view->GetVisibleHandles(
+                    subscriber.peer,
+                    interest_angle_);
+            }
+            if (maybe_visible) {
+                BroadcastVisibleUpdateLocked(
+                    *view,
+                    subscriber,
+                    std::move(*maybe_visible),
+                    baseline_sequence,
+                    time);
+                continue;
+            }
+            // The client may hold a filtered view, don't use it as baseline.
+            if (!subscriber.visible_history.empty()) {
+                subscriber.visible_history.clear();
+                baseline_sequence = 0;
+            }
+            const auto key = std::make_pair(
+                baseline_sequence,
+                subscriber.wire_id);
+            auto it = updates.find(key);
+            if (it == updates.end()) {
+                proto::UpdateResponse response;
+                {
+                    ScopedPhaseTimer timer(
+                        &tick_profiler_,
+                        TickPhaseEnum::TICK_PHASE_FILL_RESPONSE);
+                    view->FillUpdateResponse(
+                        response,
+                        baseline_sequence,
+                        subscriber.wire_id);
+                    response.set_time(time);
+                }
+                ScopedPhaseTimer timer(
+                    &tick_profiler_,
+                    TickPhaseEnum::TICK_PHASE_SERIALIZE);
+                it = updates.insert({
+                    key,
+                    {
+                        response.baseline_sequence() == 0,
+                        SerializeUpdateResponse(response)
+                    } }).first;
+            }
+            if (it->second.is_keyframe) {
+                subscriber.keyframe_sequence = sequence;
+            }
+            ScopedPhaseTimer timer(
+                &tick_profiler_,
+                TickPhaseEnum::TICK_PHASE_WRITE);
+            subscriber.writer->WriteUpdate(
+                it->second.buffer,
+                subscriber.report_sequence);
+        }
     }
 
-    void DarwinServiceImpl::ClearCharacters()
+    void DarwinServiceImpl::BroadcastVisibleUpdateLocked(
+        const WorldView& view,
+        UpdateSubscriber& subscriber,
+        std::vector<EntityHandle> visible,
+        std::uint64_t baseline_sequence,
+        double time)
     {
-        characters_.clear();
+        const std::uint64_t sequence = view.GetSequence();
+        auto& history = subscriber.visible_history;
+        // Nothing older than the acknowledged sequence will be a baseline.
+        while (!history.empty() &&
+            history.front().sequence < subscriber.acknowledged_sequence)
+        {
+            history.pop_front();
+        }
+        proto::UpdateResponse response;
+        {
+            ScopedPhaseTimer timer(
+                &tick_profiler_,
+                TickPhaseEnum::TICK_PHASE_FILL_RESPONSE);
+            if (baseline_sequence != 0 &&
+                !history.empty() &&
+                history.front().sequence == baseline_sequence)
+            {
+                view.FillVisibleUpdateResponse(
+                    response,
+                    visible,
+                    baseline_sequence,
+                    history.front().handles,
+                    subscriber.wire_id);
+            }
+            else {
+                view.FillVisibleUpdateResponse(
+                    response,
+                    visible,
+                    0,
+                    {},
+                    subscriber.wire_id);
+            }
+            response.set_time(time);
+        }
+        if (response.baseline_sequence() == 0) {
+            subscriber.keyframe_sequence = sequence;
+        }
+        grpc::ByteBuffer buffer;
+        {
+            ScopedPhaseTimer timer(
+                &tick_profiler_,
+                TickPhaseEnum::TICK_PHASE_SERIALIZE);
+            buffer = SerializeUpdateResponse(response);
+        }
+        {
+            ScopedPhaseTimer timer(
+                &tick_profiler_,
+                TickPhaseEnum::TICK_PHASE_WRITE);
+            subscriber.writer->WriteUpdate(
+                buffer,
+                subscriber.report_sequence);
+        }
+        if (!subscriber.delta) {
+            return;
+        }
+        if (!history.empty() && history.back().sequence == sequence) {
+            history.back().handles = std::move(visible);
+        }
+        else {
+            history.push_back({ sequence, std::move(visible) });
+        }
+        while (history.size() > keyframe_interval_ + 1) {
+            history.pop_front();
+        }
     }
 
-    void DarwinServiceImpl::ComputeWorld(double loop_timer) {
-        loop_timer_ = loop_timer;
-        while (true) {
-            const std::int64_t loop_time_milli =
-                static_cast<std::int64_t>(1000.0 * loop_timer);
-            auto now = std::chrono::system_clock::now();
+    void DarwinServiceImpl::DrainReportsLocked(double time) {
+        // Newest report by peer (a peer has one character), the hits of
+        // every report.
+        std::map<std::string, PlayerReport> latest_reports;
+        hit_events_.clear();
+        const auto view = world_state_.GetView();
+        reports_.Drain([&](PlayerReport&& report) {
+            if (!CheckReportLocked(*view, report)) {
+                return;
+            }
+            if (world_recorder_) {
+                RecordReportLocked(report);
+            }
+            const std::string peer = report.peer;
+            if (report.hit.target != INVALID_ENTITY_HANDLE) {
+                // Resolved in the order drained (and recorded).
+                report.hit.sequence = hit_events_.size();
+                hit_events_.push_back(report.hit);
+            }
+            auto it = latest_reports.find(peer);
+            // The frames of all the reports are simulated, in order.
+            if (it != latest_reports.end() &&
+                !it->second.player_inputs.empty() &&
+                !report.player_inputs.empty())
             {
-                std::lock_guard<std::mutex> lock(writers_mutex_);
-                double time =
-                    std::chrono::duration_cast<std::chrono::duration<double>>(
-                        now.time_since_epoch())
-                    .count();
-                // Update the players.
-                {
-                    for (const auto& player : GetCharacters()) {
-                        world_state_.UpdateCharacter(
-                            player.name(),
-                            player.status_enum(),
-                            player.physic());
-                    }
-                    ClearCharacters();
+                auto& player_inputs = it->second.player_inputs;
+                report.player_inputs.insert(
+                    report.player_inputs.begin(),
+                    player_inputs.begin(),
+                    player_inputs.end());
+                report.mass_cost += it->second.mass_cost;
+            }
+            latest_reports[peer] = std::move(report);
+        });
+        if (latest_reports.empty()) {
+            return;
+        }
+        // Move the delta baselines forward.
+        const std::uint64_t sequence = world_state_.GetSequence();
+        std::vector<proto::Character> characters;
+        characters.reserve(latest_reports.size());
+        for (auto& [peer, report] : latest_reports) {
+            const std::uint64_t acknowledged_sequence =
+                std::min(report.acknowledged_sequence, sequence);
+            for (auto& subscriber : writers_) {
+                if (subscriber.peer != peer) {
+                    continue;
                 }
-                // Update the list of potential hits.
-                world_state_.SetCharacterHits(character_hits_);
-                character_hits_.clear();
-                // Update the elements in the world.
-                world_state_.Update(time);
-                const auto& elements = world_state_.GetElements();
-                const auto& characters = world_state_.GetCharacters();
-                proto::UpdateResponse response;
-                response.mutable_elements()->CopyFrom(
-                    { elements.begin(), elements.end() });
-                response.mutable_characters()->CopyFrom(
-                    { characters.begin(), characters.end() });
-                response.set_time(time);
-                BroadcastUpdateLocked(response);
-                // Pring a warning if the computation is too slow.
-                if ((now + std::chrono::milliseconds(loop_time_milli)) <
-                    std::chrono::system_clock::now())
-                {
-                    std::cerr <<
-                        std::format(
-                            "ComputeWorld is too slow {} < {} !!!\n",
-                            now + std::chrono::milliseconds(loop_time_milli),
-                            std::chrono::system_clock::now());
+                subscriber.acknowledged_sequence = std::max(
+                    subscriber.acknowledged_sequence,
+                    acknowledged_sequence);
+                subscriber.report_sequence = std::max(
+                    subscriber.report_sequence,
+                    report.report_sequence);
+            }
+            if (report.character.name().empty()) {
+                continue;
+            }
+            if (!report.player_inputs.empty()) {
+                input_states_.push_back({
+                    report.character.name(),
+                    std::move(report.player_inputs),
+                    report.mass_cost });
+                continue;
+            }
+            characters.push_back(std::move(report.character));
+        }
+        world_state_.UpdateCharacters(characters);
+        SimulateInputsLocked(time);
+        world_state_.SetCharacterHits(hit_events_);
+    }
+
+    bool DarwinServiceImpl::CheckReportLocked(
+        const WorldView& view,
+        PlayerReport& report)
+    {
+        // The view of the last step holds the live characters (a replay
+        // checks the report against it too).
+        if (report.view_sequence == view.GetSequence()) {
+            return true;
+        }
+        auto request = std::move(report.request);
+        auto status = BuildPlayerReport(
+            view,
+            report.peer,
+            request,
+            report.report_sequence,
+            report.is_play_report,
+            report);
+        report.request = std::move(request);
+        return status.ok() || report.is_play_report;
+    }
+
+    void DarwinServiceImpl::RecordReportLocked(PlayerReport& report) {
+        auto event = CreateRecordedEvent(
+            report.is_play_report ?
+                proto::RECORDED_EVENT_PLAY_REPORT :
+                proto::RECORDED_EVENT_REPORT_IN_GAME,
+            report.peer);
+        if (report.is_play_report) {
+            event.set_report_sequence(report.report_sequence);
+        }
+        event.mutable_report()->Swap(&report.request);
+        world_recorder_->Record(event);
+    }
+
+    void DarwinServiceImpl::SimulateInputsLocked(double time) {
+        if (input_states_.empty()) {
+            return;
+        }
+        ScopedPhaseTimer timer(
+            &tick_profiler_,
+            TickPhaseEnum::TICK_PHASE_SIMULATE_INPUTS);
+        for (auto& state : input_states_) {
+            double& input_time =
+                input_times_.try_emplace(
+                    state.name,
+                    time - MAX_INPUT_LAG).first->second;
+            input_time = std::max(input_time, time - MAX_INPUT_LAG);
+            // Drop the frames ahead of the server.
+            std::size_t count = 0;
+            for (const auto& player_input : state.player_inputs) {
+                if (input_time + player_input.duration > time) {
+                    break;
                 }
+                input_time += player_input.duration;
+                ++count;
             }
-            // Wait for the next computation.
-            std::this_thread::sleep_until(
-                now + std::chrono::milliseconds(loop_time_milli));
+            state.player_inputs.resize(count);
         }
+        world_state_.GetCharacterInputStates(input_states_);
+        input_simulator_->Simulate(
+            input_states_,
+            world_state_.GetGroundStates(),
+            world_state_.GetPlayerParameter());
+        world_state_.SetCharacterInputStates(input_states_);
+        input_states_.clear();
     }
-    
+
+    void DarwinServiceImpl::SetSimulationThreads(std::size_t thread_count) {
+        std::lock_guard<std::mutex> lock(writers_mutex_);
+        world_state_.SetWorkerPool(nullptr);
+        input_simulator_.reset();
+        worker_pool_ = std::make_unique<WorkerPool>(thread_count);
+        input_simulator_ = std::make_unique<InputSimulator>(*worker_pool_);
+        world_state_.SetWorkerPool(worker_pool_.get());
+    }
+
+    void DarwinServiceImpl::SetTickPeriods(
+        double step_period,
+        double broadcast_period,
+        std::uint32_t max_catch_up_steps)
+    {
+        tick_scheduler_.SetPeriods(
+            step_period,
+            broadcast_period,
+            max_catch_up_steps);
+    }
+
+    TickMetrics DarwinServiceImpl::GetTickMetrics() const {
+        return tick_scheduler_.GetMetrics();
+    }
+
+    const TickProfiler& DarwinServiceImpl::GetTickProfiler() const {
+        return tick_profiler_;
+    }
+
+    void DarwinServiceImpl::ComputeWorld() {
+        const double start_time =
+            std::chrono::duration_cast<std::chrono::duration<double>>(
+                std::chrono::system_clock::now().time_since_epoch())
+            .count();
+        world_state_.SetTickProfiler(&tick_profiler_);
+        tick_scheduler_.Run(
+            start_time,
+            [this](double time) { TickStep(time); },
+            [this](double time) { TickBroadcast(time); });
+        world_state_.SetTickProfiler(nullptr);
+    }
+
+    void DarwinServiceImpl::TickStep(double time) {
+        Step(time);
+    }
+
+    void DarwinServiceImpl::TickBroadcast(double time) {
+        {
+            std::lock_guard<std::mutex> lock(writers_mutex_);
+            ScopedPhaseTimer timer(
+                &tick_profiler_,
+                TickPhaseEnum::TICK_PHASE_BROADCAST);
+            BroadcastUpdateLocked(time);
+        }
+        tick_profiler_.Flush();
+    }
+
+    void DarwinServiceImpl::Step(double time) {
+        {
+            std::lock_guard<std::mutex> lock(writers_mutex_);
+            ScopedPhaseTimer step_timer(
+                &tick_profiler_,
+                TickPhaseEnum::TICK_PHASE_STEP);
+            {
+                ScopedPhaseTimer timer(
+                    &tick_profiler_,
+                    TickPhaseEnum::TICK_PHASE_DRAIN_REPORTS);
+                // Update the players and the list of potential hits.
+                DrainReportsLocked(time);
+            }
+            if (world_recorder_) {
+                // After the reports it drained.
+                auto event =
+                    CreateRecordedEvent(proto::RECORDED_EVENT_STEP, {});
+                event.set_time(time);
+                world_recorder_->Record(event);
+            }
+            ScopedPhaseTimer timer(
+                &tick_profiler_,
+                TickPhaseEnum::TICK_PHASE_UPDATE);
+            // Update the elements in the world.
+            world_state_.Update(time);
+        }
+        if (world_checkpointer_) {
+            ScopedPhaseTimer timer(
+                &tick_profiler_,
+                TickPhaseEnum::TICK_PHASE_CHECKPOINT);
+            world_checkpointer_->Tick(time);
+        }
+        if (region_service_) {
+            ScopedPhaseTimer timer(
+                &tick_profiler_,
+                TickPhaseEnum::TICK_PHASE_REGION_EXCHANGE);
+            region_service_->Tick(time);
+        }
+        tick_profiler_.Flush();
+    }
+
+    void DarwinServiceImpl::ReplayEvent(const proto::RecordedEvent& event) {
+        switch (event.recorded_event_enum()) {
+            case proto::RECORDED_EVENT_CREATE_CHARACTER: {
+                proto::CreateCharacterResponse response;
+                CreateCharacterForPeer(
+                    event.peer(),
+                    event.create_character(),
+                    response);
+                return;
+            }
+            case proto::RECORDED_EVENT_REPORT_IN_GAME: {
+                PushReport(event.peer(), event.report());
+                return;
+            }
+            case proto::RECORDED_EVENT_PLAY_REPORT: {
+                PushPlayReport(
+                    event.peer(),
+                    event.report(),
+                    event.report_sequence());
+                return;
+            }
+            case proto::RECORDED_EVENT_DISCONNECT: {
+                RemovePeer(event.peer());
+                return;
+            }
+            case proto::RECORDED_EVENT_STEP: {
+                Step(event.time());
+                return;
+            }
+            default:
+                throw std::runtime_error(
+                    std::format(
+                        "Unknown recorded event: {}",
+                        static_cast<int>(event.recorded_event_enum())));
+        }
+    }
+
+    void DarwinServiceImpl::SetWorldRecorder(WorldRecorder* world_recorder) {
+        world_recorder_ = world_recorder;
+    }
+
+    void DarwinServiceImpl::SetPeerRemovedCallback(
+        std::function<void(const std::string&)> peer_removed)
+    {
+        peer_removed_ = std::move(peer_removed);
+    }
+
+    void DarwinServiceImpl::SetRegionService(RegionService* region_service) {
+        region_service_ = region_service;
+    }
+
+    void DarwinServiceImpl::SetWorldCheckpointer(
+        WorldCheckpointer* world_checkpointer)
+    {
+        world_checkpointer_ = world_checkpointer;
+    }
+
+    void DarwinServiceImpl::StopComputeWorld() {
+        tick_scheduler_.Stop();
+    }
+
     proto::Physic DarwinServiceImpl::UpdatePhysic(
         const proto::Physic& server_physic,
         const proto::Physic& client_physic) const
@@ -1,43 +1,145 @@
 #pragma once
 
+#include <deque>
 #include <grpc++/grpc++.h>
 
 #include "Common/darwin_service.grpc.pb.h"
 #include "Common/stl_proto_wrapper.h"
+#include "Server/input_simulator.h"
+#include "Server/mpsc_queue.h"
+#include "Server/play_stream.h"
+#include "Server/region_service.h"
+#include "Server/tick_profiler.h"
+#include "Server/tick_scheduler.h"
+#include "Server/update_writer.h"
+#include "Server/world_checkpoint.h"
+#include "Server/world_recorder.h"
 #include "world_state.h"
 
 namespace darwin {
 
-    class DarwinServiceImpl final : public proto::DarwinService::Service {
+    // All the methods use the callback API, no thread is held by a call.
+    // The Update and Play streams are raw callbacks, so that a response
+    // serialized once can be written to all the subscribers.
+    using DarwinCallbackService =
+        proto::DarwinService::WithRawCallbackMethod_Update<
+            proto::DarwinService::WithCallbackMethod_ReportInGame<
+                proto::DarwinService::WithCallbackMethod_CreateCharacter<
+                    proto::DarwinService::WithCallbackMethod_Ping<
+                        proto::DarwinService::WithRawCallbackMethod_Play<
+                            proto::DarwinService::Service>>>>>;
+
+    class DarwinServiceImpl final : public DarwinCallbackService {
     public:
         DarwinServiceImpl(WorldState& world_state) : 
-            world_state_(world_state) {}
+            world_state_(world_state),
+            worker_pool_(std::make_unique<WorkerPool>(0)),
+            input_simulator_(std::make_unique<InputSimulator>(*worker_pool_))
+        {}
+        ~DarwinServiceImpl() override;
 
     public:
-        grpc::Status Update(
-            grpc::ServerContext* context, 
-            const proto::UpdateRequest* request,
-            grpc::ServerWriter<proto::UpdateResponse>* writer) override;
-        grpc::Status ReportInGame(
-            grpc::ServerContext* context, 
+        grpc::ServerWriteReactor<grpc::ByteBuffer>* Update(
+            grpc::CallbackServerContext* context,
+            const grpc::ByteBuffer* request) override;
+        grpc::ServerUnaryReactor* ReportInGame(
+            grpc::CallbackServerContext* context,
             const proto::ReportInGameRequest* request,
             proto::ReportInGameResponse* response) override;
-        grpc::Status CreateCharacter(
-            grpc::ServerContext* context, 
+        grpc::ServerUnaryReactor* CreateCharacter(
+            grpc::CallbackServerContext* context,
             const proto::CreateCharacterRequest* request,
             proto::CreateCharacterResponse* response) override;
-        grpc::Status Ping(
-            grpc::ServerContext* context, 
+        grpc::ServerUnaryReactor* Ping(
+            grpc::CallbackServerContext* context,
             const proto::PingRequest* request,
             proto::PingResponse* response) override;
+        grpc::ServerBidiReactor<grpc::ByteBuffer, grpc::ByteBuffer>* Play(
+            grpc::CallbackServerContext* context) override;
 
     public:
-        std::vector<proto::Character>& GetCharacters();
-        void ClearCharacters();
-        void ComputeWorld(double loop_timer);
+        // Periods in seconds of the simulation steps and of the broadcasts
+        // (a client reports about once per broadcast).
+        void SetTickPeriods(
+            double step_period,
+            double broadcast_period,
+            std::uint32_t max_catch_up_steps);
+        // Run the simulation and the broadcasts until StopComputeWorld.
+        void ComputeWorld();
+        void StopComputeWorld();
+        // One simulation step (recorded) and one broadcast at time, as run
+        // by ComputeWorld, for a caller that schedules the ticks itself.
+        void TickStep(double time);
+        void TickBroadcast(double time);
+        TickMetrics GetTickMetrics() const;
+        // Time spent by phase in the last steps and broadcasts.
+        const TickProfiler& GetTickProfiler() const;
+        // Maximum number of simulation steps between two full updates for a
+        // delta subscriber.
+        void SetKeyframeInterval(std::uint64_t keyframe_interval);
+        // Angle (in radians) around its character under which a subscriber
+        // get the entities, 0 to send the whole world.
+        void SetInterestAngle(double interest_angle);
+        // Checkpoint the world (if needed) after each simulation step.
+        void SetWorldCheckpointer(WorldCheckpointer* world_checkpointer);
+        // Exchange with the other regions of the world (if any) after each
+        // simulation step, set before serving.
+        void SetRegionService(RegionService* region_service);
+        // Record what is received and the steps (nullptr to stop), set
+        // before serving.
+        void SetWorldRecorder(WorldRecorder* world_recorder);
+        // Apply a recorded event as if it came from the network, a step
+        // runs the simulation step (without a broadcast).
+        void ReplayEvent(const proto::RecordedEvent& event);
+        // Worker threads (besides the tick thread) that simulate the
+        // characters driven by input commands and run the phases of the
+        // world update, set before serving.
+        void SetSimulationThreads(std::size_t thread_count);
+        // Called once a peer and its character are removed (its stream is
+        // closed), set before serving.
+        void SetPeerRemovedCallback(
+            std::function<void(const std::string&)> peer_removed);
 
     protected:
-        void BroadcastUpdateLocked(const proto::UpdateResponse& response);
+        // One simulation step at time.
+        void Step(double time);
+        void DrainReportsLocked(double time);
+        // Simulate the characters driven by input commands (drained in
+        // input_states_) up to time.
+        void SimulateInputsLocked(double time);
+        void BroadcastUpdateLocked(double time);
+        // Check the report and push it for the next tick.
+        grpc::Status PushReport(
+            const std::string& peer,
+            const proto::ReportInGameRequest& report);
+        // Same as PushReport, a report out of game is still acknowledged.
+        void PushPlayReport(
+            const std::string& peer,
+            const proto::ReportInGameRequest& report,
+            std::uint64_t report_sequence);
+        struct PlayerReport;
+        // Check the report against the view and build the player report
+        // from it, out of game it only acknowledges the update.
+        grpc::Status BuildPlayerReport(
+            const WorldView& view,
+            const std::string& peer,
+            const proto::ReportInGameRequest& report,
+            std::uint64_t report_sequence,
+            bool is_play_report,
+            PlayerReport& player_report);
+        // Check a drained report again if it was checked against an older
+        // view than the one of the last step, as the tick changed the
+        // characters since. Return false if the report is dropped.
+        bool CheckReportLocked(const WorldView& view, PlayerReport& report);
+        // Record a drained report, in the order the tick applies them.
+        void RecordReportLocked(PlayerReport& report);
+        grpc::Status CreateCharacterForPeer(
+            const std::string& peer,
+            const proto::CreateCharacterRequest& request,
+            proto::CreateCharacterResponse& response);
+        // Remove the peer and its character.
+        void RemovePeer(const std::string& peer);
+        void RemoveUpdateStream(UpdateStream* stream, const std::string& peer);
         proto::SpecialEffectParameter UpdateSpecialEffectBoost(
             const proto::SpecialEffectParameter& special_effect,
             double delta_time) const;
@@ -49,13 +151,73 @@ namespace darwin {
             const proto::SpecialEffectParameter& new_special_effect);
         
     protected:
-        std::vector<proto::Character> characters_;
-        // Name of the character against name of potential hits.
-        std::map<proto::Character, std::string> character_hits_;
+        // Report from a client, the character is already updated from it
+        // (empty if the client only acknowledge an update).
+        struct PlayerReport {
+            std::string peer;
+            proto::Character character;
+            // Potential hit, its target is INVALID_ENTITY_HANDLE if none.
+            HitEvent hit{ INVALID_ENTITY_HANDLE, INVALID_ENTITY_HANDLE, 0 };
+            std::uint64_t acknowledged_sequence = 0;
+            // Sequence of the report in a Play stream (0 otherwise).
+            std::uint64_t report_sequence = 0;
+            // Frames to simulate if the client sent input commands (the
+            // physic of the character is then ignored).
+            std::vector<PlayerInput> player_inputs;
+            double mass_cost = 0.0;
+            bool is_play_report = false;
+            // Sequence of the view the report was checked against.
+            std::uint64_t view_sequence = 0;
+            // Report as received, checked again when drained (and recorded).
+            proto::ReportInGameRequest request;
+        };
+        // Filled by ReportInGame without lock, drained by the tick.
+        MpscQueue<PlayerReport> reports_;
+        // Hits of the drained reports (reused from tick to tick).
+        std::vector<HitEvent> hit_events_;
         WorldState& world_state_;
-        std::list<grpc::ServerWriter<proto::UpdateResponse>*> writers_;
+        // Entities sent to a subscriber at a sequence.
+        struct VisibleSet {
+            std::uint64_t sequence;
+            std::vector<EntityHandle> handles;
+        };
+        struct UpdateSubscriber {
+            std::string peer;
+            UpdateStream* writer = nullptr;
+            bool delta = false;
+            WireIdEnum wire_id = WireIdEnum::WIRE_ID_NAME;
+            std::uint64_t acknowledged_sequence = 0;
+            std::uint64_t keyframe_sequence = 0;
+            // Last report applied (sent back in a Play stream).
+            std::uint64_t report_sequence = 0;
+            // Empty unless filtered by area of interest.
+            std::deque<VisibleSet> visible_history;
+        };
+        std::list<UpdateSubscriber> writers_;
+        std::uint64_t keyframe_interval_ = 50;
+        double interest_angle_ = 0.0;
         std::mutex writers_mutex_;
-        double loop_timer_ = 0.0;
+        TickScheduler tick_scheduler_;
+        TickProfiler tick_profiler_;
+        WorldCheckpointer* world_checkpointer_ = nullptr;
+        WorldRecorder* world_recorder_ = nullptr;
+        RegionService* region_service_ = nullptr;
+        std::function<void(const std::string&)> peer_removed_;
+        // Tick thread (under writers_mutex_).
+        std::unique_ptr<WorkerPool> worker_pool_;
+        std::unique_ptr<InputSimulator> input_simulator_;
+        std::vector<CharacterInputState> input_states_;
+        // Time up to which the inputs of a character were simulated (by
+        // name), the frames of a player can't run ahead of the server.
+        std::map<std::string, double> input_times_;
+
+    protected:
+        void BroadcastVisibleUpdateLocked(
+            const WorldView& view,
+            UpdateSubscriber& subscriber,
+            std::vector<EntityHandle> visible,
+            std::uint64_t baseline_sequence,
+            double time);
     };
 
 }  // namespace darwin.
@@ -0,0 +1,602 @@
+#include "entity_store.h"
+
+#include <utility>
+
+#include "Common/convert_math.h"
+
+namespace darwin {
+
+    namespace {
+
+        glm::dvec4 ProtoVector2Dvec4(const proto::Vector4& vector4) {
+            return glm::dvec4(
+                vector4.x(),
+                vector4.y(),
+                vector4.z(),
+                vector4.w());
+        }
+
+        proto::Vector4 Dvec42ProtoVector(const glm::dvec4& vector4) {
+            proto::Vector4 result;
+            result.set_x(vector4.x);
+            result.set_y(vector4.y);
+            result.set_z(vector4.z);
+            result.set_w(vector4.w);
+            return result;
+        }
+
+        SpecialEffect ProtoSpecialEffect2SpecialEffect(
+            const proto::SpecialEffectParameter& parameter)
+        {
+            return SpecialEffect{
+                parameter.special_state_enum(),
+                parameter.effect_duration(),
+                parameter.cooldown_duration(),
+                parameter.counter()
+            };
+        }
+
+        bool IsDefault(const SpecialEffect& special_effect) {
+            return
+                special_effect.special_state_enum ==
+                    proto::SPECIAL_STATE_WAIT &&
+                special_effect.effect_duration == 0.0 &&
+                special_effect.cooldown_duration == 0.0 &&
+                special_effect.counter == 0.0;
+        }
+
+    }  // End anonymous namespace.
+
+    std::size_t EntityStore::Add(
+        EntityHandle handle,
+        const proto::Element& element)
+    {
+        std::size_t index = AddRow(handle, element.name());
+        Set(index, element);
+        return index;
+    }
+
+    std::size_t EntityStore::Add(
+        EntityHandle handle,
+        const proto::Character& character)
+    {
+        std::size_t index = AddRow(handle, character.name());
+        Set(index, character);
+        return index;
+    }
+
+    std::size_t EntityStore::Add(
+        EntityHandle handle,
+        std::string_view name,
+        const ElementRow& row)
+    {
+        std::size_t index = AddRow(handle, name);
+        Set(index, row);
+        return index;
+    }
+
+    std::size_t EntityStore::AddRow(
+        EntityHandle handle,
+        std::string_view name)
+    {
+        ++version_;
+        std::size_t index = handles_.size();
+        handles_.push_back(handle);
+        names_.emplace_back(name);
+        positions_.emplace_back(0.0);
+        position_dts_.emplace_back(0.0);
+        orientations_.emplace_back(0.0);
+        orientation_dts_.emplace_back(0.0);
+        masses_.push_back(0.0);
+        radii_.push_back(0.0);
+        colors_.emplace_back(0.0);
+        statuses_.push_back(proto::STATUS_UNKNOWN);
+        types_.push_back(proto::TYPE_UNKNOWN);
+        normals_.emplace_back(0.0);
+        g_forces_.emplace_back(0.0);
+        special_effects_.emplace_back();
+        character_types_.push_back(proto::CHARACTER_NONE);
+        peers_.emplace_back();
+        last_seens_.push_back(NEVER_SEEN);
+        created_sequences_.push_back(sequence_);
+        physic_sequences_.push_back(sequence_);
+        appearance_sequences_.push_back(sequence_);
+        status_sequences_.push_back(sequence_);
+        journaled_.push_back(0);
+        handle_indices_.insert({ handle, index });
+        name_handles_.insert({ names_.back(), handle });
+        JournalChange(index);
+        return index;
+    }
+
+    void EntityStore::Set(std::size_t index, const proto::Element& element) {
+        if (SetPhysicRow(index, element.physic())) {
+            MarkChanged(index, ChangeEnum::CHANGE_PHYSIC);
+        }
+        const glm::dvec3 color = ProtoVector2Glm(element.color());
+        if (colors_[index] != color ||
+            types_[index] != element.type_enum())
+        {
+            colors_[index] = color;
+            types_[index] = element.type_enum();
+            MarkChanged(index, ChangeEnum::CHANGE_APPEARANCE);
+        }
+    }
+
+    void EntityStore::Set(std::size_t index, const ElementRow& row) {
+        if (positions_[index] != row.position ||
+            position_dts_[index] != row.position_dt ||
+            orientations_[index] != row.orientation ||
+            orientation_dts_[index] != row.orientation_dt ||
+            masses_[index] != row.mass ||
+            radii_[index] != row.radius)
+        {
+            positions_[index] = row.position;
+            position_dts_[index] = row.position_dt;
+            orientations_[index] = row.orientation;
+            orientation_dts_[index] = row.orientation_dt;
+            masses_[index] = row.mass;
+            radii_[index] = row.radius;
+            MarkChanged(index, ChangeEnum::CHANGE_PHYSIC);
+        }
+        const auto type_enum = static_cast<proto::TypeEnum>(row.type_enum);
+        if (colors_[index] != row.color || types_[index] != type_enum) {
+            colors_[index] = row.color;
+            types_[index] = type_enum;
+            MarkChanged(index, ChangeEnum::CHANGE_APPEARANCE);
+        }
+    }
+
+    void EntityStore::Set(
+        std::size_t index,
+        const proto::Character& character)
+    {
+        if (SetPhysicRow(index, character.physic())) {
+            MarkChanged(index, ChangeEnum::CHANGE_PHYSIC);
+        }
+        const glm::dvec3 color = ProtoVector2Glm(character.color());
+        if (colors_[index] != color ||
+            types_[index] != proto::TYPE_CHARACTER ||
+            character_types_[index] != character.character_type())
+        {
+            colors_[index] = color;
+            types_[index] = proto::TYPE_CHARACTER;
+            character_types_[index] = character.character_type();
+            MarkChanged(index, ChangeEnum::CHANGE_APPEARANCE);
+        }
+        const glm::dvec3 normal = ProtoVector2Glm(character.normal());
+        const glm::dvec3 g_force = ProtoVector2Glm(character.g_force());
+        const SpecialEffect special_effect =
+            ProtoSpecialEffect2SpecialEffect(
+                character.special_effect_boost());
+        if (statuses_[index] != character.status_enum() ||
+            normals_[index] != normal ||
+            g_forces_[index] != g_force ||
+            !(special_effects_[index] == special_effect))
+        {
+            statuses_[index] = character.status_enum();
+            normals_[index] = normal;
+            g_forces_[index] = g_force;
+            special_effects_[index] = special_effect;
+            MarkChanged(index, ChangeEnum::CHANGE_STATUS);
+        }
+    }
+
+    void EntityStore::SetPhysic(
+        std::size_t index,
+        const proto::Physic& physic)
+    {
+        if (SetPhysicRow(index, physic)) {
+            MarkChanged(index, ChangeEnum::CHANGE_PHYSIC);
+        }
+    }
+
+    bool EntityStore::SetPhysicRow(
+        std::size_t index,
+        const proto::Physic& physic)
+    {
+        const glm::dvec3 position = ProtoVector2Glm(physic.position());
+        const glm::dvec3 position_dt = ProtoVector2Glm(physic.position_dt());
+        const glm::dvec4 orientation = ProtoVector2Dvec4(physic.orientation());
+        const glm::dvec4 orientation_dt =
+            ProtoVector2Dvec4(physic.orientation_dt());
+        if (positions_[index] == position &&
+            position_dts_[index] == position_dt &&
+            orientations_[index] == orientation &&
+            orientation_dts_[index] == orientation_dt &&
+            masses_[index] == physic.mass() &&
+            radii_[index] == physic.radius())
+        {
+            return false;
+        }
+        positions_[index] = position;
+        position_dts_[index] = position_dt;
+        orientations_[index] = orientation;
+        orientation_dts_[index] = orientation_dt;
+        masses_[index] = physic.mass();
+        radii_[index] = physic.radius();
+        return true;
+    }
+
+    void EntityStore::SetSequence(std::uint64_t sequence) {
+        sequence_ = sequence;
+    }
+
+    void EntityStore::MarkChanged(std::size_t index, ChangeEnum change) {
+        ++version_;
+        JournalChange(index);
+        switch (change) {
+            case ChangeEnum::CHANGE_PHYSIC:
+                physic_sequences_[index] = sequence_;
+                break;
+            case ChangeEnum::CHANGE_APPEARANCE:
+                appearance_sequences_[index] = sequence_;
+                break;
+            case ChangeEnum::CHANGE_STATUS:
+                status_sequences_[index] = sequence_;
+                break;
+        }
+    }
+
+    std::uint64_t EntityStore::GetChangeSequence(
+        std::size_t index,
+        ChangeEnum change) const
+    {
+        switch (change) {
+            case ChangeEnum::CHANGE_PHYSIC:
+                return physic_sequences_[index];
+            case ChangeEnum::CHANGE_APPEARANCE:
+                return appearance_sequences_[index];
+            case ChangeEnum::CHANGE_STATUS:
+                return status_sequences_[index];
+        }
+        return sequence_;
+    }
+
+    void EntityStore::Remove(EntityHandle handle) {
+        auto it = handle_indices_.find(handle);
+        if (it == handle_indices_.end()) {
+            return;
+        }
+        ++version_;
+        const std::size_t index = it->second;
+        const std::size_t last = handles_.size() - 1;
+        for (auto& journal : journals_) {
+            if (journal.enabled) {
+                journal.removed_entities.push_back({ handle, names_[index] });
+            }
+        }
+        name_handles_.erase(names_[index]);
+        handle_indices_.erase(it);
+        if (index != last) {
+            ForEachColumn([index, last](auto& column) {
+                column[index] = std::move(column[last]);
+            });
+            handle_indices_[handles_[index]] = index;
+            JournalMove(index);
+        }
+        ForEachColumn([](auto& column) { column.pop_back(); });
+    }
+
+    void EntityStore::Clear() {
+        ++version_;
+        for (auto& journal : journals_) {
+            if (!journal.enabled) {
+                continue;
+            }
+            for (std::size_t i = 0; i < handles_.size(); ++i) {
+                journal.removed_entities.push_back(
+                    { handles_[i], names_[i] });
+            }
+        }
+        ForEachColumn([](auto& column) { column.clear(); });
+        handle_indices_.clear();
+        name_handles_.clear();
+    }
+
+    void EntityStore::EnableJournal(
+        JournalEnum journal,
+        bool include_existing)
+    {
+        auto& current = journals_[static_cast<std::size_t>(journal)];
+        if (current.enabled) {
+            return;
+        }
+        current.enabled = true;
+        if (!include_existing) {
+            return;
+        }
+        for (std::size_t i = 0; i < handles_.size(); ++i) {
+            const std::uint8_t bit = 1 << static_cast<int>(journal);
+            if (!(journaled_[i] & bit)) {
+                journaled_[i] |= bit;
+                current.changed_handles.push_back(handles_[i]);
+            }
+        }
+    }
+
+    void EntityStore::TakeJournal(
+        JournalEnum journal,
+        std::vector<EntityHandle>& changed_handles,
+        std::vector<RemovedEntity>& removed_entities)
+    {
+        auto& current = journals_[static_cast<std::size_t>(journal)];
+        changed_handles.clear();
+        removed_entities.clear();
+        std::swap(changed_handles, current.changed_handles);
+        std::swap(removed_entities, current.removed_entities);
+        const std::uint8_t mask = ~(1 << static_cast<int>(journal));
+        for (const EntityHandle handle : changed_handles) {
+            auto it = handle_indices_.find(handle);
+            if (it != handle_indices_.end()) {
+                journaled_[it->second] &= mask;
+            }
+        }
+    }
+
+    void EntityStore::JournalChange(std::size_t index) {
+        for (std::size_t i = 0; i < journals_.size(); ++i) {
+            const std::uint8_t bit = 1 << i;
+            if (journals_[i].enabled && !(journaled_[index] & bit)) {
+                journaled_[index] |= bit;
+                journals_[i].changed_handles.push_back(handles_[index]);
+            }
+        }
+    }
+
+    void EntityStore::JournalMove(std::size_t index) {
+        // The mirrors copy the rows by index.
+        const std::size_t mirror =
+            static_cast<std::size_t>(JournalEnum::JOURNAL_MIRROR);
+        const std::uint8_t bit = 1 << mirror;
+        if (journals_[mirror].enabled && !(journaled_[index] & bit)) {
+            journaled_[index] |= bit;
+            journals_[mirror].changed_handles.push_back(handles_[index]);
+        }
+    }
+
+    void EntityStore::Mirror(const EntityStore& source) {
+        *this = source;
+        for (auto& journal : journals_) {
+            journal = {};
+        }
+    }
+
+    void EntityStore::MirrorRows(
+        const EntityStore& source,
+        std::span<const EntityHandle> changed_handles)
+    {
+        // A row that holds another handle than in the source was added or
+        // moved there, so it is in the changed handles, the extra rows are
+        // dropped.
+        const std::size_t size = source.Size();
+        for (std::size_t i = size; i < handles_.size(); ++i) {
+            ForgetMirrorRow(i, source);
+        }
+        ForEachColumn([size](auto& column) { column.resize(size); });
+        for (const EntityHandle handle : changed_handles) {
+            auto maybe_index = source.FindIndex(handle);
+            if (!maybe_index) {
+                continue;
+            }
+            const std::size_t index = *maybe_index;
+            const bool is_moved = handles_[index] != handle;
+            if (is_moved) {
+                ForgetMirrorRow(index, source);
+            }
+            ForEachColumn(
+                [index](auto& column, const auto& source_column) {
+                    column[index] = source_column[index];
+                },
+                source);
+            if (is_moved) {
+                handle_indices_[handle] = index;
+                name_handles_.insert_or_assign(names_[index], handle);
+            }
+        }
+        sequence_ = source.sequence_;
+        version_ = source.version_;
+    }
+
+    void EntityStore::ForgetMirrorRow(
+        std::size_t index,
+        const EntityStore& source)
+    {
+        const EntityHandle handle = handles_[index];
+        if (handle == INVALID_ENTITY_HANDLE || source.FindIndex(handle)) {
+            // Its own row updates the indices.
+            return;
+        }
+        auto it = handle_indices_.find(handle);
+        if (it != handle_indices_.end() && it->second == index) {
+            handle_indices_.erase(it);
+        }
+        auto name_it = name_handles_.find(names_[index]);
+        if (name_it != name_handles_.end() && name_it->second == handle) {
+            name_handles_.erase(name_it);
+        }
+    }
+
+    void EntityStore::Reserve(std::size_t size) {
+        ForEachColumn([size](auto& column) { column.reserve(size); });
+        handle_indices_.reserve(size);
+        name_handles_.reserve(size);
+    }
+
+    std::optional<std::size_t> EntityStore::FindIndex(
+        EntityHandle handle) const
+    {
+        auto it = handle_indices_.find(handle);
+        if (it == handle_indices_.end()) {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    std::optional<std::size_t> EntityStore::FindIndex(
+        std::string_view name) const
+    {
+        auto it = name_handles_.find(name);
+        if (it == name_handles_.end()) {
+            return std::nullopt;
+        }
+        return FindIndex(it->second);
+    }
+
+    proto::Element EntityStore::GetElement(std::size_t index) const {
+        proto::Element element;
+        FillElement(index, element);
+        return element;
+    }
+
+    proto::Character EntityStore::GetCharacter(std::size_t index) const {
+        proto::Character character;
+        FillCharacter(index, character);
+        return character;
+    }
+
+    ElementRow EntityStore::GetElementRow(std::size_t index) const {
+        ElementRow row{};
+        row.position = positions_[index];
+        row.position_dt = position_dts_[index];
+        row.orientation = orientations_[index];
+        row.orientation_dt = orientation_dts_[index];
+        row.mass = masses_[index];
+        row.radius = radii_[index];
+        row.color = colors_[index];
+        row.type_enum = types_[index];
+        return row;
+    }
+
+    void EntityStore::FillElement(
+        std::size_t index,
+        proto::Element& element) const
+    {
+        element.set_name(names_[index]);
+        element.mutable_color()->CopyFrom(Glm2ProtoVector(colors_[index]));
+        FillPhysic(index, *element.mutable_physic());
+        element.set_type_enum(types_[index]);
+    }
+
+    void EntityStore::FillCharacter(
+        std::size_t index,
+        proto::Character& character) const
+    {
+        character.set_name(names_[index]);
+        character.mutable_color()->CopyFrom(Glm2ProtoVector(colors_[index]));
+        FillPhysic(index, *character.mutable_physic());
+        character.mutable_g_force()->CopyFrom(
+            Glm2ProtoVector(g_forces_[index]));
+        character.mutable_normal()->CopyFrom(
+            Glm2ProtoVector(normals_[index]));
+        character.set_status_enum(statuses_[index]);
+        const auto& special_effect = special_effects_[index];
+        if (!IsDefault(special_effect)) {
+            auto* boost = character.mutable_special_effect_boost();
+            boost->set_special_state_enum(special_effect.special_state_enum);
+            boost->set_effect_duration(special_effect.effect_duration);
+            boost->set_cooldown_duration(special_effect.cooldown_duration);
+            boost->set_counter(special_effect.counter);
+        }
+        character.set_character_type(character_types_[index]);
+    }
+
+    bool EntityStore::FillElementDelta(
+        std::size_t index,
+        std::uint64_t baseline_sequence,
+        proto::Element& element,
+        WireIdEnum wire_id) const
+    {
+        const bool created = created_sequences_[index] > baseline_sequence;
+        const bool physic_changed =
+            created || physic_sequences_[index] > baseline_sequence;
+        const bool appearance_changed =
+            created || appearance_sequences_[index] > baseline_sequence;
+        if (!physic_changed && !appearance_changed) {
+            return false;
+        }
+        if (wire_id == WireIdEnum::WIRE_ID_HANDLE) {
+            element.set_handle(handles_[index]);
+        }
+        if (wire_id == WireIdEnum::WIRE_ID_NAME || created) {
+            element.set_name(names_[index]);
+        }
+        if (physic_changed) {
+            FillPhysic(index, *element.mutable_physic());
+        }
+        if (appearance_changed) {
+            element.mutable_color()->CopyFrom(
+                Glm2ProtoVector(colors_[index]));
+            element.set_type_enum(types_[index]);
+        }
+        return true;
+    }
+
+    bool EntityStore::FillCharacterDelta(
+        std::size_t index,
+        std::uint64_t baseline_sequence,
+        proto::Character& character,
+        WireIdEnum wire_id) const
+    {
+        const bool created = created_sequences_[index] > baseline_sequence;
+        const bool physic_changed =
+            created || physic_sequences_[index] > baseline_sequence;
+        const bool appearance_changed =
+            created || appearance_sequences_[index] > baseline_sequence;
+        const bool status_changed =
+            created || status_sequences_[index] > baseline_sequence;
+        if (!physic_changed && !appearance_changed && !status_changed) {
+            return false;
+        }
+        if (wire_id == WireIdEnum::WIRE_ID_HANDLE) {
+            character.set_handle(handles_[index]);
+        }
+        if (wire_id == WireIdEnum::WIRE_ID_NAME || created) {
+            character.set_name(names_[index]);
+        }
+        if (physic_changed) {
+            FillPhysic(index, *character.mutable_physic());
+        }
+        if (appearance_changed) {
+            character.mutable_color()->CopyFrom(
+                Glm2ProtoVector(colors_[index]));
+            character.set_character_type(character_types_[index]);
+        }
+        if (status_changed) {
+            character.mutable_g_force()->CopyFrom(
+                Glm2ProtoVector(g_forces_[index]));
+            character.mutable_normal()->CopyFrom(
+                Glm2ProtoVector(normals_[index]));
+            character.set_status_enum(statuses_[index]);
+            // Always present, it marks the status part as changed.
+            const auto& special_effect = special_effects_[index];
+            auto* boost = character.mutable_special_effect_boost();
+            boost->set_special_state_enum(special_effect.special_state_enum);
+            boost->set_effect_duration(special_effect.effect_duration);
+            boost->set_cooldown_duration(special_effect.cooldown_duration);
+            boost->set_counter(special_effect.counter);
+        }
+        return true;
+    }
+
+    void EntityStore::FillPhysic(
+        std::size_t index,
+        proto::Physic& physic) const
+    {
+        physic.set_radius(radii_[index]);
+        physic.set_mass(masses_[index]);
+        physic.mutable_position()->CopyFrom(
+            Glm2ProtoVector(positions_[index]));
+        physic.mutable_position_dt()->CopyFrom(
+            Glm2ProtoVector(position_dts_[index]));
+        if (orientations_[index] != glm::dvec4(0.0)) {
+            physic.mutable_orientation()->CopyFrom(
+                Dvec42ProtoVector(orientations_[index]));
+        }
+        if (orientation_dts_[index] != glm::dvec4(0.0)) {
+            physic.mutable_orientation_dt()->CopyFrom(
+                Dvec42ProtoVector(orientation_dts_[index]));
+        }
+    }
+
+}  // End namespace darwin.
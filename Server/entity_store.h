@@ -0,0 +1,292 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+#include <glm/glm.hpp>
+
+#include "Common/darwin_service.pb.h"
+
+namespace darwin {
+
+    // Stable integer identifier of an entity, handles are never reused (a
+    // world that runs out of them throws rather than wrap around).
+    using EntityHandle = std::uint32_t;
+    constexpr EntityHandle INVALID_ENTITY_HANDLE = 0;
+    // Last seen value of a character that never reported in.
+    constexpr double NEVER_SEEN = std::numeric_limits<double>::infinity();
+
+    // Group of columns tracked for delta updates.
+    enum class ChangeEnum {
+        CHANGE_PHYSIC,      // Position, speed, orientation, mass, radius.
+        CHANGE_APPEARANCE,  // Color, type and character type.
+        CHANGE_STATUS,      // Status, normal, g force and special effect.
+    };
+
+    // Consumers of the change journal of a store.
+    enum class JournalEnum {
+        JOURNAL_CHECKPOINT,
+        JOURNAL_WRITE_AHEAD,
+        JOURNAL_MIRROR,     // Also the rows moved by a removal.
+        JOURNAL_COUNT
+    };
+
+    // How the entities are identified in the updates sent to a client.
+    enum class WireIdEnum {
+        WIRE_ID_NAME,       // By name, in every update.
+        WIRE_ID_HANDLE,     // By handle, named once when introduced.
+    };
+
+    // Row removed while journaled.
+    struct RemovedEntity {
+        EntityHandle handle;
+        std::string name;
+    };
+
+    // Plain value version of the proto::SpecialEffectParameter.
+    struct SpecialEffect {
+        proto::SpecialStateEnum special_state_enum =
+            proto::SPECIAL_STATE_WAIT;
+        double effect_duration = 0.0;
+        double cooldown_duration = 0.0;
+        double counter = 0.0;
+        bool operator==(const SpecialEffect&) const = default;
+    };
+
+    // Plain value of an element row (without its name), also the record of
+    // the binary world snapshot so it has a fixed layout.
+    struct ElementRow {
+        glm::dvec3 position;
+        glm::dvec3 position_dt;
+        glm::dvec4 orientation;
+        glm::dvec4 orientation_dt;
+        double mass;
+        double radius;
+        glm::dvec3 color;
+        // proto::TypeEnum.
+        std::int32_t type_enum;
+        std::int32_t padding;
+    };
+    static_assert(std::is_trivially_copyable_v<ElementRow>);
+    static_assert(sizeof(ElementRow) == 160);
+
+    // Dense structure of arrays storage for entities (characters or
+    // elements). Every column is contiguous and share the same row index,
+    // a removed row is replaced by the last one so the columns never have
+    // holes. Rows move, handles don't.
+    // Every row remember the sequence at which it was created and the last
+    // sequence at which each group of columns changed, so a delta against
+    // any older sequence can be built. Direct writes through the column
+    // getters have to call MarkChanged.
+    class EntityStore {
+    public:
+        std::size_t Add(EntityHandle handle, const proto::Element& element);
+        std::size_t Add(
+            EntityHandle handle,
+            const proto::Character& character);
+        std::size_t Add(
+            EntityHandle handle,
+            std::string_view name,
+            const ElementRow& row);
+        void Set(std::size_t index, const proto::Element& element);
+        void Set(std::size_t index, const ElementRow& row);
+        void Set(std::size_t index, const proto::Character& character);
+        void Remove(EntityHandle handle);
+        void Clear();
+        void Reserve(std::size_t size);
+        std::optional<std::size_t> FindIndex(EntityHandle handle) const;
+        std::optional<std::size_t> FindIndex(std::string_view name) const;
+        // Build the proto at the RPC boundary.
+        proto::Element GetElement(std::size_t index) const;
+        proto::Character GetCharacter(std::size_t index) const;
+        ElementRow GetElementRow(std::size_t index) const;
+        void FillElement(std::size_t index, proto::Element& element) const;
+        void FillCharacter(
+            std::size_t index,
+            proto::Character& character) const;
+        void SetPhysic(std::size_t index, const proto::Physic& physic);
+        // Fill only what changed after the baseline sequence (everything if
+        // the row was created after it), return false if nothing changed.
+        // The character special effect is always set with the status part.
+        bool FillElementDelta(
+            std::size_t index,
+            std::uint64_t baseline_sequence,
+            proto::Element& element,
+            WireIdEnum wire_id = WireIdEnum::WIRE_ID_NAME) const;
+        bool FillCharacterDelta(
+            std::size_t index,
+            std::uint64_t baseline_sequence,
+            proto::Character& character,
+            WireIdEnum wire_id = WireIdEnum::WIRE_ID_NAME) const;
+        // Sequence stamped on changes from now on.
+        void SetSequence(std::uint64_t sequence);
+        void MarkChanged(std::size_t index, ChangeEnum change);
+        std::uint64_t GetChangeSequence(
+            std::size_t index,
+            ChangeEnum change) const;
+        // Once enabled, the handles of the rows added or changed and the
+        // rows removed are journaled (once each) until taken, by journal.
+        // The existing rows count as added if include_existing.
+        void EnableJournal(JournalEnum journal, bool include_existing);
+        void TakeJournal(
+            JournalEnum journal,
+            std::vector<EntityHandle>& changed_handles,
+            std::vector<RemovedEntity>& removed_entities);
+        // Keep a mirror of a source store, where every row has the same
+        // index as in the source. Mirror copies everything but the
+        // journals, MirrorRows only the rows of the changed handles (taken
+        // from the JOURNAL_MIRROR of the source since the last sync), which
+        // is O(changed). A mirror has no journal.
+        void Mirror(const EntityStore& source);
+        void MirrorRows(
+            const EntityStore& source,
+            std::span<const EntityHandle> changed_handles);
+
+    public:
+        std::size_t Size() const { return handles_.size(); }
+        bool Empty() const { return handles_.empty(); }
+        const std::vector<EntityHandle>& GetHandles() const {
+            return handles_;
+        }
+        const std::vector<std::string>& GetNames() const { return names_; }
+        std::vector<glm::dvec3>& GetPositions() { return positions_; }
+        const std::vector<glm::dvec3>& GetPositions() const {
+            return positions_;
+        }
+        std::vector<glm::dvec3>& GetPositionDts() { return position_dts_; }
+        const std::vector<glm::dvec3>& GetPositionDts() const {
+            return position_dts_;
+        }
+        std::vector<double>& GetMasses() { return masses_; }
+        const std::vector<double>& GetMasses() const { return masses_; }
+        std::vector<double>& GetRadii() { return radii_; }
+        const std::vector<double>& GetRadii() const { return radii_; }
+        const std::vector<glm::dvec3>& GetColors() const { return colors_; }
+        std::vector<proto::StatusEnum>& GetStatuses() { return statuses_; }
+        const std::vector<proto::StatusEnum>& GetStatuses() const {
+            return statuses_;
+        }
+        const std::vector<proto::TypeEnum>& GetTypes() const {
+            return types_;
+        }
+        std::vector<glm::dvec3>& GetNormals() { return normals_; }
+        const std::vector<glm::dvec3>& GetNormals() const {
+            return normals_;
+        }
+        std::vector<glm::dvec3>& GetGForces() { return g_forces_; }
+        std::vector<SpecialEffect>& GetSpecialEffects() {
+            return special_effects_;
+        }
+        const std::vector<SpecialEffect>& GetSpecialEffects() const {
+            return special_effects_;
+        }
+        std::vector<std::string>& GetPeers() { return peers_; }
+        const std::vector<std::string>& GetPeers() const { return peers_; }
+        std::vector<double>& GetLastSeens() { return last_seens_; }
+        const std::vector<std::uint64_t>& GetCreatedSequences() const {
+            return created_sequences_;
+        }
+        // Bumped by every added, changed (MarkChanged) or removed row, a
+        // copy with the same version holds the same rows.
+        std::uint64_t GetVersion() const { return version_; }
+
+    protected:
+        std::size_t AddRow(EntityHandle handle, std::string_view name);
+        // Return true if the physic changed.
+        bool SetPhysicRow(std::size_t index, const proto::Physic& physic);
+        void JournalChange(std::size_t index);
+        void JournalMove(std::size_t index);
+        // Drop the indices of the row of a mirror that will be overwritten
+        // (or removed), unless its handle is still in the source.
+        void ForgetMirrorRow(std::size_t index, const EntityStore& source);
+        void FillPhysic(std::size_t index, proto::Physic& physic) const;
+        // Call func with every column, and with the same column of the
+        // other stores if any.
+        template <typename F, typename... Stores>
+        void ForEachColumn(F&& func, Stores&... others) {
+            func(handles_, others.handles_...);
+            func(names_, others.names_...);
+            func(positions_, others.positions_...);
+            func(position_dts_, others.position_dts_...);
+            func(orientations_, others.orientations_...);
+            func(orientation_dts_, others.orientation_dts_...);
+            func(masses_, others.masses_...);
+            func(radii_, others.radii_...);
+            func(colors_, others.colors_...);
+            func(statuses_, others.statuses_...);
+            func(types_, others.types_...);
+            func(normals_, others.normals_...);
+            func(g_forces_, others.g_forces_...);
+            func(special_effects_, others.special_effects_...);
+            func(character_types_, others.character_types_...);
+            func(peers_, others.peers_...);
+            func(last_seens_, others.last_seens_...);
+            func(created_sequences_, others.created_sequences_...);
+            func(physic_sequences_, others.physic_sequences_...);
+            func(appearance_sequences_, others.appearance_sequences_...);
+            func(status_sequences_, others.status_sequences_...);
+            func(journaled_, others.journaled_...);
+        }
+
+    private:
+        // Columns.
+        std::vector<EntityHandle> handles_;
+        std::vector<std::string> names_;
+        std::vector<glm::dvec3> positions_;
+        std::vector<glm::dvec3> position_dts_;
+        std::vector<glm::dvec4> orientations_;
+        std::vector<glm::dvec4> orientation_dts_;
+        std::vector<double> masses_;
+        std::vector<double> radii_;
+        std::vector<glm::dvec3> colors_;
+        std::vector<proto::StatusEnum> statuses_;
+        std::vector<proto::TypeEnum> types_;
+        // Character only columns.
+        std::vector<glm::dvec3> normals_;
+        std::vector<glm::dvec3> g_forces_;
+        std::vector<SpecialEffect> special_effects_;
+        std::vector<proto::CharacterTypeEnum> character_types_;
+        std::vector<std::string> peers_;
+        std::vector<double> last_seens_;
+        // Change tracking.
+        std::uint64_t sequence_ = 1;
+        std::uint64_t version_ = 0;
+        std::vector<std::uint64_t> created_sequences_;
+        std::vector<std::uint64_t> physic_sequences_;
+        std::vector<std::uint64_t> appearance_sequences_;
+        std::vector<std::uint64_t> status_sequences_;
+        // Journals, a row is in the changed handles of a journal once until
+        // taken (a bit by journal).
+        struct Journal {
+            bool enabled = false;
+            std::vector<EntityHandle> changed_handles;
+            std::vector<RemovedEntity> removed_entities;
+        };
+        std::array<Journal, static_cast<std::size_t>(
+            JournalEnum::JOURNAL_COUNT)> journals_;
+        std::vector<std::uint8_t> journaled_;
+        // Indices (handle -> row, name -> handle), names are looked up
+        // without building a string.
+        struct NameHash {
+            using is_transparent = void;
+            std::size_t operator()(std::string_view name) const {
+                return std::hash<std::string_view>{}(name);
+            }
+        };
+        std::unordered_map<EntityHandle, std::size_t> handle_indices_;
+        std::unordered_map<
+            std::string,
+            EntityHandle,
+            NameHash,
+            std::equal_to<>> name_handles_;
+    };
+
+}  // End namespace darwin.
@@ -0,0 +1,109 @@
+#include "input_simulator.h"
+
+namespace darwin {
+
+    namespace {
+
+        // Characters by chunk of the worker pool.
+        constexpr std::size_t SIMULATION_GRAIN = 32;
+        // Mass paid when the boost is activated (see CheckNewBoost).
+        constexpr double BOOST_COST = 1.0;
+
+        // Run the boost of the character for a frame, return true if the
+        // frame can boost: from a waiting boost (paid) or while it is
+        // active, never during its cooldown.
+        bool UpdateBoost(
+            CharacterInputState& state,
+            bool is_boosting,
+            double duration,
+            const proto::SpecialEffectParameter& parameter)
+        {
+            auto& boost = state.special_effect_boost;
+            boost.effect_duration = parameter.effect_duration();
+            boost.cooldown_duration = parameter.cooldown_duration();
+            if (is_boosting &&
+                boost.special_state_enum == proto::SPECIAL_STATE_WAIT)
+            {
+                boost.special_state_enum = proto::SPECIAL_STATE_ACTIVE;
+                boost.counter = 0.0;
+                state.mass_cost += BOOST_COST;
+            }
+            switch (boost.special_state_enum) {
+                case proto::SPECIAL_STATE_ACTIVE: {
+                    boost.counter += duration;
+                    if (boost.counter > boost.effect_duration) {
+                        boost.counter = 0.0;
+                        boost.special_state_enum =
+                            proto::SPECIAL_STATE_COOLDOWN;
+                    }
+                    return is_boosting;
+                }
+                case proto::SPECIAL_STATE_COOLDOWN: {
+                    boost.counter += duration;
+                    if (boost.counter > boost.cooldown_duration) {
+                        boost.counter = 0.0;
+                        boost.special_state_enum = proto::SPECIAL_STATE_WAIT;
+                    }
+                    return false;
+                }
+                default: {
+                    boost.counter = 0.0;
+                    return false;
+                }
+            }
+        }
+
+    }  // End namespace.
+
+    void InputSimulator::Simulate(
+        std::span<CharacterInputState> states,
+        std::span<const PhysicState> grounds,
+        const proto::PlayerParameter& player_parameter)
+    {
+        worker_pool_.ParallelFor(
+            states.size(),
+            SIMULATION_GRAIN,
+            [&](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) {
+                    SimulateCharacterInputs(
+                        states[i],
+                        grounds,
+                        player_parameter);
+                }
+            });
+    }
+
+    void SimulateCharacterInputs(
+        CharacterInputState& state,
+        std::span<const PhysicState> grounds,
+        const proto::PlayerParameter& player_parameter)
+    {
+        for (auto player_input : state.player_inputs) {
+            player_input.boost = UpdateBoost(
+                state,
+                player_input.boost,
+                player_input.duration,
+                player_parameter.special_effect_boost());
+            state.status_enum = ApplyPlayerInput(
+                state.physic,
+                state.status_enum,
+                state.normal,
+                player_input,
+                player_parameter);
+            if (grounds.empty()) {
+                continue;
+            }
+            glm::dvec3 force = glm::dvec3(0.0);
+            for (const auto& ground : grounds) {
+                force += ApplyPhysic(ground, state.physic);
+            }
+            state.g_force = force;
+            state.normal = glm::normalize(-force);
+            UpdateObject(state.physic, force, player_input.duration);
+            for (const auto& ground : grounds) {
+                state.status_enum = CorrectSurface(state.physic, ground);
+            }
+        }
+    }
+
+}  // End namespace darwin.
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <span>
+
+#include "Server/character_info.h"
+#include "Server/worker_pool.h"
+
+namespace darwin {
+
+    // Authoritative simulation of the characters from the inputs of their
+    // players, with the physic of the client prediction. The characters are
+    // independent so they are simulated in parallel on a worker pool.
+    class InputSimulator {
+    public:
+        explicit InputSimulator(WorkerPool& worker_pool) :
+            worker_pool_(worker_pool) {}
+
+    public:
+        void Simulate(
+            std::span<CharacterInputState> states,
+            std::span<const PhysicState> grounds,
+            const proto::PlayerParameter& player_parameter);
+        std::size_t GetWorkerCount() const {
+            return worker_pool_.GetWorkerCount();
+        }
+
+    private:
+        WorkerPool& worker_pool_;
+    };
+
+    // Run the frames of a character one by one: boost, inputs, gravity,
+    // integration and ground (as the client prediction does). A frame gets
+    // the boost it asks for only if the boost of the character allows it.
+    void SimulateCharacterInputs(
+        CharacterInputState& state,
+        std::span<const PhysicState> grounds,
+        const proto::PlayerParameter& player_parameter);
+
+}  // End namespace darwin.
@@ -1,11 +1,25 @@
 #include <grpc++/grpc++.h>
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <csignal>
+#include <fstream>
 #include <future>
+#include <memory>
+#include <optional>
+#include <random>
+#include <thread>
 #include <absl/flags/flag.h>
 #include <absl/flags/parse.h>
 
+#include "Common/vector.h"
 #include "Server/darwin_service_impl.h"
+#include "Server/region_service.h"
+#include "Server/room_service.h"
+#include "world_checkpoint.h"
+#include "world_recorder.h"
+#include "world_snapshot.h"
 #include "world_state_file.h"
 
 ABSL_FLAG(
@@ -17,7 +31,7 @@ ABSL_FLAG(
     std::string, 
     world_db, 
     "world_db.json", 
-    "The name of the world database file.");
+    "The name of the world database file (json or binary snapshot).");
 ABSL_FLAG(
     std::uint32_t,
     upgrade_count,
@@ -26,8 +40,149 @@ ABSL_FLAG(
 ABSL_FLAG(
     double,
     loop_timer,
+    1.0 / 30.0,
+    "The time in seconds between each simulation step.");
+ABSL_FLAG(
+    double,
+    broadcast_timer,
     0.1,
-    "The time in seconds between each world update.");
+    "The time in seconds between each broadcast to the clients.");
+ABSL_FLAG(
+    std::uint32_t,
+    max_catch_up_steps,
+    5,
+    "Number of late simulation steps run to catch up before skipping.");
+ABSL_FLAG(
+    bool,
+    server_hit_detection,
+    true,
+    "Detect hits on the server instead of trusting the clients.");
+ABSL_FLAG(
+    std::uint64_t,
+    keyframe_interval,
+    50,
+    "Maximum number of simulation steps between two full updates.");
+ABSL_FLAG(
+    double,
+    interest_angle,
+    40.0,
+    "Angle in degrees around a character under which entities are sent to "
+    "its client, 0 to send the whole world.");
+ABSL_FLAG(
+    double,
+    profile_period,
+    0.0,
+    "The time in seconds between each print of the tick profile, 0 to only "
+    "print it on shutdown.");
+ABSL_FLAG(
+    std::string,
+    profile_file,
+    "",
+    "The file the tick profile is written to on shutdown (stdout if empty).");
+ABSL_FLAG(
+    std::string,
+    checkpoint_directory,
+    "",
+    "The directory of the world checkpoints, the newest one is loaded "
+    "instead of the world database if any (no checkpoint if empty).");
+ABSL_FLAG(
+    double,
+    checkpoint_period,
+    60.0,
+    "The time in seconds between each world checkpoint, 0 to only "
+    "checkpoint on demand (SIGUSR1) and on shutdown.");
+ABSL_FLAG(
+    std::uint32_t,
+    checkpoint_retention,
+    3,
+    "The number of world checkpoints kept.");
+ABSL_FLAG(
+    bool,
+    checkpoint_journal,
+    true,
+    "Journal the changes of every step next to the checkpoints, and replay "
+    "them over the newest checkpoint at startup.");
+ABSL_FLAG(
+    std::string,
+    record_file,
+    "",
+    "The file what the server receives is recorded to, to be replayed by "
+    "DarwinReplay (no recording if empty).");
+ABSL_FLAG(
+    std::uint64_t,
+    random_seed,
+    0,
+    "The seed of the random generator, 0 for a random one.");
+ABSL_FLAG(
+    std::uint32_t,
+    simulation_threads,
+    0,
+    "The number of worker threads that simulate the characters from the "
+    "input commands of their players and run the phases of the world "
+    "update, 0 for one less than the hardware threads (the tick thread "
+    "also takes part).");
+ABSL_FLAG(
+    std::uint32_t,
+    room_players,
+    0,
+    "The number of players by room, a new room (an independent copy of the "
+    "world) is opened once all the rooms are full, 0 for a single world "
+    "(needed by the checkpoints and the recording).");
+ABSL_FLAG(
+    std::vector<std::string>,
+    region_servers,
+    {},
+    "The addresses of the servers of the regions of the world (sectors of "
+    "longitude), this one included, empty for a single server.");
+ABSL_FLAG(
+    std::uint32_t,
+    region_index,
+    0,
+    "The region of this server in region_servers.");
+ABSL_FLAG(
+    double,
+    mirror_angle,
+    5.0,
+    "Angle in degrees from a border under which the entities are mirrored "
+    "to the server of the region across it.");
+ABSL_FLAG(
+    bool,
+    region_handoff,
+    false,
+    "Hand off the characters that leave the region to the server of their "
+    "new region (the client has to follow the handoff). Off, a character "
+    "stays on the server of its player and is mirrored where it is.");
+
+namespace {
+
+    std::atomic<bool> g_shutdown_requested = false;
+    std::atomic<bool> g_checkpoint_requested = false;
+
+    void HandleSignal(int) {
+        g_shutdown_requested = true;
+    }
+
+#if defined(SIGUSR1)
+    void HandleCheckpointSignal(int) {
+        g_checkpoint_requested = true;
+    }
+#endif
+
+    template <typename Service>
+    std::string GetTickReport(const Service& service) {
+        const auto metrics = service.GetTickMetrics();
+        return std::format(
+            "steps: {} broadcasts: {} overruns: {} skipped: {} "
+            "max jitter: {:.3f} ms\n{}",
+            metrics.step_count,
+            metrics.broadcast_count,
+            metrics.overrun_count,
+            metrics.skipped_step_count,
+            metrics.max_jitter * 1000.0,
+            service.GetTickProfiler().ToString());
+    }
+
+}  // End namespace.
 
 int main(int ac, char** av) try {
     absl::ParseCommandLine(ac, av);
@@ -38,32 +193,272 @@ int main(int ac, char** av) try {
 
     grpc::ServerBuilder builder;
     darwin::WorldState world_state;
+    const std::filesystem::path checkpoint_directory =
+        absl::GetFlag(FLAGS_checkpoint_directory);
+    std::optional<std::filesystem::path> maybe_checkpoint;
+    if (!checkpoint_directory.empty()) {
+        maybe_checkpoint = darwin::WorldCheckpointer::FindLatestCheckpoint(
+            checkpoint_directory);
+    }
+    const std::filesystem::path world_db =
+        maybe_checkpoint ?
+            *maybe_checkpoint :
+            std::filesystem::path(absl::GetFlag(FLAGS_world_db));
     std::cout 
-        << "loading world state from file: "<< absl::GetFlag(FLAGS_world_db)
+        << "loading world state from file: "<< world_db.string()
         << "\n";
-    LoadWorldStateFromFile(world_state, absl::GetFlag(FLAGS_world_db));
+    if (world_db.extension() == ".json") {
+        LoadWorldStateFromFile(world_state, world_db);
+    }
+    else {
+        LoadWorldStateFromSnapshot(world_state, world_db);
+    }
+    const bool checkpoint_journal = absl::GetFlag(FLAGS_checkpoint_journal);
+    if (maybe_checkpoint && checkpoint_journal) {
+        const auto replayed = darwin::ReplayWorldJournal(
+            world_state,
+            checkpoint_directory,
+            *darwin::WorldCheckpointer::GetCheckpointIndex(
+                *maybe_checkpoint));
+        std::cout << std::format("replayed journal entries: {}\n", replayed);
+    }
+    std::uint64_t random_seed = absl::GetFlag(FLAGS_random_seed);
+    const std::string record_file = absl::GetFlag(FLAGS_record_file);
+    if (random_seed == 0 && !record_file.empty()) {
+        // A replay needs the seed.
+        random_seed = std::random_device{}();
+    }
+    if (random_seed != 0) {
+        darwin::SetRandomSeed(random_seed);
+    }
+    std::unique_ptr<darwin::WorldRecorder> world_recorder;
+    std::unique_ptr<darwin::RoomService> room_service;
+    if (!record_file.empty()) {
+        proto::RecordingHeader header;
+        header.set_version(darwin::WORLD_RECORDING_VERSION);
+        header.set_random_seed(random_seed);
+        header.set_step_period(absl::GetFlag(FLAGS_loop_timer));
+        header.set_broadcast_period(absl::GetFlag(FLAGS_broadcast_timer));
+        header.set_upgrade_count(absl::GetFlag(FLAGS_upgrade_count));
+        header.set_server_hit_detection(
+            absl::GetFlag(FLAGS_server_hit_detection));
+        *header.mutable_world() =
+            darwin::SaveWorldStateToDatabase(world_state);
+        world_recorder =
+            std::make_unique<darwin::WorldRecorder>(record_file, header);
+        std::cout << std::format(
+            "recording to: {} (random seed: {})\n",
+            record_file,
+            random_seed);
+    }
+    const std::uint32_t room_players = absl::GetFlag(FLAGS_room_players);
+    if (room_players != 0 &&
+        (!checkpoint_directory.empty() || world_recorder))
+    {
+        throw std::runtime_error(
+            "Checkpoints and recording need a single world (no rooms).");
+    }
+    const auto region_servers = absl::GetFlag(FLAGS_region_servers);
+    std::unique_ptr<darwin::WorldRegion> world_region;
+    if (!region_servers.empty()) {
+        if (room_players != 0 ||
+            !checkpoint_directory.empty() ||
+            world_recorder)
+        {
+            throw std::runtime_error(
+                "Regions exclude rooms, checkpoints and recording.");
+        }
+        world_region = std::make_unique<darwin::WorldRegion>(
+            absl::GetFlag(FLAGS_region_index),
+            region_servers);
+        world_state.SetWorldRegion(world_region.get());
+        std::cout << std::format(
+            "simulating region {} of {}\n",
+            world_region->GetRegionIndex(),
+            world_region->GetRegionCount());
+    }
+    std::uint32_t simulation_threads = absl::GetFlag(FLAGS_simulation_threads);
+    if (simulation_threads == 0) {
+        simulation_threads =
+            std::max(std::thread::hardware_concurrency(), 1u) - 1;
+    }
+    double loop_timer = absl::GetFlag(FLAGS_loop_timer);
+    double broadcast_timer = absl::GetFlag(FLAGS_broadcast_timer);
+    if (room_players != 0) {
+        darwin::RoomParameter room_parameter;
+        room_parameter.world = darwin::SaveWorldStateToDatabase(world_state);
+        room_parameter.world.clear_characters();
+        room_parameter.upgrade_count = absl::GetFlag(FLAGS_upgrade_count);
+        room_parameter.server_hit_detection =
+            absl::GetFlag(FLAGS_server_hit_detection);
+        room_parameter.max_players = room_players;
+        room_parameter.keyframe_interval =
+            absl::GetFlag(FLAGS_keyframe_interval);
+        room_parameter.interest_angle =
+            absl::GetFlag(FLAGS_interest_angle) * darwin::PI / 180.0;
+        room_service =
+            std::make_unique<darwin::RoomService>(room_parameter);
+        room_service->SetSimulationThreads(simulation_threads);
+        std::cout << std::format(
+            "starting rooms of {} players with loop timer: {} broadcast "
+            "timer: {}\n",
+            room_players,
+            loop_timer,
+            broadcast_timer);
+        room_service->SetTickPeriods(
+            loop_timer,
+            broadcast_timer,
+            absl::GetFlag(FLAGS_max_catch_up_steps));
+    }
+    world_state.SetServerHitDetection(
+        absl::GetFlag(FLAGS_server_hit_detection));
     world_state.SetUpgradeElement(absl::GetFlag(FLAGS_upgrade_count));
     darwin::DarwinServiceImpl service{ world_state };
-
-    double loop_timer = absl::GetFlag(FLAGS_loop_timer);
-    std::cout << std::format(
-        "starting world simulation with loop timer: {}\n", 
-        loop_timer);
+    service.SetWorldRecorder(world_recorder.get());
+    std::unique_ptr<darwin::WorldJournal> world_journal;
+    std::unique_ptr<darwin::WorldCheckpointer> world_checkpointer;
+    if (!checkpoint_directory.empty()) {
+        world_checkpointer = std::make_unique<darwin::WorldCheckpointer>(
+            world_state,
+            checkpoint_directory,
+            absl::GetFlag(FLAGS_checkpoint_period),
+            absl::GetFlag(FLAGS_checkpoint_retention));
+        if (checkpoint_journal) {
+            world_journal =
+                std::make_unique<darwin::WorldJournal>(checkpoint_directory);
+            world_checkpointer->SetWorldJournal(world_journal.get());
+        }
+        service.SetWorldCheckpointer(world_checkpointer.get());
+    }
+    std::unique_ptr<darwin::RegionService> region_service;
+    if (world_region) {
+        region_service = std::make_unique<darwin::RegionService>(
+            world_state,
+            *world_region);
+        region_service->SetMirrorAngle(
+            absl::GetFlag(FLAGS_mirror_angle) * darwin::PI / 180.0);
+        region_service->SetExchangePeriod(
+            absl::GetFlag(FLAGS_broadcast_timer));
+        region_service->SetHandoff(absl::GetFlag(FLAGS_region_handoff));
+        service.SetRegionService(region_service.get());
+    }
+    service.SetKeyframeInterval(absl::GetFlag(FLAGS_keyframe_interval));
+    service.SetInterestAngle(
+        absl::GetFlag(FLAGS_interest_angle) * darwin::PI / 180.0);
+    if (!room_service) {
+        service.SetSimulationThreads(simulation_threads);
+        std::cout << std::format(
+            "starting world simulation with loop timer: {} broadcast "
+            "timer: {}\n",
+            loop_timer,
+            broadcast_timer);
+        service.SetTickPeriods(
+            loop_timer,
+            broadcast_timer,
+            absl::GetFlag(FLAGS_max_catch_up_steps));
+    }
+    const auto get_tick_report = [&] {
+        return room_service ?
+            GetTickReport(*room_service) :
+            GetTickReport(service);
+    };
     // Create a callback that will compute the next epoch.
-    auto future = std::async(std::launch::async, [&service, loop_timer] {
-        service.ComputeWorld(loop_timer);
+    auto future = std::async(std::launch::async, [&] {
+        if (room_service) {
+            room_service->ComputeWorld();
+        }
+        else {
+            service.ComputeWorld();
+        }
     });
 
     std::cout << "listening on: " << absl::GetFlag(FLAGS_server_name) << "\n";
     builder.AddListeningPort(
         absl::GetFlag(FLAGS_server_name),
         grpc::InsecureServerCredentials());
-    builder.RegisterService(&service);
+    // Detect dead clients, their Update stream is then cancelled.
+    builder.AddChannelArgument(GRPC_ARG_KEEPALIVE_TIME_MS, 10'000);
+    builder.AddChannelArgument(GRPC_ARG_KEEPALIVE_TIMEOUT_MS, 5'000);
+    builder.AddChannelArgument(GRPC_ARG_KEEPALIVE_PERMIT_WITHOUT_CALLS, 1);
+    if (room_service) {
+        builder.RegisterService(room_service.get());
+    }
+    else {
+        builder.RegisterService(&service);
+    }
+    if (region_service) {
+        builder.RegisterService(region_service.get());
+    }
     std::unique_ptr<grpc::Server> server(builder.BuildAndStart());
-    server->Wait();
+
+    // Run until interrupted, then dump the tick profile.
+    std::signal(SIGINT, HandleSignal);
+    std::signal(SIGTERM, HandleSignal);
+#if defined(SIGUSR1)
+    std::signal(SIGUSR1, HandleCheckpointSignal);
+#endif
+    const auto profile_period = std::chrono::duration<double>(
+        absl::GetFlag(FLAGS_profile_period));
+    auto next_profile = std::chrono::steady_clock::now() + profile_period;
+    while (!g_shutdown_requested) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        if (g_checkpoint_requested.exchange(false) && world_checkpointer) {
+            world_checkpointer->RequestCheckpoint();
+        }
+        if (profile_period.count() > 0.0 &&
+            std::chrono::steady_clock::now() >= next_profile)
+        {
+            std::cout << get_tick_report();
+            next_profile += std::chrono::duration_cast<
+                std::chrono::steady_clock::duration>(profile_period);
+        }
+    }
+    std::cout << "shutting down\n";
+    // Open streams are cancelled after the deadline.
+    server->Shutdown(
+        std::chrono::system_clock::now() + std::chrono::seconds(1));
+    if (room_service) {
+        room_service->StopComputeWorld();
+    }
+    else {
+        service.StopComputeWorld();
+    }
 
     // Wait for the future to finish.
     future.wait();
+    if (region_service) {
+        region_service->WaitForExchanges();
+        std::cout << std::format(
+            "characters handed off: {}\n",
+            region_service->GetHandoffCount());
+    }
+    // Nothing ticks anymore, save the last state.
+    if (world_checkpointer) {
+        world_checkpointer->Flush();
+        std::cout << std::format(
+            "world checkpoints written: {}\n",
+            world_checkpointer->GetWrittenCount());
+    }
+    if (world_journal) {
+        std::cout << std::format(
+            "world journal entries: {} commits: {}\n",
+            world_journal->GetWrittenCount(),
+            world_journal->GetSyncCount());
+    }
+    if (world_recorder) {
+        world_recorder->Flush();
+        std::cout << std::format(
+            "recorded events: {}\n",
+            world_recorder->GetRecordedCount());
+    }
+    const std::string profile_file = absl::GetFlag(FLAGS_profile_file);
+    if (profile_file.empty()) {
+        std::cout << get_tick_report();
+    }
+    else {
+        std::ofstream ofs(profile_file);
+        ofs << get_tick_report();
+    }
     return 0;
 } catch (const std::exception& e) {
     std::cerr << "Error: " << e.what() << std::endl;
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <atomic>
+#include <utility>
+
+namespace darwin {
+
+    // Lock-free multiple producers single consumer queue. Producers push on
+    // an intrusive stack, the consumer takes the whole stack at once (so no
+    // ABA problem) and walks it in push order.
+    template <typename T>
+    class MpscQueue {
+    public:
+        MpscQueue() = default;
+        MpscQueue(const MpscQueue&) = delete;
+        MpscQueue& operator=(const MpscQueue&) = delete;
+        ~MpscQueue() {
+            Drain([](T&&) {});
+        }
+
+    public:
+        // Can be called from any thread.
+        void Push(T value) {
+            auto* node = new Node{ std::move(value), nullptr };
+            node->next = head_.load(std::memory_order_relaxed);
+            while (!head_.compare_exchange_weak(
+                node->next,
+                node,
+                std::memory_order_release,
+                std::memory_order_relaxed))
+            {
+            }
+        }
+        // Call func on every value pushed so far, oldest first. Only one
+        // thread at a time can drain.
+        template <typename Func>
+        std::size_t Drain(Func&& func) {
+            Node* node = head_.exchange(nullptr, std::memory_order_acquire);
+            Node* reversed = nullptr;
+            while (node) {
+                Node* next = node->next;
+                node->next = reversed;
+                reversed = node;
+                node = next;
+            }
+            std::size_t count = 0;
+            while (reversed) {
+                Node* next = reversed->next;
+                func(std::move(reversed->value));
+                delete reversed;
+                reversed = next;
+                ++count;
+            }
+            return count;
+        }
+
+    private:
+        struct Node {
+            T value;
+            Node* next;
+        };
+        std::atomic<Node*> head_ = nullptr;
+    };
+
+}  // End namespace darwin.
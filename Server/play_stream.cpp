@@ -0,0 +1,93 @@
+#include "play_stream.h"
+
+namespace darwin {
+
+    PlayStream::PlayStream(
+        std::function<void(PlayStream*, const proto::PlayRequest&)>
+            on_request,
+        std::function<void(PlayStream*)> on_done) :
+        on_request_(std::move(on_request)),
+        on_done_(std::move(on_done))
+    {
+        StartRead(&read_buffer_);
+    }
+
+    void PlayStream::WriteUpdate(
+        const grpc::ByteBuffer& update,
+        std::uint64_t report_sequence)
+    {
+        auto buffer = SerializePlayResponse(update, report_sequence);
+        std::scoped_lock l(mutex_);
+        if (is_finished_) {
+            return;
+        }
+        if (is_writing_) {
+            pending_buffer_.Swap(&buffer);
+            has_pending_ = true;
+            return;
+        }
+        writing_buffer_.Swap(&buffer);
+        is_writing_ = true;
+        StartWrite(&writing_buffer_);
+    }
+
+    void PlayStream::Close(const grpc::Status& status) {
+        std::scoped_lock l(mutex_);
+        FinishLocked(status);
+    }
+
+    void PlayStream::OnReadDone(bool ok) {
+        if (!ok) {
+            // The client is done.
+            Close(grpc::Status::OK);
+            return;
+        }
+        proto::PlayRequest request;
+        auto status =
+            grpc::SerializationTraits<proto::PlayRequest>::Deserialize(
+                &read_buffer_,
+                &request);
+        if (!status.ok()) {
+            Close(status);
+            return;
+        }
+        on_request_(this, request);
+        StartRead(&read_buffer_);
+    }
+
+    void PlayStream::OnWriteDone(bool ok) {
+        std::scoped_lock l(mutex_);
+        is_writing_ = false;
+        if (!ok) {
+            FinishLocked(
+                grpc::Status(grpc::StatusCode::UNAVAILABLE, "Write failed."));
+            return;
+        }
+        if (has_pending_ && !is_finished_) {
+            writing_buffer_.Swap(&pending_buffer_);
+            pending_buffer_.Clear();
+            has_pending_ = false;
+            is_writing_ = true;
+            StartWrite(&writing_buffer_);
+        }
+    }
+
+    void PlayStream::OnCancel() {
+        std::scoped_lock l(mutex_);
+        FinishLocked(grpc::Status::CANCELLED);
+    }
+
+    void PlayStream::OnDone() {
+        on_done_(this);
+    }
+
+    void PlayStream::FinishLocked(const grpc::Status& status) {
+        if (is_finished_) {
+            return;
+        }
+        is_finished_ = true;
+        has_pending_ = false;
+        Finish(status);
+    }
+
+}  // End namespace darwin.
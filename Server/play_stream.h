@@ -0,0 +1,59 @@
+#pragma once
+
+#include <functional>
+#include <mutex>
+#include <grpc++/grpc++.h>
+
+#include "Common/darwin_service.grpc.pb.h"
+#include "Server/update_writer.h"
+
+namespace darwin {
+
+    // Server side of a Play stream. Requests are read one after the other
+    // and handed to on_request, updates are written as with UpdateWriter
+    // (only the latest one is kept while a write is in flight).
+    class PlayStream :
+        public grpc::ServerBidiReactor<grpc::ByteBuffer, grpc::ByteBuffer>,
+        public UpdateStream
+    {
+    public:
+        // Start reading, on_done is called once the stream is over, the
+        // stream can be deleted from it.
+        PlayStream(
+            std::function<void(PlayStream*, const proto::PlayRequest&)>
+                on_request,
+            std::function<void(PlayStream*)> on_done);
+
+    public:
+        // Replace the pending update.
+        void WriteUpdate(
+            const grpc::ByteBuffer& update,
+            std::uint64_t report_sequence) override;
+        // End the stream.
+        void Close(const grpc::Status& status);
+
+    public:
+        void OnReadDone(bool ok) override;
+        void OnWriteDone(bool ok) override;
+        void OnCancel() override;
+        void OnDone() override;
+
+    private:
+        void FinishLocked(const grpc::Status& status);
+
+    private:
+        // Only used by the read reaction (one read at a time).
+        grpc::ByteBuffer read_buffer_;
+        std::mutex mutex_;
+        // Buffer given to StartWrite, has to live until OnWriteDone.
+        grpc::ByteBuffer writing_buffer_;
+        grpc::ByteBuffer pending_buffer_;
+        bool is_writing_ = false;
+        bool has_pending_ = false;
+        bool is_finished_ = false;
+        std::function<void(PlayStream*, const proto::PlayRequest&)>
+            on_request_;
+        std::function<void(PlayStream*)> on_done_;
+    };
+
+}  // End namespace darwin.
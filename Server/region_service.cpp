@@ -0,0 +1,215 @@
+#include "region_service.h"
+
+#include <algorithm>
+#include <chrono>
+#include <format>
+#include <iostream>
+
+namespace darwin {
+
+    namespace {
+
+        // An exchange is late after it (its handoffs are then sent again).
+        constexpr auto EXCHANGE_DEADLINE = std::chrono::seconds(1);
+
+    }  // End namespace.
+
+    RegionService::RegionService(
+        WorldState& world_state,
+        const WorldRegion& region) :
+        world_state_(world_state),
+        region_(region)
+    {
+        stubs_.resize(region_.GetRegionCount());
+        unacknowledged_handoff_ids_.resize(region_.GetRegionCount());
+        retry_handoffs_.resize(region_.GetRegionCount());
+        received_handoff_ids_.resize(region_.GetRegionCount());
+        received_handoff_floors_.resize(region_.GetRegionCount(), 0);
+        for (std::uint32_t i = 0; i < region_.GetRegionCount(); ++i) {
+            if (i == region_.GetRegionIndex()) {
+                continue;
+            }
+            stubs_[i] = proto::DarwinRegionService::NewStub(
+                grpc::CreateChannel(
+                    region_.GetServerName(i),
+                    grpc::InsecureChannelCredentials()));
+        }
+    }
+
+    RegionService::~RegionService() {
+        WaitForExchanges();
+    }
+
+    grpc::ServerUnaryReactor* RegionService::Exchange(
+        grpc::CallbackServerContext* context,
+        const proto::RegionExchangeRequest* request,
+        proto::RegionExchangeResponse* response)
+    {
+        auto* reactor = context->DefaultReactor();
+        if (request->region() >= region_.GetRegionCount() ||
+            request->region() == region_.GetRegionIndex())
+        {
+            reactor->Finish(
+                grpc::Status(
+                    grpc::StatusCode::INVALID_ARGUMENT,
+                    std::format("Invalid region {}.", request->region())));
+            return reactor;
+        }
+        std::scoped_lock l(received_mutex_);
+        auto& received_ids = received_handoff_ids_[request->region()];
+        auto& floor = received_handoff_floors_[request->region()];
+        floor = std::max(floor, request->handoff_floor());
+        received_ids.erase(
+            received_ids.begin(),
+            received_ids.lower_bound(floor));
+        // Drop the handoffs already applied (or acknowledged).
+        const auto& ids = request->handoff_ids();
+        std::vector<int> fresh;
+        for (int i = 0; i < ids.size(); ++i) {
+            if (ids[i] >= floor && received_ids.insert(ids[i]).second) {
+                fresh.push_back(i);
+            }
+        }
+        proto::RegionExchangeRequest deduplicated;
+        const auto* applied = request;
+        if (fresh.size() != static_cast<std::size_t>(ids.size())) {
+            deduplicated.CopyFrom(*request);
+            deduplicated.clear_handoff_characters();
+            deduplicated.clear_handoff_ids();
+            for (const int i : fresh) {
+                deduplicated.add_handoff_ids(ids[i]);
+                deduplicated.add_handoff_characters()->CopyFrom(
+                    request->handoff_characters(i));
+            }
+            applied = &deduplicated;
+        }
+        world_state_.ApplyRegionExchange(*applied);
+        reactor->Finish(grpc::Status::OK);
+        return reactor;
+    }
+
+    void RegionService::SetMirrorAngle(double mirror_angle) {
+        mirror_angle_ = mirror_angle;
+    }
+
+    void RegionService::SetExchangePeriod(double exchange_period) {
+        exchange_period_ = exchange_period;
+    }
+
+    void RegionService::SetHandoff(bool is_handoff) {
+        is_handoff_ = is_handoff;
+    }
+
+    void RegionService::Tick(double time) {
+        if (time - last_exchange_time_ < exchange_period_) {
+            return;
+        }
+        last_exchange_time_ = time;
+        SendExchanges();
+    }
+
+    void RegionService::SendExchanges() {
+        world_state_.CaptureRegionExchanges(
+            mirror_angle_,
+            is_handoff_,
+            requests_);
+        for (std::uint32_t i = 0; i < requests_.size(); ++i) {
+            if (!stubs_[i]) {
+                continue;
+            }
+            auto call = std::make_unique<ExchangeCall>();
+            call->region = i;
+            call->request.Swap(&requests_[i]);
+            call->context.set_deadline(
+                std::chrono::system_clock::now() + EXCHANGE_DEADLINE);
+            {
+                std::scoped_lock l(mutex_);
+                auto& unacknowledged_ids = unacknowledged_handoff_ids_[i];
+                for (int j = 0;
+                    j < call->request.handoff_characters_size();
+                    ++j)
+                {
+                    call->request.add_handoff_ids(next_handoff_id_);
+                    unacknowledged_ids.insert(next_handoff_id_++);
+                }
+                for (auto& [id, character] : retry_handoffs_[i]) {
+                    call->request.add_handoff_ids(id);
+                    call->request.add_handoff_characters()->Swap(
+                        &character);
+                }
+                retry_handoffs_[i].clear();
+                call->request.set_handoff_floor(
+                    unacknowledged_ids.empty() ?
+                        next_handoff_id_ :
+                        *unacknowledged_ids.begin());
+                ++pending_count_;
+            }
+            // Released by the callback.
+            auto* pending_call = call.release();
+            stubs_[i]->async()->Exchange(
+                &pending_call->context,
+                &pending_call->request,
+                &pending_call->response,
+                [this, pending_call](grpc::Status status) {
+                    FinishExchange(
+                        std::unique_ptr<ExchangeCall>(pending_call),
+                        status);
+                });
+        }
+    }
+
+    void RegionService::FinishExchange(
+        std::unique_ptr<ExchangeCall> call,
+        const grpc::Status& status)
+    {
+        auto& request = call->request;
+        const auto& ids = request.handoff_ids();
+        // Rejected by the receiver, certainly not applied.
+        const bool rejected =
+            status.error_code() == grpc::StatusCode::INVALID_ARGUMENT;
+        if (status.ok()) {
+            handoff_count_ += ids.size();
+        }
+        else if (rejected && !ids.empty()) {
+            std::cerr << std::format(
+                "Exchange with region rejected ({}), {} characters given "
+                "back.\n",
+                status.error_message(),
+                ids.size());
+            // Owned again by this region (without a player).
+            proto::RegionExchangeRequest given_back;
+            given_back.set_region(region_.GetRegionIndex());
+            given_back.mutable_handoff_characters()->Swap(
+                request.mutable_handoff_characters());
+            world_state_.ApplyRegionExchange(given_back);
+        }
+        else if (!ids.empty()) {
+            std::cerr << std::format(
+                "Exchange with region failed ({}), {} characters sent "
+                "again.\n",
+                status.error_message(),
+                ids.size());
+        }
+        std::scoped_lock l(mutex_);
+        for (int i = 0; i < ids.size(); ++i) {
+            if (status.ok() || rejected) {
+                unacknowledged_handoff_ids_[call->region].erase(ids[i]);
+                continue;
+            }
+            retry_handoffs_[call->region][ids[i]].Swap(
+                request.mutable_handoff_characters(i));
+        }
+        --pending_count_;
+        condition_.notify_all();
+    }
+
+    void RegionService::WaitForExchanges() {
+        std::unique_lock l(mutex_);
+        condition_.wait(l, [this] { return pending_count_ == 0; });
+    }
+
+    std::uint64_t RegionService::GetHandoffCount() const {
+        return handoff_count_;
+    }
+
+}  // End namespace darwin.
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
+#include <grpc++/grpc++.h>
+
+#include "Common/darwin_service.grpc.pb.h"
+#include "world_region.h"
+#include "world_state.h"
+
+namespace darwin {
+
+    // Exchange with the servers of the other regions of the world. After
+    // the steps, the characters that left the region are handed off to the
+    // server of their new region (if enabled) and the entities near a
+    // border are mirrored to the server of the region across it. Every
+    // region gets a request at every exchange (an empty one clears its
+    // mirrors). The handoffs of a failed exchange are sent again with the
+    // next one, under the same ids so that the receiver applies each of
+    // them only once (the failed exchange may have been applied). They are
+    // given back to this region only if the receiver rejected the exchange.
+    class RegionService final :
+        public proto::DarwinRegionService::CallbackService
+    {
+    public:
+        RegionService(WorldState& world_state, const WorldRegion& region);
+        ~RegionService() override;
+        RegionService(const RegionService&) = delete;
+        RegionService& operator=(const RegionService&) = delete;
+
+    public:
+        grpc::ServerUnaryReactor* Exchange(
+            grpc::CallbackServerContext* context,
+            const proto::RegionExchangeRequest* request,
+            proto::RegionExchangeResponse* response) override;
+
+    public:
+        // Angle (in radians) from a border under which the entities are
+        // mirrored, set before the first tick.
+        void SetMirrorAngle(double mirror_angle);
+        // Time in seconds between two exchanges, 0 to exchange at every
+        // step, set before the first tick.
+        void SetExchangePeriod(double exchange_period);
+        // Hand off the characters that leave the region (off by default,
+        // their players have to follow them to the new server), set before
+        // the first tick.
+        void SetHandoff(bool is_handoff);
+        // Called on the tick thread after each step.
+        void Tick(double time);
+        // Send the exchanges now (tick thread).
+        void SendExchanges();
+        // Wait until the exchanges sent are done.
+        void WaitForExchanges();
+        std::uint64_t GetHandoffCount() const;
+
+    protected:
+        struct ExchangeCall {
+            // Region of the receiver.
+            std::uint32_t region = 0;
+            grpc::ClientContext context;
+            proto::RegionExchangeRequest request;
+            proto::RegionExchangeResponse response;
+        };
+        void FinishExchange(
+            std::unique_ptr<ExchangeCall> call,
+            const grpc::Status& status);
+
+    private:
+        WorldState& world_state_;
+        const WorldRegion& region_;
+        double mirror_angle_ = 0.05;
+        double exchange_period_ = 0.0;
+        bool is_handoff_ = false;
+        // By region, none for this region.
+        std::vector<std::unique_ptr<proto::DarwinRegionService::Stub>>
+            stubs_;
+        // Tick thread only.
+        std::vector<proto::RegionExchangeRequest> requests_;
+        double last_exchange_time_ = 0.0;
+        std::mutex mutex_;
+        std::condition_variable condition_;
+        std::size_t pending_count_ = 0;
+        std::uint64_t next_handoff_id_ = 1;
+        // By region, the handoffs sent and not acknowledged yet.
+        std::vector<std::set<std::uint64_t>> unacknowledged_handoff_ids_;
+        // By region, the handoffs of the failed exchanges by id.
+        std::vector<std::map<std::uint64_t, proto::Character>>
+            retry_handoffs_;
+        // Receiver side, by region, the handoffs applied above its floor.
+        std::mutex received_mutex_;
+        std::vector<std::set<std::uint64_t>> received_handoff_ids_;
+        std::vector<std::uint64_t> received_handoff_floors_;
+        std::atomic<std::uint64_t> handoff_count_ = 0;
+    };
+
+}  // End namespace darwin.
@@ -0,0 +1,233 @@
+#include "room_service.h"
+
+#include <chrono>
+#include <format>
+#include <iostream>
+
+namespace darwin {
+
+    RoomService::RoomService(const RoomParameter& room_parameter) :
+        room_parameter_(room_parameter),
+        worker_pool_(std::make_unique<WorkerPool>(0))
+    {
+        std::scoped_lock l(mutex_);
+        OpenRoomLocked();
+    }
+
+    RoomService::~RoomService() {
+        // The rooms are destroyed in order, a service must not call back
+        // LeaveRoom once the rooms before it are gone.
+        for (auto& room : rooms_) {
+            room->service->SetPeerRemovedCallback(nullptr);
+        }
+    }
+
+    grpc::ServerWriteReactor<grpc::ByteBuffer>* RoomService::Update(
+        grpc::CallbackServerContext* context,
+        const grpc::ByteBuffer* request)
+    {
+        return JoinRoom(context->peer()).Update(context, request);
+    }
+
+    grpc::ServerUnaryReactor* RoomService::ReportInGame(
+        grpc::CallbackServerContext* context,
+        const proto::ReportInGameRequest* request,
+        proto::ReportInGameResponse* response)
+    {
+        return GetRoom(context->peer()).ReportInGame(
+            context,
+            request,
+            response);
+    }
+
+    grpc::ServerUnaryReactor* RoomService::CreateCharacter(
+        grpc::CallbackServerContext* context,
+        const proto::CreateCharacterRequest* request,
+        proto::CreateCharacterResponse* response)
+    {
+        return JoinRoom(context->peer()).CreateCharacter(
+            context,
+            request,
+            response);
+    }
+
+    grpc::ServerUnaryReactor* RoomService::Ping(
+        grpc::CallbackServerContext* context,
+        const proto::PingRequest* request,
+        proto::PingResponse* response)
+    {
+        return GetRoom(context->peer()).Ping(context, request, response);
+    }
+
+    grpc::ServerBidiReactor<grpc::ByteBuffer, grpc::ByteBuffer>*
+        RoomService::Play(grpc::CallbackServerContext* context)
+    {
+        return JoinRoom(context->peer()).Play(context);
+    }
+
+    void RoomService::SetTickPeriods(
+        double step_period,
+        double broadcast_period,
+        std::uint32_t max_catch_up_steps)
+    {
+        tick_scheduler_.SetPeriods(
+            step_period,
+            broadcast_period,
+            max_catch_up_steps);
+    }
+
+    void RoomService::ComputeWorld() {
+        const double start_time =
+            std::chrono::duration_cast<std::chrono::duration<double>>(
+                std::chrono::system_clock::now().time_since_epoch())
+            .count();
+        tick_scheduler_.Run(
+            start_time,
+            [this](double time) { StepRooms(time); },
+            [this](double time) { BroadcastRooms(time); });
+    }
+
+    void RoomService::StopComputeWorld() {
+        tick_scheduler_.Stop();
+    }
+
+    TickMetrics RoomService::GetTickMetrics() const {
+        return tick_scheduler_.GetMetrics();
+    }
+
+    const TickProfiler& RoomService::GetTickProfiler() const {
+        return tick_profiler_;
+    }
+
+    void RoomService::SetSimulationThreads(std::size_t thread_count) {
+        worker_pool_.reset();
+        worker_pool_ = std::make_unique<WorkerPool>(thread_count);
+    }
+
+    DarwinServiceImpl& RoomService::JoinRoom(const std::string& peer) {
+        std::scoped_lock l(mutex_);
+        auto it = peer_rooms_.find(peer);
+        if (it != peer_rooms_.end()) {
+            return *rooms_[it->second]->service;
+        }
+        std::size_t room_index = 0;
+        while (room_index < rooms_.size() &&
+            rooms_[room_index]->player_count >= room_parameter_.max_players)
+        {
+            ++room_index;
+        }
+        if (room_index == rooms_.size()) {
+            room_index = OpenRoomLocked();
+        }
+        auto& room = *rooms_[room_index];
+        ++room.player_count;
+        peer_rooms_.emplace(peer, room_index);
+#ifdef _DEBUG
+        std::cout <<
+            std::format("[{}] Joined room {}\n", peer, room_index);
+#endif // _DEBUG
+        return *room.service;
+    }
+
+    void RoomService::StepRooms(double time) {
+        CaptureRooms();
+        ScopedPhaseTimer timer(
+            &tick_profiler_,
+            TickPhaseEnum::TICK_PHASE_STEP);
+        worker_pool_->ParallelFor(
+            tick_rooms_.size(),
+            1,
+            [this, time](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) {
+                    tick_rooms_[i]->TickStep(time);
+                }
+            });
+    }
+
+    void RoomService::BroadcastRooms(double time) {
+        CaptureRooms();
+        {
+            ScopedPhaseTimer timer(
+                &tick_profiler_,
+                TickPhaseEnum::TICK_PHASE_BROADCAST);
+            worker_pool_->ParallelFor(
+                tick_rooms_.size(),
+                1,
+                [this, time](std::size_t begin, std::size_t end) {
+                    for (std::size_t i = begin; i < end; ++i) {
+                        tick_rooms_[i]->TickBroadcast(time);
+                    }
+                });
+        }
+        tick_profiler_.Flush();
+    }
+
+    std::size_t RoomService::GetRoomCount() const {
+        std::scoped_lock l(mutex_);
+        return rooms_.size();
+    }
+
+    std::size_t RoomService::GetRoomPlayerCount(
+        std::size_t room_index) const
+    {
+        std::scoped_lock l(mutex_);
+        return rooms_.at(room_index)->player_count;
+    }
+
+    const WorldState& RoomService::GetRoomWorldState(
+        std::size_t room_index) const
+    {
+        std::scoped_lock l(mutex_);
+        return rooms_.at(room_index)->world_state;
+    }
+
+    std::size_t RoomService::OpenRoomLocked() {
+        const std::size_t room_index = rooms_.size();
+        auto room = std::make_unique<Room>();
+        // Same start as the single world: the elements, then the upgrades.
+        const auto& world = room_parameter_.world;
+        auto& world_state = room->world_state;
+        world_state.SetPlayerParameter(world.player_parameter());
+        proto::WorldJournalEntry entry;
+        entry.set_time(world.time());
+        entry.mutable_elements()->CopyFrom(world.elements());
+        world_state.ApplyJournalEntry(entry);
+        world_state.SetServerHitDetection(
+            room_parameter_.server_hit_detection);
+        world_state.SetUpgradeElement(room_parameter_.upgrade_count);
+        room->service = std::make_unique<DarwinServiceImpl>(world_state);
+        room->service->SetKeyframeInterval(
+            room_parameter_.keyframe_interval);
+        room->service->SetInterestAngle(room_parameter_.interest_angle);
+        room->service->SetPeerRemovedCallback(
+            [this](const std::string& peer) { LeaveRoom(peer); });
+        rooms_.push_back(std::move(room));
+        std::cout << std::format("opened room {}\n", room_index);
+        return room_index;
+    }
+
+    DarwinServiceImpl& RoomService::GetRoom(const std::string& peer) {
+        std::scoped_lock l(mutex_);
+        auto it = peer_rooms_.find(peer);
+        return *rooms_[it != peer_rooms_.end() ? it->second : 0]->service;
+    }
+
+    void RoomService::LeaveRoom(const std::string& peer) {
+        std::scoped_lock l(mutex_);
+        auto it = peer_rooms_.find(peer);
+        if (it == peer_rooms_.end()) {
+            return;
+        }
+        --rooms_[it->second]->player_count;
+        peer_rooms_.erase(it);
+    }
+
+    void RoomService::CaptureRooms() {
+        std::scoped_lock l(mutex_);
+        tick_rooms_.clear();
+        for (const auto& room : rooms_) {
+            tick_rooms_.push_back(room->service.get());
+        }
+    }
+
+}  // End namespace darwin.
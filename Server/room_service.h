@@ -0,0 +1,114 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Common/darwin_service.pb.h"
+#include "Server/darwin_service_impl.h"
+#include "Server/tick_profiler.h"
+#include "Server/tick_scheduler.h"
+#include "Server/worker_pool.h"
+#include "Server/world_state.h"
+
+namespace darwin {
+
+    // Settings of the rooms opened by a RoomService.
+    struct RoomParameter {
+        // Elements and player parameter every room starts from (the
+        // characters are ignored).
+        proto::WorldDatabase world;
+        std::uint32_t upgrade_count = 0;
+        bool server_hit_detection = true;
+        // Peers in a room, a new room is opened once they are all full.
+        std::uint32_t max_players = 16;
+        std::uint64_t keyframe_interval = 50;
+        double interest_angle = 0.0;
+    };
+
+    // Host many independent worlds (rooms) in one process. A peer is placed
+    // in a room by its first stream (or character creation) and all its
+    // calls go there until it is removed. The rooms are ticked by one
+    // scheduler, their steps and broadcasts run in parallel on one worker
+    // pool (one room by chunk, a room runs on a single thread).
+    class RoomService final : public DarwinCallbackService {
+    public:
+        explicit RoomService(const RoomParameter& room_parameter);
+        ~RoomService() override;
+
+    public:
+        grpc::ServerWriteReactor<grpc::ByteBuffer>* Update(
+            grpc::CallbackServerContext* context,
+            const grpc::ByteBuffer* request) override;
+        grpc::ServerUnaryReactor* ReportInGame(
+            grpc::CallbackServerContext* context,
+            const proto::ReportInGameRequest* request,
+            proto::ReportInGameResponse* response) override;
+        grpc::ServerUnaryReactor* CreateCharacter(
+            grpc::CallbackServerContext* context,
+            const proto::CreateCharacterRequest* request,
+            proto::CreateCharacterResponse* response) override;
+        grpc::ServerUnaryReactor* Ping(
+            grpc::CallbackServerContext* context,
+            const proto::PingRequest* request,
+            proto::PingResponse* response) override;
+        grpc::ServerBidiReactor<grpc::ByteBuffer, grpc::ByteBuffer>* Play(
+            grpc::CallbackServerContext* context) override;
+
+    public:
+        // Same as in DarwinServiceImpl, for all the rooms.
+        void SetTickPeriods(
+            double step_period,
+            double broadcast_period,
+            std::uint32_t max_catch_up_steps);
+        void ComputeWorld();
+        void StopComputeWorld();
+        TickMetrics GetTickMetrics() const;
+        // Time spent stepping and broadcasting all the rooms.
+        const TickProfiler& GetTickProfiler() const;
+        // Worker threads (besides the tick thread) shared by the rooms, set
+        // before serving.
+        void SetSimulationThreads(std::size_t thread_count);
+        // Room of the peer, the peer is placed in the first room with a
+        // free place (a new one if they are all full) if it has none yet.
+        DarwinServiceImpl& JoinRoom(const std::string& peer);
+        // Step (or broadcast) every room at time.
+        void StepRooms(double time);
+        void BroadcastRooms(double time);
+        std::size_t GetRoomCount() const;
+        // Peers placed in a room.
+        std::size_t GetRoomPlayerCount(std::size_t room_index) const;
+        const WorldState& GetRoomWorldState(std::size_t room_index) const;
+
+    protected:
+        struct Room {
+            // Declared first, the service holds a reference to it.
+            WorldState world_state;
+            std::unique_ptr<DarwinServiceImpl> service;
+            std::size_t player_count = 0;
+        };
+        std::size_t OpenRoomLocked();
+        // Room of the peer if it has one, the first room otherwise (without
+        // placing the peer).
+        DarwinServiceImpl& GetRoom(const std::string& peer);
+        // Free the place of a removed peer.
+        void LeaveRoom(const std::string& peer);
+        // Copy the services to tick_rooms_ (rooms are never closed).
+        void CaptureRooms();
+
+    private:
+        RoomParameter room_parameter_;
+        mutable std::mutex mutex_;
+        std::vector<std::unique_ptr<Room>> rooms_;
+        // Room index by peer.
+        std::map<std::string, std::size_t> peer_rooms_;
+        TickScheduler tick_scheduler_;
+        TickProfiler tick_profiler_;
+        // Tick thread.
+        std::unique_ptr<WorkerPool> worker_pool_;
+        std::vector<DarwinServiceImpl*> tick_rooms_;
+    };
+
+}  // End namespace darwin.
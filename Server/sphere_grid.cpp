@@ -0,0 +1,163 @@
+#include "sphere_grid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "Common/darwin_constant.h"
+
+namespace darwin {
+
+    namespace {
+
+        // A cell of an equal angle cube face is at least 1/sqrt(2) of its
+        // nominal width (pi/2 / resolution) wide, at the corners.
+        constexpr double MINIMUM_CELL_RATIO = 0.70710678118654752;
+
+        // Map [-1, 1] face coordinate (tangent) to a cell row or column.
+        std::uint32_t GetFaceCoordinate(
+            double tangent,
+            std::uint32_t resolution)
+        {
+            double unit = std::atan(tangent) * (4.0 / PI);
+            auto coordinate = static_cast<std::int64_t>(
+                std::floor((unit + 1.0) * 0.5 * resolution));
+            return static_cast<std::uint32_t>(
+                std::clamp<std::int64_t>(coordinate, 0, resolution - 1));
+        }
+
+        // Inverse of GetFaceCoordinate for the center of a row or column.
+        double GetFaceTangent(
+            std::uint32_t coordinate,
+            std::uint32_t resolution)
+        {
+            double unit = (coordinate + 0.5) / resolution * 2.0 - 1.0;
+            return std::tan(unit * (PI / 4.0));
+        }
+
+    }  // End anonymous namespace.
+
+    SphereGrid::SphereGrid(double cell_angle) :
+        resolution_(GetResolutionForAngle(cell_angle))
+    {
+        cell_starts_.assign(GetCellCount() + 1, 0);
+    }
+
+    std::uint32_t SphereGrid::GetResolutionForAngle(double cell_angle) {
+        double resolution =
+            std::floor((PI * 0.5) * MINIMUM_CELL_RATIO / cell_angle);
+        return static_cast<std::uint32_t>(std::max(resolution, 1.0));
+    }
+
+    double SphereGrid::GetMinimumCellAngle() const {
+        return (PI * 0.5) / resolution_ * MINIMUM_CELL_RATIO;
+    }
+
+    std::uint32_t SphereGrid::GetCell(const glm::dvec3& position) const {
+        const glm::dvec3 absolute(
+            std::abs(position.x),
+            std::abs(position.y),
+            std::abs(position.z));
+        std::uint32_t face = 0;
+        double major = 0.0;
+        double u = 0.0;
+        double v = 0.0;
+        if (absolute.x >= absolute.y && absolute.x >= absolute.z) {
+            face = (position.x >= 0.0) ? 0 : 1;
+            major = absolute.x;
+            u = position.y;
+            v = position.z;
+        }
+        else if (absolute.y >= absolute.z) {
+            face = (position.y >= 0.0) ? 2 : 3;
+            major = absolute.y;
+            u = position.z;
+            v = position.x;
+        }
+        else {
+            face = (position.z >= 0.0) ? 4 : 5;
+            major = absolute.z;
+            u = position.x;
+            v = position.y;
+        }
+        if (major == 0.0) {
+            return 0;
+        }
+        std::uint32_t column = GetFaceCoordinate(u / major, resolution_);
+        std::uint32_t row = GetFaceCoordinate(v / major, resolution_);
+        return (face * resolution_ + row) * resolution_ + column;
+    }
+
+    glm::dvec3 SphereGrid::GetCellCenter(std::uint32_t cell) const {
+        const std::uint32_t column = cell % resolution_;
+        const std::uint32_t row = (cell / resolution_) % resolution_;
+        const std::uint32_t face = cell / (resolution_ * resolution_);
+        const double u = GetFaceTangent(column, resolution_);
+        const double v = GetFaceTangent(row, resolution_);
+        const double major = (face % 2 == 0) ? 1.0 : -1.0;
+        switch (face / 2) {
+            case 0:
+                return glm::normalize(glm::dvec3(major, u, v));
+            case 1:
+                return glm::normalize(glm::dvec3(v, major, u));
+            default:
+                return glm::normalize(glm::dvec3(u, v, major));
+        }
+    }
+
+    void SphereGrid::GetCellsInCap(
+        const glm::dvec3& position,
+        double angle,
+        std::vector<std::uint32_t>& cells) const
+    {
+        cells.clear();
+        const glm::dvec3 normal = glm::normalize(position);
+        // Tangent frame at the position.
+        const glm::dvec3 helper = (std::abs(normal.x) < 0.9) ?
+            glm::dvec3(1.0, 0.0, 0.0) : glm::dvec3(0.0, 1.0, 0.0);
+        const glm::dvec3 tangent = glm::normalize(glm::cross(normal, helper));
+        const glm::dvec3 bitangent = glm::cross(normal, tangent);
+        // Sample the square that bound the cap on the tangent plane, with
+        // a margin of one cell, at half the smallest cell width. Every cell
+        // that overlap the cap contains at least one sample.
+        const double cell_angle = GetMinimumCellAngle();
+        const int samples = (angle < PI * 0.25) ?
+            static_cast<int>(std::ceil(
+                2.0 * (std::tan(angle) + cell_angle) /
+                (cell_angle * 0.5))) + 1 :
+            std::numeric_limits<int>::max();
+        // Wide caps, cheaper to check the center of every cell (a point of a
+        // cell is never further than a nominal cell width from its center).
+        if (static_cast<double>(samples) * samples >= GetCellCount()) {
+            const double max_angle = angle + (PI * 0.5) / resolution_;
+            const double min_dot = std::cos(std::min(max_angle, PI));
+            for (std::uint32_t cell = 0; cell < GetCellCount(); ++cell) {
+                if (glm::dot(GetCellCenter(cell), normal) >= min_dot) {
+                    cells.push_back(cell);
+                }
+            }
+            return;
+        }
+        const double half_extent = std::tan(angle) + cell_angle;
+        const double spacing = 2.0 * half_extent / (samples - 1);
+        for (int i = 0; i < samples; ++i) {
+            const double a = -half_extent + i * spacing;
+            for (int j = 0; j < samples; ++j) {
+                const double b = -half_extent + j * spacing;
+                cells.push_back(
+                    GetCell(normal + tangent * a + bitangent * b));
+            }
+        }
+        std::sort(cells.begin(), cells.end());
+        cells.erase(std::unique(cells.begin(), cells.end()), cells.end());
+    }
+
+    std::span<const std::uint32_t> SphereGrid::GetCellItems(
+        std::uint32_t cell) const
+    {
+        return std::span<const std::uint32_t>(
+            items_.data() + cell_starts_[cell],
+            items_.data() + cell_starts_[cell + 1]);
+    }
+
+}  // End namespace darwin.
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace darwin {
+
+    // Cell grid over the surface of a sphere centered at the origin, keyed
+    // on the normalized position. The sphere is split in the 6 faces of a
+    // cube and every face in resolution x resolution cells using an equal
+    // angle projection (so cells have roughly the same size).
+    // Rows are stored sorted by cell (counting sort), a Build is O(n).
+    class SphereGrid {
+    public:
+        // Pick a resolution where no cell is narrower than cell_angle
+        // (in radians).
+        explicit SphereGrid(double cell_angle);
+        static std::uint32_t GetResolutionForAngle(double cell_angle);
+        std::uint32_t GetCell(const glm::dvec3& position) const;
+        // Normalized direction of the center of a cell.
+        glm::dvec3 GetCellCenter(std::uint32_t cell) const;
+        // Fill cells with every cell that can hold a position within angle
+        // (in radians) of position (sorted, no duplicates).
+        void GetCellsInCap(
+            const glm::dvec3& position,
+            double angle,
+            std::vector<std::uint32_t>& cells) const;
+        // Rebuild the grid from the positions for which include(row) is
+        // true, the items of the cells are the row indices.
+        template <typename Predicate>
+        void Build(
+            const std::vector<glm::dvec3>& positions,
+            Predicate include);
+        std::span<const std::uint32_t> GetCellItems(
+            std::uint32_t cell) const;
+
+    public:
+        std::uint32_t GetResolution() const { return resolution_; }
+        std::uint32_t GetCellCount() const {
+            return 6 * resolution_ * resolution_;
+        }
+        // Smallest angular width of a cell (at the corners of a face).
+        double GetMinimumCellAngle() const;
+        // Number of rows given to the last Build (included or not).
+        std::size_t GetRowCount() const { return item_cells_.size(); }
+
+    private:
+        std::uint32_t resolution_ = 1;
+        // Start of the cell items in items_ (cell count + 1 entries).
+        std::vector<std::uint32_t> cell_starts_;
+        std::vector<std::uint32_t> items_;
+        // Scratch buffers kept to avoid allocating on every Build.
+        std::vector<std::uint32_t> item_cells_;
+        std::vector<std::uint32_t> cursors_;
+    };
+
+    template <typename Predicate>
+    void SphereGrid::Build(
+        const std::vector<glm::dvec3>& positions,
+        Predicate include)
+    {
+        cell_starts_.assign(GetCellCount() + 1, 0);
+        item_cells_.resize(positions.size());
+        std::uint32_t count = 0;
+        for (std::size_t i = 0; i < positions.size(); ++i) {
+            if (!include(i)) {
+                item_cells_[i] = GetCellCount();
+                continue;
+            }
+            item_cells_[i] = GetCell(positions[i]);
+            ++cell_starts_[item_cells_[i] + 1];
+            ++count;
+        }
+        for (std::uint32_t cell = 0; cell < GetCellCount(); ++cell) {
+            cell_starts_[cell + 1] += cell_starts_[cell];
+        }
+        items_.resize(count);
+        cursors_.assign(cell_starts_.begin(), cell_starts_.end() - 1);
+        for (std::size_t i = 0; i < positions.size(); ++i) {
+            if (item_cells_[i] == GetCellCount()) {
+                continue;
+            }
+            items_[cursors_[item_cells_[i]]++] = static_cast<std::uint32_t>(i);
+        }
+    }
+
+}  // End namespace darwin.
@@ -0,0 +1,107 @@
+#include "task_graph.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace darwin {
+
+    TaskId TaskGraph::AddTask(
+        TickPhaseEnum phase,
+        std::function<void()> func,
+        std::initializer_list<TaskId> dependencies)
+    {
+        NewTask(phase, dependencies).func = std::move(func);
+        return tasks_.size() - 1;
+    }
+
+    TaskId TaskGraph::AddParallelTask(
+        TickPhaseEnum phase,
+        std::size_t count,
+        std::size_t grain,
+        std::function<void(std::size_t, std::size_t)> func,
+        std::initializer_list<TaskId> dependencies)
+    {
+        auto& task = NewTask(phase, dependencies);
+        task.count = count;
+        task.grain = std::max<std::size_t>(grain, 1);
+        task.chunk_func = std::move(func);
+        return tasks_.size() - 1;
+    }
+
+    TaskGraph::Task& TaskGraph::NewTask(
+        TickPhaseEnum phase,
+        std::initializer_list<TaskId> dependencies)
+    {
+        std::size_t wave = 0;
+        for (const auto dependency : dependencies) {
+            wave = std::max(wave, tasks_.at(dependency).wave + 1);
+        }
+        wave_count_ = std::max(wave_count_, wave + 1);
+        auto& task = tasks_.emplace_back();
+        task.phase = phase;
+        task.wave = wave;
+        return task;
+    }
+
+    void TaskGraph::Run(WorkerPool* worker_pool, TickProfiler* tick_profiler) {
+        const std::function<void(std::size_t, std::size_t)> run_chunks =
+            [this, tick_profiler](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) {
+                    auto& chunk = chunks_[i];
+                    const auto& task = tasks_[chunk.task];
+                    const auto start = tick_profiler ?
+                        std::chrono::steady_clock::now() :
+                        std::chrono::steady_clock::time_point{};
+                    if (task.func) {
+                        task.func();
+                    }
+                    else {
+                        task.chunk_func(chunk.begin, chunk.end);
+                    }
+                    if (tick_profiler) {
+                        chunk.seconds = std::chrono::duration<double>(
+                            std::chrono::steady_clock::now() - start).count();
+                    }
+                }
+            };
+        for (std::size_t wave = 0; wave < wave_count_; ++wave) {
+            chunks_.clear();
+            for (std::size_t i = 0; i < tasks_.size(); ++i) {
+                const auto& task = tasks_[i];
+                if (task.wave != wave) {
+                    continue;
+                }
+                for (std::size_t begin = 0;
+                    begin < task.count;
+                    begin += task.grain)
+                {
+                    chunks_.push_back({
+                        i,
+                        begin,
+                        std::min(begin + task.grain, task.count),
+                        0.0 });
+                }
+            }
+            if (worker_pool) {
+                worker_pool->ParallelFor(chunks_.size(), 1, run_chunks);
+            }
+            else {
+                run_chunks(0, chunks_.size());
+            }
+            for (const auto& chunk : chunks_) {
+                tasks_[chunk.task].seconds += chunk.seconds;
+            }
+        }
+        if (tick_profiler) {
+            for (const auto& task : tasks_) {
+                tick_profiler->Add(task.phase, task.seconds);
+            }
+        }
+    }
+
+    void TaskGraph::Clear() {
+        tasks_.clear();
+        wave_count_ = 0;
+    }
+
+}  // End namespace darwin.
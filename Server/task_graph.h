@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <vector>
+
+#include "Server/tick_profiler.h"
+#include "Server/worker_pool.h"
+
+namespace darwin {
+
+    using TaskId = std::size_t;
+
+    // Tasks that depend on each other (a directed acyclic graph), some of
+    // them split in chunks. A task runs in the wave after the last of its
+    // dependencies, the chunks of all the tasks of a wave are run together
+    // on the worker pool. Rebuilt after a Clear it does not allocate, as
+    // long as the functions fit in a std::function.
+    class TaskGraph {
+    public:
+        // Run func once.
+        TaskId AddTask(
+            TickPhaseEnum phase,
+            std::function<void()> func,
+            std::initializer_list<TaskId> dependencies = {});
+        // Run func(begin, end) on chunks of at most grain indices covering
+        // [0, count), the chunks run in parallel.
+        TaskId AddParallelTask(
+            TickPhaseEnum phase,
+            std::size_t count,
+            std::size_t grain,
+            std::function<void(std::size_t, std::size_t)> func,
+            std::initializer_list<TaskId> dependencies = {});
+        // Run all the tasks, inline without a worker pool. The time spent in
+        // a task (summed over the threads) is added to its phase.
+        void Run(WorkerPool* worker_pool, TickProfiler* tick_profiler);
+        // Remove the tasks (keep the memory).
+        void Clear();
+
+    private:
+        struct Task {
+            TickPhaseEnum phase = TickPhaseEnum::TICK_PHASE_COUNT;
+            std::size_t count = 1;
+            std::size_t grain = 1;
+            // Only one of them is set.
+            std::function<void()> func;
+            std::function<void(std::size_t, std::size_t)> chunk_func;
+            std::size_t wave = 0;
+            double seconds = 0.0;
+        };
+        struct Chunk {
+            std::size_t task;
+            std::size_t begin;
+            std::size_t end;
+            double seconds;
+        };
+        // Append a task in the wave after its dependencies.
+        Task& NewTask(
+            TickPhaseEnum phase,
+            std::initializer_list<TaskId> dependencies);
+
+    private:
+        std::vector<Task> tasks_;
+        std::size_t wave_count_ = 0;
+        std::vector<Chunk> chunks_;
+    };
+
+}  // End namespace darwin.
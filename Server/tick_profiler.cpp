@@ -0,0 +1,123 @@
+#include "tick_profiler.h"
+
+#include <algorithm>
+#include <format>
+#include <stdexcept>
+
+namespace darwin {
+
+    std::string GetTickPhaseName(TickPhaseEnum phase) {
+        switch (phase) {
+            case TickPhaseEnum::TICK_PHASE_STEP:
+                return "step";
+            case TickPhaseEnum::TICK_PHASE_DRAIN_REPORTS:
+                return "  drain reports";
+            case TickPhaseEnum::TICK_PHASE_SIMULATE_INPUTS:
+                return "  simulate inputs";
+            case TickPhaseEnum::TICK_PHASE_UPDATE:
+                return "  update";
+            case TickPhaseEnum::TICK_PHASE_STILL_IN_USE:
+                return "    still in use";
+            case TickPhaseEnum::TICK_PHASE_GROUND:
+                return "    ground";
+            case TickPhaseEnum::TICK_PHASE_DEATH:
+                return "    death";
+            case TickPhaseEnum::TICK_PHASE_VICTORY:
+                return "    victory";
+            case TickPhaseEnum::TICK_PHASE_BUILD_GRIDS:
+                return "    build grids";
+            case TickPhaseEnum::TICK_PHASE_DETECT_HITS:
+                return "    detect hits";
+            case TickPhaseEnum::TICK_PHASE_INTERSECT:
+                return "    intersect";
+            case TickPhaseEnum::TICK_PHASE_CHECKPOINT:
+                return "checkpoint";
+            case TickPhaseEnum::TICK_PHASE_REGION_EXCHANGE:
+                return "region exchange";
+            case TickPhaseEnum::TICK_PHASE_BROADCAST:
+                return "broadcast";
+            case TickPhaseEnum::TICK_PHASE_FILL_RESPONSE:
+                return "  fill response";
+            case TickPhaseEnum::TICK_PHASE_SERIALIZE:
+                return "  serialize";
+            case TickPhaseEnum::TICK_PHASE_WRITE:
+                return "  write";
+            default:
+                throw std::runtime_error("Unknown tick phase.");
+        }
+    }
+
+    TickProfiler::TickProfiler(std::size_t window_size) :
+        window_size_(std::max<std::size_t>(window_size, 1)) {}
+
+    void TickProfiler::Add(TickPhaseEnum phase, double seconds) {
+        std::scoped_lock l(mutex_);
+        auto& window = windows_[static_cast<std::size_t>(phase)];
+        window.pending += seconds;
+        window.has_pending = true;
+    }
+
+    void TickProfiler::Flush() {
+        std::scoped_lock l(mutex_);
+        for (auto& window : windows_) {
+            if (!window.has_pending) {
+                continue;
+            }
+            if (window.samples.size() < window_size_) {
+                window.samples.push_back(window.pending);
+            }
+            else {
+                window.samples[window.next] = window.pending;
+            }
+            window.next = (window.next + 1) % window_size_;
+            window.pending = 0.0;
+            window.has_pending = false;
+        }
+    }
+
+    PhaseStatistics TickProfiler::GetStatistics(TickPhaseEnum phase) const {
+        std::vector<double> samples;
+        {
+            std::scoped_lock l(mutex_);
+            samples = windows_[static_cast<std::size_t>(phase)].samples;
+        }
+        PhaseStatistics statistics;
+        statistics.count = samples.size();
+        if (samples.empty()) {
+            return statistics;
+        }
+        std::sort(samples.begin(), samples.end());
+        auto percentile = [&samples](double ratio) {
+            auto index = static_cast<std::size_t>(
+                ratio * static_cast<double>(samples.size() - 1) + 0.5);
+            return samples[index];
+        };
+        statistics.p50 = percentile(0.5);
+        statistics.p99 = percentile(0.99);
+        statistics.max = samples.back();
+        return statistics;
+    }
+
+    std::string TickProfiler::ToString() const {
+        std::string result = std::format(
+            "{:<20}{:>8}{:>10}{:>10}{:>10}\n",
+            "phase (ms)",
+            "count",
+            "p50",
+            "p99",
+            "max");
+        for (std::size_t i = 0; i < windows_.size(); ++i) {
+            const auto phase = static_cast<TickPhaseEnum>(i);
+            const auto statistics = GetStatistics(phase);
+            result += std::format(
+                "{:<20}{:>8}{:>10.3f}{:>10.3f}{:>10.3f}\n",
+                GetTickPhaseName(phase),
+                statistics.count,
+                statistics.p50 * 1000.0,
+                statistics.p99 * 1000.0,
+                statistics.max * 1000.0);
+        }
+        return result;
+    }
+
+}  // End namespace darwin.
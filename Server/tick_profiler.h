@@ -0,0 +1,101 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace darwin {
+
+    enum class TickPhaseEnum {
+        // Simulation step.
+        TICK_PHASE_STEP,
+        TICK_PHASE_DRAIN_REPORTS,
+        TICK_PHASE_SIMULATE_INPUTS,
+        TICK_PHASE_UPDATE,
+        TICK_PHASE_STILL_IN_USE,
+        TICK_PHASE_GROUND,
+        TICK_PHASE_DEATH,
+        TICK_PHASE_VICTORY,
+        TICK_PHASE_BUILD_GRIDS,
+        TICK_PHASE_DETECT_HITS,
+        TICK_PHASE_INTERSECT,
+        // Capture of the changes for a checkpoint, after the step.
+        TICK_PHASE_CHECKPOINT,
+        // Handoffs and mirrors sent to the other regions, after the step.
+        TICK_PHASE_REGION_EXCHANGE,
+        // Broadcast.
+        TICK_PHASE_BROADCAST,
+        TICK_PHASE_FILL_RESPONSE,
+        TICK_PHASE_SERIALIZE,
+        TICK_PHASE_WRITE,
+        TICK_PHASE_COUNT
+    };
+
+    std::string GetTickPhaseName(TickPhaseEnum phase);
+
+    // Statistics of a phase (in seconds) over the rolling window.
+    struct PhaseStatistics {
+        std::size_t count = 0;
+        double p50 = 0.0;
+        double p99 = 0.0;
+        double max = 0.0;
+    };
+
+    // Time spent in each phase of the ticks. The time of a phase is summed
+    // until Flush (once by step or broadcast), and kept as one sample in a
+    // rolling window of the last samples of this phase.
+    class TickProfiler {
+    public:
+        explicit TickProfiler(std::size_t window_size = 1024);
+
+    public:
+        void Add(TickPhaseEnum phase, double seconds);
+        void Flush();
+        PhaseStatistics GetStatistics(TickPhaseEnum phase) const;
+        // Table of the statistics of all the phases (in milliseconds).
+        std::string ToString() const;
+
+    private:
+        struct Window {
+            std::vector<double> samples;
+            std::size_t next = 0;
+            double pending = 0.0;
+            bool has_pending = false;
+        };
+        const std::size_t window_size_;
+        mutable std::mutex mutex_;
+        std::array<Window, static_cast<std::size_t>(
+            TickPhaseEnum::TICK_PHASE_COUNT)> windows_;
+    };
+
+    // Add the time from construction to destruction to a phase, do nothing
+    // without a profiler.
+    class ScopedPhaseTimer {
+    public:
+        ScopedPhaseTimer(TickProfiler* profiler, TickPhaseEnum phase) :
+            profiler_(profiler),
+            phase_(phase),
+            start_(profiler ?
+                std::chrono::steady_clock::now() :
+                std::chrono::steady_clock::time_point{}) {}
+        ScopedPhaseTimer(const ScopedPhaseTimer&) = delete;
+        ScopedPhaseTimer& operator=(const ScopedPhaseTimer&) = delete;
+        ~ScopedPhaseTimer() {
+            if (profiler_) {
+                profiler_->Add(
+                    phase_,
+                    std::chrono::duration<double>(
+                        std::chrono::steady_clock::now() - start_).count());
+            }
+        }
+
+    private:
+        TickProfiler* profiler_;
+        TickPhaseEnum phase_;
+        std::chrono::steady_clock::time_point start_;
+    };
+
+}  // End namespace darwin.
@@ -0,0 +1,105 @@
+#include "tick_scheduler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+namespace darwin {
+
+    void TickScheduler::SetPeriods(
+        double step_period,
+        double broadcast_period,
+        std::uint32_t max_catch_up_steps)
+    {
+        step_period_ = step_period;
+        broadcast_period_ = broadcast_period;
+        max_catch_up_steps_ = std::max<std::uint32_t>(max_catch_up_steps, 1);
+    }
+
+    void TickScheduler::Run(
+        double start_time,
+        const std::function<void(double)>& step,
+        const std::function<void(double)>& broadcast)
+    {
+        using Clock = std::chrono::steady_clock;
+        using Seconds = std::chrono::duration<double>;
+        const auto step_period =
+            std::chrono::duration_cast<Clock::duration>(
+                Seconds(step_period_));
+        const auto broadcast_period =
+            std::chrono::duration_cast<Clock::duration>(
+                Seconds(broadcast_period_));
+        auto next_step = Clock::now();
+        auto next_broadcast = next_step;
+        std::uint64_t step_index = 0;
+        std::uint64_t broadcast_step_index = 0;
+        while (!stop_) {
+            auto now = Clock::now();
+            // Too far behind, skip the late steps.
+            const std::int64_t late_steps = (now - next_step) / step_period;
+            if (late_steps > std::int64_t{ max_catch_up_steps_ }) {
+                std::scoped_lock l(mutex_);
+                metrics_.skipped_step_count += late_steps;
+                next_step += late_steps * step_period;
+                step_index += late_steps;
+            }
+            for (std::uint32_t i = 0;
+                i < max_catch_up_steps_ && now >= next_step && !stop_;
+                ++i)
+            {
+                const double jitter = Seconds(now - next_step).count();
+                step(start_time + step_index * step_period_);
+                const auto end = Clock::now();
+                {
+                    std::scoped_lock l(mutex_);
+                    AddStepLocked(jitter, Seconds(end - now).count());
+                }
+                next_step += step_period;
+                ++step_index;
+                now = end;
+            }
+            if (now >= next_broadcast && broadcast_step_index != step_index) {
+                broadcast(start_time + (step_index - 1) * step_period_);
+                broadcast_step_index = step_index;
+                next_broadcast += broadcast_period;
+                // Don't send a burst to catch up.
+                if (next_broadcast <= now) {
+                    next_broadcast = now + broadcast_period;
+                }
+                std::scoped_lock l(mutex_);
+                ++metrics_.broadcast_count;
+            }
+            // Nothing new to broadcast before the next step (the broadcast
+            // period can be shorter than the step period).
+            std::this_thread::sleep_until(
+                broadcast_step_index == step_index ?
+                    next_step :
+                    std::min(next_step, next_broadcast));
+        }
+    }
+
+    void TickScheduler::Stop() {
+        stop_ = true;
+    }
+
+    TickMetrics TickScheduler::GetMetrics() const {
+        std::scoped_lock l(mutex_);
+        TickMetrics metrics = metrics_;
+        if (metrics.step_count != 0) {
+            metrics.mean_jitter = total_jitter_ / metrics.step_count;
+        }
+        return metrics;
+    }
+
+    void TickScheduler::AddStepLocked(double jitter, double duration) {
+        ++metrics_.step_count;
+        total_jitter_ += jitter;
+        metrics_.max_jitter = std::max(metrics_.max_jitter, jitter);
+        metrics_.max_step_duration =
+            std::max(metrics_.max_step_duration, duration);
+        if (duration > step_period_) {
+            ++metrics_.overrun_count;
+        }
+    }
+
+}  // End namespace darwin.
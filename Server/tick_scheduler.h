@@ -0,0 +1,59 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+
+namespace darwin {
+
+    struct TickMetrics {
+        std::uint64_t step_count = 0;
+        std::uint64_t broadcast_count = 0;
+        // Steps that took longer than the step period.
+        std::uint64_t overrun_count = 0;
+        // Steps dropped because the simulation was too far behind.
+        std::uint64_t skipped_step_count = 0;
+        // Delay between the scheduled and the actual start of a step (s).
+        double mean_jitter = 0.0;
+        double max_jitter = 0.0;
+        // Duration of a step (s).
+        double max_step_duration = 0.0;
+    };
+
+    // Run the simulation at a fixed step on a monotonic clock, with a
+    // bounded catch-up, and the broadcast at its own (lower) rate.
+    class TickScheduler {
+    public:
+        // Periods are in seconds, once more than max_catch_up_steps steps
+        // late the late steps are skipped.
+        void SetPeriods(
+            double step_period,
+            double broadcast_period,
+            std::uint32_t max_catch_up_steps = 5);
+        // Run until Stop, step is called with the simulation time (from
+        // start_time by fixed steps), broadcast with the time of the last
+        // step, only after a new step.
+        void Run(
+            double start_time,
+            const std::function<void(double)>& step,
+            const std::function<void(double)>& broadcast);
+        void Stop();
+        TickMetrics GetMetrics() const;
+        double GetStepPeriod() const { return step_period_; }
+        double GetBroadcastPeriod() const { return broadcast_period_; }
+
+    private:
+        void AddStepLocked(double jitter, double duration);
+
+    private:
+        double step_period_ = 1.0 / 30.0;
+        double broadcast_period_ = 0.1;
+        std::uint32_t max_catch_up_steps_ = 5;
+        std::atomic<bool> stop_ = false;
+        mutable std::mutex mutex_;
+        TickMetrics metrics_;
+        double total_jitter_ = 0.0;
+    };
+
+}  // End namespace darwin.
@@ -0,0 +1,113 @@
+#include "update_writer.h"
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+
+namespace darwin {
+
+    grpc::ByteBuffer SerializeUpdateResponse(
+        const proto::UpdateResponse& response)
+    {
+        grpc::ByteBuffer buffer;
+        bool own_buffer = false;
+        auto status =
+            grpc::SerializationTraits<proto::UpdateResponse>::Serialize(
+                response,
+                &buffer,
+                &own_buffer);
+        if (!status.ok()) {
+            throw std::runtime_error(
+                "Could not serialize update: " + status.error_message());
+        }
+        return buffer;
+    }
+
+    grpc::ByteBuffer SerializePlayResponse(
+        const grpc::ByteBuffer& update,
+        std::uint64_t report_sequence)
+    {
+        // Key of a field is (field number << 3) | wire type.
+        constexpr std::uint32_t report_sequence_key = (1 << 3) | 0;
+        constexpr std::uint32_t update_key = (2 << 3) | 2;
+        std::string header;
+        {
+            google::protobuf::io::StringOutputStream string_stream(&header);
+            google::protobuf::io::CodedOutputStream coded_stream(
+                &string_stream);
+            if (report_sequence != 0) {
+                coded_stream.WriteTag(report_sequence_key);
+                coded_stream.WriteVarint64(report_sequence);
+            }
+            coded_stream.WriteTag(update_key);
+            coded_stream.WriteVarint32(
+                static_cast<std::uint32_t>(update.Length()));
+        }
+        std::vector<grpc::Slice> slices;
+        slices.emplace_back(header);
+        std::vector<grpc::Slice> update_slices;
+        if (!update.Dump(&update_slices).ok()) {
+            throw std::runtime_error("Could not read serialized update.");
+        }
+        slices.insert(slices.end(), update_slices.begin(), update_slices.end());
+        return grpc::ByteBuffer(slices.data(), slices.size());
+    }
+
+    void UpdateWriter::WriteUpdate(
+        const grpc::ByteBuffer& update,
+        std::uint64_t /*report_sequence*/)
+    {
+        std::scoped_lock l(mutex_);
+        if (is_finished_) {
+            return;
+        }
+        if (is_writing_) {
+            pending_buffer_ = update;
+            has_pending_ = true;
+            return;
+        }
+        writing_buffer_ = update;
+        is_writing_ = true;
+        StartWrite(&writing_buffer_);
+    }
+
+    void UpdateWriter::Close(const grpc::Status& status) {
+        std::scoped_lock l(mutex_);
+        FinishLocked(status);
+    }
+
+    void UpdateWriter::OnWriteDone(bool ok) {
+        std::scoped_lock l(mutex_);
+        is_writing_ = false;
+        if (!ok) {
+            FinishLocked(
+                grpc::Status(grpc::StatusCode::UNAVAILABLE, "Write failed."));
+            return;
+        }
+        if (has_pending_ && !is_finished_) {
+            writing_buffer_.Swap(&pending_buffer_);
+            pending_buffer_.Clear();
+            has_pending_ = false;
+            is_writing_ = true;
+            StartWrite(&writing_buffer_);
+        }
+    }
+
+    void UpdateWriter::OnCancel() {
+        std::scoped_lock l(mutex_);
+        FinishLocked(grpc::Status::CANCELLED);
+    }
+
+    void UpdateWriter::OnDone() {
+        on_done_(this);
+    }
+
+    void UpdateWriter::FinishLocked(const grpc::Status& status) {
+        if (is_finished_) {
+            return;
+        }
+        is_finished_ = true;
+        has_pending_ = false;
+        Finish(status);
+    }
+
+}  // End namespace darwin.
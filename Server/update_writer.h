@@ -0,0 +1,71 @@
+#pragma once
+
+#include <functional>
+#include <mutex>
+#include <grpc++/grpc++.h>
+
+#include "Common/darwin_service.grpc.pb.h"
+
+namespace darwin {
+
+    // Encode a response once, the buffer can be handed to many streams (the
+    // copies share the same slices).
+    grpc::ByteBuffer SerializeUpdateResponse(
+        const proto::UpdateResponse& response);
+    // A proto::PlayResponse around a serialized update, the update slices are
+    // shared and not copied.
+    grpc::ByteBuffer SerializePlayResponse(
+        const grpc::ByteBuffer& update,
+        std::uint64_t report_sequence);
+
+    // Stream on which a subscriber get its updates.
+    class UpdateStream {
+    public:
+        virtual ~UpdateStream() = default;
+        // Queue a serialized proto::UpdateResponse, report_sequence is the
+        // last report from the client applied to it.
+        virtual void WriteUpdate(
+            const grpc::ByteBuffer& update,
+            std::uint64_t report_sequence) = 0;
+    };
+
+    // Server side of an Update stream, it writes responses serialized by the
+    // tick. Only the latest response is kept while a write is in flight, a
+    // slow client skip updates instead of piling them up.
+    class UpdateWriter :
+        public grpc::ServerWriteReactor<grpc::ByteBuffer>,
+        public UpdateStream
+    {
+    public:
+        // Called once the stream is over, the writer can be deleted from it.
+        UpdateWriter(std::function<void(UpdateWriter*)> on_done) :
+            on_done_(std::move(on_done)) {}
+
+    public:
+        // Replace the pending update, the report sequence is not sent.
+        void WriteUpdate(
+            const grpc::ByteBuffer& update,
+            std::uint64_t report_sequence) override;
+        // End the stream with an error.
+        void Close(const grpc::Status& status);
+
+    public:
+        void OnWriteDone(bool ok) override;
+        void OnCancel() override;
+        void OnDone() override;
+
+    private:
+        void FinishLocked(const grpc::Status& status);
+
+    private:
+        std::mutex mutex_;
+        // Buffer given to StartWrite, has to live until OnWriteDone.
+        grpc::ByteBuffer writing_buffer_;
+        grpc::ByteBuffer pending_buffer_;
+        bool is_writing_ = false;
+        bool has_pending_ = false;
+        bool is_finished_ = false;
+        std::function<void(UpdateWriter*)> on_done_;
+    };
+
+}  // End namespace darwin.
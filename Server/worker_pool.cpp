@@ -0,0 +1,153 @@
+#include "worker_pool.h"
+
+#include <algorithm>
+
+namespace darwin {
+
+    namespace {
+
+        std::uint64_t PackRange(std::uint32_t begin, std::uint32_t end) {
+            return (static_cast<std::uint64_t>(begin) << 32) | end;
+        }
+
+        std::uint32_t RangeBegin(std::uint64_t range) {
+            return static_cast<std::uint32_t>(range >> 32);
+        }
+
+        std::uint32_t RangeEnd(std::uint64_t range) {
+            return static_cast<std::uint32_t>(range);
+        }
+
+    }  // End namespace.
+
+    WorkerPool::WorkerPool(std::size_t worker_count) :
+        ranges_(std::make_unique<ChunkRange[]>(worker_count + 1))
+    {
+        workers_.reserve(worker_count);
+        for (std::size_t i = 0; i < worker_count; ++i) {
+            workers_.emplace_back([this, i] { WorkerLoop(i + 1); });
+        }
+    }
+
+    WorkerPool::~WorkerPool() {
+        {
+            std::scoped_lock l(mutex_);
+            stop_ = true;
+        }
+        condition_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    void WorkerPool::ParallelFor(
+        std::size_t count,
+        std::size_t grain,
+        const std::function<void(std::size_t, std::size_t)>& func)
+    {
+        grain = std::max<std::size_t>(grain, 1);
+        if (count == 0) {
+            return;
+        }
+        if (workers_.empty() || count <= grain) {
+            func(0, count);
+            return;
+        }
+        {
+            std::scoped_lock l(mutex_);
+            func_ = &func;
+            count_ = count;
+            grain_ = grain;
+            // Contiguous chunks by thread, the rest is stolen.
+            const std::size_t chunk_count = (count + grain - 1) / grain;
+            const std::size_t thread_count = workers_.size() + 1;
+            for (std::size_t i = 0; i < thread_count; ++i) {
+                ranges_[i].value.store(PackRange(
+                    static_cast<std::uint32_t>(
+                        chunk_count * i / thread_count),
+                    static_cast<std::uint32_t>(
+                        chunk_count * (i + 1) / thread_count)));
+            }
+            running_ = workers_.size();
+            ++generation_;
+        }
+        condition_.notify_all();
+        RunChunks(0);
+        std::unique_lock l(mutex_);
+        done_condition_.wait(l, [this] { return running_ == 0; });
+        func_ = nullptr;
+    }
+
+    void WorkerPool::WorkerLoop(std::size_t thread_index) {
+        std::uint64_t generation = 0;
+        std::unique_lock l(mutex_);
+        while (true) {
+            condition_.wait(l, [this, generation] {
+                return stop_ || generation_ != generation;
+            });
+            if (stop_) {
+                return;
+            }
+            generation = generation_;
+            l.unlock();
+            RunChunks(thread_index);
+            l.lock();
+            if (--running_ == 0) {
+                done_condition_.notify_all();
+            }
+        }
+    }
+
+    void WorkerPool::RunChunks(std::size_t thread_index) {
+        std::uint32_t chunk = 0;
+        while (true) {
+            if (!PopChunk(thread_index, chunk)) {
+                if (!StealChunks(thread_index)) {
+                    return;
+                }
+                continue;
+            }
+            const std::size_t begin = chunk * grain_;
+            (*func_)(begin, std::min(begin + grain_, count_));
+        }
+    }
+
+    bool WorkerPool::PopChunk(std::size_t thread_index, std::uint32_t& chunk) {
+        auto& value = ranges_[thread_index].value;
+        std::uint64_t range = value.load();
+        while (RangeBegin(range) < RangeEnd(range)) {
+            if (value.compare_exchange_weak(
+                range,
+                PackRange(RangeBegin(range) + 1, RangeEnd(range))))
+            {
+                chunk = RangeBegin(range);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool WorkerPool::StealChunks(std::size_t thread_index) {
+        const std::size_t thread_count = workers_.size() + 1;
+        for (std::size_t i = 1; i < thread_count; ++i) {
+            auto& value = ranges_[(thread_index + i) % thread_count].value;
+            std::uint64_t range = value.load();
+            while (RangeBegin(range) < RangeEnd(range)) {
+                const std::uint32_t begin = RangeBegin(range);
+                const std::uint32_t end = RangeEnd(range);
+                const std::uint32_t middle = begin + (end - begin) / 2;
+                if (value.compare_exchange_weak(
+                    range,
+                    PackRange(begin, middle)))
+                {
+                    // Its own range is empty, nobody else writes it.
+                    ranges_[thread_index].value.store(
+                        PackRange(middle, end));
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+}  // End namespace darwin.
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace darwin {
+
+    // Fixed set of worker threads that run one parallel loop at a time. The
+    // calling thread takes part in the loop, so a pool without workers runs
+    // it inline. The chunks of a loop are split in contiguous ranges, one by
+    // thread, and a thread out of chunks steals half of the range of another
+    // one (work stealing).
+    class WorkerPool {
+    public:
+        explicit WorkerPool(std::size_t worker_count);
+        ~WorkerPool();
+        WorkerPool(const WorkerPool&) = delete;
+        WorkerPool& operator=(const WorkerPool&) = delete;
+
+    public:
+        // Call func(begin, end) on chunks of at most grain indices covering
+        // [0, count) and wait until they are all done. The chunks run in
+        // any order on any thread, func must not throw. Not reentrant.
+        void ParallelFor(
+            std::size_t count,
+            std::size_t grain,
+            const std::function<void(std::size_t, std::size_t)>& func);
+        std::size_t GetWorkerCount() const { return workers_.size(); }
+
+    protected:
+        void WorkerLoop(std::size_t thread_index);
+        void RunChunks(std::size_t thread_index);
+        // Take a chunk from the front of its own range.
+        bool PopChunk(std::size_t thread_index, std::uint32_t& chunk);
+        // Move the back half of the range of another thread to its own.
+        bool StealChunks(std::size_t thread_index);
+
+    private:
+        // Chunks [begin, end) left to a thread, packed as begin << 32 | end
+        // so that the owner and the thieves update it with one CAS.
+        struct alignas(64) ChunkRange {
+            std::atomic<std::uint64_t> value = 0;
+        };
+        std::mutex mutex_;
+        std::condition_variable condition_;
+        std::condition_variable done_condition_;
+        bool stop_ = false;
+        // Loop in progress, set under the lock before the workers wake up.
+        std::uint64_t generation_ = 0;
+        const std::function<void(std::size_t, std::size_t)>* func_ =
+            nullptr;
+        std::size_t count_ = 0;
+        std::size_t grain_ = 1;
+        // One by thread, the calling thread is the first.
+        std::unique_ptr<ChunkRange[]> ranges_;
+        // Workers still in the loop in progress.
+        std::size_t running_ = 0;
+        std::vector<std::thread> workers_;
+    };
+
+}  // End namespace darwin.
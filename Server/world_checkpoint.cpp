@@ -0,0 +1,294 @@
+#include "world_checkpoint.h"
+
+#include <algorithm>
+#include <cctype>
+#include <format>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(_WIN32) || defined(_WIN64)
+#define WINDOWS_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "world_snapshot.h"
+
+namespace darwin {
+
+    namespace {
+
+        constexpr std::string_view CHECKPOINT_PREFIX = "world_checkpoint_";
+        constexpr std::string_view CHECKPOINT_EXTENSION = ".bin";
+
+        std::vector<std::pair<std::uint64_t, std::filesystem::path>>
+        ListCheckpoints(const std::filesystem::path& directory)
+        {
+            std::vector<std::pair<std::uint64_t, std::filesystem::path>>
+                checkpoints;
+            std::error_code error;
+            for (const auto& entry :
+                std::filesystem::directory_iterator(directory, error))
+            {
+                auto maybe_index =
+                    WorldCheckpointer::GetCheckpointIndex(entry.path());
+                if (maybe_index && entry.is_regular_file()) {
+                    checkpoints.emplace_back(*maybe_index, entry.path());
+                }
+            }
+            std::sort(checkpoints.begin(), checkpoints.end());
+            return checkpoints;
+        }
+
+        // Make the content of the file (or of the directory, so a rename
+        // is) durable.
+        void SyncPath(const std::filesystem::path& path, bool directory) {
+#if defined(_WIN32) || defined(_WIN64)
+            // A rename is durable once done on Windows.
+            if (directory) {
+                return;
+            }
+            HANDLE file = CreateFileW(
+                path.c_str(),
+                GENERIC_WRITE,
+                FILE_SHARE_READ,
+                nullptr,
+                OPEN_EXISTING,
+                FILE_ATTRIBUTE_NORMAL,
+                nullptr);
+            if (file == INVALID_HANDLE_VALUE) {
+                throw std::runtime_error(
+                    std::format("Couldn't open file: {}", path.string()));
+            }
+            const bool ok = FlushFileBuffers(file);
+            CloseHandle(file);
+#else
+            const int fd = open(
+                path.c_str(),
+                directory ? O_RDONLY | O_DIRECTORY : O_RDONLY);
+            if (fd < 0) {
+                throw std::runtime_error(
+                    std::format("Couldn't open file: {}", path.string()));
+            }
+            const bool ok = fsync(fd) == 0;
+            close(fd);
+#endif
+            if (!ok) {
+                throw std::runtime_error(
+                    std::format("Couldn't sync file: {}", path.string()));
+            }
+        }
+
+    }  // End namespace.
+
+    WorldCheckpointer::WorldCheckpointer(
+        WorldState& world_state,
+        const std::filesystem::path& directory,
+        double period,
+        std::size_t retention) :
+        world_state_(world_state),
+        directory_(directory),
+        period_(period),
+        retention_(std::max<std::size_t>(retention, 1))
+    {
+        std::filesystem::create_directories(directory_);
+        // Start after the checkpoints and the journal segments left (a
+        // segment of a checkpoint that never made it to the disk included).
+        for (const auto& entry :
+            std::filesystem::directory_iterator(directory_))
+        {
+            auto maybe_index = GetCheckpointIndex(entry.path());
+            if (!maybe_index) {
+                maybe_index = WorldJournal::GetSegmentIndex(entry.path());
+            }
+            if (maybe_index) {
+                next_index_ = std::max(next_index_, *maybe_index + 1);
+            }
+        }
+        writer_ = std::thread([this] { WriterLoop(); });
+    }
+
+    WorldCheckpointer::~WorldCheckpointer() {
+        {
+            std::scoped_lock l(mutex_);
+            stop_ = true;
+        }
+        condition_.notify_all();
+        writer_.join();
+    }
+
+    void WorldCheckpointer::Tick(double time) {
+        const bool periodic =
+            period_ > 0.0 && time - last_capture_time_ >= period_;
+        if ((periodic || requested_ || !has_captured_) && Capture()) {
+            last_capture_time_ = time;
+            return;
+        }
+        if (world_journal_) {
+            proto::WorldJournalEntry entry;
+            world_state_.CaptureJournalEntry(entry, false);
+            world_journal_->Append(journal_segment_, std::move(entry));
+        }
+    }
+
+    void WorldCheckpointer::RequestCheckpoint() {
+        requested_ = true;
+    }
+
+    void WorldCheckpointer::Flush() {
+        WaitForWriter();
+        Capture();
+        WaitForWriter();
+        if (world_journal_) {
+            world_journal_->Flush();
+        }
+    }
+
+    std::uint64_t WorldCheckpointer::GetWrittenCount() const {
+        std::scoped_lock l(mutex_);
+        return written_count_;
+    }
+
+    void WorldCheckpointer::SetWorldJournal(WorldJournal* world_journal) {
+        world_journal_ = world_journal;
+    }
+
+    std::optional<std::uint64_t> WorldCheckpointer::GetCheckpointIndex(
+        const std::filesystem::path& filename)
+    {
+        const std::string name = filename.filename().string();
+        if (!name.starts_with(CHECKPOINT_PREFIX) ||
+            !name.ends_with(CHECKPOINT_EXTENSION))
+        {
+            return std::nullopt;
+        }
+        const std::string digits = name.substr(
+            CHECKPOINT_PREFIX.size(),
+            name.size() -
+                CHECKPOINT_PREFIX.size() -
+                CHECKPOINT_EXTENSION.size());
+        if (digits.empty() ||
+            !std::all_of(
+                digits.begin(),
+                digits.end(),
+                [](unsigned char c) { return std::isdigit(c); }))
+        {
+            return std::nullopt;
+        }
+        return std::stoull(digits);
+    }
+
+    std::optional<std::filesystem::path>
+    WorldCheckpointer::FindLatestCheckpoint(
+        const std::filesystem::path& directory)
+    {
+        const auto checkpoints = ListCheckpoints(directory);
+        if (checkpoints.empty()) {
+            return std::nullopt;
+        }
+        return checkpoints.back().second;
+    }
+
+    bool WorldCheckpointer::Capture() {
+        {
+            std::scoped_lock l(mutex_);
+            if (writing_) {
+                return false;
+            }
+        }
+        requested_ = false;
+        has_captured_ = true;
+        world_state_.CaptureElementChanges(elements_);
+        time_ = world_state_.GetLastUpdated();
+        player_parameter_ = world_state_.GetPlayerParameter();
+        if (world_journal_) {
+            // The segment of this checkpoint starts with every character,
+            // they are not in the checkpoint.
+            journal_segment_ = next_index_;
+            proto::WorldJournalEntry entry;
+            world_state_.CaptureJournalEntry(entry, true);
+            world_journal_->Append(journal_segment_, std::move(entry));
+        }
+        {
+            std::scoped_lock l(mutex_);
+            writing_ = true;
+        }
+        condition_.notify_all();
+        return true;
+    }
+
+    void WorldCheckpointer::WaitForWriter() {
+        std::unique_lock l(mutex_);
+        condition_.wait(l, [this] { return !writing_; });
+    }
+
+    void WorldCheckpointer::WriterLoop() {
+        std::unique_lock l(mutex_);
+        while (true) {
+            condition_.wait(l, [this] { return writing_ || stop_; });
+            if (!writing_) {
+                return;
+            }
+            l.unlock();
+            bool written = false;
+            try {
+                WriteCheckpoint();
+                const std::uint64_t oldest = RemoveOldCheckpoints();
+                if (world_journal_) {
+                    world_journal_->RemoveSegmentsBefore(oldest);
+                }
+                written = true;
+            }
+            catch (const std::exception& e) {
+                std::cerr << "Checkpoint failed: " << e.what() << "\n";
+            }
+            l.lock();
+            writing_ = false;
+            if (written) {
+                ++written_count_;
+            }
+            condition_.notify_all();
+        }
+    }
+
+    void WorldCheckpointer::WriteCheckpoint() {
+        std::vector<ElementRow> rows(elements_.Size());
+        for (std::size_t i = 0; i < rows.size(); ++i) {
+            rows[i] = elements_.GetElementRow(i);
+        }
+        const auto filename = directory_ / std::format(
+            "{}{:010}{}",
+            CHECKPOINT_PREFIX,
+            next_index_++,
+            CHECKPOINT_EXTENSION);
+        auto temporary = filename;
+        temporary += ".tmp";
+        SaveElementRowsToSnapshot(
+            temporary,
+            time_,
+            player_parameter_,
+            rows,
+            elements_.GetNames());
+        SyncPath(temporary, false);
+        std::filesystem::rename(temporary, filename);
+        SyncPath(directory_, true);
+    }
+
+    std::uint64_t WorldCheckpointer::RemoveOldCheckpoints() const {
+        const auto checkpoints = ListCheckpoints(directory_);
+        if (checkpoints.size() <= retention_) {
+            return checkpoints.empty() ? 0 : checkpoints.front().first;
+        }
+        const std::size_t removed = checkpoints.size() - retention_;
+        for (std::size_t i = 0; i < removed; ++i) {
+            std::filesystem::remove(checkpoints[i].second);
+        }
+        return checkpoints[removed].first;
+    }
+
+}  // End namespace darwin.
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+#include "entity_store.h"
+#include "world_journal.h"
+#include "world_state.h"
+
+namespace darwin {
+
+    // Periodic (and on demand) world checkpoints. The tick thread only
+    // brings a copy of the elements up to date with what changed since the
+    // last checkpoint (O(changed)), a background thread writes that copy as
+    // a binary snapshot, syncs it and atomically renames it in place. Only
+    // the last retention checkpoints are kept. While a checkpoint is being
+    // written the copy belongs to the writer, the next capture waits for the
+    // tick after it is done. The first tick always checkpoints. A world
+    // state has at most one checkpointer (they would share its change
+    // journal). With a world journal, every tick also appends its changes
+    // to the segment of the last checkpoint captured.
+    class WorldCheckpointer {
+    public:
+        WorldCheckpointer(
+            WorldState& world_state,
+            const std::filesystem::path& directory,
+            double period,
+            std::size_t retention);
+        ~WorldCheckpointer();
+        WorldCheckpointer(const WorldCheckpointer&) = delete;
+        WorldCheckpointer& operator=(const WorldCheckpointer&) = delete;
+
+    public:
+        // Called on the tick thread after each step, a period of 0 only
+        // checkpoint on request.
+        void Tick(double time);
+        // Any thread, the checkpoint is captured at the next tick.
+        void RequestCheckpoint();
+        // Capture now and wait until written, only when nothing ticks.
+        void Flush();
+        std::uint64_t GetWrittenCount() const;
+        // Set before the first tick.
+        void SetWorldJournal(WorldJournal* world_journal);
+        // Newest checkpoint in the directory (if any).
+        static std::optional<std::filesystem::path> FindLatestCheckpoint(
+            const std::filesystem::path& directory);
+        static std::optional<std::uint64_t> GetCheckpointIndex(
+            const std::filesystem::path& filename);
+
+    protected:
+        // Return false if the writer still owns the copy.
+        bool Capture();
+        void WaitForWriter();
+        void WriterLoop();
+        void WriteCheckpoint();
+        // Return the index of the oldest checkpoint kept.
+        std::uint64_t RemoveOldCheckpoints() const;
+
+    private:
+        WorldState& world_state_;
+        std::filesystem::path directory_;
+        double period_;
+        std::size_t retention_;
+        // Tick thread only.
+        bool has_captured_ = false;
+        double last_capture_time_ = 0.0;
+        std::atomic<bool> requested_ = false;
+        WorldJournal* world_journal_ = nullptr;
+        std::uint64_t journal_segment_ = 0;
+        // Owned by the tick thread while not writing, by the writer while
+        // writing.
+        EntityStore elements_;
+        double time_ = 0.0;
+        proto::PlayerParameter player_parameter_;
+        std::uint64_t next_index_ = 0;
+        // Writer.
+        mutable std::mutex mutex_;
+        std::condition_variable condition_;
+        bool writing_ = false;
+        bool stop_ = false;
+        std::uint64_t written_count_ = 0;
+        std::thread writer_;
+    };
+
+}  // End namespace darwin.
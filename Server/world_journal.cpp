@@ -0,0 +1,302 @@
+#include "world_journal.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace darwin {
+
+    namespace {
+
+        constexpr std::string_view SEGMENT_PREFIX = "world_journal_";
+        constexpr std::string_view SEGMENT_EXTENSION = ".bin";
+
+        constexpr std::array<std::uint32_t, 256> CreateCrc32Table() {
+            std::array<std::uint32_t, 256> table{};
+            for (std::uint32_t i = 0; i < 256; ++i) {
+                std::uint32_t crc = i;
+                for (int j = 0; j < 8; ++j) {
+                    crc = (crc & 1) ? (crc >> 1) ^ 0xedb88320u : crc >> 1;
+                }
+                table[i] = crc;
+            }
+            return table;
+        }
+
+        // Same as zlib crc32.
+        std::uint32_t Crc32(std::string_view data) {
+            static constexpr auto table = CreateCrc32Table();
+            std::uint32_t crc = 0xffffffffu;
+            for (const char c : data) {
+                crc = table[(crc ^ static_cast<std::uint8_t>(c)) & 0xff] ^
+                    (crc >> 8);
+            }
+            return crc ^ 0xffffffffu;
+        }
+
+        std::filesystem::path GetSegmentPath(
+            const std::filesystem::path& directory,
+            std::uint64_t segment)
+        {
+            return directory / std::format(
+                "{}{:010}{}",
+                SEGMENT_PREFIX,
+                segment,
+                SEGMENT_EXTENSION);
+        }
+
+        std::vector<std::pair<std::uint64_t, std::filesystem::path>>
+        ListSegments(const std::filesystem::path& directory)
+        {
+            std::vector<std::pair<std::uint64_t, std::filesystem::path>>
+                segments;
+            std::error_code error;
+            for (const auto& entry :
+                std::filesystem::directory_iterator(directory, error))
+            {
+                auto maybe_index =
+                    WorldJournal::GetSegmentIndex(entry.path());
+                if (maybe_index && entry.is_regular_file()) {
+                    segments.emplace_back(*maybe_index, entry.path());
+                }
+            }
+            std::sort(segments.begin(), segments.end());
+            return segments;
+        }
+
+        void SyncFile(std::FILE* file) {
+            if (std::fflush(file) != 0) {
+                throw std::runtime_error("Couldn't flush the journal.");
+            }
+#if defined(_WIN32) || defined(_WIN64)
+            const bool ok = _commit(_fileno(file)) == 0;
+#else
+            const bool ok = fsync(fileno(file)) == 0;
+#endif
+            if (!ok) {
+                throw std::runtime_error("Couldn't sync the journal.");
+            }
+        }
+
+    }  // End namespace.
+
+    WorldJournal::WorldJournal(const std::filesystem::path& directory) :
+        directory_(directory)
+    {
+        std::filesystem::create_directories(directory_);
+        writer_ = std::thread([this] { WriterLoop(); });
+    }
+
+    WorldJournal::~WorldJournal() {
+        {
+            std::scoped_lock l(mutex_);
+            stop_ = true;
+        }
+        condition_.notify_all();
+        writer_.join();
+        CloseSegment();
+    }
+
+    void WorldJournal::Append(
+        std::uint64_t segment,
+        proto::WorldJournalEntry entry)
+    {
+        {
+            std::scoped_lock l(mutex_);
+            pending_.emplace_back(segment, std::move(entry));
+        }
+        condition_.notify_all();
+    }
+
+    void WorldJournal::Flush() {
+        std::unique_lock l(mutex_);
+        condition_.wait(l, [this] { return pending_.empty() && !writing_; });
+    }
+
+    void WorldJournal::RemoveSegmentsBefore(std::uint64_t segment) {
+        {
+            std::scoped_lock l(mutex_);
+            remove_before_ = std::max(remove_before_.value_or(0), segment);
+        }
+        condition_.notify_all();
+    }
+
+    std::uint64_t WorldJournal::GetWrittenCount() const {
+        std::scoped_lock l(mutex_);
+        return written_count_;
+    }
+
+    std::uint64_t WorldJournal::GetSyncCount() const {
+        std::scoped_lock l(mutex_);
+        return sync_count_;
+    }
+
+    std::optional<std::uint64_t> WorldJournal::GetSegmentIndex(
+        const std::filesystem::path& filename)
+    {
+        const std::string name = filename.filename().string();
+        if (!name.starts_with(SEGMENT_PREFIX) ||
+            !name.ends_with(SEGMENT_EXTENSION))
+        {
+            return std::nullopt;
+        }
+        const std::string digits = name.substr(
+            SEGMENT_PREFIX.size(),
+            name.size() - SEGMENT_PREFIX.size() - SEGMENT_EXTENSION.size());
+        if (digits.empty() ||
+            !std::all_of(
+                digits.begin(),
+                digits.end(),
+                [](unsigned char c) { return std::isdigit(c); }))
+        {
+            return std::nullopt;
+        }
+        return std::stoull(digits);
+    }
+
+    void WorldJournal::WriterLoop() {
+        std::vector<std::pair<std::uint64_t, proto::WorldJournalEntry>>
+            entries;
+        std::unique_lock l(mutex_);
+        while (true) {
+            condition_.wait(l, [this] {
+                return !pending_.empty() || remove_before_ || stop_;
+            });
+            if (pending_.empty() && !remove_before_) {
+                return;
+            }
+            // Everything queued so far goes in a single commit.
+            std::swap(entries, pending_);
+            auto remove_before = remove_before_;
+            remove_before_.reset();
+            writing_ = true;
+            l.unlock();
+            try {
+                if (!entries.empty()) {
+                    WriteEntries(entries);
+                }
+                if (remove_before) {
+                    for (const auto& [index, path] : ListSegments(directory_))
+                    {
+                        if (index < *remove_before && index != segment_) {
+                            std::filesystem::remove(path);
+                        }
+                    }
+                }
+            }
+            catch (const std::exception& e) {
+                std::cerr << "Journal failed: " << e.what() << "\n";
+            }
+            l.lock();
+            if (!entries.empty()) {
+                written_count_ += entries.size();
+                ++sync_count_;
+            }
+            entries.clear();
+            writing_ = false;
+            condition_.notify_all();
+        }
+    }
+
+    void WorldJournal::WriteEntries(
+        const std::vector<
+            std::pair<std::uint64_t, proto::WorldJournalEntry>>& entries)
+    {
+        std::string payload;
+        for (const auto& [segment, entry] : entries) {
+            if (!file_ || segment != segment_) {
+                if (file_) {
+                    SyncFile(file_);
+                }
+                OpenSegment(segment);
+            }
+            entry.SerializeToString(&payload);
+            const std::uint32_t size =
+                static_cast<std::uint32_t>(payload.size());
+            const std::uint32_t crc = Crc32(payload);
+            std::fwrite(&size, sizeof(size), 1, file_);
+            std::fwrite(&crc, sizeof(crc), 1, file_);
+            std::fwrite(payload.data(), 1, payload.size(), file_);
+        }
+        SyncFile(file_);
+    }
+
+    void WorldJournal::OpenSegment(std::uint64_t segment) {
+        CloseSegment();
+        const auto path = GetSegmentPath(directory_, segment);
+        file_ = std::fopen(path.string().c_str(), "ab");
+        if (!file_) {
+            throw std::runtime_error(
+                std::format("Couldn't open journal: {}", path.string()));
+        }
+        segment_ = segment;
+    }
+
+    void WorldJournal::CloseSegment() {
+        if (file_) {
+            std::fclose(file_);
+            file_ = nullptr;
+        }
+    }
+
+    std::uint64_t ReplayWorldJournal(
+        WorldState& world_state,
+        const std::filesystem::path& directory,
+        std::uint64_t first_segment)
+    {
+        std::uint64_t count = 0;
+        for (const auto& [index, path] : ListSegments(directory)) {
+            if (index < first_segment) {
+                continue;
+            }
+            std::ifstream ifs(path, std::ios::binary);
+            const std::string data{
+                std::istreambuf_iterator<char>(ifs),
+                std::istreambuf_iterator<char>() };
+            std::size_t offset = 0;
+            proto::WorldJournalEntry entry;
+            while (offset < data.size()) {
+                std::uint32_t size = 0;
+                std::uint32_t crc = 0;
+                if (data.size() - offset < sizeof(size) + sizeof(crc)) {
+                    return count;
+                }
+                std::memcpy(&size, data.data() + offset, sizeof(size));
+                std::memcpy(
+                    &crc,
+                    data.data() + offset + sizeof(size),
+                    sizeof(crc));
+                offset += sizeof(size) + sizeof(crc);
+                if (data.size() - offset < size) {
+                    return count;
+                }
+                const std::string_view payload(data.data() + offset, size);
+                offset += size;
+                if (Crc32(payload) != crc ||
+                    !entry.ParseFromArray(payload.data(), size))
+                {
+                    return count;
+                }
+                world_state.ApplyJournalEntry(entry);
+                ++count;
+            }
+        }
+        return count;
+    }
+
+}  // End namespace darwin.
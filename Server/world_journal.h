@@ -0,0 +1,77 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "Common/world_parameter.pb.h"
+#include "world_state.h"
+
+namespace darwin {
+
+    // Write ahead journal of the world changes, one entry by simulation
+    // step. Segment k holds the entries that follow checkpoint k (see
+    // WorldCheckpointer), so recovery loads the newest checkpoint and
+    // replays the segments from its index on. Each entry is a frame:
+    //   size (uint32) | crc32 of the payload (uint32) | payload (proto).
+    // Append only queues the entry, a writer thread serializes everything
+    // queued, writes and syncs it at once (group commit), the tick never
+    // waits for the disk.
+    class WorldJournal {
+    public:
+        explicit WorldJournal(const std::filesystem::path& directory);
+        ~WorldJournal();
+        WorldJournal(const WorldJournal&) = delete;
+        WorldJournal& operator=(const WorldJournal&) = delete;
+
+    public:
+        void Append(std::uint64_t segment, proto::WorldJournalEntry entry);
+        // Wait until everything appended is on disk.
+        void Flush();
+        // Remove the segments before this one (once the checkpoint is on
+        // disk).
+        void RemoveSegmentsBefore(std::uint64_t segment);
+        // Entries and syncs (group commits) done.
+        std::uint64_t GetWrittenCount() const;
+        std::uint64_t GetSyncCount() const;
+        static std::optional<std::uint64_t> GetSegmentIndex(
+            const std::filesystem::path& filename);
+
+    protected:
+        void WriterLoop();
+        void WriteEntries(
+            const std::vector<
+                std::pair<std::uint64_t, proto::WorldJournalEntry>>& entries);
+        void OpenSegment(std::uint64_t segment);
+        void CloseSegment();
+
+    private:
+        std::filesystem::path directory_;
+        mutable std::mutex mutex_;
+        std::condition_variable condition_;
+        std::vector<std::pair<std::uint64_t, proto::WorldJournalEntry>>
+            pending_;
+        bool writing_ = false;
+        bool stop_ = false;
+        std::uint64_t written_count_ = 0;
+        std::uint64_t sync_count_ = 0;
+        std::optional<std::uint64_t> remove_before_;
+        // Writer thread only.
+        std::FILE* file_ = nullptr;
+        std::uint64_t segment_ = 0;
+        std::thread writer_;
+    };
+
+    // Replay the journal segments from first_segment on, in order. Stop at
+    // the first torn or corrupted entry (the tail of a crash), return the
+    // number of entries replayed.
+    std::uint64_t ReplayWorldJournal(
+        WorldState& world_state,
+        const std::filesystem::path& directory,
+        std::uint64_t first_segment);
+
+}  // End namespace darwin.
@@ -0,0 +1,105 @@
+#include "world_recorder.h"
+
+#include <cstring>
+#include <format>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+namespace darwin {
+
+    WorldRecorder::WorldRecorder(
+        const std::filesystem::path& filename,
+        const proto::RecordingHeader& header) :
+        ofs_(filename, std::ios::binary | std::ios::trunc)
+    {
+        if (!ofs_) {
+            throw std::runtime_error(
+                std::format("Couldn't open recording: {}", filename.string()));
+        }
+        std::scoped_lock l(mutex_);
+        WriteFrameLocked(header);
+    }
+
+    void WorldRecorder::Record(const proto::RecordedEvent& event) {
+        std::scoped_lock l(mutex_);
+        WriteFrameLocked(event);
+        ++recorded_count_;
+    }
+
+    void WorldRecorder::Flush() {
+        std::scoped_lock l(mutex_);
+        ofs_.flush();
+    }
+
+    std::uint64_t WorldRecorder::GetRecordedCount() const {
+        std::scoped_lock l(mutex_);
+        return recorded_count_;
+    }
+
+    void WorldRecorder::WriteFrameLocked(
+        const google::protobuf::Message& message)
+    {
+        message.SerializeToString(&payload_);
+        const std::uint32_t size = static_cast<std::uint32_t>(payload_.size());
+        ofs_.write(reinterpret_cast<const char*>(&size), sizeof(size));
+        ofs_.write(payload_.data(), payload_.size());
+    }
+
+    void LoadWorldRecording(
+        const std::filesystem::path& filename,
+        proto::RecordingHeader& header,
+        std::vector<proto::RecordedEvent>& events)
+    {
+        std::ifstream ifs(filename, std::ios::binary);
+        if (!ifs) {
+            throw std::runtime_error(
+                std::format("Couldn't open recording: {}", filename.string()));
+        }
+        const std::string data{
+            std::istreambuf_iterator<char>(ifs),
+            std::istreambuf_iterator<char>() };
+        std::size_t offset = 0;
+        // Next frame, empty if none is left (or torn).
+        auto next_frame = [&data, &offset]() -> std::string_view {
+            std::uint32_t size = 0;
+            if (data.size() - offset < sizeof(size)) {
+                return {};
+            }
+            std::memcpy(&size, data.data() + offset, sizeof(size));
+            if (data.size() - offset - sizeof(size) < size) {
+                return {};
+            }
+            const std::string_view frame(
+                data.data() + offset + sizeof(size),
+                size);
+            offset += sizeof(size) + size;
+            return frame;
+        };
+        const auto header_frame = next_frame();
+        if (header_frame.empty() ||
+            !header.ParseFromArray(header_frame.data(), header_frame.size()))
+        {
+            throw std::runtime_error(
+                std::format("No recording header in: {}", filename.string()));
+        }
+        if (header.version() != WORLD_RECORDING_VERSION) {
+            throw std::runtime_error(
+                std::format(
+                    "Recording version {} is not supported.",
+                    header.version()));
+        }
+        events.clear();
+        while (offset < data.size()) {
+            const auto frame = next_frame();
+            proto::RecordedEvent event;
+            if (frame.data() == nullptr ||
+                !event.ParseFromArray(frame.data(), frame.size()))
+            {
+                break;
+            }
+            events.push_back(std::move(event));
+        }
+    }
+
+}  // End namespace darwin.
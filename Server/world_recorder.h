@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <vector>
+
+#include "Common/darwin_service.pb.h"
+
+namespace darwin {
+
+    constexpr std::uint32_t WORLD_RECORDING_VERSION = 1;
+
+    // Record what the server receives (character creations, reports and
+    // disconnections) with the simulation steps, in the order the tick
+    // applies them, so that a session can be replayed without the
+    // network. The file is a sequence of frames:
+    //   size (uint32) | payload (proto).
+    // The first frame is the header, the next ones are the events. Frames
+    // are buffered, a crash loses the tail.
+    class WorldRecorder {
+    public:
+        WorldRecorder(
+            const std::filesystem::path& filename,
+            const proto::RecordingHeader& header);
+        WorldRecorder(const WorldRecorder&) = delete;
+        WorldRecorder& operator=(const WorldRecorder&) = delete;
+
+    public:
+        // Any thread.
+        void Record(const proto::RecordedEvent& event);
+        void Flush();
+        std::uint64_t GetRecordedCount() const;
+
+    protected:
+        void WriteFrameLocked(const google::protobuf::Message& message);
+
+    private:
+        mutable std::mutex mutex_;
+        std::ofstream ofs_;
+        std::string payload_;
+        std::uint64_t recorded_count_ = 0;
+    };
+
+    // Read a whole recording, a torn last frame is ignored. Throw if the
+    // header is missing or of another version.
+    void LoadWorldRecording(
+        const std::filesystem::path& filename,
+        proto::RecordingHeader& header,
+        std::vector<proto::RecordedEvent>& events);
+
+}  // End namespace darwin.
@@ -0,0 +1,85 @@
+#include "world_region.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "Common/darwin_constant.h"
+
+namespace darwin {
+
+    namespace {
+
+        // Longitude in [0, 2 pi).
+        double GetLongitude(const glm::dvec3& position) {
+            const double longitude = std::atan2(position.y, position.x);
+            return longitude < 0.0 ? longitude + 2.0 * PI : longitude;
+        }
+
+        // Angle from the position to the half great circle from pole to
+        // pole at longitude.
+        double GetAngleToMeridian(
+            const glm::dvec3& normal,
+            double longitude)
+        {
+            const double colatitude =
+                std::acos(std::clamp(normal.z, -1.0, 1.0));
+            const double delta = GetLongitude(normal) - longitude;
+            if (std::cos(delta) < 0.0) {
+                // Closer to the nearest pole than to any other point.
+                return std::min(colatitude, PI - colatitude);
+            }
+            return std::asin(std::min(
+                std::sin(colatitude) * std::abs(std::sin(delta)),
+                1.0));
+        }
+
+    }  // End namespace.
+
+    WorldRegion::WorldRegion(
+        std::uint32_t region_index,
+        std::vector<std::string> server_names) :
+        region_index_(region_index),
+        server_names_(std::move(server_names))
+    {
+        if (region_index_ >= server_names_.size()) {
+            throw std::runtime_error("Region index out of the regions.");
+        }
+        sector_angle_ = 2.0 * PI / server_names_.size();
+    }
+
+    std::uint32_t WorldRegion::GetRegion(const glm::dvec3& position) const {
+        const auto region = static_cast<std::uint32_t>(
+            GetLongitude(position) / sector_angle_);
+        return std::min(region, GetRegionCount() - 1);
+    }
+
+    double WorldRegion::GetAngleToRegion(
+        const glm::dvec3& position,
+        std::uint32_t region) const
+    {
+        if (GetRegion(position) == region) {
+            return 0.0;
+        }
+        const glm::dvec3 normal = glm::normalize(position);
+        return std::min(
+            GetAngleToMeridian(normal, region * sector_angle_),
+            GetAngleToMeridian(normal, (region + 1) * sector_angle_));
+    }
+
+    void WorldRegion::GetRegionsInCap(
+        const glm::dvec3& position,
+        double angle,
+        std::vector<std::uint32_t>& regions) const
+    {
+        regions.clear();
+        for (std::uint32_t region = 0; region < GetRegionCount(); ++region) {
+            if (region != region_index_ &&
+                GetAngleToRegion(position, region) < angle)
+            {
+                regions.push_back(region);
+            }
+        }
+    }
+
+}  // End namespace darwin.
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace darwin {
+
+    // Split of the surface of a planet centered at the origin in sectors of
+    // longitude (around the z axis), one by server. The server of a region
+    // owns (simulates) the entities whose position is in its sector.
+    class WorldRegion {
+    public:
+        // The region count is the number of servers, region_index is the
+        // one of this server.
+        WorldRegion(
+            std::uint32_t region_index,
+            std::vector<std::string> server_names);
+        std::uint32_t GetRegion(const glm::dvec3& position) const;
+        bool IsOwned(const glm::dvec3& position) const {
+            return GetRegion(position) == region_index_;
+        }
+        // Angle (in radians) from the position to the sector of a region, 0
+        // inside of it.
+        double GetAngleToRegion(
+            const glm::dvec3& position,
+            std::uint32_t region) const;
+        // Fill regions with the other regions within angle (in radians) of
+        // the position, the ones its entity is mirrored to.
+        void GetRegionsInCap(
+            const glm::dvec3& position,
+            double angle,
+            std::vector<std::uint32_t>& regions) const;
+
+    public:
+        std::uint32_t GetRegionIndex() const { return region_index_; }
+        std::uint32_t GetRegionCount() const {
+            return static_cast<std::uint32_t>(server_names_.size());
+        }
+        const std::string& GetServerName(std::uint32_t region) const {
+            return server_names_.at(region);
+        }
+
+    private:
+        std::uint32_t region_index_ = 0;
+        std::vector<std::string> server_names_;
+        // Angular width of a sector.
+        double sector_angle_ = 0.0;
+    };
+
+}  // End namespace darwin.
@@ -0,0 +1,64 @@
+#include "world_replay.h"
+
+#include <chrono>
+
+#include "Common/vector.h"
+#include "darwin_service_impl.h"
+#include "world_state_file.h"
+
+namespace darwin {
+
+    void StartRecordedWorldState(
+        WorldState& world_state,
+        const proto::RecordingHeader& header)
+    {
+        SetRandomSeed(header.random_seed());
+        const auto& world = header.world();
+        world_state.SetPlayerParameter(world.player_parameter());
+        proto::WorldJournalEntry entry;
+        entry.set_time(world.time());
+        entry.mutable_elements()->CopyFrom(world.elements());
+        entry.mutable_characters()->CopyFrom(world.characters());
+        world_state.ApplyJournalEntry(entry);
+        world_state.SetServerHitDetection(header.server_hit_detection());
+        world_state.SetUpgradeElement(header.upgrade_count());
+    }
+
+    WorldReplayResult ReplayWorldRecording(
+        WorldState& world_state,
+        const proto::RecordingHeader& header,
+        const std::vector<proto::RecordedEvent>& events)
+    {
+        StartRecordedWorldState(world_state, header);
+        DarwinServiceImpl service{ world_state };
+        service.SetTickPeriods(
+            header.step_period(),
+            header.broadcast_period(),
+            1);
+        WorldReplayResult result;
+        const auto start = std::chrono::steady_clock::now();
+        for (const auto& event : events) {
+            service.ReplayEvent(event);
+            if (event.recorded_event_enum() == proto::RECORDED_EVENT_STEP) {
+                ++result.step_count;
+            }
+        }
+        result.duration = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+        result.event_count = events.size();
+        result.world_hash = HashWorldState(world_state);
+        return result;
+    }
+
+    std::uint64_t HashWorldState(const WorldState& world_state) {
+        const std::string data =
+            SaveWorldStateToDatabase(world_state).SerializeAsString();
+        std::uint64_t hash = 0xcbf29ce484222325ull;
+        for (const char c : data) {
+            hash ^= static_cast<std::uint8_t>(c);
+            hash *= 0x100000001b3ull;
+        }
+        return hash;
+    }
+
+}  // End namespace darwin.
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Common/darwin_service.pb.h"
+#include "world_state.h"
+
+namespace darwin {
+
+    struct WorldReplayResult {
+        std::uint64_t event_count = 0;
+        std::uint64_t step_count = 0;
+        // Wall time of the replay (s).
+        double duration = 0.0;
+        // Hash of the world at the end (see HashWorldState).
+        std::uint64_t world_hash = 0;
+    };
+
+    // Replay a recording (see WorldRecorder) in an empty world state, as
+    // fast as possible: the events go through the same checks as on the
+    // server and the steps are run at their recorded time. The same
+    // recording always ends on the same world (same hash) with a given
+    // build.
+    // Start the world as the server that recorded did: the world loaded,
+    // then the upgrades.
+    void StartRecordedWorldState(
+        WorldState& world_state,
+        const proto::RecordingHeader& header);
+
+    WorldReplayResult ReplayWorldRecording(
+        WorldState& world_state,
+        const proto::RecordingHeader& header,
+        const std::vector<proto::RecordedEvent>& events);
+
+    // FNV-1a of the serialized world (elements, characters, time and
+    // parameters), equal hashes mean bit identical worlds.
+    std::uint64_t HashWorldState(const WorldState& world_state);
+
+}  // End namespace darwin.
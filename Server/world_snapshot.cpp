@@ -0,0 +1,400 @@
+#include "world_snapshot.h"
+
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(_WIN32) || defined(_WIN64)
+#define WINDOWS_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "Common/stl_proto_wrapper.h"
+#include "entity_store.h"
+
+namespace darwin {
+
+    namespace {
+
+        constexpr std::uint64_t SNAPSHOT_ALIGNMENT = 8;
+        static_assert(alignof(ElementRow) <= SNAPSHOT_ALIGNMENT);
+
+        std::uint64_t Align(std::uint64_t offset) {
+            return
+                (offset + SNAPSHOT_ALIGNMENT - 1) / SNAPSHOT_ALIGNMENT *
+                SNAPSHOT_ALIGNMENT;
+        }
+
+        void WriteAt(
+            std::ofstream& ofs,
+            std::uint64_t offset,
+            const void* data,
+            std::uint64_t size)
+        {
+            ofs.seekp(static_cast<std::streamoff>(offset));
+            ofs.write(
+                static_cast<const char*>(data),
+                static_cast<std::streamsize>(size));
+        }
+
+        // View over a mapped snapshot, checked at construction.
+        class SnapshotView {
+        public:
+            explicit SnapshotView(const MappedFile& file) : file_(file) {
+                if (file.GetSize() < sizeof(WorldSnapshotHeader)) {
+                    throw std::runtime_error("Snapshot file is too small.");
+                }
+                std::memcpy(&header_, file.GetData(), sizeof(header_));
+                const WorldSnapshotHeader reference;
+                if (std::memcmp(
+                    header_.magic,
+                    reference.magic,
+                    sizeof(reference.magic)) != 0)
+                {
+                    throw std::runtime_error("Not a world snapshot file.");
+                }
+                if (header_.version != WORLD_SNAPSHOT_VERSION) {
+                    throw std::runtime_error(
+                        std::format(
+                            "Unsupported world snapshot version: {}",
+                            header_.version));
+                }
+                if (header_.row_size != sizeof(ElementRow)) {
+                    throw std::runtime_error(
+                        std::format(
+                            "Unsupported world snapshot row size: {}",
+                            header_.row_size));
+                }
+                CheckRange(
+                    header_.player_parameter_offset,
+                    header_.player_parameter_size);
+                // Before the sizes below are computed (they could overflow).
+                if (header_.element_count >
+                    file.GetSize() / sizeof(ElementRow))
+                {
+                    throw std::runtime_error(
+                        "Truncated world snapshot file.");
+                }
+                CheckRange(
+                    header_.rows_offset,
+                    header_.element_count * sizeof(ElementRow));
+                CheckRange(
+                    header_.name_offsets_offset,
+                    (header_.element_count + 1) * sizeof(std::uint64_t));
+                CheckRange(header_.names_offset, header_.names_size);
+                if (header_.rows_offset % alignof(ElementRow) != 0 ||
+                    header_.name_offsets_offset %
+                        alignof(std::uint64_t) != 0)
+                {
+                    throw std::runtime_error(
+                        "Misaligned world snapshot file.");
+                }
+                const auto offsets = GetNameOffsets();
+                for (std::size_t i = 0; i + 1 < offsets.size(); ++i) {
+                    if (offsets[i] > offsets[i + 1]) {
+                        throw std::runtime_error(
+                            "Corrupted world snapshot names.");
+                    }
+                }
+                if (offsets.back() > header_.names_size) {
+                    throw std::runtime_error(
+                        "Corrupted world snapshot names.");
+                }
+            }
+
+        public:
+            const WorldSnapshotHeader& GetHeader() const { return header_; }
+            proto::PlayerParameter GetPlayerParameter() const {
+                proto::PlayerParameter player_parameter;
+                if (!player_parameter.ParseFromArray(
+                    file_.GetData() + header_.player_parameter_offset,
+                    static_cast<int>(header_.player_parameter_size)))
+                {
+                    throw std::runtime_error(
+                        "Corrupted world snapshot player parameter.");
+                }
+                return player_parameter;
+            }
+            std::span<const ElementRow> GetRows() const {
+                return {
+                    reinterpret_cast<const ElementRow*>(
+                        file_.GetData() + header_.rows_offset),
+                    header_.element_count };
+            }
+            // Views inside the mapping, valid as long as the file.
+            std::vector<std::string_view> GetNames() const {
+                const auto offsets = GetNameOffsets();
+                const char* names = reinterpret_cast<const char*>(
+                    file_.GetData() + header_.names_offset);
+                std::vector<std::string_view> result;
+                result.reserve(header_.element_count);
+                for (std::size_t i = 0; i < header_.element_count; ++i) {
+                    result.emplace_back(
+                        names + offsets[i],
+                        offsets[i + 1] - offsets[i]);
+                }
+                return result;
+            }
+
+        protected:
+            void CheckRange(std::uint64_t offset, std::uint64_t size) const {
+                if (offset > file_.GetSize() ||
+                    size > file_.GetSize() - offset)
+                {
+                    throw std::runtime_error(
+                        "Truncated world snapshot file.");
+                }
+            }
+            std::span<const std::uint64_t> GetNameOffsets() const {
+                return {
+                    reinterpret_cast<const std::uint64_t*>(
+                        file_.GetData() + header_.name_offsets_offset),
+                    header_.element_count + 1 };
+            }
+
+        private:
+            const MappedFile& file_;
+            WorldSnapshotHeader header_;
+        };
+
+    }  // End namespace.
+
+#if defined(_WIN32) || defined(_WIN64)
+
+    MappedFile::MappedFile(const std::filesystem::path& filename) {
+        file_ = CreateFileW(
+            filename.c_str(),
+            GENERIC_READ,
+            FILE_SHARE_READ,
+            nullptr,
+            OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL,
+            nullptr);
+        if (file_ == INVALID_HANDLE_VALUE) {
+            file_ = nullptr;
+            throw std::runtime_error(
+                std::format("Couldn't open file: {}", filename.string()));
+        }
+        LARGE_INTEGER size;
+        GetFileSizeEx(file_, &size);
+        size_ = static_cast<std::size_t>(size.QuadPart);
+        if (size_ == 0) {
+            return;
+        }
+        mapping_ = CreateFileMappingW(
+            file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping_) {
+            data_ = static_cast<const std::byte*>(
+                MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+        }
+        if (!data_) {
+            if (mapping_) {
+                CloseHandle(mapping_);
+            }
+            CloseHandle(file_);
+            throw std::runtime_error(
+                std::format("Couldn't map file: {}", filename.string()));
+        }
+    }
+
+    MappedFile::~MappedFile() {
+        if (data_) {
+            UnmapViewOfFile(data_);
+        }
+        if (mapping_) {
+            CloseHandle(mapping_);
+        }
+        if (file_) {
+            CloseHandle(file_);
+        }
+    }
+
+#else
+
+    MappedFile::MappedFile(const std::filesystem::path& filename) {
+        const int fd = open(filename.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error(
+                std::format("Couldn't open file: {}", filename.string()));
+        }
+        struct stat file_stat {};
+        if (fstat(fd, &file_stat) != 0) {
+            close(fd);
+            throw std::runtime_error(
+                std::format("Couldn't stat file: {}", filename.string()));
+        }
+        size_ = static_cast<std::size_t>(file_stat.st_size);
+        if (size_ == 0) {
+            close(fd);
+            return;
+        }
+        void* data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        // The mapping stays valid once the descriptor is closed.
+        close(fd);
+        if (data == MAP_FAILED) {
+            throw std::runtime_error(
+                std::format("Couldn't map file: {}", filename.string()));
+        }
+        data_ = static_cast<const std::byte*>(data);
+    }
+
+    MappedFile::~MappedFile() {
+        if (data_) {
+            munmap(const_cast<std::byte*>(data_), size_);
+        }
+    }
+
+#endif
+
+    void SaveElementRowsToSnapshot(
+        const std::filesystem::path& filename,
+        double time,
+        const proto::PlayerParameter& player_parameter,
+        std::span<const ElementRow> rows,
+        const std::vector<std::string>& names)
+    {
+        const std::string player_parameter_bytes =
+            player_parameter.SerializeAsString();
+        std::vector<std::uint64_t> name_offsets;
+        name_offsets.reserve(names.size() + 1);
+        std::uint64_t names_size = 0;
+        for (const auto& name : names) {
+            name_offsets.push_back(names_size);
+            names_size += name.size();
+        }
+        name_offsets.push_back(names_size);
+        WorldSnapshotHeader header;
+        header.element_count = rows.size();
+        header.time = time;
+        header.player_parameter_offset =
+            Align(sizeof(WorldSnapshotHeader));
+        header.player_parameter_size = player_parameter_bytes.size();
+        header.rows_offset = Align(
+            header.player_parameter_offset +
+            header.player_parameter_size);
+        header.name_offsets_offset = Align(
+            header.rows_offset + rows.size_bytes());
+        header.names_offset = Align(
+            header.name_offsets_offset +
+            name_offsets.size() * sizeof(std::uint64_t));
+        header.names_size = names_size;
+
+        std::ofstream ofs(filename, std::ios::binary | std::ios::trunc);
+        if (!ofs) {
+            throw std::runtime_error(
+                std::format(
+                    "Couldn't open snapshot file: {}",
+                    filename.string()));
+        }
+        WriteAt(ofs, 0, &header, sizeof(header));
+        WriteAt(
+            ofs,
+            header.player_parameter_offset,
+            player_parameter_bytes.data(),
+            player_parameter_bytes.size());
+        WriteAt(ofs, header.rows_offset, rows.data(), rows.size_bytes());
+        WriteAt(
+            ofs,
+            header.name_offsets_offset,
+            name_offsets.data(),
+            name_offsets.size() * sizeof(std::uint64_t));
+        ofs.seekp(static_cast<std::streamoff>(header.names_offset));
+        for (const auto& name : names) {
+            ofs.write(
+                name.data(),
+                static_cast<std::streamsize>(name.size()));
+        }
+        if (!ofs) {
+            throw std::runtime_error(
+                std::format(
+                    "Couldn't write snapshot file: {}",
+                    filename.string()));
+        }
+    }
+
+    void SaveWorldStateToSnapshot(
+        const WorldState& world_state,
+        const std::filesystem::path& filename)
+    {
+        std::vector<ElementRow> rows;
+        std::vector<std::string> names;
+        world_state.GetElementRows(rows, names);
+        SaveElementRowsToSnapshot(
+            filename,
+            world_state.GetLastUpdated(),
+            world_state.GetPlayerParameter(),
+            rows,
+            names);
+    }
+
+    void LoadWorldStateFromSnapshot(
+        WorldState& world_state,
+        const std::filesystem::path& filename)
+    {
+        MappedFile file(filename);
+        SnapshotView view(file);
+        world_state.AddElementRows(view.GetRows(), view.GetNames());
+        world_state.SetPlayerParameter(view.GetPlayerParameter());
+        world_state.Update(view.GetHeader().time);
+    }
+
+    void ConvertJsonToSnapshot(
+        const std::filesystem::path& json_filename,
+        const std::filesystem::path& snapshot_filename)
+    {
+        const auto world =
+            LoadProtoFromJsonFile<proto::WorldDatabase>(json_filename);
+        // The store does the proto to row conversion.
+        EntityStore store;
+        store.Reserve(world.elements_size());
+        std::vector<ElementRow> rows;
+        rows.reserve(world.elements_size());
+        for (const auto& element : world.elements()) {
+            const std::size_t index = store.Add(
+                static_cast<EntityHandle>(store.Size() + 1),
+                element);
+            rows.push_back(store.GetElementRow(index));
+        }
+        SaveElementRowsToSnapshot(
+            snapshot_filename,
+            world.time(),
+            world.player_parameter(),
+            rows,
+            store.GetNames());
+    }
+
+    void ConvertSnapshotToJson(
+        const std::filesystem::path& snapshot_filename,
+        const std::filesystem::path& json_filename)
+    {
+        MappedFile file(snapshot_filename);
+        SnapshotView view(file);
+        proto::WorldDatabase world;
+        world.set_time(view.GetHeader().time);
+        world.mutable_player_parameter()->CopyFrom(
+            view.GetPlayerParameter());
+        const auto rows = view.GetRows();
+        const auto names = view.GetNames();
+        EntityStore store;
+        store.Reserve(rows.size());
+        for (std::size_t i = 0; i < rows.size(); ++i) {
+            const std::size_t index = store.Add(
+                static_cast<EntityHandle>(i + 1),
+                names[i],
+                rows[i]);
+            *world.add_elements() = store.GetElement(index);
+        }
+        SaveProtoToJsonFile(world, json_filename);
+    }
+
+}  // End namespace darwin.
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "world_state.h"
+
+namespace darwin {
+
+    // Bump it each time the layout of the header or of the ElementRow
+    // changes, old snapshots are refused (convert them from the json).
+    constexpr std::uint32_t WORLD_SNAPSHOT_VERSION = 1;
+
+    // Binary world snapshot, meant to be mapped in memory and loaded in
+    // bulk. Native (little endian) layout, every offset is from the start
+    // of the file and aligned on 8 bytes:
+    //   header | player parameter (binary proto) | element rows |
+    //   name offsets (element_count + 1) | names (no terminator).
+    // Characters are not saved, as in the json world database.
+    struct WorldSnapshotHeader {
+        char magic[8] = { 'D', 'A', 'R', 'W', 'I', 'N', 'W', 'S' };
+        std::uint32_t version = WORLD_SNAPSHOT_VERSION;
+        std::uint32_t row_size = sizeof(ElementRow);
+        std::uint64_t element_count = 0;
+        double time = 0.0;
+        std::uint64_t player_parameter_offset = 0;
+        std::uint64_t player_parameter_size = 0;
+        std::uint64_t rows_offset = 0;
+        std::uint64_t name_offsets_offset = 0;
+        std::uint64_t names_offset = 0;
+        std::uint64_t names_size = 0;
+    };
+    static_assert(sizeof(WorldSnapshotHeader) == 80);
+
+    // Read only memory mapping of a whole file.
+    class MappedFile {
+    public:
+        explicit MappedFile(const std::filesystem::path& filename);
+        ~MappedFile();
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+    public:
+        const std::byte* GetData() const { return data_; }
+        std::size_t GetSize() const { return size_; }
+
+    private:
+        const std::byte* data_ = nullptr;
+        std::size_t size_ = 0;
+#if defined(_WIN32) || defined(_WIN64)
+        void* file_ = nullptr;
+        void* mapping_ = nullptr;
+#endif
+    };
+
+    // Save the element rows (names[i] is the name of rows[i]).
+    void SaveElementRowsToSnapshot(
+        const std::filesystem::path& filename,
+        double time,
+        const proto::PlayerParameter& player_parameter,
+        std::span<const ElementRow> rows,
+        const std::vector<std::string>& names);
+
+    void SaveWorldStateToSnapshot(
+        const WorldState& world_state,
+        const std::filesystem::path& filename);
+
+    // Throw a std::runtime_error if the file is not a valid snapshot of the
+    // current version.
+    void LoadWorldStateFromSnapshot(
+        WorldState& world_state,
+        const std::filesystem::path& filename);
+
+    // Convert between the json world database and the binary snapshot,
+    // without going through a world state (no update in between).
+    void ConvertJsonToSnapshot(
+        const std::filesystem::path& json_filename,
+        const std::filesystem::path& snapshot_filename);
+
+    void ConvertSnapshotToJson(
+        const std::filesystem::path& snapshot_filename,
+        const std::filesystem::path& json_filename);
+
+}  // End namespace darwin.
@@ -1,8 +1,11 @@
 #include "world_state.h"
 
 #include <algorithm>
+#include <atomic>
 #include <format>
 #include <cmath>
+#include <set>
+#include <tuple>
 #include <assert.h>
 
 #include "Common/darwin_constant.h"
@@ -12,9 +15,26 @@
 
 namespace darwin {
 
+    namespace {
+
+        // Characters by chunk of the parallel phases of Update.
+        constexpr std::size_t CHARACTER_GRAIN = 256;
+        // Bits of the ground flags.
+        constexpr std::uint8_t GROUND_PHYSIC_CHANGED = 1;
+        constexpr std::uint8_t GROUND_STATUS_CHANGED = 2;
+        // Views kept for reuse: the published one, one still read by a slow
+        // reader and the next one.
+        constexpr std::size_t RECYCLED_VIEW_COUNT = 3;
+        // Copies of the elements shared by the views, one more than the
+        // views so that one is always free.
+        constexpr std::size_t ELEMENT_MIRROR_COUNT = RECYCLED_VIEW_COUNT + 1;
+
+    }  // End namespace.
+
     void WorldState::SetUpgradeElement(std::uint32_t upgrade_count) {
         std::scoped_lock l(mutex_);
         element_max_number_ = upgrade_count;
+        element_store_.Reserve(element_store_.Size() + upgrade_count);
         AddRandomElementsLocked(upgrade_count);
     }
 
@@ -24,26 +44,37 @@ namespace darwin {
         const proto::Vector3& color)
     {
         std::scoped_lock l(mutex_);
-        auto it = character_infos_.find(name);
-        if (it != character_infos_.end()) {
-            const auto& character = it->second;
-            if (character.status_enum() == proto::STATUS_DEAD) {
-                character_infos_.erase(name);
-                it = character_infos_.end();
+        auto maybe_index = character_store_.FindIndex(name);
+        if (maybe_index) {
+            if (character_store_.GetStatuses()[*maybe_index] ==
+                proto::STATUS_DEAD)
+            {
+                RemoveCharacterLocked(name);
+                maybe_index = std::nullopt;
             }
         }
-        if (it == character_infos_.end()) {
+        if (maybe_index &&
+            character_store_.GetPeers()[*maybe_index].empty() &&
+            !IsMirroredLocked(character_store_.GetHandles()[*maybe_index]))
+        {
+            // Restored from the journal, the player takes it back.
+            character_store_.GetPeers()[*maybe_index] = peer;
+            peer_characters_.insert(
+                { peer, character_store_.GetHandles()[*maybe_index] });
+            return true;
+        }
+        if (!maybe_index) {
             proto::Character character;
             character.set_name(name);
             character.mutable_color()->CopyFrom(Normalize(color));
             auto vec3 = CreateRandomNormalizedVector3();
             proto::Physic physic{};
-            double radius = 
+            double radius =
                 GetRadiusFromVolume(player_parameter_.start_mass());
             physic.set_radius(radius);
             physic.set_mass(player_parameter_.start_mass());
             physic.mutable_position()->CopyFrom(
-                vec3 * (GetPlanetLocked().physic().radius() + 
+                vec3 * (GetPlanetLocked().physic().radius() +
                     player_parameter_.drop_height()));
             physic.mutable_position_dt()->CopyFrom(
                 CreateVector3(0.0, 0.0, 0.0));
@@ -52,20 +83,22 @@ namespace darwin {
             physic.mutable_orientation_dt()->CopyFrom(
                 CreateVector4(0.0, 0.0, 0.0, 1.0));
             character.mutable_physic()->CopyFrom(physic);
-            // WARNING: This suppose the gravity well is at the 
+            // WARNING: This suppose the gravity well is at the
             // position(0, 0, 0).
             character.mutable_normal()->CopyFrom(vec3);
             // This is wrong, and should be set to the real value.
             character.mutable_g_force()->CopyFrom(
                 CreateVector3(0.0, 0.0, 0.0));
             character.set_status_enum(proto::STATUS_LOADING);
-            character_infos_.insert({ character.name(), character });
-            peer_characters_.insert({ peer, name });
+            EntityHandle handle = NextHandleLocked();
+            auto index = character_store_.Add(handle, character);
+            character_store_.GetPeers()[index] = peer;
+            peer_characters_.insert({ peer, handle });
             return true;
         }
         else
         {
-            std::cerr 
+            std::cerr
                 << std::format(
                     "[{}] Has already a character with name {}.\n",
                     peer,
@@ -75,25 +108,21 @@ namespace darwin {
     }
 
     void WorldState::AddCharacter(
-        const proto::Character& character) 
+        const proto::Character& character)
     {
         std::scoped_lock l(mutex_);
-        if (character_infos_.contains(character.name())) {
-            std::cerr 
-                << "(test) Error adding character: " 
-                << character.name() 
+        if (character_store_.FindIndex(character.name())) {
+            std::cerr
+                << "(test) Error adding character: "
+                << character.name()
                 << "\n";
             return;
         }
-        auto it = character_infos_.find(character.name());
-        if (it == character_infos_.end()) {
-            character_infos_.insert({ character.name(), character });
-            // Enter a fake peer to avoid inconsistencies.
-            peer_characters_.insert({ character.name(), character.name() });
-        }
-        else {
-            it->second = character;
-        }
+        EntityHandle handle = NextHandleLocked();
+        auto index = character_store_.Add(handle, character);
+        // Enter a fake peer to avoid inconsistencies.
+        character_store_.GetPeers()[index] = character.name();
+        peer_characters_.insert({ character.name(), handle });
     }
 
     proto::Element WorldState::GetPlanet() const {
@@ -101,30 +130,52 @@ namespace darwin {
         return GetPlanetLocked();
     }
 
+    std::size_t WorldState::GetPlanetIndexLocked() const {
+        const auto& types = element_store_.GetTypes();
+        auto it = std::find(types.begin(), types.end(), proto::TYPE_GROUND);
+        if (it == types.end()) {
+            throw std::runtime_error("No planet found.");
+        }
+        return std::distance(types.begin(), it);
+    }
+
     proto::Element WorldState::GetPlanetLocked() const {
-        for (const auto& [name, element_info] : element_infos_) {
-            assert(name == element_info.name());
-            if (element_info.type_enum() == proto::TYPE_GROUND) {
-                return element_info;
-            }
+        return element_store_.GetElement(GetPlanetIndexLocked());
+    }
+
+    EntityHandle WorldState::NextHandleLocked() {
+        if (next_handle_ == std::numeric_limits<EntityHandle>::max()) {
+            throw std::runtime_error("Out of entity handles.");
         }
-        throw std::runtime_error("No planet found.");
+        return next_handle_++;
     }
 
     void WorldState::AddRandomElementsLocked(std::uint32_t number) {
+        std::vector<proto::Vector3> colors;
+        for (const auto& color : player_parameter_.color_parameters()) {
+            colors.push_back(color.color());
+        }
         for (std::uint32_t i = 0; i < number; ++i) {
             proto::Element element;
-            static int element_number = 0;
+            // Upgrade names are unique across the regions of a world.
             element.set_name(
-                std::format("element_upgrade{}", element_number++));
+                world_region_ ?
+                    std::format(
+                        "element_upgrade{}_{}",
+                        world_region_->GetRegionIndex(),
+                        next_upgrade_number_++) :
+                    std::format(
+                        "element_upgrade{}",
+                        next_upgrade_number_++));
             element.set_type_enum(proto::TYPE_UPGRADE);
-            std::vector<proto::Vector3> colors;
-            for (const auto& color : player_parameter_.color_parameters()) {
-                colors.push_back(color.color());
-            }
             element.mutable_color()->CopyFrom(
                 CreateRandomNormalizedColor(colors.begin(), colors.end()));
             auto vec3 = CreateRandomNormalizedVector3();
+            while (world_region_ &&
+                !world_region_->IsOwned(ProtoVector2Glm(vec3)))
+            {
+                vec3 = CreateRandomNormalizedVector3();
+            }
             proto::Physic physic{};
             double radius = GetRadiusFromVolume(1.0);
             physic.mutable_position()->CopyFrom(
@@ -134,8 +185,9 @@ namespace darwin {
             physic.set_radius(radius);
             physic.set_mass(1.0);
             element.mutable_physic()->CopyFrom(physic);
-            element_infos_.insert({ element.name(), element });
+            element_store_.Add(NextHandleLocked(), element);
         }
+        element_grid_dirty_ = true;
     }
 
     void WorldState::UpdateCharacter(
@@ -144,24 +196,176 @@ namespace darwin {
         const proto::Physic& physic)
     {
         std::scoped_lock l(mutex_);
-        auto it = character_infos_.find(name);
-        if (character_infos_.contains(name)) {
-            it->second.mutable_physic()->CopyFrom(physic);
-            it->second.set_status_enum(status);
+        auto maybe_index = character_store_.FindIndex(name);
+        if (maybe_index) {
+            character_store_.SetPhysic(*maybe_index, physic);
+            SetCharacterStatusLocked(*maybe_index, status);
         }
         else {
             std::cerr << "Error updating character: " << name << "\n";
         }
     }
 
+    void WorldState::UpdateCharacters(
+        const std::vector<proto::Character>& characters)
+    {
+        std::scoped_lock l(mutex_);
+        for (const auto& character : characters) {
+            auto maybe_index = character_store_.FindIndex(character.name());
+            if (!maybe_index) {
+                std::cerr <<
+                    "Error updating character: " << character.name() << "\n";
+                continue;
+            }
+            character_store_.SetPhysic(*maybe_index, character.physic());
+            SetCharacterStatusLocked(*maybe_index, character.status_enum());
+            character_store_.GetLastSeens()[*maybe_index] = last_updated_;
+        }
+    }
+
+    void WorldState::GetCharacterInputStates(
+        std::vector<CharacterInputState>& states) const
+    {
+        std::scoped_lock l(mutex_);
+        std::erase_if(states, [this](CharacterInputState& state) {
+            auto maybe_index = character_store_.FindIndex(state.name);
+            if (!maybe_index) {
+                return true;
+            }
+            const std::size_t index = *maybe_index;
+            state.physic = {
+                character_store_.GetPositions()[index],
+                character_store_.GetPositionDts()[index],
+                character_store_.GetMasses()[index],
+                character_store_.GetRadii()[index] };
+            state.status_enum = character_store_.GetStatuses()[index];
+            state.normal = character_store_.GetNormals()[index];
+            state.special_effect_boost =
+                character_store_.GetSpecialEffects()[index];
+            return false;
+        });
+    }
+
+    void WorldState::SetCharacterInputStates(
+        std::span<const CharacterInputState> states)
+    {
+        std::scoped_lock l(mutex_);
+        for (const auto& state : states) {
+            auto maybe_index = character_store_.FindIndex(state.name);
+            if (!maybe_index) {
+                continue;
+            }
+            const std::size_t index = *maybe_index;
+            auto& positions = character_store_.GetPositions();
+            auto& position_dts = character_store_.GetPositionDts();
+            if (positions[index] != state.physic.position ||
+                position_dts[index] != state.physic.position_dt)
+            {
+                positions[index] = state.physic.position;
+                position_dts[index] = state.physic.position_dt;
+                character_store_.MarkChanged(
+                    index,
+                    ChangeEnum::CHANGE_PHYSIC);
+            }
+            if (state.mass_cost != 0.0) {
+                SetCharacterMassLocked(
+                    index,
+                    character_store_.GetMasses()[index] - state.mass_cost);
+            }
+            SetCharacterStatusLocked(index, state.status_enum);
+            auto& normals = character_store_.GetNormals();
+            auto& g_forces = character_store_.GetGForces();
+            auto& special_effects = character_store_.GetSpecialEffects();
+            if (normals[index] != state.normal ||
+                g_forces[index] != state.g_force ||
+                special_effects[index] != state.special_effect_boost)
+            {
+                normals[index] = state.normal;
+                g_forces[index] = state.g_force;
+                special_effects[index] = state.special_effect_boost;
+                character_store_.MarkChanged(
+                    index,
+                    ChangeEnum::CHANGE_STATUS);
+            }
+            character_store_.GetLastSeens()[index] = last_updated_;
+        }
+    }
+
+    std::vector<PhysicState> WorldState::GetGroundStates() const {
+        std::scoped_lock l(mutex_);
+        std::vector<PhysicState> grounds;
+        const auto& types = element_store_.GetTypes();
+        for (std::size_t i = 0; i < types.size(); ++i) {
+            if (types[i] == proto::TYPE_GROUND) {
+                grounds.push_back({
+                    element_store_.GetPositions()[i],
+                    element_store_.GetPositionDts()[i],
+                    element_store_.GetMasses()[i],
+                    element_store_.GetRadii()[i] });
+            }
+        }
+        return grounds;
+    }
+
     void WorldState::RemoveCharacter(const std::string& name) {
         std::scoped_lock l(mutex_);
-        character_infos_.erase(name);
+        RemoveCharacterLocked(name);
+    }
+
+    void WorldState::RemoveCharacterLocked(const std::string& name) {
+        auto maybe_index = character_store_.FindIndex(name);
+        if (maybe_index) {
+            RemoveCharacterHandleLocked(
+                character_store_.GetHandles()[*maybe_index]);
+        }
+    }
+
+    void WorldState::RemoveCharacterHandleLocked(EntityHandle handle) {
+        auto maybe_index = character_store_.FindIndex(handle);
+        if (!maybe_index) {
+            return;
+        }
+        removed_characters_.push_back(
+            {
+                sequence_ + 1,
+                handle,
+                character_store_.GetNames()[*maybe_index]
+            });
+        character_store_.Remove(handle);
+        mirrored_.erase(handle);
+        character_grid_dirty_ = true;
+    }
+
+    void WorldState::RemoveElementHandleLocked(EntityHandle handle) {
+        auto maybe_index = element_store_.FindIndex(handle);
+        if (!maybe_index) {
+            return;
+        }
+        removed_elements_.push_back(
+            {
+                sequence_ + 1,
+                handle,
+                element_store_.GetNames()[*maybe_index]
+            });
+        element_store_.Remove(handle);
+        mirrored_.erase(handle);
+        element_grid_dirty_ = true;
+    }
+
+    void WorldState::SetCharacterStatusLocked(
+        std::size_t index,
+        proto::StatusEnum status)
+    {
+        auto& statuses = character_store_.GetStatuses();
+        if (statuses[index] != status) {
+            statuses[index] = status;
+            character_store_.MarkChanged(index, ChangeEnum::CHANGE_STATUS);
+        }
     }
 
     bool WorldState::HasCharacter(const std::string& name) const {
         std::scoped_lock l(mutex_);
-        return character_infos_.contains(name);
+        return character_store_.FindIndex(name).has_value();
     }
 
     std::string WorldState::RemovePeer(const std::string& peer) {
@@ -170,23 +374,40 @@ namespace darwin {
     }
 
     std::string WorldState::RemovePeerLocked(const std::string& peer) {
-        if (peer_characters_.contains(peer)) {
-            auto character_name = peer_characters_.at(peer);
-            peer_characters_.erase(peer);
-            character_infos_.erase(character_name);
+        auto it = peer_characters_.find(peer);
+        if (it != peer_characters_.end()) {
+            EntityHandle handle = it->second;
+            peer_characters_.erase(it);
+            auto maybe_index = character_store_.FindIndex(handle);
+            if (!maybe_index) {
+                return "";
+            }
+            auto character_name = character_store_.GetNames()[*maybe_index];
+            RemoveCharacterHandleLocked(handle);
             return character_name;
         }
         return "";
     }
 
+    void WorldState::RemovePeerOfCharacterLocked(std::size_t index) {
+        auto it = peer_characters_.find(character_store_.GetPeers()[index]);
+        if (it != peer_characters_.end() &&
+            it->second == character_store_.GetHandles()[index])
+        {
+            peer_characters_.erase(it);
+        }
+    }
+
     std::optional<proto::Character> WorldState::GetCharacterOwnedByPeer(
         const std::string& peer,
         const std::string& character_name) const
     {
         std::scoped_lock l(mutex_);
-        if (peer_characters_.contains(peer)) {
-            if (character_infos_.contains(peer_characters_.at(peer))) {
-                return character_infos_.at(peer_characters_.at(peer));
+        auto it = peer_characters_.find(peer);
+        if (it != peer_characters_.end()) {
+            auto maybe_index = character_store_.FindIndex(it->second);
+            if (maybe_index) {
+                return character_store_.GetCharacter(*maybe_index);
             }
         }
         return std::nullopt;
@@ -197,21 +418,180 @@ namespace darwin {
         const std::string& character_name) const
     {
         std::scoped_lock l(mutex_);
-        if (peer_characters_.contains(peer)) {
-            return peer_characters_.at(peer) == character_name;
+        auto it = peer_characters_.find(peer);
+        if (it != peer_characters_.end()) {
+            auto maybe_index = character_store_.FindIndex(it->second);
+            return maybe_index &&
+                character_store_.GetNames()[*maybe_index] == character_name;
         }
         return false;
     }
 
     void WorldState::AddElement(const proto::Element& element) {
         std::scoped_lock l(mutex_);
-        auto it = element_infos_.find(element.name());
-        if (it == element_infos_.end()) {
-            element_infos_.insert({ element.name(), element });
+        auto maybe_index = element_store_.FindIndex(element.name());
+        if (!maybe_index) {
+            element_store_.Add(NextHandleLocked(), element);
         }
         else {
-            it->second = element;
+            element_store_.Set(*maybe_index, element);
         }
+        element_grid_dirty_ = true;
+    }
+
+    void WorldState::AddElementRows(
+        std::span<const ElementRow> rows,
+        std::span<const std::string_view> names)
+    {
+        if (rows.size() != names.size()) {
+            throw std::runtime_error("Element rows and names don't match.");
+        }
+        std::scoped_lock l(mutex_);
+        element_store_.Reserve(element_store_.Size() + rows.size());
+        for (std::size_t i = 0; i < rows.size(); ++i) {
+            auto maybe_index = element_store_.FindIndex(names[i]);
+            if (!maybe_index) {
+                element_store_.Add(NextHandleLocked(), names[i], rows[i]);
+            }
+            else {
+                element_store_.Set(*maybe_index, rows[i]);
+            }
+        }
+        element_grid_dirty_ = true;
+    }
+
+    void WorldState::GetElementRows(
+        std::vector<ElementRow>& rows,
+        std::vector<std::string>& names) const
+    {
+        std::scoped_lock l(mutex_);
+        rows.resize(element_store_.Size());
+        for (std::size_t i = 0; i < rows.size(); ++i) {
+            rows[i] = element_store_.GetElementRow(i);
+        }
+        names = element_store_.GetNames();
+    }
+
+    void WorldState::CaptureElementChanges(EntityStore& elements) {
+        std::vector<EntityHandle> changed_handles;
+        std::vector<RemovedEntity> removed_entities;
+        {
+            std::scoped_lock l(mutex_);
+            element_store_.EnableJournal(
+                JournalEnum::JOURNAL_CHECKPOINT,
+                true);
+            element_store_.TakeJournal(
+                JournalEnum::JOURNAL_CHECKPOINT,
+                changed_handles,
+                removed_entities);
+            for (const EntityHandle handle : changed_handles) {
+                auto maybe_index = element_store_.FindIndex(handle);
+                if (!maybe_index) {
+                    continue;
+                }
+                const ElementRow row =
+                    element_store_.GetElementRow(*maybe_index);
+                auto maybe_copy_index = elements.FindIndex(handle);
+                if (maybe_copy_index) {
+                    elements.Set(*maybe_copy_index, row);
+                }
+                else {
+                    elements.Add(
+                        handle,
+                        element_store_.GetNames()[*maybe_index],
+                        row);
+                }
+            }
+        }
+        for (const auto& removed_entity : removed_entities) {
+            elements.Remove(removed_entity.handle);
+        }
+    }
+
+    void WorldState::CaptureJournalEntry(
+        proto::WorldJournalEntry& entry,
+        bool all_characters)
+    {
+        std::vector<EntityHandle> changed_handles;
+        std::vector<RemovedEntity> removed_entities;
+        std::scoped_lock l(mutex_);
+        entry.set_time(last_updated_);
+        element_store_.EnableJournal(JournalEnum::JOURNAL_WRITE_AHEAD, false);
+        element_store_.TakeJournal(
+            JournalEnum::JOURNAL_WRITE_AHEAD,
+            changed_handles,
+            removed_entities);
+        for (const EntityHandle handle : changed_handles) {
+            auto maybe_index = element_store_.FindIndex(handle);
+            if (maybe_index) {
+                element_store_.FillElement(
+                    *maybe_index,
+                    *entry.add_elements());
+            }
+        }
+        for (const auto& removed_entity : removed_entities) {
+            entry.add_removed_elements(removed_entity.name);
+        }
+        character_store_.EnableJournal(
+            JournalEnum::JOURNAL_WRITE_AHEAD,
+            false);
+        character_store_.TakeJournal(
+            JournalEnum::JOURNAL_WRITE_AHEAD,
+            changed_handles,
+            removed_entities);
+        if (all_characters) {
+            changed_handles = character_store_.GetHandles();
+        }
+        for (const EntityHandle handle : changed_handles) {
+            auto maybe_index = character_store_.FindIndex(handle);
+            if (maybe_index) {
+                character_store_.FillCharacter(
+                    *maybe_index,
+                    *entry.add_characters());
+            }
+        }
+        for (const auto& removed_entity : removed_entities) {
+            entry.add_removed_characters(removed_entity.name);
+        }
+    }
+
+    void WorldState::ApplyJournalEntry(const proto::WorldJournalEntry& entry)
+    {
+        std::scoped_lock l(mutex_);
+        for (const auto& name : entry.removed_elements()) {
+            auto maybe_index = element_store_.FindIndex(name);
+            if (maybe_index) {
+                RemoveElementHandleLocked(
+                    element_store_.GetHandles()[*maybe_index]);
+            }
+        }
+        for (const auto& element : entry.elements()) {
+            auto maybe_index = element_store_.FindIndex(element.name());
+            if (!maybe_index) {
+                element_store_.Add(NextHandleLocked(), element);
+            }
+            else {
+                element_store_.Set(*maybe_index, element);
+            }
+        }
+        element_grid_dirty_ = true;
+        for (const auto& name : entry.removed_characters()) {
+            RemoveCharacterLocked(name);
+        }
+        for (const auto& character : entry.characters()) {
+            auto maybe_index = character_store_.FindIndex(character.name());
+            if (!maybe_index) {
+                maybe_index =
+                    character_store_.Add(NextHandleLocked(), character);
+            }
+            else {
+                character_store_.Set(*maybe_index, character);
+            }
+            // Gone if nobody claims it before the disconnection timeout.
+            character_store_.GetLastSeens()[*maybe_index] = entry.time();
+        }
+        character_grid_dirty_ = true;
+        last_updated_ = entry.time();
     }
 
     void WorldState::SetPlayerParameter(
@@ -219,65 +599,393 @@ namespace darwin {
     {
         std::scoped_lock l(mutex_);
         player_parameter_ = parameter;
+        published_player_parameter_ =
+            std::make_shared<const proto::PlayerParameter>(parameter);
+        PublishViewLocked();
+    }
+
+    void WorldState::SetServerHitDetection(bool server_hit_detection) {
+        std::scoped_lock l(mutex_);
+        server_hit_detection_ = server_hit_detection;
+        character_hits_.clear();
+    }
+
+    void WorldState::SetTickProfiler(TickProfiler* tick_profiler) {
+        std::scoped_lock l(mutex_);
+        tick_profiler_ = tick_profiler;
+    }
+
+    void WorldState::SetWorkerPool(WorkerPool* worker_pool) {
+        std::scoped_lock l(mutex_);
+        worker_pool_ = worker_pool;
+    }
+
+    void WorldState::SetWorldRegion(const WorldRegion* world_region) {
+        std::scoped_lock l(mutex_);
+        world_region_ = world_region;
+    }
+
+    void WorldState::CaptureRegionExchanges(
+        double mirror_angle,
+        bool is_handoff,
+        std::vector<proto::RegionExchangeRequest>& requests)
+    {
+        std::scoped_lock l(mutex_);
+        if (!world_region_) {
+            requests.clear();
+            return;
+        }
+        const std::uint32_t region_index = world_region_->GetRegionIndex();
+        requests.resize(world_region_->GetRegionCount());
+        for (auto& request : requests) {
+            request.Clear();
+            request.set_region(region_index);
+            request.set_time(last_updated_);
+        }
+        std::vector<EntityHandle> handoffs;
+        const auto& handles = character_store_.GetHandles();
+        const auto& positions = character_store_.GetPositions();
+        const auto& statuses = character_store_.GetStatuses();
+        for (std::size_t i = 0; i < character_store_.Size(); ++i) {
+            if (IsMirroredLocked(handles[i])) {
+                continue;
+            }
+            const std::uint32_t region =
+                world_region_->GetRegion(positions[i]);
+            if (is_handoff &&
+                region != region_index &&
+                statuses[i] != proto::STATUS_DEAD)
+            {
+                character_store_.FillCharacter(
+                    i,
+                    *requests[region].add_handoff_characters());
+                handoffs.push_back(handles[i]);
+                continue;
+            }
+            world_region_->GetRegionsInCap(
+                positions[i],
+                mirror_angle,
+                regions_);
+            for (const auto region : regions_) {
+                character_store_.FillCharacter(
+                    i,
+                    *requests[region].add_mirrored_characters());
+            }
+        }
+        for (const auto handle : handoffs) {
+            const auto index = *character_store_.FindIndex(handle);
+            const auto& name = character_store_.GetNames()[index];
+            handoffs_.push_back(
+                {
+                    sequence_ + 1,
+                    name,
+                    world_region_->GetServerName(
+                        world_region_->GetRegion(positions[index]))
+                });
+            RemovePeerOfCharacterLocked(index);
+            RemoveCharacterHandleLocked(handle);
+        }
+        const auto& element_types = element_store_.GetTypes();
+        for (std::size_t i = 0; i < element_store_.Size(); ++i) {
+            // The other elements come from the world database, the same in
+            // every region.
+            if (element_types[i] != proto::TYPE_UPGRADE ||
+                IsMirroredLocked(element_store_.GetHandles()[i]))
+            {
+                continue;
+            }
+            world_region_->GetRegionsInCap(
+                element_store_.GetPositions()[i],
+                mirror_angle,
+                regions_);
+            for (const auto region : regions_) {
+                element_store_.FillElement(
+                    i,
+                    *requests[region].add_mirrored_elements());
+            }
+        }
+    }
+
+    void WorldState::ApplyRegionExchange(
+        const proto::RegionExchangeRequest& request)
+    {
+        std::scoped_lock l(mutex_);
+        const std::uint32_t region = request.region();
+        for (const auto& character : request.handoff_characters()) {
+            auto maybe_index = character_store_.FindIndex(character.name());
+            if (!maybe_index) {
+                maybe_index =
+                    character_store_.Add(NextHandleLocked(), character);
+            }
+            else if (mirrored_.erase(
+                character_store_.GetHandles()[*maybe_index]))
+            {
+                character_store_.Set(*maybe_index, character);
+            }
+            else {
+                std::cerr << std::format(
+                    "Handed off character {} is already owned.\n",
+                    character.name());
+                continue;
+            }
+            // Gone if nobody claims it before the disconnection timeout.
+            character_store_.GetLastSeens()[*maybe_index] = last_updated_;
+        }
+        std::set<EntityHandle> mirrors;
+        for (const auto& character : request.mirrored_characters()) {
+            auto maybe_index = character_store_.FindIndex(character.name());
+            if (!maybe_index) {
+                maybe_index =
+                    character_store_.Add(NextHandleLocked(), character);
+                mirrored_.emplace(
+                    character_store_.GetHandles()[*maybe_index],
+                    region);
+            }
+            else {
+                auto it = mirrored_.find(
+                    character_store_.GetHandles()[*maybe_index]);
+                if (it == mirrored_.end() || it->second != region) {
+                    // Owned here (or by another region).
+                    continue;
+                }
+                character_store_.Set(*maybe_index, character);
+            }
+            // Gone if its region stops sending it.
+            character_store_.GetLastSeens()[*maybe_index] = last_updated_;
+            mirrors.insert(character_store_.GetHandles()[*maybe_index]);
+        }
+        for (const auto& element : request.mirrored_elements()) {
+            auto maybe_index = element_store_.FindIndex(element.name());
+            if (!maybe_index) {
+                maybe_index = element_store_.Add(NextHandleLocked(), element);
+                mirrored_.emplace(
+                    element_store_.GetHandles()[*maybe_index],
+                    region);
+            }
+            else {
+                auto it = mirrored_.find(
+                    element_store_.GetHandles()[*maybe_index]);
+                if (it == mirrored_.end() || it->second != region) {
+                    continue;
+                }
+                element_store_.Set(*maybe_index, element);
+            }
+            mirrors.insert(element_store_.GetHandles()[*maybe_index]);
+        }
+        std::vector<EntityHandle> removed;
+        for (const auto& [handle, mirror_region] : mirrored_) {
+            if (mirror_region == region && !mirrors.contains(handle)) {
+                removed.push_back(handle);
+            }
+        }
+        for (const auto handle : removed) {
+            RemoveCharacterHandleLocked(handle);
+            RemoveElementHandleLocked(handle);
+        }
+        character_grid_dirty_ = true;
+        element_grid_dirty_ = true;
+    }
+
+    bool WorldState::IsMirrored(const std::string& name) const {
+        std::scoped_lock l(mutex_);
+        if (auto maybe_index = character_store_.FindIndex(name)) {
+            return IsMirroredLocked(
+                character_store_.GetHandles()[*maybe_index]);
+        }
+        if (auto maybe_index = element_store_.FindIndex(name)) {
+            return IsMirroredLocked(
+                element_store_.GetHandles()[*maybe_index]);
+        }
+        return false;
+    }
+
+    bool WorldState::IsMirroredLocked(EntityHandle handle) const {
+        return !mirrored_.empty() && mirrored_.contains(handle);
+    }
+
+    void WorldState::BuildGridsLocked() {
+        BuildElementGridLocked();
+        BuildCharacterGridLocked();
+    }
+
+    void WorldState::BuildElementGridLocked() {
+        if (element_grid_dirty_) {
+            const auto& element_types = element_store_.GetTypes();
+            element_grid_.Build(
+                element_store_.GetPositions(),
+                [&element_types](std::size_t i) {
+                    return element_types[i] != proto::TYPE_GROUND;
+                });
+            element_grid_dirty_ = false;
+        }
+    }
+
+    void WorldState::BuildCharacterGridLocked() {
+        if (character_grid_dirty_) {
+            const auto& statuses = character_store_.GetStatuses();
+            character_grid_.Build(
+                character_store_.GetPositions(),
+                [&statuses](std::size_t i) {
+                    return statuses[i] != proto::STATUS_DEAD;
+                });
+            character_grid_dirty_ = false;
+        }
+    }
+
+    void WorldState::DetectHitsLocked(std::size_t begin, std::size_t end) {
+        auto& [grid_cells, hits] = hit_chunks_[begin / CHARACTER_GRAIN];
+        hits.clear();
+        const auto& element_types = element_store_.GetTypes();
+        const auto& element_positions = element_store_.GetPositions();
+        const auto& element_radii = element_store_.GetRadii();
+        const auto& element_handles = element_store_.GetHandles();
+        const auto& statuses = character_store_.GetStatuses();
+        const auto& positions = character_store_.GetPositions();
+        const auto& radii = character_store_.GetRadii();
+        const auto& masses = character_store_.GetMasses();
+        const auto& handles = character_store_.GetHandles();
+        // Same test as the client (real intersection) and as the server
+        // (almost intersecting), the grid only return cells within the
+        // almost intersecting angle.
+        auto is_hit = [](
+            const glm::dvec3& position_from,
+            double radius_from,
+            const glm::dvec3& position_to,
+            double radius_to)
+        {
+            return
+                glm::distance(position_from, position_to) <
+                    radius_from + radius_to &&
+                IsAlmostIntersecting(position_from, position_to);
+        };
+        for (std::size_t i = begin; i < end; ++i) {
+            if (statuses[i] == proto::STATUS_DEAD) {
+                continue;
+            }
+            element_grid_.GetCellsInCap(
+                positions[i],
+                ALMOST_INTERSECT_ANGLE,
+                grid_cells);
+            for (const auto cell : grid_cells) {
+                for (const auto j : element_grid_.GetCellItems(cell)) {
+                    if (element_types[j] == proto::TYPE_UPGRADE &&
+                        is_hit(
+                        positions[i], radii[i],
+                        element_positions[j], element_radii[j]))
+                    {
+                        hits.push_back(
+                            { handles[i], element_handles[j], 0 });
+                    }
+                }
+            }
+            character_grid_.GetCellsInCap(
+                positions[i],
+                ALMOST_INTERSECT_ANGLE,
+                grid_cells);
+            for (const auto cell : grid_cells) {
+                for (const auto j : character_grid_.GetCellItems(cell)) {
+                    // Only the heaviest can eat the other.
+                    if (i == j || masses[i] <= masses[j]) {
+                        continue;
+                    }
+                    if (is_hit(positions[i], radii[i], positions[j], radii[j]))
+                    {
+                        hits.push_back({ handles[i], handles[j], 0 });
+                    }
+                }
+            }
+        }
+    }
+
+    void WorldState::GatherHitsLocked() {
+        character_hits_.clear();
+        for (const auto& hit_chunk : hit_chunks_) {
+            character_hits_.insert(
+                character_hits_.end(),
+                hit_chunk.hits.begin(),
+                hit_chunk.hits.end());
+        }
     }
 
     void WorldState::CheckIntersectPlayerLocked() {
-        std::map<std::string, proto::TypeEnum> to_remove_type;
-        for (const auto& [character, target_name] : character_hits_) {
+        const auto& positions_from = character_store_.GetPositions();
+        const auto& masses_from = character_store_.GetMasses();
+        const auto& colors_from = character_store_.GetColors();
+        eaten_elements_.clear();
+        eaten_flags_.assign(element_store_.Size(), 0);
+        for (const auto& hit : character_hits_) {
+            const EntityHandle handle_from = hit.eater;
+            const EntityHandle handle_to = hit.target;
+            if (IsMirroredLocked(handle_from) || IsMirroredLocked(handle_to))
+            {
+                // Resolved by the region that owns the mirror.
+                continue;
+            }
+            auto maybe_from = character_store_.FindIndex(handle_from);
+            if (!maybe_from) {
+                continue;
+            }
             proto::TypeEnum type_enum = proto::TYPE_UNKNOWN;
-            proto::Physic physic_from = character.physic();
-            proto::Vector3 color_from = character.color();
-            proto::Physic physic_to;
-            proto::Vector3 color_to;
-            if (element_infos_.contains(target_name)) {
-                if (physic_from.mass() > 
-                    player_parameter_.max_upgrade_grow()) 
+            const EntityStore* store_to = nullptr;
+            auto maybe_to = element_store_.FindIndex(handle_to);
+            if (maybe_to) {
+                if (masses_from[*maybe_from] >
+                    player_parameter_.max_upgrade_grow())
                 {
                     // You can't eat any more elements!
                     continue;
                 }
-                if (element_infos_.at(target_name).type_enum() !=
+                if (element_store_.GetTypes()[*maybe_to] !=
                     proto::TYPE_UPGRADE)
                 {
                     // You can't eat this type of element.
                     continue;
                 }
-                physic_to = element_infos_.at(target_name).physic();
-                color_to = element_infos_.at(target_name).color();
+                if (eaten_flags_[*maybe_to]) {
+                    // Already eaten by an earlier hit.
+                    continue;
+                }
+                store_to = &element_store_;
                 type_enum = proto::TYPE_UPGRADE;
             }
-            if (character_infos_.contains(target_name)) {
-                physic_to = character_infos_.at(target_name).physic();
-                color_to = character_infos_.at(target_name).color();
+            else {
+                maybe_to = character_store_.FindIndex(handle_to);
+                if (!maybe_to) {
+                    continue;
+                }
+                store_to = &character_store_;
                 type_enum = proto::TYPE_CHARACTER;
             }
+            const std::size_t index_from = *maybe_from;
+            const std::size_t index_to = *maybe_to;
             // Check if you can eat the target.
-            if (physic_from.mass() <= physic_to.mass()) {
+            if (masses_from[index_from] <= store_to->GetMasses()[index_to]) {
 #ifdef _DEBUG
-                std::cerr 
-                    << "[" << character.name()
-                    << "].mass() <= [" << target_name
+                std::cerr
+                    << "[" << character_store_.GetNames()[index_from]
+                    << "].mass() <= [" << store_to->GetNames()[index_to]
                     << "].mass() ?\n";
 #endif // _DEBUG
                 continue;
             }
+            const auto& position_to = store_to->GetPositions()[index_to];
 #ifdef _DEBUG
             std::cout << std::format(
                 "Character {} is trying to eating {} ({}).\n",
-                character.name(),
-                target_name,
-                Dot(
-                    Normalize(physic_to.position()), 
-                    Normalize(physic_from.position())));
+                character_store_.GetNames()[index_from],
+                store_to->GetNames()[index_to],
+                glm::dot(
+                    glm::normalize(position_to),
+                    glm::normalize(positions_from[index_from])));
 #endif // _DEBUG
-            if (IsAlmostIntersecting(physic_from, physic_to)) {
-                FromTo from_to{ 
-                    character.name(),   target_name,
-                    physic_from,        physic_to, 
-                    color_from,         color_to
-                };
+            if (IsAlmostIntersecting(positions_from[index_from], position_to))
+            {
+                FromTo from_to{ index_from, index_to };
                 // Check if color are compatible.
-                if (Dot(color_from, color_to) > 0.99) {
+                if (glm::dot(
+                        colors_from[index_from],
+                        store_to->GetColors()[index_to]) > 0.99)
+                {
                     if (type_enum == proto::TYPE_UPGRADE) {
                         LostSourceElementLocked(from_to);
                     }
@@ -289,7 +997,8 @@ namespace darwin {
                 {
                     if (type_enum == proto::TYPE_UPGRADE) {
                         ChangeSourceEatUpgradeLocked(from_to);
-                        to_remove_type.insert({ target_name, type_enum });
+                        eaten_elements_.push_back(handle_to);
+                        eaten_flags_[index_to] = 1;
                     }
                     if (type_enum == proto::TYPE_CHARACTER) {
                         ChangeSourceEatCharacterLocked(from_to);
@@ -297,212 +1006,499 @@ namespace darwin {
                 }
             }
         }
-        for (const auto& [name, type] : to_remove_type) {
-            if (type == proto::TYPE_UPGRADE) {
-                element_infos_.erase(name);
-                AddRandomElementsLocked(1);
-            }
-            if (type == proto::TYPE_CHARACTER) {
-                character_infos_.erase(name);
-            }
-#ifdef _DEBUG
-            if (type == proto::TYPE_UNKNOWN) {
-                std::cerr << "[" << name << "]: unknown type.\n";
-            }
-#endif // _DEBUG
+        // Hits are consumed (the server detects them again every tick).
+        character_hits_.clear();
+        std::sort(eaten_elements_.begin(), eaten_elements_.end());
+        for (const auto handle : eaten_elements_) {
+            RemoveElementHandleLocked(handle);
+            AddRandomElementsLocked(1);
         }
     }
 
+    void WorldState::SetCharacterMassLocked(std::size_t index, double mass) {
+        character_store_.GetMasses()[index] = mass;
+        character_store_.GetRadii()[index] = GetRadiusFromVolume(mass);
+        character_store_.MarkChanged(index, ChangeEnum::CHANGE_PHYSIC);
+    }
+
     void WorldState::ChangeSourceEatUpgradeLocked(const FromTo& from_to) {
-        proto::Physic physic_from{ from_to.physic_from };
-        proto::Physic physic_to{ from_to.physic_to };
-        physic_from.set_mass(
-            from_to.physic_from.mass() + from_to.physic_to.mass());
-        physic_from.set_radius(GetRadiusFromVolume(physic_from.mass()));
-        character_infos_.at(
-            from_to.name_from).mutable_physic()->CopyFrom(
-                physic_from);
+        SetCharacterMassLocked(
+            from_to.index_from,
+            character_store_.GetMasses()[from_to.index_from] +
+                element_store_.GetMasses()[from_to.index_to]);
     }
 
     void WorldState::ChangeSourceEatCharacterLocked(const FromTo& from_to) {
-        proto::Physic physic_from{ from_to.physic_from };
-        proto::Physic physic_to{ from_to.physic_to };
-        double move_mass = 
-            std::min(physic_to.mass(), player_parameter_.eat_speed());
-        physic_from.set_mass(from_to.physic_from.mass() + move_mass);
-        physic_from.set_radius(GetRadiusFromVolume(physic_from.mass()));
-        character_infos_.at(
-            from_to.name_from).mutable_physic()->CopyFrom(
-                physic_from);
-        physic_to.set_mass(from_to.physic_to.mass() - move_mass);
-        physic_to.set_radius(GetRadiusFromVolume(physic_to.mass()));
-        character_infos_.at(
-            from_to.name_to).mutable_physic()->CopyFrom(
-                physic_to);
+        const double mass_from =
+            character_store_.GetMasses()[from_to.index_from];
+        const double mass_to = character_store_.GetMasses()[from_to.index_to];
+        double move_mass = std::min(mass_to, player_parameter_.eat_speed());
+        SetCharacterMassLocked(from_to.index_from, mass_from + move_mass);
+        SetCharacterMassLocked(from_to.index_to, mass_to - move_mass);
     }
 
     void WorldState::LostSourceElementLocked(const FromTo& from_to) {
-        proto::Physic physic{ from_to.physic_from };
-        physic.set_mass(
-            from_to.physic_from.mass() + GetPlayerParameter().penalty());
-        physic.set_radius(GetRadiusFromVolume(physic.mass()));
-        character_infos_.at(
-            from_to.name_from).mutable_physic()->CopyFrom(physic);
+        SetCharacterMassLocked(
+            from_to.index_from,
+            character_store_.GetMasses()[from_to.index_from] +
+                player_parameter_.penalty());
     }
 
     void WorldState::LostSourceCharacterLocked(const FromTo& from_to) {
-        double new_mass = 
-            (from_to.physic_from.mass() + from_to.physic_to.mass()) * 0.5;
-        {
-            proto::Physic physic{ from_to.physic_from };
-            physic.set_mass(new_mass);
-            physic.set_radius(GetRadiusFromVolume(physic.mass()));
-            character_infos_.at(
-                from_to.name_from).mutable_physic()->CopyFrom(
-                    physic);
-        }
-        {
-            proto::Physic physic{ from_to.physic_to };
-            physic.set_mass(new_mass);
-            physic.set_radius(GetRadiusFromVolume(physic.mass()));
-            character_infos_.at(
-                from_to.name_to).mutable_physic()->CopyFrom(physic);
-        }
+        double new_mass =
+            (character_store_.GetMasses()[from_to.index_from] +
+                character_store_.GetMasses()[from_to.index_to]) * 0.5;
+        SetCharacterMassLocked(from_to.index_from, new_mass);
+        SetCharacterMassLocked(from_to.index_to, new_mass);
     }
 
     void WorldState::Update(double time) {
         std::scoped_lock l(mutex_);
         if (time != last_updated_) {
-            CheckStillInUseCharactersLocked();
-            CheckGroundCharactersLocked();
-            CheckDeathCharactersLocked();
-            CheckVictoryCharactersLocked();
-            CheckIntersectPlayerLocked();
+            // The checks are per character and run in parallel, their side
+            // effects are applied in row order so that the result does not
+            // depend on the thread count. The hits are detected in parallel
+            // and resolved in row order, a hit changes the masses the next
+            // hits are checked against.
+            {
+                ScopedPhaseTimer timer(
+                    tick_profiler_, TickPhaseEnum::TICK_PHASE_STILL_IN_USE);
+                CheckStillInUseCharactersLocked();
+            }
+            const double ground_radius =
+                element_store_.GetRadii()[GetPlanetIndexLocked()];
+            const std::size_t size = character_store_.Size();
+            ground_flags_.assign(size, 0);
+            dead_flags_.assign(size, 0);
+            victory_flags_.assign(size, 0);
+            hit_chunks_.resize((size + CHARACTER_GRAIN - 1) / CHARACTER_GRAIN);
+            task_graph_.Clear();
+            // The upgrades do not depend on the characters.
+            const TaskId element_grid = task_graph_.AddTask(
+                TickPhaseEnum::TICK_PHASE_BUILD_GRIDS,
+                [this] { BuildElementGridLocked(); });
+            const TaskId ground = task_graph_.AddParallelTask(
+                TickPhaseEnum::TICK_PHASE_GROUND,
+                size,
+                CHARACTER_GRAIN,
+                [this, ground_radius](std::size_t begin, std::size_t end) {
+                    CheckGroundCharactersLocked(ground_radius, begin, end);
+                });
+            const TaskId death = task_graph_.AddParallelTask(
+                TickPhaseEnum::TICK_PHASE_DEATH,
+                size,
+                CHARACTER_GRAIN,
+                [this](std::size_t begin, std::size_t end) {
+                    CheckDeathCharactersLocked(begin, end);
+                });
+            const TaskId victory = task_graph_.AddParallelTask(
+                TickPhaseEnum::TICK_PHASE_VICTORY,
+                size,
+                CHARACTER_GRAIN,
+                [this](std::size_t begin, std::size_t end) {
+                    CheckVictoryCharactersLocked(begin, end);
+                });
+            const TaskId apply_checks = task_graph_.AddTask(
+                TickPhaseEnum::TICK_PHASE_DEATH,
+                [this] { ApplyCharacterChecksLocked(); },
+                { ground, death, victory });
+            const TaskId character_grid = task_graph_.AddTask(
+                TickPhaseEnum::TICK_PHASE_BUILD_GRIDS,
+                [this] {
+                    // Characters moved since the last tick.
+                    character_grid_dirty_ = true;
+                    BuildCharacterGridLocked();
+                },
+                { apply_checks });
+            TaskId hits = character_grid;
+            if (server_hit_detection_) {
+                const TaskId detect_hits = task_graph_.AddParallelTask(
+                    TickPhaseEnum::TICK_PHASE_DETECT_HITS,
+                    size,
+                    CHARACTER_GRAIN,
+                    [this](std::size_t begin, std::size_t end) {
+                        DetectHitsLocked(begin, end);
+                    },
+                    { element_grid, character_grid });
+                hits = task_graph_.AddTask(
+                    TickPhaseEnum::TICK_PHASE_DETECT_HITS,
+                    [this] { GatherHitsLocked(); },
+                    { detect_hits });
+            }
+            const TaskId intersect = task_graph_.AddTask(
+                TickPhaseEnum::TICK_PHASE_INTERSECT,
+                [this] { CheckIntersectPlayerLocked(); },
+                { element_grid, hits });
+            task_graph_.AddTask(
+                TickPhaseEnum::TICK_PHASE_BUILD_GRIDS,
+                // Eaten upgrades were replaced.
+                [this] { BuildGridsLocked(); },
+                { intersect });
+            task_graph_.Run(worker_pool_, tick_profiler_);
             last_updated_ = time;
+            // Publish the changes of this tick.
+            ++sequence_;
+            character_store_.SetSequence(sequence_ + 1);
+            element_store_.SetSequence(sequence_ + 1);
+            auto is_old = [this](const Removal& removal) {
+                return removal.sequence + delta_history_ < sequence_;
+            };
+            while (!removed_characters_.empty() &&
+                is_old(removed_characters_.front()))
+            {
+                removed_characters_.pop_front();
+            }
+            while (!removed_elements_.empty() &&
+                is_old(removed_elements_.front()))
+            {
+                removed_elements_.pop_front();
+            }
+            while (!handoffs_.empty() &&
+                handoffs_.front().sequence + delta_history_ < sequence_)
+            {
+                handoffs_.pop_front();
+            }
+            PublishViewLocked();
         }
-        FillVectorsLocked();
+    }
+
+    void WorldState::SetDeltaHistory(std::uint64_t delta_history) {
+        std::scoped_lock l(mutex_);
+        delta_history_ = delta_history;
+    }
+
+    std::uint64_t WorldState::GetSequence() const {
+        std::scoped_lock l(mutex_);
+        return sequence_;
     }
 
     void WorldState::UpdatePing(const std::string& name) {
         std::scoped_lock l(mutex_);
-        last_seen_[name] = last_updated_;
+        auto maybe_index = character_store_.FindIndex(name);
+        if (maybe_index) {
+            character_store_.GetLastSeens()[*maybe_index] = last_updated_;
+        }
     }
 
     void WorldState::CheckStillInUseCharactersLocked() {
-        for (const auto& [name, time] : last_seen_) {
-            if (time + player_parameter_.disconnection_timeout() < 
-                last_updated_) 
+        const auto& last_seens = character_store_.GetLastSeens();
+        for (std::size_t i = 0; i < last_seens.size(); ++i) {
+            if (last_seens[i] == NEVER_SEEN) {
+                continue;
+            }
+            if (last_seens[i] + player_parameter_.disconnection_timeout() <
+                last_updated_)
             {
                 std::cout << std::format(
-                    "Character {} has been disconnected.\n", 
-                    name);
-                character_infos_.erase(name);
-                last_seen_.erase(name);
+                    "Character {} has been disconnected.\n",
+                    character_store_.GetNames()[i]);
+                RemoveCharacterHandleLocked(
+                    character_store_.GetHandles()[i]);
                 break;
             }
         }
     }
 
-    void WorldState::CheckGroundCharactersLocked() {
-        auto ground = GetPlanetLocked();
-        for (auto& [name, character_info] : character_infos_) {
-            if (character_info.status_enum() == 
-                proto::STATUS_ON_GROUND) 
-            {
-                assert(name == character_info.name());
-                auto position_normal = Normalize(
-                    character_info.physic().position());
-                character_info.mutable_physic()->
-                    mutable_position()->
-                    CopyFrom(
-                        position_normal *
-                        (ground.physic().radius() + 
-                         character_info.physic().radius()));
-                character_info.mutable_normal()->CopyFrom(
-                    position_normal);
-            }
-        }
-    }
-
-    void WorldState::CheckDeathCharactersLocked() {
-        for (auto& [name, character_info] : character_infos_) {
-            assert(name == character_info.name());
-            if (character_info.physic().mass() < 1.0) {
-                character_info.set_status_enum(
-                    proto::STATUS_DEAD);
-                for (const auto& [peer, character] : peer_characters_) {
-                    if (character == character_info.name()) {
-                        peer_characters_.erase(peer);
-                        break;
-                    }
+    void WorldState::CheckGroundCharactersLocked(
+        double ground_radius,
+        std::size_t begin,
+        std::size_t end)
+    {
+        const auto& statuses = character_store_.GetStatuses();
+        const auto& radii = character_store_.GetRadii();
+        auto& positions = character_store_.GetPositions();
+        auto& normals = character_store_.GetNormals();
+        for (std::size_t i = begin; i < end; ++i) {
+            if (statuses[i] == proto::STATUS_ON_GROUND) {
+                auto position_normal = glm::normalize(positions[i]);
+                auto position =
+                    position_normal * (ground_radius + radii[i]);
+                if (positions[i] != position) {
+                    positions[i] = position;
+                    ground_flags_[i] |= GROUND_PHYSIC_CHANGED;
+                }
+                if (normals[i] != position_normal) {
+                    normals[i] = position_normal;
+                    ground_flags_[i] |= GROUND_STATUS_CHANGED;
                 }
             }
         }
     }
 
-    void WorldState::CheckVictoryCharactersLocked() {
-        for (auto& [name, character_info] : character_infos_) {
-            assert(name == character_info.name());
-            if (character_info.physic().mass() >=
-                player_parameter_.victory_size()) 
-            {
-                character_info.set_status_enum(
-                    proto::STATUS_DEAD);
-                for (const auto& [peer, character] : peer_characters_) {
-                    if (character == character_info.name()) {
-                        peer_characters_.erase(peer);
-                        break;
-                    }
+    void WorldState::CheckDeathCharactersLocked(
+        std::size_t begin,
+        std::size_t end)
+    {
+        const auto& masses = character_store_.GetMasses();
+        for (std::size_t i = begin; i < end; ++i) {
+            dead_flags_[i] = masses[i] < 1.0;
+        }
+    }
+
+    void WorldState::CheckVictoryCharactersLocked(
+        std::size_t begin,
+        std::size_t end)
+    {
+        const auto& masses = character_store_.GetMasses();
+        for (std::size_t i = begin; i < end; ++i) {
+            victory_flags_[i] = masses[i] >= player_parameter_.victory_size();
+        }
+    }
+
+    void WorldState::ApplyCharacterChecksLocked() {
+        for (std::size_t i = 0; i < ground_flags_.size(); ++i) {
+            if (ground_flags_[i] & GROUND_PHYSIC_CHANGED) {
+                character_store_.MarkChanged(i, ChangeEnum::CHANGE_PHYSIC);
+            }
+            if (ground_flags_[i] & GROUND_STATUS_CHANGED) {
+                character_store_.MarkChanged(i, ChangeEnum::CHANGE_STATUS);
+            }
+        }
+        const auto& handles = character_store_.GetHandles();
+        for (const auto* flags : { &dead_flags_, &victory_flags_ }) {
+            for (std::size_t i = 0; i < flags->size(); ++i) {
+                if ((*flags)[i] && !IsMirroredLocked(handles[i])) {
+                    SetCharacterStatusLocked(i, proto::STATUS_DEAD);
+                    RemovePeerOfCharacterLocked(i);
                 }
             }
         }
     }
 
     double WorldState::GetLastUpdated() const {
+        std::scoped_lock l(mutex_);
         return last_updated_;
     }
 
-    void WorldState::FillVectorsLocked() {
-        characters_.clear();
-        elements_.clear();
-        for (const auto& [_, character_info] : character_infos_) {
-            characters_.push_back(character_info);
+    proto::PlayerParameter WorldState::GetPlayerParameter() const {
+        std::scoped_lock l(mutex_);
+        return player_parameter_;
+    }
+
+    std::vector<proto::Character> WorldState::GetCharacters() const {
+        std::scoped_lock l(mutex_);
+        std::vector<proto::Character> characters;
+        characters.reserve(character_store_.Size());
+        for (std::size_t i = 0; i < character_store_.Size(); ++i) {
+            characters.push_back(character_store_.GetCharacter(i));
+        }
+        return characters;
+    }
+
+    std::vector<proto::Element> WorldState::GetElements() const {
+        std::scoped_lock l(mutex_);
+        std::vector<proto::Element> elements;
+        elements.reserve(element_store_.Size());
+        for (std::size_t i = 0; i < element_store_.Size(); ++i) {
+            elements.push_back(element_store_.GetElement(i));
+        }
+        return elements;
+    }
+
+    std::shared_ptr<const WorldView> WorldState::GetView() const {
+        return view_.load();
+    }
+
+    void WorldState::FillUpdateResponse(
+        proto::UpdateResponse& response,
+        std::uint64_t baseline_sequence) const
+    {
+        GetView()->FillUpdateResponse(response, baseline_sequence);
+    }
+
+    std::optional<std::vector<EntityHandle>> WorldState::GetVisibleHandles(
+        const std::string& peer,
+        double angle) const
+    {
+        return GetView()->GetVisibleHandles(peer, angle);
+    }
+
+    void WorldState::FillVisibleUpdateResponse(
+        proto::UpdateResponse& response,
+        const std::vector<EntityHandle>& visible,
+        std::uint64_t baseline_sequence,
+        const std::vector<EntityHandle>& baseline_visible) const
+    {
+        GetView()->FillVisibleUpdateResponse(
+            response,
+            visible,
+            baseline_sequence,
+            baseline_visible);
+    }
+
+    void WorldState::PublishViewLocked() {
+        // Reuse the buffers of a view only the ring holds, once replaced a
+        // view can't be loaded again so nobody can take it back.
+        std::shared_ptr<WorldView> view;
+        for (const auto& recycled : recycled_views_) {
+            if (recycled.use_count() == 1) {
+                // See the reads of its last reader done.
+                std::atomic_thread_fence(std::memory_order_acquire);
+                view = recycled;
+                break;
+            }
         }
-        bool first_loop = true;
-        for (const auto& [_, element_info] : element_infos_) {
-            elements_.push_back(element_info);
+        if (!view) {
+            view = std::make_shared<WorldView>();
+            if (recycled_views_.size() < RECYCLED_VIEW_COUNT) {
+                recycled_views_.push_back(view);
+            }
         }
+        view->time_ = last_updated_;
+        view->sequence_ = sequence_;
+        view->delta_history_ = delta_history_;
+        view->player_parameter_ = published_player_parameter_;
+        // Let go of its old elements, their mirror may be the free one.
+        view->elements_.reset();
+        if (!published_elements_ ||
+            published_elements_->version != element_store_.GetVersion() ||
+            published_elements_->grid_dirty != element_grid_dirty_)
+        {
+            PublishElementsLocked();
+        }
+        view->elements_ = published_elements_;
+        // Copy assignments, the buffers of a recycled view are reused.
+        view->character_store_ = character_store_;
+        view->character_grid_ = character_grid_;
+        view->character_grid_dirty_ = character_grid_dirty_;
+        view->peer_characters_ = peer_characters_;
+        view->removed_characters_.assign(
+            removed_characters_.begin(),
+            removed_characters_.end());
+        view->removed_elements_.assign(
+            removed_elements_.begin(),
+            removed_elements_.end());
+        view->handoffs_.assign(handoffs_.begin(), handoffs_.end());
+        view_.store(std::move(view));
+    }
+
+    void WorldState::PublishElementsLocked() {
+        element_store_.EnableJournal(JournalEnum::JOURNAL_MIRROR, false);
+        element_store_.TakeJournal(
+            JournalEnum::JOURNAL_MIRROR,
+            mirror_changed_handles_,
+            mirror_removed_entities_);
+        // Every mirror missed the changes, the free one catches up.
+        ElementMirror* free_mirror = nullptr;
+        for (auto& mirror : element_mirrors_) {
+            if (!mirror.is_full_copy) {
+                mirror.changed_handles.insert(
+                    mirror.changed_handles.end(),
+                    mirror_changed_handles_.begin(),
+                    mirror_changed_handles_.end());
+                if (mirror.changed_handles.size() > element_store_.Size()) {
+                    mirror.changed_handles.clear();
+                    mirror.is_full_copy = true;
+                }
+            }
+            if (!free_mirror && mirror.elements.use_count() == 1) {
+                // See the reads of its last reader done.
+                std::atomic_thread_fence(std::memory_order_acquire);
+                free_mirror = &mirror;
+            }
+        }
+        if (!free_mirror) {
+            if (element_mirrors_.size() >= ELEMENT_MIRROR_COUNT) {
+                // Slow readers hold them all, copy without keeping it.
+                auto elements = std::make_shared<WorldView::Elements>();
+                elements->store.Mirror(element_store_);
+                elements->grid = element_grid_;
+                elements->grid_dirty = element_grid_dirty_;
+                elements->version = element_store_.GetVersion();
+                published_elements_ = std::move(elements);
+                return;
+            }
+            element_mirrors_.push_back(
+                { std::make_shared<WorldView::Elements>() });
+            free_mirror = &element_mirrors_.back();
+        }
+        auto& elements = *free_mirror->elements;
+        if (free_mirror->is_full_copy) {
+            elements.store.Mirror(element_store_);
+        }
+        else {
+            elements.store.MirrorRows(
+                element_store_,
+                free_mirror->changed_handles);
+        }
+        free_mirror->changed_handles.clear();
+        free_mirror->is_full_copy = false;
+        // Copy assignment, the buffers of the grid are reused.
+        elements.grid = element_grid_;
+        elements.grid_dirty = element_grid_dirty_;
+        elements.version = element_store_.GetVersion();
+        published_elements_ = free_mirror->elements;
     }
 
     bool WorldState::operator==(const WorldState& other) const {
         if (last_updated_ != other.last_updated_) {
             return false;
         }
-        if (character_infos_.size() != other.character_infos_.size()) {
+        if (character_store_.Size() != other.character_store_.Size()) {
             return false;
         }
-        if (element_infos_.size() != other.element_infos_.size()) {
+        if (element_store_.Size() != other.element_store_.Size()) {
             return false;
         }
-        for (size_t i = 0; i < characters_.size(); ++i) {
-            if (!(characters_[i] == other.characters_[i])) {
+        // Rows can be in a different order, match them by name.
+        for (std::size_t i = 0; i < character_store_.Size(); ++i) {
+            auto maybe_index = other.character_store_.FindIndex(
+                character_store_.GetNames()[i]);
+            if (!maybe_index ||
+                !(character_store_.GetCharacter(i) ==
+                    other.character_store_.GetCharacter(*maybe_index)))
+            {
                 return false;
             }
         }
-        for (size_t i = 0; i < elements_.size(); ++i) {
-            if (!(elements_[i] == other.elements_[i])) {
+        for (std::size_t i = 0; i < element_store_.Size(); ++i) {
+            auto maybe_index = other.element_store_.FindIndex(
+                element_store_.GetNames()[i]);
+            if (!maybe_index ||
+                !(element_store_.GetElement(i) ==
+                    other.element_store_.GetElement(*maybe_index)))
+            {
                 return false;
             }
         }
         return true;
     }
 
-    void WorldState::SetCharacterHits(
-        const std::map<proto::Character, std::string>& character_hits)
-    {
+    void WorldState::SetCharacterHits(std::span<const HitEvent> hits) {
         std::scoped_lock l(mutex_);
-        character_hits_.clear();
-        character_hits_ = character_hits;
+        if (server_hit_detection_) {
+            // Hits are detected in Update.
+            return;
+        }
+        character_hits_.insert(
+            character_hits_.end(),
+            hits.begin(),
+            hits.end());
+        // Keep the first report of a pair, then sort in resolution order
+        // (in place, the buffer is reused from tick to tick).
+        std::sort(
+            character_hits_.begin(),
+            character_hits_.end(),
+            [](const HitEvent& left, const HitEvent& right) {
+                return std::tie(left.eater, left.target, left.sequence) <
+                    std::tie(right.eater, right.target, right.sequence);
+            });
+        character_hits_.erase(
+            std::unique(
+                character_hits_.begin(),
+                character_hits_.end(),
+                [](const HitEvent& left, const HitEvent& right) {
+                    return left.eater == right.eater &&
+                        left.target == right.target;
+                }),
+            character_hits_.end());
+        std::sort(
+            character_hits_.begin(),
+            character_hits_.end(),
+            [](const HitEvent& left, const HitEvent& right) {
+                return std::tie(left.sequence, left.eater, left.target) <
+                    std::tie(right.sequence, right.eater, right.target);
+            });
     }
 
 }  // End namespace darwin.
@@ -1,12 +1,35 @@
 #pragma once
 
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <span>
+#include <string_view>
+
+#include "Common/darwin_constant.h"
 #include "Common/darwin_service.grpc.pb.h"
 #include "Common/stl_proto_wrapper.h"
 #include "Server/element_info.h"
 #include "Server/character_info.h"
+#include "Server/entity_store.h"
+#include "Server/sphere_grid.h"
+#include "Server/task_graph.h"
+#include "Server/tick_profiler.h"
+#include "Server/worker_pool.h"
+#include "Server/world_region.h"
+#include "Server/world_view.h"
 
 namespace darwin {
 
+    // Potential hit of a character (eater) on an upgrade or a character
+    // (target), the sequence orders the hits of a tick (the order the tick
+    // drained their reports, so that a replay resolves them alike).
+    struct HitEvent {
+        EntityHandle eater;
+        EntityHandle target;
+        std::uint64_t sequence;
+    };
+
     class WorldState {
     public:
         bool CreateCharacter(
@@ -29,62 +52,224 @@ namespace darwin {
             const std::string& name,
             proto::StatusEnum status,
             const proto::Physic& physic);
+        // Update the physic and status of many characters (reported by
+        // their clients) at once, this also count as a ping.
+        void UpdateCharacters(const std::vector<proto::Character>& characters);
+        // Fill the simulated part of the characters (by name) from the
+        // store, the ones not in game anymore are dropped.
+        void GetCharacterInputStates(
+            std::vector<CharacterInputState>& states) const;
+        // Write the simulated characters back (minus their mass cost), this
+        // also count as a ping.
+        void SetCharacterInputStates(
+            std::span<const CharacterInputState> states);
+        // Physic of the ground elements.
+        std::vector<PhysicState> GetGroundStates() const;
         void AddElement(const proto::Element& element);
+        // Add (or replace by name) the elements in bulk under one lock, the
+        // name of rows[i] is names[i].
+        void AddElementRows(
+            std::span<const ElementRow> rows,
+            std::span<const std::string_view> names);
+        void GetElementRows(
+            std::vector<ElementRow>& rows,
+            std::vector<std::string>& names) const;
+        // Bring a copy of the elements up to date with the changes since
+        // the previous call (a full copy the first time), O(changed).
+        void CaptureElementChanges(EntityStore& elements);
+        // Fill the entry with the changes since the previous call (nothing
+        // before the first call), with every character if all_characters.
+        void CaptureJournalEntry(
+            proto::WorldJournalEntry& entry,
+            bool all_characters);
+        // Replay a journal entry, the characters are restored without a
+        // peer until a player creates a character with the same name.
+        void ApplyJournalEntry(const proto::WorldJournalEntry& entry);
         void SetPlayerParameter(const proto::PlayerParameter& parameter);
         void Update(double time);
         double GetLastUpdated() const;
         bool operator==(const WorldState& other) const;
         proto::Element GetPlanet() const;
-        void SetCharacterHits(
-            const std::map<proto::Character, std::string>& character_hits);
+        // Add the hits reported by the clients (ignored when the server
+        // detects them), resolved by the next Update in (sequence, eater,
+        // target) order, a same eater and target pair only once.
+        void SetCharacterHits(std::span<const HitEvent> hits);
         void UpdatePing(const std::string& name);
+        // Detect the hits on the server (broad phase on a sphere grid) and
+        // ignore the potential hits reported by the clients.
+        void SetServerHitDetection(bool server_hit_detection);
+        // Oldest baseline (in sequences) a delta can be built against, an
+        // older baseline get a full update.
+        void SetDeltaHistory(std::uint64_t delta_history);
+        std::uint64_t GetSequence() const;
+        // Time the phases of Update (nullptr to disable).
+        void SetTickProfiler(TickProfiler* tick_profiler);
+        // Run the phases of Update on a worker pool (nullptr to run them on
+        // the calling thread), the pool must outlive its use.
+        void SetWorkerPool(WorkerPool* worker_pool);
+        // Own only the entities of a region of the world (nullptr for the
+        // whole world), the upgrades are placed in it. Set before the
+        // upgrades, the region must outlive its use.
+        void SetWorldRegion(const WorldRegion* world_region);
+        // Take the characters that left the region (handed off, if
+        // is_handoff) and copy the entities within mirror_angle (in radians)
+        // of another region, in one request by region (indexed by region).
+        // Without handoff a character that left stays here with its player
+        // and is mirrored to the region it is in.
+        void CaptureRegionExchanges(
+            double mirror_angle,
+            bool is_handoff,
+            std::vector<proto::RegionExchangeRequest>& requests);
+        // Add the characters handed off by another region (their player
+        // takes them back by creating them again) and replace the mirrors of
+        // that region. Mirrors are sent to the clients but are never hit,
+        // checked or created here, their region owns them.
+        void ApplyRegionExchange(const proto::RegionExchangeRequest& request);
+        bool IsMirrored(const std::string& name) const;
 
     public:
-        proto::PlayerParameter GetPlayerParameter() const {
-            return player_parameter_;
-        }
-        const std::vector<proto::Character>& GetCharacters() const {
-            return characters_;
-        }
-        const std::vector<proto::Element>& GetElements() const {
-            return elements_;
-        }
+        proto::PlayerParameter GetPlayerParameter() const;
+        // Build the protos from the entity stores (copy).
+        std::vector<proto::Character> GetCharacters() const;
+        std::vector<proto::Element> GetElements() const;
+        // View published by the last tick (and by SetPlayerParameter), read
+        // without a lock. The other changes show at the next tick.
+        std::shared_ptr<const WorldView> GetView() const;
+        // Same as on the view (see WorldView).
+        void FillUpdateResponse(
+            proto::UpdateResponse& response,
+            std::uint64_t baseline_sequence = 0) const;
+        std::optional<std::vector<EntityHandle>> GetVisibleHandles(
+            const std::string& peer,
+            double angle) const;
+        void FillVisibleUpdateResponse(
+            proto::UpdateResponse& response,
+            const std::vector<EntityHandle>& visible,
+            std::uint64_t baseline_sequence = 0,
+            const std::vector<EntityHandle>& baseline_visible = {}) const;
 
     private:
+        // Throws once every handle was given out (they are never reused).
+        EntityHandle NextHandleLocked();
         void AddRandomElementsLocked(std::uint32_t number);
         std::string RemovePeerLocked(const std::string& peer);
+        void RemoveCharacterLocked(const std::string& name);
+        void RemoveCharacterHandleLocked(EntityHandle handle);
+        void RemoveElementHandleLocked(EntityHandle handle);
+        void SetCharacterStatusLocked(
+            std::size_t index,
+            proto::StatusEnum status);
+        void RemovePeerOfCharacterLocked(std::size_t index);
         void CheckStillInUseCharactersLocked();
-        void CheckGroundCharactersLocked();
-        void CheckDeathCharactersLocked();
-        void CheckVictoryCharactersLocked();
+        // The checks of the characters [begin, end) only write their own
+        // rows of the tick flags, ApplyCharacterChecksLocked applies them in
+        // row order (the change journals are not thread safe).
+        void CheckGroundCharactersLocked(
+            double ground_radius,
+            std::size_t begin,
+            std::size_t end);
+        void CheckDeathCharactersLocked(std::size_t begin, std::size_t end);
+        void CheckVictoryCharactersLocked(std::size_t begin, std::size_t end);
+        void ApplyCharacterChecksLocked();
+        std::size_t GetPlanetIndexLocked() const;
         proto::Element GetPlanetLocked() const;
-        void FillVectorsLocked();
+        void BuildElementGridLocked();
+        void BuildCharacterGridLocked();
+        void BuildGridsLocked();
+        // Copy the state to a view and swap it in for the readers.
+        void PublishViewLocked();
+        // Bring a free element mirror up to date (by row) and share it.
+        void PublishElementsLocked();
+        // Hits of the characters [begin, end) in their chunk of the hit
+        // chunks, gathered in row order by GatherHitsLocked.
+        void DetectHitsLocked(std::size_t begin, std::size_t end);
+        void GatherHitsLocked();
         void CheckIntersectPlayerLocked();
+        bool IsMirroredLocked(EntityHandle handle) const;
+        // Row indices of the eater (character store) and of the target
+        // (element or character store).
         struct FromTo {
-            std::string name_from;
-            std::string name_to;
-            proto::Physic physic_from;
-            proto::Physic physic_to;
-            proto::Vector3 color_from;
-            proto::Vector3 color_to;
+            std::size_t index_from;
+            std::size_t index_to;
         };
         void ChangeSourceEatUpgradeLocked(const FromTo& from_to);
         void ChangeSourceEatCharacterLocked(const FromTo& from_to);
         void LostSourceElementLocked(const FromTo& from_to);
         void LostSourceCharacterLocked(const FromTo& from_to);
+        void SetCharacterMassLocked(std::size_t index, double mass);
 
     private:
         mutable std::mutex mutex_;
-        std::map<std::string, proto::Character> character_infos_;
-        std::map<std::string, double> last_seen_;
-        std::map<std::string, proto::Element> element_infos_;
-        std::map<std::string, std::string> peer_characters_;
+        EntityStore character_store_;
+        EntityStore element_store_;
+        // Peer against the handle of the character it owns.
+        std::map<std::string, EntityHandle> peer_characters_;
+        EntityHandle next_handle_ = INVALID_ENTITY_HANDLE + 1;
+        // Names the upgrades (by world, so that a replay names them alike).
+        std::uint64_t next_upgrade_number_ = 0;
         double last_updated_ = 0.0;
-        std::vector<proto::Character> characters_;
-        std::vector<proto::Element> elements_;
         proto::PlayerParameter player_parameter_;
-        std::map<proto::Character, std::string> character_hits_;
+        // Potential hits of the next Update, consumed by it.
+        std::vector<HitEvent> character_hits_;
+        // Upgrades eaten by the hits of a tick, and the same as a flag by
+        // element row.
+        std::vector<EntityHandle> eaten_elements_;
+        std::vector<std::uint8_t> eaten_flags_;
         std::uint32_t element_max_number_ = 0;
+        bool server_hit_detection_ = true;
+        TickProfiler* tick_profiler_ = nullptr;
+        WorkerPool* worker_pool_ = nullptr;
+        // Phases of Update, rebuilt every tick.
+        TaskGraph task_graph_;
+        // Tick flags by character row: the changes of the ground check,
+        // dead and victorious characters.
+        std::vector<std::uint8_t> ground_flags_;
+        std::vector<std::uint8_t> dead_flags_;
+        std::vector<std::uint8_t> victory_flags_;
+        struct HitChunk {
+            std::vector<std::uint32_t> grid_cells;
+            std::vector<HitEvent> hits;
+        };
+        std::vector<HitChunk> hit_chunks_;
+        // Grids over the elements but the planets (rebuilt only when they
+        // change) and over the characters (rebuilt every tick). A dirty grid
+        // is never queried, a clean one can miss rows added after its build.
+        SphereGrid element_grid_{ ALMOST_INTERSECT_ANGLE };
+        SphereGrid character_grid_{ ALMOST_INTERSECT_ANGLE };
+        bool element_grid_dirty_ = true;
+        bool character_grid_dirty_ = true;
+        // Last published sequence, changes are stamped with the next one.
+        std::uint64_t sequence_ = 0;
+        std::uint64_t delta_history_ = 100;
+        using Removal = WorldView::Removal;
+        std::deque<Removal> removed_characters_;
+        std::deque<Removal> removed_elements_;
+        const WorldRegion* world_region_ = nullptr;
+        // Region of the mirrored entities (characters or elements).
+        std::map<EntityHandle, std::uint32_t> mirrored_;
+        std::deque<WorldView::Handoff> handoffs_;
+        // Scratch of CaptureRegionExchanges.
+        std::vector<std::uint32_t> regions_;
+        std::atomic<std::shared_ptr<const WorldView>> view_{
+            std::make_shared<const WorldView>() };
+        // Views that can be reused once no reader holds them.
+        std::vector<std::shared_ptr<WorldView>> recycled_views_;
+        // Parts of the views that are shared until they change.
+        std::shared_ptr<const proto::PlayerParameter>
+            published_player_parameter_ =
+                std::make_shared<const proto::PlayerParameter>();
+        std::shared_ptr<const WorldView::Elements> published_elements_;
+        // Element copies patched with the changes they missed, reused once
+        // no view holds them.
+        struct ElementMirror {
+            std::shared_ptr<WorldView::Elements> elements;
+            std::vector<EntityHandle> changed_handles;
+            bool is_full_copy = true;
+        };
+        std::vector<ElementMirror> element_mirrors_;
+        // Scratch of PublishElementsLocked.
+        std::vector<EntityHandle> mirror_changed_handles_;
+        std::vector<RemovedEntity> mirror_removed_entities_;
     };
 
 }  // namespace darwin.
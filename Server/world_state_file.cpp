@@ -6,8 +6,7 @@
 
 namespace darwin {
 
-    void SaveWorldStateToString(
-        std::string& json, 
+    proto::WorldDatabase SaveWorldStateToDatabase(
         const WorldState& world_state)
     {
         proto::WorldDatabase world;
@@ -22,7 +21,14 @@ namespace darwin {
         }
         world.mutable_player_parameter()->CopyFrom(
             world_state.GetPlayerParameter());
-        json = SaveProtoToJson(world);
+        return world;
+    }
+
+    void SaveWorldStateToString(
+        std::string& json, 
+        const WorldState& world_state)
+    {
+        json = SaveProtoToJson(SaveWorldStateToDatabase(world_state));
     }
 
     void LoadWorldStateFromString(
@@ -69,19 +75,7 @@ namespace darwin {
         const WorldState& world_state,
         const std::filesystem::path filename)
     {
-        proto::WorldDatabase world;
-        world.set_time(world_state.GetLastUpdated());
-        for (const auto& character : world_state.GetCharacters())
-        {
-            *world.add_characters() = character;
-        }
-        for (const auto& element : world_state.GetElements())
-        {
-            *world.add_elements() = element;
-        }
-        world.mutable_player_parameter()->CopyFrom(
-            world_state.GetPlayerParameter());
-        SaveProtoToJsonFile(world, filename);
+        SaveProtoToJsonFile(SaveWorldStateToDatabase(world_state), filename);
     }
 
 } // namespace darwin.
@@ -6,6 +6,9 @@
 
 namespace darwin {
 
+    proto::WorldDatabase SaveWorldStateToDatabase(
+        const WorldState& world_state);
+
     void SaveWorldStateToString(
         std::string& json, 
         const WorldState& world_state);
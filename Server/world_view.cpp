@@ -0,0 +1,368 @@
+#include "world_view.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+namespace darwin {
+
+    WorldView::WorldView() :
+        player_parameter_(std::make_shared<const proto::PlayerParameter>()),
+        elements_(std::make_shared<const Elements>())
+    {
+    }
+
+    std::optional<proto::Character> WorldView::GetCharacterOwnedByPeer(
+        const std::string& peer,
+        const std::string& character_name) const
+    {
+        auto it = peer_characters_.find(peer);
+        if (it != peer_characters_.end()) {
+            auto maybe_index = character_store_.FindIndex(it->second);
+            if (maybe_index) {
+                return character_store_.GetCharacter(*maybe_index);
+            }
+        }
+        return std::nullopt;
+    }
+
+    std::optional<EntityHandle> WorldView::FindHandle(
+        std::string_view name) const
+    {
+        if (auto maybe_index = character_store_.FindIndex(name)) {
+            return character_store_.GetHandles()[*maybe_index];
+        }
+        const auto& element_store = elements_->store;
+        if (auto maybe_index = element_store.FindIndex(name)) {
+            return element_store.GetHandles()[*maybe_index];
+        }
+        return std::nullopt;
+    }
+
+    std::vector<proto::Character> WorldView::GetCharacters() const {
+        std::vector<proto::Character> characters;
+        characters.reserve(character_store_.Size());
+        for (std::size_t i = 0; i < character_store_.Size(); ++i) {
+            characters.push_back(character_store_.GetCharacter(i));
+        }
+        return characters;
+    }
+
+    std::vector<proto::Element> WorldView::GetElements() const {
+        const auto& element_store = elements_->store;
+        std::vector<proto::Element> elements;
+        elements.reserve(element_store.Size());
+        for (std::size_t i = 0; i < element_store.Size(); ++i) {
+            elements.push_back(element_store.GetElement(i));
+        }
+        return elements;
+    }
+
+    void WorldView::FillUpdateResponse(
+        proto::UpdateResponse& response,
+        std::uint64_t baseline_sequence,
+        WireIdEnum wire_id) const
+    {
+        const auto& element_store = elements_->store;
+        response.set_sequence(sequence_);
+        if (IsDeltaBaseline(baseline_sequence)) {
+            response.set_baseline_sequence(baseline_sequence);
+            for (const auto& removal : removed_characters_) {
+                if (removal.sequence > baseline_sequence) {
+                    AddRemovedCharacter(
+                        removal.handle,
+                        removal.name,
+                        response,
+                        wire_id);
+                }
+            }
+            for (const auto& removal : removed_elements_) {
+                if (removal.sequence > baseline_sequence) {
+                    AddRemovedElement(
+                        removal.handle,
+                        removal.name,
+                        response,
+                        wire_id);
+                }
+            }
+            AddHandoffs(response, baseline_sequence);
+            proto::Character character;
+            for (std::size_t i = 0; i < character_store_.Size(); ++i) {
+                if (character_store_.FillCharacterDelta(
+                    i,
+                    baseline_sequence,
+                    character,
+                    wire_id))
+                {
+                    response.add_characters()->Swap(&character);
+                    character.Clear();
+                }
+            }
+            proto::Element element;
+            for (std::size_t i = 0; i < element_store.Size(); ++i) {
+                if (element_store.FillElementDelta(
+                    i,
+                    baseline_sequence,
+                    element,
+                    wire_id))
+                {
+                    response.add_elements()->Swap(&element);
+                    element.Clear();
+                }
+            }
+            return;
+        }
+        response.set_baseline_sequence(0);
+        AddHandoffs(response, 0);
+        auto* characters = response.mutable_characters();
+        characters->Reserve(static_cast<int>(character_store_.Size()));
+        // A full update introduces every entity (name and handle).
+        const bool by_handle = wire_id == WireIdEnum::WIRE_ID_HANDLE;
+        for (std::size_t i = 0; i < character_store_.Size(); ++i) {
+            auto& character = *characters->Add();
+            character_store_.FillCharacter(i, character);
+            if (by_handle) {
+                character.set_handle(character_store_.GetHandles()[i]);
+            }
+        }
+        auto* elements = response.mutable_elements();
+        elements->Reserve(static_cast<int>(element_store.Size()));
+        for (std::size_t i = 0; i < element_store.Size(); ++i) {
+            auto& element = *elements->Add();
+            element_store.FillElement(i, element);
+            if (by_handle) {
+                element.set_handle(element_store.GetHandles()[i]);
+            }
+        }
+    }
+
+    bool WorldView::IsDeltaBaseline(std::uint64_t baseline_sequence) const {
+        return
+            baseline_sequence != 0 &&
+            baseline_sequence <= sequence_ &&
+            baseline_sequence + delta_history_ >= sequence_;
+    }
+
+    std::optional<std::vector<EntityHandle>> WorldView::GetVisibleHandles(
+        const std::string& peer,
+        double angle) const
+    {
+        auto it = peer_characters_.find(peer);
+        if (it == peer_characters_.end()) {
+            return std::nullopt;
+        }
+        auto maybe_index = character_store_.FindIndex(it->second);
+        if (!maybe_index ||
+            character_store_.GetStatuses()[*maybe_index] ==
+                proto::STATUS_DEAD)
+        {
+            return std::nullopt;
+        }
+        const glm::dvec3 normal =
+            glm::normalize(character_store_.GetPositions()[*maybe_index]);
+        const double min_dot = std::cos(angle);
+        const auto& element_store = elements_->store;
+        std::vector<EntityHandle> handles;
+        // Planets are always visible.
+        const auto& element_types = element_store.GetTypes();
+        for (std::size_t i = 0; i < element_types.size(); ++i) {
+            if (element_types[i] == proto::TYPE_GROUND) {
+                handles.push_back(element_store.GetHandles()[i]);
+            }
+        }
+        std::vector<std::uint32_t> cells;
+        auto add_visible = [&](
+            const EntityStore& store,
+            const SphereGrid& grid,
+            bool grid_dirty,
+            auto include)
+        {
+            const auto& positions = store.GetPositions();
+            auto add_row = [&](std::size_t i) {
+                if (include(i) &&
+                    glm::dot(glm::normalize(positions[i]), normal) > min_dot)
+                {
+                    handles.push_back(store.GetHandles()[i]);
+                }
+            };
+            if (grid_dirty) {
+                for (std::size_t i = 0; i < positions.size(); ++i) {
+                    add_row(i);
+                }
+                return;
+            }
+            grid.GetCellsInCap(normal, angle, cells);
+            for (const auto cell : cells) {
+                for (const auto i : grid.GetCellItems(cell)) {
+                    add_row(i);
+                }
+            }
+            // Rows added after the grid was built.
+            for (std::size_t i = grid.GetRowCount(); i < positions.size(); ++i)
+            {
+                add_row(i);
+            }
+        };
+        add_visible(
+            element_store,
+            elements_->grid,
+            elements_->grid_dirty,
+            [&element_types](std::size_t i) {
+                return element_types[i] != proto::TYPE_GROUND;
+            });
+        const auto& statuses = character_store_.GetStatuses();
+        add_visible(
+            character_store_,
+            character_grid_,
+            character_grid_dirty_,
+            [&statuses](std::size_t i) {
+                return statuses[i] != proto::STATUS_DEAD;
+            });
+        std::sort(handles.begin(), handles.end());
+        return handles;
+    }
+
+    void WorldView::FillVisibleUpdateResponse(
+        proto::UpdateResponse& response,
+        const std::vector<EntityHandle>& visible,
+        std::uint64_t baseline_sequence,
+        const std::vector<EntityHandle>& baseline_visible,
+        WireIdEnum wire_id) const
+    {
+        const auto& element_store = elements_->store;
+        response.set_sequence(sequence_);
+        const bool is_delta = IsDeltaBaseline(baseline_sequence);
+        response.set_baseline_sequence(is_delta ? baseline_sequence : 0);
+        AddHandoffs(response, is_delta ? baseline_sequence : 0);
+        for (const auto handle : visible) {
+            // Sent in full if the client didn't have it at the baseline.
+            const std::uint64_t sequence =
+                (is_delta && std::binary_search(
+                    baseline_visible.begin(),
+                    baseline_visible.end(),
+                    handle)) ? baseline_sequence : 0;
+            if (auto maybe_index = character_store_.FindIndex(handle)) {
+                proto::Character character;
+                if (character_store_.FillCharacterDelta(
+                    *maybe_index,
+                    sequence,
+                    character,
+                    wire_id))
+                {
+                    response.add_characters()->Swap(&character);
+                }
+            }
+            else if (auto maybe_index = element_store.FindIndex(handle)) {
+                proto::Element element;
+                if (element_store.FillElementDelta(
+                    *maybe_index,
+                    sequence,
+                    element,
+                    wire_id))
+                {
+                    response.add_elements()->Swap(&element);
+                }
+            }
+        }
+        if (!is_delta) {
+            return;
+        }
+        std::vector<EntityHandle> removed;
+        std::set_difference(
+            baseline_visible.begin(),
+            baseline_visible.end(),
+            visible.begin(),
+            visible.end(),
+            std::back_inserter(removed));
+        for (const auto handle : removed) {
+            AddRemoved(handle, response, wire_id);
+        }
+    }
+
+    void WorldView::AddHandoffs(
+        proto::UpdateResponse& response,
+        std::uint64_t baseline_sequence) const
+    {
+        for (const auto& handoff : handoffs_) {
+            if (handoff.sequence > baseline_sequence) {
+                auto* added = response.add_handoffs();
+                added->set_name(handoff.name);
+                added->set_server_name(handoff.server_name);
+            }
+        }
+    }
+
+    void WorldView::AddRemoved(
+        EntityHandle handle,
+        proto::UpdateResponse& response,
+        WireIdEnum wire_id) const
+    {
+        const auto& element_store = elements_->store;
+        if (auto maybe_index = character_store_.FindIndex(handle)) {
+            AddRemovedCharacter(
+                handle,
+                character_store_.GetNames()[*maybe_index],
+                response,
+                wire_id);
+            return;
+        }
+        if (auto maybe_index = element_store.FindIndex(handle)) {
+            AddRemovedElement(
+                handle,
+                element_store.GetNames()[*maybe_index],
+                response,
+                wire_id);
+            return;
+        }
+        // Not in the world anymore.
+        for (const auto& removal : removed_characters_) {
+            if (removal.handle == handle) {
+                AddRemovedCharacter(
+                    removal.handle,
+                    removal.name,
+                    response,
+                    wire_id);
+                return;
+            }
+        }
+        for (const auto& removal : removed_elements_) {
+            if (removal.handle == handle) {
+                AddRemovedElement(
+                    removal.handle,
+                    removal.name,
+                    response,
+                    wire_id);
+                return;
+            }
+        }
+    }
+
+    void WorldView::AddRemovedCharacter(
+        EntityHandle handle,
+        const std::string& name,
+        proto::UpdateResponse& response,
+        WireIdEnum wire_id) const
+    {
+        if (wire_id == WireIdEnum::WIRE_ID_HANDLE) {
+            response.add_removed_character_handles(handle);
+        }
+        else {
+            response.add_removed_characters(name);
+        }
+    }
+
+    void WorldView::AddRemovedElement(
+        EntityHandle handle,
+        const std::string& name,
+        proto::UpdateResponse& response,
+        WireIdEnum wire_id) const
+    {
+        if (wire_id == WireIdEnum::WIRE_ID_HANDLE) {
+            response.add_removed_element_handles(handle);
+        }
+        else {
+            response.add_removed_elements(name);
+        }
+    }
+
+}  // End namespace darwin.
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Common/darwin_constant.h"
+#include "Common/darwin_service.pb.h"
+#include "Server/entity_store.h"
+#include "Server/sphere_grid.h"
+
+namespace darwin {
+
+    // Immutable copy of a world published by its tick (read-copy-update).
+    // Readers take a reference to the last published view and read it with
+    // no lock while the tick keeps the mutable state to itself, a view stays
+    // alive until its last reader lets go of it.
+    class WorldView {
+    public:
+        struct Removal {
+            std::uint64_t sequence;
+            EntityHandle handle;
+            std::string name;
+        };
+        struct Handoff {
+            std::uint64_t sequence;
+            std::string name;
+            std::string server_name;
+        };
+
+    public:
+        WorldView();
+        // Time and sequence of the tick that published the view.
+        double GetTime() const { return time_; }
+        std::uint64_t GetSequence() const { return sequence_; }
+        const proto::PlayerParameter& GetPlayerParameter() const {
+            return *player_parameter_;
+        }
+        std::optional<proto::Character> GetCharacterOwnedByPeer(
+            const std::string& peer,
+            const std::string& character_name) const;
+        // Handle of the character (or else the element) with that name.
+        std::optional<EntityHandle> FindHandle(std::string_view name) const;
+        // Build the protos from the entity stores (copy).
+        std::vector<proto::Character> GetCharacters() const;
+        std::vector<proto::Element> GetElements() const;
+        // Fill the characters and elements of an update response directly
+        // from the entity stores, everything if the baseline sequence is 0
+        // or too old, only what changed after the baseline otherwise. By
+        // handle, the removed entities are listed by handle too.
+        void FillUpdateResponse(
+            proto::UpdateResponse& response,
+            std::uint64_t baseline_sequence = 0,
+            WireIdEnum wire_id = WireIdEnum::WIRE_ID_NAME) const;
+        // Sorted handles of the entities within angle (in radians) of the
+        // character owned by the peer, plus the planets. Nothing if the peer
+        // has no living character (it sees everything).
+        std::optional<std::vector<EntityHandle>> GetVisibleHandles(
+            const std::string& peer,
+            double angle) const;
+        // Same as FillUpdateResponse limited to the visible entities. The
+        // entities that were visible at the baseline and are not anymore are
+        // sent as removed, the newly visible ones are sent in full.
+        void FillVisibleUpdateResponse(
+            proto::UpdateResponse& response,
+            const std::vector<EntityHandle>& visible,
+            std::uint64_t baseline_sequence = 0,
+            const std::vector<EntityHandle>& baseline_visible = {},
+            WireIdEnum wire_id = WireIdEnum::WIRE_ID_NAME) const;
+
+    private:
+        // Filled by WorldState::PublishViewLocked.
+        friend class WorldState;
+        bool IsDeltaBaseline(std::uint64_t baseline_sequence) const;
+        void AddRemoved(
+            EntityHandle handle,
+            proto::UpdateResponse& response,
+            WireIdEnum wire_id) const;
+        void AddRemovedCharacter(
+            EntityHandle handle,
+            const std::string& name,
+            proto::UpdateResponse& response,
+            WireIdEnum wire_id) const;
+        void AddRemovedElement(
+            EntityHandle handle,
+            const std::string& name,
+            proto::UpdateResponse& response,
+            WireIdEnum wire_id) const;
+        // Handoffs after the baseline (all of them for a full update).
+        void AddHandoffs(
+            proto::UpdateResponse& response,
+            std::uint64_t baseline_sequence) const;
+        // The elements change seldom, views share them until they do.
+        struct Elements {
+            EntityStore store;
+            SphereGrid grid{ ALMOST_INTERSECT_ANGLE };
+            bool grid_dirty = true;
+            std::uint64_t version = 0;
+        };
+
+    private:
+        double time_ = 0.0;
+        std::uint64_t sequence_ = 0;
+        std::uint64_t delta_history_ = 0;
+        std::shared_ptr<const proto::PlayerParameter> player_parameter_;
+        EntityStore character_store_;
+        SphereGrid character_grid_{ ALMOST_INTERSECT_ANGLE };
+        bool character_grid_dirty_ = true;
+        std::shared_ptr<const Elements> elements_;
+        std::map<std::string, EntityHandle> peer_characters_;
+        std::vector<Removal> removed_characters_;
+        std::vector<Removal> removed_elements_;
+        std::vector<Handoff> handoffs_;
+    };
+
+}  // End namespace darwin.
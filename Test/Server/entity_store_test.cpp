@@ -0,0 +1,183 @@
+#include "Test/Server/entity_store_test.h"
+
+#include <string>
+
+#include "Common/stl_proto_wrapper.h"
+#include "Common/vector.h"
+
+namespace test {
+
+    void EntityStoreTest::PopulateEntityStore() {
+        entity_store_.Add(
+            1,
+            darwin::CreateBasicElement(
+                "element1",
+                proto::TYPE_GROUND,
+                darwin::CreateVector3(1.0, 2.0, 3.0),
+                1.0,
+                1.0));
+        entity_store_.Add(
+            2,
+            darwin::CreateBasicElement(
+                "element2",
+                proto::TYPE_UPGRADE,
+                darwin::CreateVector3(4.0, 5.0, 6.0),
+                2.0,
+                2.0));
+        entity_store_.Add(
+            3,
+            darwin::CreateBasicElement(
+                "element3",
+                proto::TYPE_UPGRADE,
+                darwin::CreateVector3(7.0, 8.0, 9.0),
+                3.0,
+                3.0));
+    }
+
+    TEST_F(EntityStoreTest, EntityStoreTestAddAndFind) {
+        PopulateEntityStore();
+        EXPECT_EQ(entity_store_.Size(), 3);
+        auto maybe_index = entity_store_.FindIndex("element2");
+        ASSERT_TRUE(maybe_index);
+        EXPECT_EQ(entity_store_.FindIndex(2), maybe_index);
+        auto element = entity_store_.GetElement(*maybe_index);
+        EXPECT_EQ(element.name(), "element2");
+        EXPECT_EQ(element.type_enum(), proto::TYPE_UPGRADE);
+        EXPECT_EQ(element.physic().mass(), 2.0);
+        EXPECT_EQ(element.physic().position().y(), 5.0);
+        EXPECT_FALSE(entity_store_.FindIndex("element4"));
+    }
+
+    TEST_F(EntityStoreTest, EntityStoreTestRemoveKeepHandles) {
+        PopulateEntityStore();
+        entity_store_.Remove(1);
+        EXPECT_EQ(entity_store_.Size(), 2);
+        EXPECT_FALSE(entity_store_.FindIndex(1));
+        EXPECT_FALSE(entity_store_.FindIndex("element1"));
+        // The last row took the place of the removed one.
+        auto maybe_index = entity_store_.FindIndex(3);
+        ASSERT_TRUE(maybe_index);
+        auto element = entity_store_.GetElement(*maybe_index);
+        EXPECT_EQ(element.name(), "element3");
+        EXPECT_EQ(element.physic().mass(), 3.0);
+        EXPECT_EQ(entity_store_.GetNames()[*maybe_index], "element3");
+    }
+
+    TEST_F(EntityStoreTest, EntityStoreTestCharacterRoundTrip) {
+        auto character = darwin::CreateBasicCharacter(
+            "character",
+            darwin::CreateVector3(1.0, -4.0, 2.0),
+            80.0,
+            1.0);
+        character.mutable_color()->CopyFrom(
+            darwin::CreateVector3(1.0, 0.0, 0.0));
+        character.mutable_physic()->mutable_position_dt()->CopyFrom(
+            darwin::CreateVector3(0.0, 0.0, 0.0));
+        character.mutable_normal()->CopyFrom(
+            darwin::CreateVector3(0.0, 1.0, 0.0));
+        character.mutable_g_force()->CopyFrom(
+            darwin::CreateVector3(0.0, -1.0, 0.0));
+        character.set_status_enum(proto::STATUS_ON_GROUND);
+        character.mutable_special_effect_boost()->set_special_state_enum(
+            proto::SPECIAL_STATE_ACTIVE);
+        auto index = entity_store_.Add(42, character);
+        EXPECT_TRUE(
+            google::protobuf::util::MessageDifferencer::Equals(
+                entity_store_.GetCharacter(index),
+                character));
+    }
+
+    TEST_F(EntityStoreTest, EntityStoreTestJournal) {
+        constexpr auto checkpoint = darwin::JournalEnum::JOURNAL_CHECKPOINT;
+        constexpr auto write_ahead =
+            darwin::JournalEnum::JOURNAL_WRITE_AHEAD;
+        PopulateEntityStore();
+        std::vector<darwin::EntityHandle> changed;
+        std::vector<darwin::RemovedEntity> removed;
+        entity_store_.TakeJournal(checkpoint, changed, removed);
+        EXPECT_TRUE(changed.empty());
+        // The existing rows count as added if asked.
+        entity_store_.EnableJournal(checkpoint, true);
+        entity_store_.EnableJournal(write_ahead, false);
+        entity_store_.TakeJournal(checkpoint, changed, removed);
+        EXPECT_EQ(changed, std::vector<darwin::EntityHandle>({ 1, 2, 3 }));
+        EXPECT_TRUE(removed.empty());
+        // Journaled once until taken, by journal.
+        entity_store_.MarkChanged(1, darwin::ChangeEnum::CHANGE_PHYSIC);
+        entity_store_.MarkChanged(1, darwin::ChangeEnum::CHANGE_STATUS);
+        entity_store_.Remove(1);
+        entity_store_.TakeJournal(checkpoint, changed, removed);
+        EXPECT_EQ(changed, std::vector<darwin::EntityHandle>({ 2 }));
+        ASSERT_EQ(removed.size(), 1);
+        EXPECT_EQ(removed[0].handle, 1);
+        EXPECT_EQ(removed[0].name, "element1");
+        entity_store_.TakeJournal(checkpoint, changed, removed);
+        EXPECT_TRUE(changed.empty());
+        EXPECT_TRUE(removed.empty());
+        entity_store_.TakeJournal(write_ahead, changed, removed);
+        EXPECT_EQ(changed, std::vector<darwin::EntityHandle>({ 2 }));
+        EXPECT_EQ(removed.size(), 1);
+    }
+
+    TEST_F(EntityStoreTest, EntityStoreTestMirror) {
+        constexpr auto mirror_journal = darwin::JournalEnum::JOURNAL_MIRROR;
+        PopulateEntityStore();
+        entity_store_.EnableJournal(mirror_journal, false);
+        darwin::EntityStore mirror;
+        mirror.Mirror(entity_store_);
+        auto expect_mirrored = [&] {
+            ASSERT_EQ(entity_store_.Size(), mirror.Size());
+            EXPECT_EQ(entity_store_.GetHandles(), mirror.GetHandles());
+            EXPECT_EQ(entity_store_.GetNames(), mirror.GetNames());
+            EXPECT_EQ(entity_store_.GetVersion(), mirror.GetVersion());
+            for (std::size_t i = 0; i < mirror.Size(); ++i) {
+                EXPECT_EQ(
+                    entity_store_.GetElement(i).SerializeAsString(),
+                    mirror.GetElement(i).SerializeAsString());
+                EXPECT_EQ(mirror.FindIndex(mirror.GetHandles()[i]), i);
+                EXPECT_EQ(mirror.FindIndex(mirror.GetNames()[i]), i);
+            }
+        };
+        expect_mirrored();
+        std::vector<darwin::EntityHandle> changed;
+        std::vector<darwin::RemovedEntity> removed;
+        auto add = [this](darwin::EntityHandle handle, double mass) {
+            entity_store_.Add(
+                handle,
+                darwin::CreateBasicElement(
+                    "element" + std::to_string(handle),
+                    proto::TYPE_UPGRADE,
+                    darwin::CreateVector3(mass, 0.0, 0.0),
+                    mass,
+                    1.0));
+        };
+        // Added, moved and changed rows, the mirror keeps the same order.
+        add(4, 4.0);
+        add(5, 5.0);
+        entity_store_.Remove(1);
+        entity_store_.GetMasses()[*entity_store_.FindIndex(2)] = 20.0;
+        entity_store_.MarkChanged(
+            *entity_store_.FindIndex(2),
+            darwin::ChangeEnum::CHANGE_PHYSIC);
+        entity_store_.Remove(3);
+        add(6, 6.0);
+        entity_store_.TakeJournal(mirror_journal, changed, removed);
+        mirror.MirrorRows(entity_store_, changed);
+        expect_mirrored();
+        EXPECT_FALSE(mirror.FindIndex(1));
+        EXPECT_FALSE(mirror.FindIndex("element3"));
+        // Shrinking, the rows left are only moved.
+        entity_store_.Remove(6);
+        entity_store_.Remove(2);
+        entity_store_.TakeJournal(mirror_journal, changed, removed);
+        mirror.MirrorRows(entity_store_, changed);
+        expect_mirrored();
+        EXPECT_FALSE(mirror.FindIndex("element2"));
+        // A mirror doesn't journal.
+        mirror.EnableJournal(mirror_journal, false);
+        mirror.TakeJournal(mirror_journal, changed, removed);
+        EXPECT_TRUE(changed.empty());
+        EXPECT_TRUE(removed.empty());
+    }
+
+} // namespace test.
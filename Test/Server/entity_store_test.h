@@ -0,0 +1,17 @@
+#pragma once
+
+#include "Server/entity_store.h"
+#include <gtest/gtest.h>
+
+namespace test {
+
+    class EntityStoreTest : public testing::Test {
+    public:
+        EntityStoreTest() = default;
+        void PopulateEntityStore();
+
+    protected:
+        darwin::EntityStore entity_store_;
+    };
+
+} // namespace test.
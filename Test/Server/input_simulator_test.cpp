@@ -0,0 +1,348 @@
+#include "Test/Server/input_simulator_test.h"
+
+#include <atomic>
+#include <random>
+
+#include "Common/convert_math.h"
+#include "Common/vector.h"
+#include "Server/darwin_service_impl.h"
+
+namespace test {
+
+    namespace {
+
+        // Exact in binary, so that the input budget adds up exactly.
+        constexpr double FRAME_DURATION = 0.0625;
+
+        std::vector<darwin::PlayerInput> CreatePlayerInputs(
+            std::size_t count,
+            const darwin::PlayerInput& player_input)
+        {
+            return std::vector<darwin::PlayerInput>(count, player_input);
+        }
+
+    }  // End namespace.
+
+    void InputSimulatorTest::SetUp() {
+        // Planet of radius 100 with a gravity of about 6.7 at the surface.
+        grounds_ = {
+            { glm::dvec3(0.0), glm::dvec3(0.0), 1e15, 100.0 } };
+        player_parameter_.set_vertical_speed(10.0);
+        player_parameter_.set_horizontal_speed(5.0);
+        player_parameter_.set_friction(0.1);
+        player_parameter_.set_boost_speed(20.0);
+    }
+
+    proto::PlayerParameter InputSimulatorTest::FillWorldState(
+        darwin::WorldState& world_state) const
+    {
+        proto::PlayerParameter player_parameter = player_parameter_;
+        player_parameter.set_start_mass(10.0);
+        player_parameter.set_drop_height(5.0);
+        player_parameter.set_disconnection_timeout(10.0);
+        player_parameter.set_victory_size(1000.0);
+        auto* red = player_parameter.add_color_parameters();
+        red->set_name("red");
+        red->mutable_color()->CopyFrom(darwin::CreateVector3(1.0, 0.0, 0.0));
+        auto* blue = player_parameter.add_color_parameters();
+        blue->set_name("blue");
+        blue->mutable_color()->CopyFrom(
+            darwin::CreateVector3(0.0, 0.0, 1.0));
+        world_state.SetPlayerParameter(player_parameter);
+        world_state.AddElement(darwin::CreateBasicElement(
+            "ground",
+            proto::TYPE_GROUND,
+            darwin::CreateVector3(0.0, 0.0, 0.0),
+            1e15,
+            100.0));
+        return player_parameter;
+    }
+
+    void InputSimulatorTest::CreateBob(
+        darwin::DarwinServiceImpl& service,
+        double time) const
+    {
+        proto::RecordedEvent create;
+        create.set_recorded_event_enum(
+            proto::RECORDED_EVENT_CREATE_CHARACTER);
+        create.set_peer("peer_bob");
+        create.mutable_create_character()->set_name("bob");
+        create.mutable_create_character()->mutable_color()->CopyFrom(
+            darwin::CreateVector3(1.0, 0.0, 0.0));
+        service.ReplayEvent(create);
+        // Reported once published by a step.
+        proto::RecordedEvent step;
+        step.set_recorded_event_enum(proto::RECORDED_EVENT_STEP);
+        step.set_time(time);
+        service.ReplayEvent(step);
+    }
+
+    proto::RecordedEvent InputSimulatorTest::CreatePlayReport(
+        std::uint64_t report_sequence) const
+    {
+        proto::RecordedEvent report;
+        report.set_recorded_event_enum(proto::RECORDED_EVENT_PLAY_REPORT);
+        report.set_peer("peer_bob");
+        report.set_report_sequence(report_sequence);
+        report.mutable_report()->set_name("bob");
+        return report;
+    }
+
+    darwin::CharacterInputState InputSimulatorTest::CreateState(
+        const glm::dvec3& position,
+        proto::StatusEnum status_enum) const
+    {
+        darwin::CharacterInputState state;
+        state.name = "bob";
+        state.physic = { position, glm::dvec3(0.0), 10.0, 1.0 };
+        state.status_enum = status_enum;
+        state.normal = glm::normalize(position);
+        return state;
+    }
+
+    TEST_F(InputSimulatorTest, InputSimulatorTestWorkerPool) {
+        for (std::size_t worker_count : { 0, 1, 3 }) {
+            darwin::WorkerPool worker_pool(worker_count);
+            EXPECT_EQ(worker_count, worker_pool.GetWorkerCount());
+            std::vector<std::atomic<int>> counts(1'000);
+            for (int loop = 0; loop < 100; ++loop) {
+                worker_pool.ParallelFor(
+                    counts.size(),
+                    7,
+                    [&counts](std::size_t begin, std::size_t end) {
+                        for (std::size_t i = begin; i < end; ++i) {
+                            ++counts[i];
+                        }
+                    });
+            }
+            for (const auto& count : counts) {
+                EXPECT_EQ(100, count.load());
+            }
+        }
+    }
+
+    TEST_F(InputSimulatorTest, InputSimulatorTestFallToGround) {
+        auto state = CreateState(
+            glm::dvec3(0.0, 0.0, 110.0),
+            proto::STATUS_JUMPING);
+        state.player_inputs = CreatePlayerInputs(
+            100,
+            { glm::dvec3(0.0), false, false, FRAME_DURATION });
+        darwin::SimulateCharacterInputs(state, grounds_, player_parameter_);
+        EXPECT_EQ(proto::STATUS_ON_GROUND, state.status_enum);
+        EXPECT_NEAR(101.0, glm::length(state.physic.position), 1e-9);
+        EXPECT_NEAR(1.0, state.normal.z, 1e-9);
+        EXPECT_GT(glm::length(state.g_force), 0.0);
+    }
+
+    TEST_F(InputSimulatorTest, InputSimulatorTestMoveAndJump) {
+        auto state = CreateState(
+            glm::dvec3(0.0, 0.0, 101.0),
+            proto::STATUS_ON_GROUND);
+        state.player_inputs = CreatePlayerInputs(
+            10,
+            { glm::dvec3(1.0, 0.0, 0.0), false, false, FRAME_DURATION });
+        darwin::SimulateCharacterInputs(state, grounds_, player_parameter_);
+        EXPECT_EQ(proto::STATUS_ON_GROUND, state.status_enum);
+        EXPECT_GT(state.physic.position.x, 0.0);
+        EXPECT_GT(state.physic.position_dt.x, 0.0);
+        EXPECT_NEAR(101.0, glm::length(state.physic.position), 1e-9);
+        // Jump off the ground, the next frames are not on the ground.
+        const double height = glm::length(state.physic.position);
+        state.player_inputs = {
+            { glm::dvec3(0.0), true, false, FRAME_DURATION } };
+        darwin::SimulateCharacterInputs(state, grounds_, player_parameter_);
+        EXPECT_EQ(proto::STATUS_JUMPING, state.status_enum);
+        EXPECT_GT(glm::length(state.physic.position), height);
+    }
+
+    TEST_F(InputSimulatorTest, InputSimulatorTestParallelMatchSequential) {
+        std::mt19937 gen(42);
+        std::normal_distribution<double> dis(0.0, 1.0);
+        std::vector<darwin::CharacterInputState> states;
+        for (int i = 0; i < 500; ++i) {
+            const glm::dvec3 position = glm::normalize(
+                glm::dvec3(dis(gen), dis(gen), dis(gen))) * 101.0;
+            auto state = CreateState(position, proto::STATUS_ON_GROUND);
+            for (int j = 0; j < 8; ++j) {
+                state.player_inputs.push_back({
+                    glm::normalize(glm::dvec3(dis(gen), dis(gen), dis(gen))),
+                    j == 4 && i % 3 == 0,
+                    j == 2 && i % 5 == 0,
+                    FRAME_DURATION });
+            }
+            states.push_back(state);
+        }
+        auto expected_states = states;
+        for (auto& state : expected_states) {
+            darwin::SimulateCharacterInputs(
+                state,
+                grounds_,
+                player_parameter_);
+        }
+        darwin::WorkerPool worker_pool(3);
+        darwin::InputSimulator input_simulator(worker_pool);
+        input_simulator.Simulate(states, grounds_, player_parameter_);
+        for (std::size_t i = 0; i < states.size(); ++i) {
+            EXPECT_EQ(expected_states[i].physic.position,
+                states[i].physic.position);
+            EXPECT_EQ(expected_states[i].physic.position_dt,
+                states[i].physic.position_dt);
+            EXPECT_EQ(expected_states[i].status_enum, states[i].status_enum);
+        }
+    }
+
+    TEST_F(InputSimulatorTest, InputSimulatorTestServiceSimulatesInputs) {
+        darwin::WorldState world_state;
+        const auto player_parameter = FillWorldState(world_state);
+        darwin::DarwinServiceImpl service(world_state);
+        service.SetTickPeriods(0.125, 0.125, 1);
+        service.SetSimulationThreads(2);
+        CreateBob(service, 1.875);
+        ASSERT_EQ(1, world_state.GetCharacters().size());
+        const auto character = world_state.GetCharacters()[0];
+        // Twice the input budget of the first step, the physic sent is
+        // ignored.
+        auto report = CreatePlayReport(1);
+        report.mutable_report()->mutable_physic()->mutable_position()
+            ->CopyFrom(darwin::CreateVector3(0.0, 0.0, 1000.0));
+        const std::size_t budget =
+            static_cast<std::size_t>(darwin::MAX_INPUT_LAG / FRAME_DURATION);
+        for (std::size_t i = 0; i < 2 * budget; ++i) {
+            auto* input_command = report.mutable_report()->add_input_commands();
+            input_command->set_sequence(static_cast<std::uint32_t>(i + 1));
+            input_command->set_duration(static_cast<float>(FRAME_DURATION));
+        }
+        service.ReplayEvent(report);
+        proto::RecordedEvent step;
+        step.set_recorded_event_enum(proto::RECORDED_EVENT_STEP);
+        step.set_time(2.0);
+        service.ReplayEvent(step);
+        // Only the frames within the budget were simulated.
+        darwin::CharacterInputState expected;
+        expected.name = "bob";
+        expected.physic = darwin::GetPhysicState(character.physic());
+        expected.status_enum = character.status_enum();
+        expected.normal = darwin::ProtoVector2Glm(character.normal());
+        expected.player_inputs = CreatePlayerInputs(
+            budget,
+            { glm::dvec3(0.0), false, false, FRAME_DURATION });
+        darwin::SimulateCharacterInputs(
+            expected,
+            grounds_,
+            player_parameter);
+        ASSERT_EQ(1, world_state.GetCharacters().size());
+        const auto simulated = world_state.GetCharacters()[0];
+        EXPECT_EQ(
+            expected.physic.position,
+            darwin::ProtoVector2Glm(simulated.physic().position()));
+        EXPECT_EQ(
+            expected.physic.position_dt,
+            darwin::ProtoVector2Glm(simulated.physic().position_dt()));
+        EXPECT_LT(
+            glm::length(expected.physic.position),
+            glm::length(darwin::GetPhysicState(character.physic()).position));
+    }
+
+    TEST_F(InputSimulatorTest, InputSimulatorTestBoostCooldown) {
+        player_parameter_.mutable_special_effect_boost()
+            ->set_cooldown_duration(10.0);
+        const darwin::PlayerInput boost_input{
+            glm::dvec3(1.0, 0.0, 0.0), false, true, FRAME_DURATION };
+        auto waiting = CreateState(
+            glm::dvec3(0.0, 0.0, 101.0),
+            proto::STATUS_ON_GROUND);
+        waiting.player_inputs = { boost_input };
+        auto cooling = waiting;
+        cooling.special_effect_boost.special_state_enum =
+            proto::SPECIAL_STATE_COOLDOWN;
+        darwin::SimulateCharacterInputs(
+            waiting,
+            grounds_,
+            player_parameter_);
+        darwin::SimulateCharacterInputs(
+            cooling,
+            grounds_,
+            player_parameter_);
+        // The boost asked for during the cooldown is ignored (and free).
+        EXPECT_EQ(1.0, waiting.mass_cost);
+        EXPECT_EQ(0.0, cooling.mass_cost);
+        EXPECT_GT(
+            glm::length(waiting.physic.position_dt),
+            2.0 * glm::length(cooling.physic.position_dt));
+        EXPECT_EQ(
+            proto::SPECIAL_STATE_COOLDOWN,
+            cooling.special_effect_boost.special_state_enum);
+    }
+
+    TEST_F(InputSimulatorTest, InputSimulatorTestServiceBoostPaidOnce) {
+        auto* boost = player_parameter_.mutable_special_effect_boost();
+        boost->set_effect_duration(10.0);
+        boost->set_cooldown_duration(10.0);
+        darwin::WorldState world_state;
+        FillWorldState(world_state);
+        darwin::DarwinServiceImpl service(world_state);
+        service.SetTickPeriods(0.125, 0.125, 1);
+        CreateBob(service, 1.875);
+        ASSERT_EQ(1, world_state.GetCharacters().size());
+        const double mass = world_state.GetCharacters()[0].physic().mass();
+        // Boost held over several reports (two frames by step).
+        proto::RecordedEvent step;
+        step.set_recorded_event_enum(proto::RECORDED_EVENT_STEP);
+        for (std::uint64_t i = 0; i < 5; ++i) {
+            auto report = CreatePlayReport(i + 1);
+            for (std::uint32_t j = 0; j < 2; ++j) {
+                auto* input_command =
+                    report.mutable_report()->add_input_commands();
+                input_command->set_sequence(
+                    static_cast<std::uint32_t>(2 * i + j + 1));
+                input_command->set_input_flags(proto::INPUT_FLAG_BOOST);
+                input_command->set_duration(
+                    static_cast<float>(FRAME_DURATION));
+            }
+            service.ReplayEvent(report);
+            step.set_time(2.0 + 0.125 * static_cast<double>(i));
+            service.ReplayEvent(step);
+        }
+        ASSERT_EQ(1, world_state.GetCharacters().size());
+        const auto character = world_state.GetCharacters()[0];
+        EXPECT_DOUBLE_EQ(mass - 1.0, character.physic().mass());
+        // Active for the other clients too.
+        EXPECT_EQ(
+            proto::SPECIAL_STATE_ACTIVE,
+            character.special_effect_boost().special_state_enum());
+        EXPECT_DOUBLE_EQ(
+            10 * FRAME_DURATION,
+            character.special_effect_boost().counter());
+    }
+
+    TEST_F(InputSimulatorTest, InputSimulatorTestServiceStaleReport) {
+        darwin::WorldState world_state;
+        FillWorldState(world_state);
+        darwin::DarwinServiceImpl service(world_state);
+        service.SetTickPeriods(0.125, 0.125, 1);
+        CreateBob(service, 1.875);
+        ASSERT_EQ(1, world_state.GetCharacters().size());
+        const auto character = world_state.GetCharacters()[0];
+        // A physic report, checked against the view of the last step.
+        auto report = CreatePlayReport(1);
+        report.mutable_report()->mutable_physic()->CopyFrom(
+            character.physic());
+        report.mutable_report()->set_status_enum(character.status_enum());
+        service.ReplayEvent(report);
+        // A tick changes the mass of bob before the report is drained.
+        auto physic = character.physic();
+        physic.set_mass(20.0);
+        world_state.UpdateCharacter("bob", character.status_enum(), physic);
+        world_state.Update(1.9375);
+        proto::RecordedEvent step;
+        step.set_recorded_event_enum(proto::RECORDED_EVENT_STEP);
+        step.set_time(2.0);
+        service.ReplayEvent(step);
+        ASSERT_EQ(1, world_state.GetCharacters().size());
+        EXPECT_DOUBLE_EQ(
+            20.0,
+            world_state.GetCharacters()[0].physic().mass());
+    }
+
+} // namespace test.
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "Server/darwin_service_impl.h"
+#include "Server/input_simulator.h"
+#include <gtest/gtest.h>
+
+namespace test {
+
+    class InputSimulatorTest : public testing::Test {
+    public:
+        InputSimulatorTest() = default;
+        void SetUp() override;
+        // Character of radius 1 at position.
+        darwin::CharacterInputState CreateState(
+            const glm::dvec3& position,
+            proto::StatusEnum status_enum) const;
+        // A planet of radius 100 and the player parameter with two colors,
+        // return the player parameter.
+        proto::PlayerParameter FillWorldState(
+            darwin::WorldState& world_state) const;
+        // Create bob (for peer_bob), published by a step at time.
+        void CreateBob(
+            darwin::DarwinServiceImpl& service,
+            double time) const;
+        // Report of bob in a Play stream.
+        proto::RecordedEvent CreatePlayReport(
+            std::uint64_t report_sequence) const;
+
+    protected:
+        std::vector<darwin::PhysicState> grounds_;
+        proto::PlayerParameter player_parameter_;
+    };
+
+} // namespace test.
@@ -0,0 +1,55 @@
+#include "Test/Server/mpsc_queue_test.h"
+
+#include <thread>
+#include <vector>
+
+namespace test {
+
+    TEST_F(MpscQueueTest, MpscQueueTestOrder) {
+        for (int i = 0; i < 10; ++i) {
+            queue_.Push({ 0, i });
+        }
+        std::vector<int> values;
+        EXPECT_EQ(
+            queue_.Drain([&values](std::pair<int, int>&& value) {
+                values.push_back(value.second);
+            }),
+            10);
+        for (int i = 0; i < 10; ++i) {
+            EXPECT_EQ(values[i], i);
+        }
+        EXPECT_EQ(queue_.Drain([](std::pair<int, int>&&) {}), 0);
+    }
+
+    TEST_F(MpscQueueTest, MpscQueueTestProducers) {
+        constexpr int producer_count = 4;
+        constexpr int value_count = 10'000;
+        std::vector<std::thread> producers;
+        for (int producer = 0; producer < producer_count; ++producer) {
+            producers.emplace_back([this, producer] {
+                for (int i = 0; i < value_count; ++i) {
+                    queue_.Push({ producer, i });
+                }
+            });
+        }
+        // Drain while the producers are running, every producer values have
+        // to come in order and none can be lost.
+        std::vector<int> next(producer_count, 0);
+        auto check = [&next](std::pair<int, int>&& value) {
+            EXPECT_EQ(next[value.first], value.second);
+            next[value.first] = value.second + 1;
+        };
+        int total = 0;
+        while (total < producer_count * value_count) {
+            total += static_cast<int>(queue_.Drain(check));
+        }
+        for (auto& producer : producers) {
+            producer.join();
+        }
+        EXPECT_EQ(total, producer_count * value_count);
+        for (int producer = 0; producer < producer_count; ++producer) {
+            EXPECT_EQ(next[producer], value_count);
+        }
+    }
+
+} // namespace test.
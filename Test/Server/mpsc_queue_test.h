@@ -0,0 +1,17 @@
+#pragma once
+
+#include "Server/mpsc_queue.h"
+#include <gtest/gtest.h>
+
+namespace test {
+
+    class MpscQueueTest : public testing::Test {
+    public:
+        MpscQueueTest() = default;
+
+    protected:
+        // Producer index and value pushed by this producer.
+        darwin::MpscQueue<std::pair<int, int>> queue_;
+    };
+
+} // namespace test.
@@ -0,0 +1,107 @@
+#include "Test/Server/physic_batch_test.h"
+
+#include <random>
+
+namespace test {
+
+    void PhysicBatchTest::PopulateBodies(std::size_t count) {
+        std::mt19937 gen(42);
+        std::normal_distribution<double> dis(0.0, 1.0);
+        std::uniform_real_distribution<double> height(90.0, 110.0);
+        ground_ = darwin::PhysicState{
+            glm::dvec3(0.0), glm::dvec3(0.0), 1e6, 100.0 };
+        positions_.clear();
+        position_dts_.clear();
+        masses_.clear();
+        radii_.clear();
+        for (std::size_t i = 0; i < count; ++i) {
+            positions_.push_back(
+                glm::normalize(glm::dvec3(dis(gen), dis(gen), dis(gen))) *
+                    height(gen));
+            position_dts_.push_back(
+                glm::dvec3(dis(gen), dis(gen), dis(gen)));
+            masses_.push_back(1.0 + i);
+            radii_.push_back(1.0 + 0.5 * i);
+        }
+    }
+
+    void PhysicBatchTest::RunKernel(darwin::PhysicKernelEnum physic_kernel) {
+        const auto previous = darwin::GetPhysicKernel();
+        ASSERT_TRUE(darwin::SetPhysicKernel(physic_kernel));
+        forces_.assign(positions_.size(), glm::dvec3(0.0));
+        statuses_.assign(positions_.size(), proto::STATUS_UNKNOWN);
+        darwin::PhysicBatch bodies{
+            positions_, position_dts_, masses_, radii_ };
+        darwin::ApplyPhysicBatch(ground_, positions_, masses_, forces_);
+        darwin::UpdateObjectBatch(bodies, forces_, 0.1);
+        darwin::CorrectSurfaceBatch(bodies, ground_, statuses_);
+        darwin::SetPhysicKernel(previous);
+    }
+
+    TEST_F(PhysicBatchTest, PhysicBatchTestScalarMatchPhysicState) {
+        PopulateBodies(13);
+        std::vector<darwin::PhysicState> physics;
+        for (std::size_t i = 0; i < positions_.size(); ++i) {
+            physics.push_back(darwin::PhysicState{
+                positions_[i], position_dts_[i], masses_[i], radii_[i] });
+        }
+        RunKernel(darwin::PhysicKernelEnum::PHYSIC_KERNEL_SCALAR);
+        for (std::size_t i = 0; i < physics.size(); ++i) {
+            auto& physic = physics[i];
+            const glm::dvec3 force = darwin::ApplyPhysic(ground_, physic);
+            darwin::UpdateObject(physic, force, 0.1);
+            const auto status = darwin::CorrectSurface(physic, ground_);
+            EXPECT_EQ(forces_[i], force);
+            EXPECT_EQ(positions_[i], physic.position);
+            EXPECT_EQ(position_dts_[i], physic.position_dt);
+            EXPECT_EQ(statuses_[i], status);
+        }
+    }
+
+    TEST_F(PhysicBatchTest, PhysicBatchTestKernelsMatchScalar) {
+        PopulateBodies(13);
+        const auto positions = positions_;
+        const auto position_dts = position_dts_;
+        RunKernel(darwin::PhysicKernelEnum::PHYSIC_KERNEL_SCALAR);
+        const auto expected_positions = positions_;
+        const auto expected_position_dts = position_dts_;
+        const auto expected_forces = forces_;
+        const auto expected_statuses = statuses_;
+        for (auto physic_kernel : {
+            darwin::PhysicKernelEnum::PHYSIC_KERNEL_AVX2,
+            darwin::PhysicKernelEnum::PHYSIC_KERNEL_NEON })
+        {
+            if (!darwin::SetPhysicKernel(physic_kernel)) {
+                continue;
+            }
+            positions_ = positions;
+            position_dts_ = position_dts;
+            RunKernel(physic_kernel);
+            EXPECT_EQ(positions_, expected_positions)
+                << darwin::GetPhysicKernelName(physic_kernel);
+            EXPECT_EQ(position_dts_, expected_position_dts)
+                << darwin::GetPhysicKernelName(physic_kernel);
+            EXPECT_EQ(forces_, expected_forces)
+                << darwin::GetPhysicKernelName(physic_kernel);
+            EXPECT_EQ(statuses_, expected_statuses)
+                << darwin::GetPhysicKernelName(physic_kernel);
+        }
+    }
+
+    TEST_F(PhysicBatchTest, PhysicBatchTestStatuses) {
+        PopulateBodies(13);
+        RunKernel(darwin::GetPhysicKernel());
+        for (std::size_t i = 0; i < positions_.size(); ++i) {
+            if (statuses_[i] == proto::STATUS_ON_GROUND) {
+                EXPECT_NEAR(
+                    glm::length(positions_[i]),
+                    ground_.radius + radii_[i],
+                    1e-9);
+            }
+            else {
+                EXPECT_EQ(statuses_[i], proto::STATUS_JUMPING);
+            }
+        }
+    }
+
+} // namespace test.
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Common/physic_batch.h"
+#include <gtest/gtest.h>
+
+namespace test {
+
+    class PhysicBatchTest : public testing::Test {
+    public:
+        PhysicBatchTest() = default;
+        void PopulateBodies(std::size_t count);
+        // Run the batched functions with the kernel on a copy of the
+        // bodies.
+        void RunKernel(darwin::PhysicKernelEnum physic_kernel);
+
+    protected:
+        darwin::PhysicState ground_;
+        std::vector<glm::dvec3> positions_;
+        std::vector<glm::dvec3> position_dts_;
+        std::vector<double> masses_;
+        std::vector<double> radii_;
+        std::vector<glm::dvec3> forces_;
+        std::vector<proto::StatusEnum> statuses_;
+    };
+
+} // namespace test.
@@ -0,0 +1,308 @@
+#include "Test/Server/region_service_test.h"
+
+#include <chrono>
+#include <filesystem>
+#include <thread>
+
+#include "Common/convert_math.h"
+#include "Common/darwin_constant.h"
+#include "Common/stl_proto_wrapper.h"
+#include "Common/vector.h"
+#include "Server/darwin_service_impl.h"
+
+namespace test {
+
+    namespace {
+
+        // Mirror angle of the tests, in radians.
+        constexpr double MIRROR_ANGLE = 0.05;
+
+        // Unix socket address, left over sockets are removed.
+        std::string GetSocketName(const std::string& name) {
+            const auto path = std::filesystem::temp_directory_path() / name;
+            std::filesystem::remove(path);
+            return "unix:" + path.string();
+        }
+
+    }  // End namespace.
+
+    void RegionServiceTest::FillWorld(darwin::WorldState& world_state) const
+    {
+        proto::PlayerParameter player_parameter;
+        player_parameter.set_start_mass(10.0);
+        player_parameter.set_drop_height(5.0);
+        player_parameter.set_disconnection_timeout(10.0);
+        player_parameter.set_victory_size(1000.0);
+        auto* red = player_parameter.add_color_parameters();
+        red->set_name("red");
+        red->mutable_color()->CopyFrom(darwin::CreateVector3(1.0, 0.0, 0.0));
+        world_state.SetPlayerParameter(player_parameter);
+        world_state.AddElement(
+            darwin::CreateBasicElement(
+                "ground",
+                proto::TYPE_GROUND,
+                darwin::CreateVector3(0.0, 0.0, 0.0),
+                1000.0,
+                100.0));
+        world_state.Update(1.0);
+    }
+
+    void RegionServiceTest::MoveCharacter(
+        darwin::WorldState& world_state,
+        const std::string& name,
+        const glm::dvec3& position) const
+    {
+        for (const auto& character : world_state.GetCharacters()) {
+            if (character.name() != name) {
+                continue;
+            }
+            auto physic = character.physic();
+            physic.mutable_position()->CopyFrom(
+                darwin::Glm2ProtoVector(position));
+            world_state.UpdateCharacter(
+                name,
+                proto::STATUS_ON_GROUND,
+                physic);
+        }
+    }
+
+    TEST_F(RegionServiceTest, Regions) {
+        darwin::WorldRegion region(1, { "a", "b", "c", "d" });
+        EXPECT_EQ(4, region.GetRegionCount());
+        EXPECT_EQ(0, region.GetRegion(glm::dvec3(1.0, 0.1, 0.0)));
+        EXPECT_EQ(1, region.GetRegion(glm::dvec3(-0.1, 1.0, 0.0)));
+        EXPECT_EQ(2, region.GetRegion(glm::dvec3(-1.0, -0.1, 0.0)));
+        EXPECT_EQ(3, region.GetRegion(glm::dvec3(0.1, -1.0, 0.0)));
+        EXPECT_TRUE(region.IsOwned(glm::dvec3(-1.0, 1.0, 0.5)));
+        // Just past the border between 0 and 1, on the equator.
+        const glm::dvec3 position(-0.01, 1.0, 0.0);
+        EXPECT_NEAR(
+            std::atan(0.01),
+            region.GetAngleToRegion(position, 0),
+            1e-9);
+        EXPECT_NEAR(darwin::PI / 2.0, region.GetAngleToRegion(position, 3),
+            1e-2);
+        std::vector<std::uint32_t> regions;
+        region.GetRegionsInCap(position, MIRROR_ANGLE, regions);
+        EXPECT_EQ(std::vector<std::uint32_t>{ 0 }, regions);
+        // Close to the pole every sector is near.
+        region.GetRegionsInCap(
+            glm::dvec3(0.01, 0.01, 1.0),
+            MIRROR_ANGLE,
+            regions);
+        EXPECT_EQ((std::vector<std::uint32_t>{ 0, 2, 3 }), regions);
+    }
+
+    TEST_F(RegionServiceTest, UpgradesInRegion) {
+        darwin::WorldRegion region(1, { "a", "b" });
+        darwin::WorldState world_state;
+        FillWorld(world_state);
+        world_state.SetWorldRegion(&region);
+        world_state.SetUpgradeElement(50);
+        std::size_t upgrade_count = 0;
+        for (const auto& element : world_state.GetElements()) {
+            if (element.type_enum() != proto::TYPE_UPGRADE) {
+                continue;
+            }
+            ++upgrade_count;
+            EXPECT_TRUE(region.IsOwned(
+                darwin::ProtoVector2Glm(element.physic().position())));
+            EXPECT_TRUE(element.name().starts_with("element_upgrade1_"));
+        }
+        EXPECT_EQ(50, upgrade_count);
+    }
+
+    TEST_F(RegionServiceTest, MirrorAndHandoff) {
+        darwin::WorldRegion region_a(0, { "a", "b" });
+        darwin::WorldRegion region_b(1, { "a", "b" });
+        darwin::WorldState world_a;
+        darwin::WorldState world_b;
+        FillWorld(world_a);
+        FillWorld(world_b);
+        world_a.SetWorldRegion(&region_a);
+        world_b.SetWorldRegion(&region_b);
+        const auto red = darwin::CreateVector3(1.0, 0.0, 0.0);
+        ASSERT_TRUE(world_a.CreateCharacter("peer_alice", "alice", red));
+        // Near the border at longitude 0, owned by a.
+        MoveCharacter(world_a, "alice", glm::dvec3(101.0, 1.0, 0.0));
+        std::vector<proto::RegionExchangeRequest> requests;
+        world_a.CaptureRegionExchanges(MIRROR_ANGLE, true, requests);
+        ASSERT_EQ(2, requests.size());
+        ASSERT_EQ(1, requests[1].mirrored_characters_size());
+        EXPECT_EQ(0, requests[1].handoff_characters_size());
+        world_b.ApplyRegionExchange(requests[1]);
+        EXPECT_TRUE(world_b.HasCharacter("alice"));
+        EXPECT_TRUE(world_b.IsMirrored("alice"));
+        // A mirror can't be taken by a player.
+        EXPECT_FALSE(world_b.CreateCharacter("peer_bob", "alice", red));
+        // Across the border, handed off to b.
+        MoveCharacter(world_a, "alice", glm::dvec3(101.0, -1.0, 0.0));
+        world_a.CaptureRegionExchanges(MIRROR_ANGLE, true, requests);
+        ASSERT_EQ(1, requests[1].handoff_characters_size());
+        EXPECT_FALSE(world_a.HasCharacter("alice"));
+        world_b.ApplyRegionExchange(requests[1]);
+        EXPECT_TRUE(world_b.HasCharacter("alice"));
+        EXPECT_FALSE(world_b.IsMirrored("alice"));
+        // The clients of a are told where alice went.
+        world_a.Update(1.1);
+        proto::UpdateResponse response;
+        world_a.FillUpdateResponse(response, 0);
+        ASSERT_EQ(1, response.handoffs_size());
+        EXPECT_EQ("alice", response.handoffs(0).name());
+        EXPECT_EQ("b", response.handoffs(0).server_name());
+        // Her player takes her back on b.
+        EXPECT_TRUE(world_b.CreateCharacter("peer_alice", "alice", red));
+        EXPECT_TRUE(world_b.IsCharacterOwnByPeer("peer_alice", "alice"));
+        // b now mirrors her to a.
+        world_b.CaptureRegionExchanges(MIRROR_ANGLE, true, requests);
+        ASSERT_EQ(1, requests[0].mirrored_characters_size());
+        world_a.ApplyRegionExchange(requests[0]);
+        EXPECT_TRUE(world_a.IsMirrored("alice"));
+        // Far from the border, the mirror is gone.
+        MoveCharacter(world_b, "alice", glm::dvec3(0.0, -101.0, 0.0));
+        world_b.CaptureRegionExchanges(MIRROR_ANGLE, true, requests);
+        EXPECT_EQ(0, requests[0].mirrored_characters_size());
+        world_a.ApplyRegionExchange(requests[0]);
+        EXPECT_FALSE(world_a.HasCharacter("alice"));
+    }
+
+    TEST_F(RegionServiceTest, ExchangeBetweenServers) {
+        const std::vector<std::string> server_names = {
+            GetSocketName("darwin_region_test_0"),
+            GetSocketName("darwin_region_test_1") };
+        std::vector<std::unique_ptr<darwin::WorldRegion>> regions;
+        std::vector<std::unique_ptr<darwin::WorldState>> worlds;
+        std::vector<std::unique_ptr<darwin::RegionService>> services;
+        std::vector<std::unique_ptr<grpc::Server>> servers;
+        const auto start_server = [&](std::uint32_t i) {
+            grpc::ServerBuilder builder;
+            builder.AddListeningPort(
+                server_names[i],
+                grpc::InsecureServerCredentials());
+            builder.RegisterService(services[i].get());
+            servers.push_back(builder.BuildAndStart());
+            return servers.back() != nullptr;
+        };
+        for (std::uint32_t i = 0; i < server_names.size(); ++i) {
+            regions.push_back(
+                std::make_unique<darwin::WorldRegion>(i, server_names));
+            worlds.push_back(std::make_unique<darwin::WorldState>());
+            FillWorld(*worlds.back());
+            worlds.back()->SetWorldRegion(regions.back().get());
+            services.push_back(
+                std::make_unique<darwin::RegionService>(
+                    *worlds.back(),
+                    *regions.back()));
+            services.back()->SetMirrorAngle(MIRROR_ANGLE);
+        }
+        // a hands off, b doesn't (the default).
+        services[0]->SetHandoff(true);
+        // The neighbor isn't up yet.
+        ASSERT_TRUE(start_server(0));
+        const auto red = darwin::CreateVector3(1.0, 0.0, 0.0);
+        ASSERT_TRUE(worlds[0]->CreateCharacter("peer_alice", "alice", red));
+        ASSERT_TRUE(worlds[0]->CreateCharacter("peer_carol", "carol", red));
+        MoveCharacter(*worlds[0], "alice", glm::dvec3(101.0, -1.0, 0.0));
+        MoveCharacter(*worlds[0], "carol", glm::dvec3(101.0, 1.0, 0.0));
+        services[0]->SendExchanges();
+        services[0]->WaitForExchanges();
+        // The handoff waits, it isn't given back.
+        EXPECT_EQ(0, services[0]->GetHandoffCount());
+        EXPECT_FALSE(worlds[0]->HasCharacter("alice"));
+        EXPECT_FALSE(worlds[1]->HasCharacter("alice"));
+        // Sent again once the neighbor is up.
+        ASSERT_TRUE(start_server(1));
+        for (int i = 0; i < 50 && !worlds[1]->HasCharacter("alice"); ++i) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            services[0]->SendExchanges();
+            services[0]->WaitForExchanges();
+        }
+        EXPECT_EQ(1, services[0]->GetHandoffCount());
+        EXPECT_FALSE(worlds[0]->HasCharacter("alice"));
+        EXPECT_TRUE(worlds[1]->HasCharacter("alice"));
+        EXPECT_FALSE(worlds[1]->IsMirrored("alice"));
+        EXPECT_TRUE(worlds[1]->IsMirrored("carol"));
+        // A handoff sent again (its exchange failed after it was applied).
+        auto stub = proto::DarwinRegionService::NewStub(
+            grpc::CreateChannel(
+                server_names[1],
+                grpc::InsecureChannelCredentials()));
+        const auto exchange = [&stub](
+            const proto::RegionExchangeRequest& request)
+        {
+            grpc::ClientContext context;
+            proto::RegionExchangeResponse response;
+            return stub->Exchange(&context, request, &response).ok();
+        };
+        ASSERT_TRUE(worlds[0]->CreateCharacter("peer_dave", "dave", red));
+        MoveCharacter(*worlds[0], "dave", glm::dvec3(101.0, -1.0, 0.0));
+        proto::RegionExchangeRequest request;
+        request.set_region(0);
+        for (const auto& character : worlds[0]->GetCharacters()) {
+            if (character.name() == "dave") {
+                request.add_handoff_characters()->CopyFrom(character);
+            }
+        }
+        request.add_handoff_ids(100);
+        ASSERT_TRUE(exchange(request));
+        EXPECT_TRUE(worlds[1]->HasCharacter("dave"));
+        // He crosses back before the exchange is sent again.
+        MoveCharacter(*worlds[1], "dave", glm::dvec3(101.0, 1.0, 0.0));
+        std::vector<proto::RegionExchangeRequest> requests;
+        worlds[1]->CaptureRegionExchanges(MIRROR_ANGLE, true, requests);
+        EXPECT_FALSE(worlds[1]->HasCharacter("dave"));
+        ASSERT_TRUE(exchange(request));
+        EXPECT_FALSE(worlds[1]->HasCharacter("dave"));
+        // Nor once it is acknowledged.
+        request.set_handoff_floor(101);
+        ASSERT_TRUE(exchange(request));
+        EXPECT_FALSE(worlds[1]->HasCharacter("dave"));
+        // Without handoff a character that crosses stays with its player
+        // (played from b) and is mirrored to a.
+        darwin::DarwinServiceImpl service_b(*worlds[1]);
+        service_b.SetRegionService(services[1].get());
+        ASSERT_TRUE(worlds[1]->CreateCharacter("peer_erin", "erin", red));
+        service_b.TickStep(1.1);
+        services[1]->WaitForExchanges();
+        const auto report_position = [&](
+            const glm::dvec3& position,
+            double time)
+        {
+            proto::RecordedEvent report;
+            report.set_recorded_event_enum(
+                proto::RECORDED_EVENT_REPORT_IN_GAME);
+            report.set_peer("peer_erin");
+            report.mutable_report()->set_name("erin");
+            report.mutable_report()->set_status_enum(
+                proto::STATUS_ON_GROUND);
+            report.mutable_report()->mutable_physic()->mutable_position()
+                ->CopyFrom(darwin::Glm2ProtoVector(position));
+            service_b.ReplayEvent(report);
+            service_b.TickStep(time);
+            services[1]->WaitForExchanges();
+        };
+        const auto get_erin_position = [&worlds]() {
+            for (const auto& character : worlds[1]->GetCharacters()) {
+                if (character.name() == "erin") {
+                    return darwin::ProtoVector2Glm(
+                        character.physic().position());
+                }
+            }
+            return glm::dvec3(0.0);
+        };
+        report_position(glm::dvec3(101.0, 1.0, 0.0), 1.2);
+        EXPECT_TRUE(regions[0]->IsOwned(get_erin_position()));
+        EXPECT_TRUE(worlds[1]->IsCharacterOwnByPeer("peer_erin", "erin"));
+        EXPECT_TRUE(worlds[0]->IsMirrored("erin"));
+        // Deep in a, her reports still count.
+        report_position(glm::dvec3(0.0, 101.0, 0.0), 1.3);
+        EXPECT_GT(get_erin_position().y, 100.0);
+        EXPECT_TRUE(worlds[1]->IsCharacterOwnByPeer("peer_erin", "erin"));
+        EXPECT_FALSE(worlds[0]->IsCharacterOwnByPeer("peer_erin", "erin"));
+        EXPECT_TRUE(worlds[0]->IsMirrored("erin"));
+        for (auto& server : servers) {
+            server->Shutdown();
+        }
+    }
+
+} // namespace test.
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "Server/region_service.h"
+#include "Server/world_state.h"
+#include <gtest/gtest.h>
+
+namespace test {
+
+    class RegionServiceTest : public testing::Test {
+    public:
+        RegionServiceTest() = default;
+        // A planet of radius 100 and a player parameter with two colors.
+        void FillWorld(darwin::WorldState& world_state) const;
+        // Move the character (on the ground) to position.
+        void MoveCharacter(
+            darwin::WorldState& world_state,
+            const std::string& name,
+            const glm::dvec3& position) const;
+    };
+
+} // namespace test.
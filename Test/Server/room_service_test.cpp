@@ -0,0 +1,111 @@
+#include "Test/Server/room_service_test.h"
+
+#include "Common/vector.h"
+
+namespace test {
+
+    namespace {
+
+        proto::RecordedEvent CreateCharacterEvent(
+            const std::string& peer,
+            const std::string& name)
+        {
+            proto::RecordedEvent event;
+            event.set_recorded_event_enum(
+                proto::RECORDED_EVENT_CREATE_CHARACTER);
+            event.set_peer(peer);
+            event.mutable_create_character()->set_name(name);
+            event.mutable_create_character()->mutable_color()->CopyFrom(
+                darwin::CreateVector3(1.0, 0.0, 0.0));
+            return event;
+        }
+
+    }  // End namespace.
+
+    void RoomServiceTest::SetUp() {
+        room_parameter_.world.set_time(1.0);
+        *room_parameter_.world.add_elements() = darwin::CreateBasicElement(
+            "ground",
+            proto::TYPE_GROUND,
+            darwin::CreateVector3(0.0, 0.0, 0.0),
+            1000.0,
+            100.0);
+        auto* player_parameter =
+            room_parameter_.world.mutable_player_parameter();
+        player_parameter->set_start_mass(10.0);
+        player_parameter->set_drop_height(5.0);
+        player_parameter->set_disconnection_timeout(10.0);
+        player_parameter->set_victory_size(1000.0);
+        auto* red = player_parameter->add_color_parameters();
+        red->set_name("red");
+        red->mutable_color()->CopyFrom(darwin::CreateVector3(1.0, 0.0, 0.0));
+        auto* blue = player_parameter->add_color_parameters();
+        blue->set_name("blue");
+        blue->mutable_color()->CopyFrom(
+            darwin::CreateVector3(0.0, 0.0, 1.0));
+        room_parameter_.upgrade_count = 10;
+        room_parameter_.max_players = 2;
+    }
+
+    TEST_F(RoomServiceTest, OpenRoomWhenFull) {
+        darwin::RoomService room_service(room_parameter_);
+        EXPECT_EQ(1, room_service.GetRoomCount());
+        auto& alice = room_service.JoinRoom("peer_alice");
+        auto& bob = room_service.JoinRoom("peer_bob");
+        EXPECT_EQ(&alice, &bob);
+        EXPECT_EQ(1, room_service.GetRoomCount());
+        // Joining again doesn't take another place.
+        EXPECT_EQ(&alice, &room_service.JoinRoom("peer_alice"));
+        auto& carol = room_service.JoinRoom("peer_carol");
+        EXPECT_NE(&alice, &carol);
+        EXPECT_EQ(2, room_service.GetRoomCount());
+        EXPECT_EQ(2, room_service.GetRoomPlayerCount(0));
+        EXPECT_EQ(1, room_service.GetRoomPlayerCount(1));
+        // Every room starts from the same world.
+        EXPECT_EQ(
+            room_service.GetRoomWorldState(0).GetElements().size(),
+            room_service.GetRoomWorldState(1).GetElements().size());
+    }
+
+    TEST_F(RoomServiceTest, RemovedPeerFreesPlace) {
+        darwin::RoomService room_service(room_parameter_);
+        auto& alice = room_service.JoinRoom("peer_alice");
+        room_service.JoinRoom("peer_bob");
+        alice.ReplayEvent(CreateCharacterEvent("peer_alice", "alice"));
+        EXPECT_TRUE(room_service.GetRoomWorldState(0).HasCharacter("alice"));
+        proto::RecordedEvent disconnect;
+        disconnect.set_recorded_event_enum(proto::RECORDED_EVENT_DISCONNECT);
+        disconnect.set_peer("peer_alice");
+        alice.ReplayEvent(disconnect);
+        EXPECT_FALSE(room_service.GetRoomWorldState(0).HasCharacter("alice"));
+        EXPECT_EQ(1, room_service.GetRoomPlayerCount(0));
+        // The free place is taken before a new room is opened.
+        EXPECT_EQ(&alice, &room_service.JoinRoom("peer_carol"));
+        EXPECT_EQ(1, room_service.GetRoomCount());
+    }
+
+    TEST_F(RoomServiceTest, RoomsAreIndependent) {
+        darwin::RoomService room_service(room_parameter_);
+        std::vector<darwin::DarwinServiceImpl*> rooms;
+        for (const std::string name : { "a", "b", "c", "d", "e" }) {
+            auto& room = room_service.JoinRoom("peer_" + name);
+            // The same name in different rooms.
+            room.ReplayEvent(CreateCharacterEvent(
+                "peer_" + name,
+                rooms.size() % 2 ? "second" : "first"));
+            rooms.push_back(&room);
+        }
+        ASSERT_EQ(3, room_service.GetRoomCount());
+        for (int i = 1; i <= 10; ++i) {
+            room_service.StepRooms(1.0 + 0.1 * i);
+            room_service.BroadcastRooms(1.0 + 0.1 * i);
+        }
+        for (std::size_t i = 0; i < room_service.GetRoomCount(); ++i) {
+            const auto& world_state = room_service.GetRoomWorldState(i);
+            EXPECT_NEAR(2.0, world_state.GetLastUpdated(), 1e-9);
+            EXPECT_TRUE(world_state.HasCharacter("first"));
+            EXPECT_EQ(i < 2, world_state.HasCharacter("second"));
+        }
+    }
+
+} // namespace test.
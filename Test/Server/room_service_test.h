@@ -0,0 +1,18 @@
+#pragma once
+
+#include "Server/room_service.h"
+#include <gtest/gtest.h>
+
+namespace test {
+
+    class RoomServiceTest : public testing::Test {
+    public:
+        RoomServiceTest() = default;
+        void SetUp() override;
+
+    protected:
+        // A planet, two colors and two players by room.
+        darwin::RoomParameter room_parameter_;
+    };
+
+} // namespace test.
@@ -0,0 +1,125 @@
+#include "Test/Server/sphere_grid_test.h"
+
+#include <random>
+#include <set>
+
+#include "Common/darwin_constant.h"
+
+namespace test {
+
+    void SphereGridTest::PopulatePositions(std::size_t count) {
+        std::mt19937 gen(42);
+        std::normal_distribution<double> dis(0.0, 1.0);
+        positions_.clear();
+        for (std::size_t i = 0; i < count; ++i) {
+            positions_.push_back(
+                glm::normalize(glm::dvec3(dis(gen), dis(gen), dis(gen))) *
+                    100.0);
+        }
+    }
+
+    TEST_F(SphereGridTest, SphereGridTestCellRange) {
+        darwin::SphereGrid sphere_grid(darwin::ALMOST_INTERSECT_ANGLE);
+        EXPECT_GE(
+            sphere_grid.GetMinimumCellAngle(),
+            darwin::ALMOST_INTERSECT_ANGLE);
+        PopulatePositions(1'000);
+        for (const auto& position : positions_) {
+            EXPECT_LT(
+                sphere_grid.GetCell(position),
+                sphere_grid.GetCellCount());
+        }
+    }
+
+    TEST_F(SphereGridTest, SphereGridTestMatchBruteForce) {
+        darwin::SphereGrid sphere_grid(darwin::ALMOST_INTERSECT_ANGLE);
+        PopulatePositions(1'000);
+        sphere_grid.Build(positions_, [](std::size_t) { return true; });
+        std::vector<std::uint32_t> cells;
+        for (std::size_t i = 0; i < positions_.size(); ++i) {
+            std::set<std::size_t> expected;
+            for (std::size_t j = 0; j < positions_.size(); ++j) {
+                if (glm::dot(
+                        glm::normalize(positions_[i]),
+                        glm::normalize(positions_[j])) >
+                    darwin::ALMOST_INTERSECT)
+                {
+                    expected.insert(j);
+                }
+            }
+            std::set<std::size_t> found;
+            sphere_grid.GetCellsInCap(
+                positions_[i],
+                darwin::ALMOST_INTERSECT_ANGLE,
+                cells);
+            for (const auto cell : cells) {
+                for (const auto j : sphere_grid.GetCellItems(cell)) {
+                    if (glm::dot(
+                            glm::normalize(positions_[i]),
+                            glm::normalize(positions_[j])) >
+                        darwin::ALMOST_INTERSECT)
+                    {
+                        found.insert(j);
+                    }
+                }
+            }
+            EXPECT_EQ(expected, found);
+        }
+    }
+
+    TEST_F(SphereGridTest, SphereGridTestBuildFilter) {
+        darwin::SphereGrid sphere_grid(darwin::ALMOST_INTERSECT_ANGLE);
+        PopulatePositions(100);
+        sphere_grid.Build(
+            positions_,
+            [](std::size_t i) { return i % 2 == 0; });
+        std::size_t count = 0;
+        for (std::uint32_t cell = 0; cell < sphere_grid.GetCellCount(); ++cell)
+        {
+            for (const auto i : sphere_grid.GetCellItems(cell)) {
+                EXPECT_EQ(i % 2, 0);
+                EXPECT_EQ(sphere_grid.GetCell(positions_[i]), cell);
+                ++count;
+            }
+        }
+        EXPECT_EQ(count, 50);
+    }
+
+    TEST_F(SphereGridTest, SphereGridTestWideCap) {
+        darwin::SphereGrid sphere_grid(darwin::ALMOST_INTERSECT_ANGLE);
+        PopulatePositions(1'000);
+        sphere_grid.Build(positions_, [](std::size_t) { return true; });
+        for (std::uint32_t cell = 0; cell < sphere_grid.GetCellCount(); ++cell)
+        {
+            EXPECT_EQ(
+                sphere_grid.GetCell(sphere_grid.GetCellCenter(cell)),
+                cell);
+        }
+        std::vector<std::uint32_t> cells;
+        const double angle = darwin::PI * 0.4;
+        const double min_dot = std::cos(angle);
+        for (std::size_t i = 0; i < positions_.size(); i += 10) {
+            const glm::dvec3 normal = glm::normalize(positions_[i]);
+            std::set<std::size_t> expected;
+            for (std::size_t j = 0; j < positions_.size(); ++j) {
+                if (glm::dot(normal, glm::normalize(positions_[j])) > min_dot)
+                {
+                    expected.insert(j);
+                }
+            }
+            std::set<std::size_t> found;
+            sphere_grid.GetCellsInCap(positions_[i], angle, cells);
+            for (const auto cell : cells) {
+                for (const auto j : sphere_grid.GetCellItems(cell)) {
+                    if (glm::dot(normal, glm::normalize(positions_[j])) >
+                        min_dot)
+                    {
+                        found.insert(j);
+                    }
+                }
+            }
+            EXPECT_EQ(expected, found);
+        }
+    }
+
+} // namespace test.
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "Server/sphere_grid.h"
+#include <gtest/gtest.h>
+
+namespace test {
+
+    class SphereGridTest : public testing::Test {
+    public:
+        SphereGridTest() = default;
+        void PopulatePositions(std::size_t count);
+
+    protected:
+        std::vector<glm::dvec3> positions_;
+    };
+
+} // namespace test.
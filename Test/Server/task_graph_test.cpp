@@ -0,0 +1,184 @@
+#include "Test/Server/task_graph_test.h"
+
+#include <atomic>
+#include <cmath>
+#include <format>
+#include <mutex>
+#include <random>
+
+#include "Common/stl_proto_wrapper.h"
+#include "Common/vector.h"
+
+namespace test {
+
+    void TaskGraphTest::FillWorld(
+        darwin::WorldState& world_state,
+        unsigned seed) const
+    {
+        proto::PlayerParameter player_parameter;
+        player_parameter.set_victory_size(45.0);
+        player_parameter.set_max_upgrade_grow(100.0);
+        player_parameter.set_eat_speed(1.0);
+        player_parameter.set_penalty(-0.5);
+        player_parameter.set_disconnection_timeout(1'000.0);
+        for (int i = 0; i < 2; ++i) {
+            auto* color_parameter = player_parameter.add_color_parameters();
+            color_parameter->mutable_color()->CopyFrom(
+                darwin::CreateVector3(0.0, i, 1.0 - i));
+        }
+        world_state.SetPlayerParameter(player_parameter);
+        world_state.AddElement(
+            darwin::CreateBasicElement(
+                "ground",
+                proto::TYPE_GROUND,
+                darwin::CreateVector3(0.0, 0.0, 0.0),
+                1'000'000'000.0,
+                100.0));
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<double> cap(-0.3, 0.3);
+        std::uniform_real_distribution<double> mass(0.5, 50.0);
+        auto random_position = [&](double height) {
+            const double x = cap(gen);
+            const double y = cap(gen);
+            const double scale = height / std::sqrt(x * x + y * y + 1.0);
+            return darwin::CreateVector3(x * scale, y * scale, scale);
+        };
+        for (int i = 0; i < 200; ++i) {
+            auto upgrade = darwin::CreateBasicElement(
+                std::format("upgrade{}", i),
+                proto::TYPE_UPGRADE,
+                random_position(100.5),
+                1.0,
+                0.5);
+            upgrade.mutable_color()->CopyFrom(
+                darwin::CreateVector3(0.0, i % 2, 1.0 - i % 2));
+            world_state.AddElement(upgrade);
+        }
+        for (int i = 0; i < 600; ++i) {
+            auto character = darwin::CreateBasicCharacter(
+                std::format("character{}", i),
+                random_position(101.0),
+                mass(gen),
+                1.0);
+            character.mutable_color()->CopyFrom(
+                darwin::CreateVector3(0.0, i % 3 == 0, i % 3 != 0));
+            character.set_status_enum(
+                i % 2 ? proto::STATUS_ON_GROUND : proto::STATUS_JUMPING);
+            world_state.AddCharacter(character);
+        }
+    }
+
+    TEST_F(TaskGraphTest, TaskGraphTestDependencies) {
+        darwin::WorkerPool worker_pool(3);
+        for (auto* pool : { &worker_pool, (darwin::WorkerPool*)nullptr }) {
+            darwin::TaskGraph task_graph;
+            std::mutex mutex;
+            std::vector<darwin::TaskId> done;
+            std::vector<std::vector<darwin::TaskId>> dependencies;
+            // Check that the dependencies of a task are done before it.
+            auto add_task = [&](std::initializer_list<darwin::TaskId> list) {
+                const std::size_t i = dependencies.size();
+                dependencies.push_back(list);
+                return task_graph.AddTask(
+                    darwin::TickPhaseEnum::TICK_PHASE_UPDATE,
+                    [&done, &mutex, &dependencies, i] {
+                        std::scoped_lock l(mutex);
+                        for (const auto dependency : dependencies[i]) {
+                            EXPECT_NE(
+                                std::find(
+                                    done.begin(),
+                                    done.end(),
+                                    dependency),
+                                done.end());
+                        }
+                        done.push_back(i);
+                    },
+                    list);
+            };
+            const auto a = add_task({});
+            const auto b = add_task({});
+            const auto c = add_task({ a });
+            const auto d = add_task({ a, b });
+            const auto e = add_task({ c });
+            add_task({ d, e });
+            add_task({});
+            task_graph.Run(pool, nullptr);
+            EXPECT_EQ(dependencies.size(), done.size());
+        }
+    }
+
+    TEST_F(TaskGraphTest, TaskGraphTestParallelTask) {
+        darwin::WorkerPool worker_pool(3);
+        darwin::TickProfiler tick_profiler;
+        std::vector<std::atomic<int>> counts(10'000);
+        darwin::TaskGraph task_graph;
+        const auto first = task_graph.AddParallelTask(
+            darwin::TickPhaseEnum::TICK_PHASE_GROUND,
+            counts.size(),
+            64,
+            [&counts](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) {
+                    ++counts[i];
+                }
+            });
+        // Uneven chunks, the first ones are stolen from the calling thread.
+        task_graph.AddParallelTask(
+            darwin::TickPhaseEnum::TICK_PHASE_DEATH,
+            counts.size(),
+            16,
+            [&counts](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) {
+                    EXPECT_EQ(1, counts[i].load());
+                    if (i < 1'000) {
+                        std::this_thread::yield();
+                    }
+                    ++counts[i];
+                }
+            },
+            { first });
+        task_graph.Run(&worker_pool, &tick_profiler);
+        tick_profiler.Flush();
+        for (const auto& count : counts) {
+            EXPECT_EQ(2, count.load());
+        }
+        EXPECT_EQ(
+            1,
+            tick_profiler.GetStatistics(
+                darwin::TickPhaseEnum::TICK_PHASE_GROUND).count);
+    }
+
+    TEST_F(TaskGraphTest, TaskGraphTestUpdateMatchSequential) {
+        darwin::WorkerPool worker_pool(3);
+        darwin::WorldState sequential_world_state;
+        darwin::WorldState parallel_world_state;
+        FillWorld(sequential_world_state, 42);
+        FillWorld(parallel_world_state, 42);
+        parallel_world_state.SetWorkerPool(&worker_pool);
+        // The eaten upgrades are replaced at random, alike in both worlds.
+        for (int step = 0; step < 4; ++step) {
+            const double time = 1.0 + step * 0.25;
+            darwin::SetRandomSeed(step);
+            sequential_world_state.Update(time);
+            darwin::SetRandomSeed(step);
+            parallel_world_state.Update(time);
+        }
+        const auto expected_characters =
+            sequential_world_state.GetCharacters();
+        const auto characters = parallel_world_state.GetCharacters();
+        ASSERT_EQ(expected_characters.size(), characters.size());
+        std::size_t dead_count = 0;
+        for (std::size_t i = 0; i < characters.size(); ++i) {
+            EXPECT_EQ(
+                expected_characters[i].SerializeAsString(),
+                characters[i].SerializeAsString());
+            dead_count +=
+                characters[i].status_enum() == proto::STATUS_DEAD;
+        }
+        // The world does eat, lose and win.
+        EXPECT_GT(dead_count, 0);
+        EXPECT_EQ(
+            sequential_world_state.GetSequence(),
+            parallel_world_state.GetSequence());
+    }
+
+} // namespace test.
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "Server/task_graph.h"
+#include "Server/world_state.h"
+#include <gtest/gtest.h>
+
+namespace test {
+
+    class TaskGraphTest : public testing::Test {
+    public:
+        TaskGraphTest() = default;
+        // Crowded cap of characters of random masses (some die, some win)
+        // and upgrades, the same world for the same seed.
+        void FillWorld(darwin::WorldState& world_state, unsigned seed) const;
+    };
+
+} // namespace test.
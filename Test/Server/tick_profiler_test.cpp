@@ -0,0 +1,47 @@
+#include "Test/Server/tick_profiler_test.h"
+
+namespace test {
+
+    TEST_F(TickProfilerTest, TickProfilerTestPercentiles) {
+        // Two adds in a tick are one sample.
+        for (int i = 1; i <= 100; ++i) {
+            tick_profiler_.Add(
+                darwin::TickPhaseEnum::TICK_PHASE_GROUND, i * 0.0005);
+            tick_profiler_.Add(
+                darwin::TickPhaseEnum::TICK_PHASE_GROUND, i * 0.0005);
+            tick_profiler_.Flush();
+        }
+        auto statistics = tick_profiler_.GetStatistics(
+            darwin::TickPhaseEnum::TICK_PHASE_GROUND);
+        EXPECT_EQ(statistics.count, 100);
+        EXPECT_NEAR(statistics.p50, 0.051, 1e-9);
+        EXPECT_NEAR(statistics.p99, 0.099, 1e-9);
+        EXPECT_NEAR(statistics.max, 0.1, 1e-9);
+        // Untouched phases have no samples.
+        EXPECT_EQ(
+            tick_profiler_.GetStatistics(
+                darwin::TickPhaseEnum::TICK_PHASE_DEATH).count,
+            0);
+    }
+
+    TEST_F(TickProfilerTest, TickProfilerTestRollingWindow) {
+        for (int i = 0; i < 150; ++i) {
+            tick_profiler_.Add(
+                darwin::TickPhaseEnum::TICK_PHASE_STEP,
+                i < 60 ? 1.0 : 0.001);
+            tick_profiler_.Flush();
+        }
+        // Only the last 100 samples are kept.
+        auto statistics = tick_profiler_.GetStatistics(
+            darwin::TickPhaseEnum::TICK_PHASE_STEP);
+        EXPECT_EQ(statistics.count, 100);
+        EXPECT_DOUBLE_EQ(statistics.p50, 0.001);
+        EXPECT_DOUBLE_EQ(statistics.max, 1.0);
+        {
+            darwin::ScopedPhaseTimer timer(
+                nullptr, darwin::TickPhaseEnum::TICK_PHASE_STEP);
+        }
+        EXPECT_NE(tick_profiler_.ToString().find("step"), std::string::npos);
+    }
+
+} // namespace test.
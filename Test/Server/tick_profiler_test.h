@@ -0,0 +1,16 @@
+#pragma once
+
+#include "Server/tick_profiler.h"
+#include <gtest/gtest.h>
+
+namespace test {
+
+    class TickProfilerTest : public testing::Test {
+    public:
+        TickProfilerTest() = default;
+
+    protected:
+        darwin::TickProfiler tick_profiler_{ 100 };
+    };
+
+} // namespace test.
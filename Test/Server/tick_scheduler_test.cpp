@@ -0,0 +1,83 @@
+#include "Test/Server/tick_scheduler_test.h"
+
+#include <chrono>
+#include <ctime>
+#include <thread>
+#include <vector>
+
+namespace test {
+
+    TEST_F(TickSchedulerTest, TickSchedulerTestFixedStep) {
+        tick_scheduler_.SetPeriods(0.002, 0.01, 5);
+        std::vector<double> step_times;
+        std::vector<double> broadcast_times;
+        tick_scheduler_.Run(
+            100.0,
+            [this, &step_times](double time) {
+                step_times.push_back(time);
+                if (step_times.size() == 50) {
+                    tick_scheduler_.Stop();
+                }
+            },
+            [&broadcast_times](double time) {
+                broadcast_times.push_back(time);
+            });
+        ASSERT_EQ(step_times.size(), 50);
+        // The simulation time only moves by fixed steps.
+        EXPECT_DOUBLE_EQ(step_times.front(), 100.0);
+        for (std::size_t i = 1; i < step_times.size(); ++i) {
+            EXPECT_GE(step_times[i] - step_times[i - 1], 0.002 - 1e-9);
+        }
+        // Broadcasts go out at their own lower rate.
+        EXPECT_FALSE(broadcast_times.empty());
+        EXPECT_LT(broadcast_times.size(), step_times.size());
+        const auto metrics = tick_scheduler_.GetMetrics();
+        EXPECT_EQ(metrics.step_count, 50);
+        EXPECT_EQ(metrics.broadcast_count, broadcast_times.size());
+    }
+
+    TEST_F(TickSchedulerTest, TickSchedulerTestCatchUp) {
+        tick_scheduler_.SetPeriods(0.001, 0.01, 3);
+        int step_count = 0;
+        tick_scheduler_.Run(
+            0.0,
+            [this, &step_count](double) {
+                // A slow step is an overrun and put the simulation behind.
+                if (step_count == 0) {
+                    std::this_thread::sleep_for(
+                        std::chrono::milliseconds(20));
+                }
+                if (++step_count == 10) {
+                    tick_scheduler_.Stop();
+                }
+            },
+            [](double) {});
+        const auto metrics = tick_scheduler_.GetMetrics();
+        EXPECT_GE(metrics.overrun_count, 1);
+        EXPECT_GT(metrics.skipped_step_count, 0);
+        EXPECT_GE(metrics.max_step_duration, 0.02);
+        EXPECT_GT(metrics.max_jitter, 0.0);
+    }
+
+    TEST_F(TickSchedulerTest, TickSchedulerTestFastBroadcast) {
+        // Broadcasts more often than steps, at most one per step.
+        tick_scheduler_.SetPeriods(0.01, 0.001, 5);
+        int step_count = 0;
+        int broadcast_count = 0;
+        const std::clock_t start = std::clock();
+        tick_scheduler_.Run(
+            0.0,
+            [this, &step_count](double) {
+                if (++step_count == 20) {
+                    tick_scheduler_.Stop();
+                }
+            },
+            [&broadcast_count](double) { ++broadcast_count; });
+        const double cpu_time =
+            static_cast<double>(std::clock() - start) / CLOCKS_PER_SEC;
+        EXPECT_LE(broadcast_count, step_count);
+        // About 0.2 s of waiting, a busy loop would take all of it.
+        EXPECT_LT(cpu_time, 0.1);
+    }
+
+} // namespace test.
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "Server/tick_scheduler.h"
+#include <gtest/gtest.h>
+
+namespace test {
+
+    class TickSchedulerTest : public testing::Test {
+    public:
+        TickSchedulerTest() = default;
+
+    protected:
+        darwin::TickScheduler tick_scheduler_;
+    };
+
+} // namespace test.
@@ -0,0 +1,57 @@
+#include "Test/Server/update_writer_test.h"
+
+#include <google/protobuf/util/message_differencer.h>
+
+#include "Common/stl_proto_wrapper.h"
+#include "Common/vector.h"
+
+namespace test {
+
+    void UpdateWriterTest::PopulateResponse() {
+        response_.set_time(1.0);
+        response_.set_sequence(42);
+        for (int i = 0; i < 100; ++i) {
+            response_.add_elements()->CopyFrom(
+                darwin::CreateBasicElement(
+                    std::format("element{}", i),
+                    proto::TYPE_UPGRADE,
+                    darwin::CreateVector3(i, 2.0, 3.0),
+                    1.0,
+                    1.0));
+        }
+    }
+
+    TEST_F(UpdateWriterTest, UpdateWriterTestSerializeUpdate) {
+        PopulateResponse();
+        auto buffer = darwin::SerializeUpdateResponse(response_);
+        proto::UpdateResponse response;
+        EXPECT_TRUE(
+            grpc::SerializationTraits<proto::UpdateResponse>::Deserialize(
+                &buffer,
+                &response).ok());
+        EXPECT_TRUE(
+            google::protobuf::util::MessageDifferencer::Equals(
+                response,
+                response_));
+    }
+
+    TEST_F(UpdateWriterTest, UpdateWriterTestSerializePlay) {
+        PopulateResponse();
+        const auto update = darwin::SerializeUpdateResponse(response_);
+        for (const std::uint64_t report_sequence : { 0, 1, 1'000'000 }) {
+            auto buffer =
+                darwin::SerializePlayResponse(update, report_sequence);
+            proto::PlayResponse play_response;
+            EXPECT_TRUE(
+                grpc::SerializationTraits<proto::PlayResponse>::Deserialize(
+                    &buffer,
+                    &play_response).ok());
+            EXPECT_EQ(play_response.report_sequence(), report_sequence);
+            EXPECT_TRUE(
+                google::protobuf::util::MessageDifferencer::Equals(
+                    play_response.update(),
+                    response_));
+        }
+    }
+
+} // namespace test.
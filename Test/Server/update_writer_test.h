@@ -0,0 +1,17 @@
+#pragma once
+
+#include "Server/update_writer.h"
+#include <gtest/gtest.h>
+
+namespace test {
+
+    class UpdateWriterTest : public testing::Test {
+    public:
+        UpdateWriterTest() = default;
+        void PopulateResponse();
+
+    protected:
+        proto::UpdateResponse response_;
+    };
+
+} // namespace test.
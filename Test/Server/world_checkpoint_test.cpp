@@ -0,0 +1,97 @@
+#include "world_checkpoint_test.h"
+
+#include "Common/vector.h"
+#include "Server/world_snapshot.h"
+
+namespace test {
+
+    void WorldCheckpointTest::SetUp() {
+        std::filesystem::remove_all(directory_);
+        AddElement("ground", 1000.0);
+        world_state_.Update(1.0);
+    }
+
+    void WorldCheckpointTest::TearDown() {
+        std::filesystem::remove_all(directory_);
+    }
+
+    void WorldCheckpointTest::AddElement(const std::string& name, double mass)
+    {
+        world_state_.AddElement(
+            darwin::CreateBasicElement(
+                name,
+                proto::TYPE_GROUND,
+                darwin::CreateVector3(0.0, 0.0, 0.0),
+                mass,
+                100.0));
+    }
+
+    TEST_F(WorldCheckpointTest, WorldCheckpointTestPeriodAndRetention) {
+        darwin::WorldCheckpointer checkpointer(
+            world_state_,
+            directory_,
+            10.0,
+            2);
+        // First tick checkpoints, then once by period.
+        for (int i = 0; i < 30; ++i) {
+            checkpointer.Tick(static_cast<double>(i));
+            checkpointer.Flush();
+        }
+        // The flushes also checkpoint.
+        EXPECT_EQ(33, checkpointer.GetWrittenCount());
+        std::size_t count = 0;
+        for (const auto& entry :
+            std::filesystem::directory_iterator(directory_))
+        {
+            EXPECT_EQ(".bin", entry.path().extension());
+            ++count;
+        }
+        EXPECT_EQ(2, count);
+    }
+
+    TEST_F(WorldCheckpointTest, WorldCheckpointTestChanges) {
+        darwin::WorldCheckpointer checkpointer(
+            world_state_,
+            directory_,
+            0.0,
+            3);
+        // No period, only the first tick and on request.
+        checkpointer.Tick(1.0);
+        checkpointer.Tick(1.5);
+        checkpointer.Flush();
+        EXPECT_EQ(2, checkpointer.GetWrittenCount());
+        AddElement("moon", 10.0);
+        AddElement("ground", 2000.0);
+        checkpointer.RequestCheckpoint();
+        checkpointer.Tick(2.0);
+        checkpointer.Flush();
+        EXPECT_EQ(4, checkpointer.GetWrittenCount());
+        auto maybe_latest =
+            darwin::WorldCheckpointer::FindLatestCheckpoint(directory_);
+        ASSERT_TRUE(maybe_latest);
+        EXPECT_EQ(
+            "world_checkpoint_0000000003.bin",
+            maybe_latest->filename().string());
+        darwin::WorldState world_state;
+        darwin::LoadWorldStateFromSnapshot(world_state, *maybe_latest);
+        const auto elements = world_state.GetElements();
+        ASSERT_EQ(2, elements.size());
+        for (const auto& element : elements) {
+            EXPECT_EQ(
+                element.name() == "ground" ? 2000.0 : 10.0,
+                element.physic().mass());
+        }
+        // Numbering goes on after a restart.
+        darwin::WorldCheckpointer restarted(
+            world_state,
+            directory_,
+            0.0,
+            3);
+        restarted.Flush();
+        EXPECT_EQ(
+            "world_checkpoint_0000000004.bin",
+            darwin::WorldCheckpointer::FindLatestCheckpoint(directory_)
+                ->filename().string());
+    }
+
+} // namespace test.
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <filesystem>
+
+#include "Server/world_checkpoint.h"
+#include <gtest/gtest.h>
+
+namespace test {
+
+    class WorldCheckpointTest : public testing::Test {
+    public:
+        WorldCheckpointTest() = default;
+        void SetUp() override;
+        void TearDown() override;
+        void AddElement(const std::string& name, double mass);
+
+    protected:
+        darwin::WorldState world_state_;
+        std::filesystem::path directory_ =
+            std::filesystem::temp_directory_path() /
+            "darwin_world_checkpoint_test";
+    };
+
+} // namespace test.
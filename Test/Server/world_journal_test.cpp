@@ -0,0 +1,144 @@
+#include "world_journal_test.h"
+
+#include "Common/vector.h"
+#include "Server/world_checkpoint.h"
+#include "Server/world_snapshot.h"
+
+namespace test {
+
+    namespace {
+
+        proto::Element CreateElement(const std::string& name, double mass) {
+            return darwin::CreateBasicElement(
+                name,
+                proto::TYPE_GROUND,
+                darwin::CreateVector3(0.0, 0.0, 0.0),
+                mass,
+                100.0);
+        }
+
+        proto::Character CreateCharacter(
+            const std::string& name,
+            double mass)
+        {
+            return darwin::CreateBasicCharacter(
+                name,
+                darwin::CreateVector3(0.0, 0.0, 1000.0),
+                mass,
+                1.0);
+        }
+
+    }  // End namespace.
+
+    void WorldJournalTest::SetUp() {
+        std::filesystem::remove_all(directory_);
+        world_state_.AddElement(CreateElement("ground", 1000.0));
+        world_state_.Update(1.0);
+    }
+
+    void WorldJournalTest::TearDown() {
+        std::filesystem::remove_all(directory_);
+    }
+
+    TEST_F(WorldJournalTest, WorldJournalTestReplay) {
+        {
+            darwin::WorldJournal world_journal(directory_);
+            proto::WorldJournalEntry entry;
+            entry.set_time(2.0);
+            *entry.add_elements() = CreateElement("moon", 10.0);
+            *entry.add_characters() = CreateCharacter("bob", 5.0);
+            world_journal.Append(0, entry);
+            entry.Clear();
+            entry.set_time(3.0);
+            entry.add_removed_elements("moon");
+            *entry.add_characters() = CreateCharacter("bob", 6.0);
+            world_journal.Append(0, entry);
+            entry.Clear();
+            entry.set_time(4.0);
+            *entry.add_elements() = CreateElement("sun", 20.0);
+            world_journal.Append(1, entry);
+            world_journal.Flush();
+            EXPECT_EQ(3, world_journal.GetWrittenCount());
+            EXPECT_LE(1, world_journal.GetSyncCount());
+        }
+        EXPECT_EQ(
+            3,
+            darwin::ReplayWorldJournal(world_state_, directory_, 0));
+        EXPECT_EQ(4.0, world_state_.GetLastUpdated());
+        const auto elements = world_state_.GetElements();
+        ASSERT_EQ(2, elements.size());
+        EXPECT_EQ("sun", elements[1].name());
+        const auto characters = world_state_.GetCharacters();
+        ASSERT_EQ(1, characters.size());
+        EXPECT_EQ(6.0, characters[0].physic().mass());
+        darwin::WorldState world_state;
+        EXPECT_EQ(1, darwin::ReplayWorldJournal(world_state, directory_, 1));
+    }
+
+    TEST_F(WorldJournalTest, WorldJournalTestTornTail) {
+        {
+            darwin::WorldJournal world_journal(directory_);
+            for (int i = 0; i < 3; ++i) {
+                proto::WorldJournalEntry entry;
+                entry.set_time(2.0 + i);
+                *entry.add_elements() = CreateElement("moon", 10.0 + i);
+                world_journal.Append(0, entry);
+            }
+        }
+        const auto segment = directory_ / "world_journal_0000000000.bin";
+        std::filesystem::resize_file(
+            segment,
+            std::filesystem::file_size(segment) - 3);
+        EXPECT_EQ(
+            2,
+            darwin::ReplayWorldJournal(world_state_, directory_, 0));
+        EXPECT_EQ(3.0, world_state_.GetLastUpdated());
+    }
+
+    TEST_F(WorldJournalTest, WorldJournalTestRecovery) {
+        {
+            darwin::WorldJournal world_journal(directory_);
+            darwin::WorldCheckpointer checkpointer(
+                world_state_,
+                directory_,
+                0.0,
+                2);
+            checkpointer.SetWorldJournal(&world_journal);
+            checkpointer.Tick(1.0);
+            world_state_.AddElement(CreateElement("moon", 10.0));
+            world_state_.AddCharacter(CreateCharacter("bob", 5.0));
+            // No update, it would apply the rules to bob.
+            checkpointer.Tick(2.0);
+            world_state_.AddElement(CreateElement("moon", 12.0));
+            checkpointer.Tick(3.0);
+            // Crash, only what the journal has on disk is left.
+            world_journal.Flush();
+        }
+        const auto maybe_checkpoint =
+            darwin::WorldCheckpointer::FindLatestCheckpoint(directory_);
+        ASSERT_TRUE(maybe_checkpoint);
+        darwin::WorldState world_state;
+        darwin::LoadWorldStateFromSnapshot(world_state, *maybe_checkpoint);
+        EXPECT_EQ(1, world_state.GetElements().size());
+        EXPECT_EQ(
+            3,
+            darwin::ReplayWorldJournal(
+                world_state,
+                directory_,
+                *darwin::WorldCheckpointer::GetCheckpointIndex(
+                    *maybe_checkpoint)));
+        const auto elements = world_state.GetElements();
+        ASSERT_EQ(2, elements.size());
+        EXPECT_EQ(12.0, elements[1].physic().mass());
+        ASSERT_EQ(1, world_state.GetCharacters().size());
+        // The player takes the character back.
+        EXPECT_TRUE(
+            world_state.CreateCharacter(
+                "peer",
+                "bob",
+                darwin::CreateVector3(1.0, 0.0, 0.0)));
+        EXPECT_TRUE(world_state.IsCharacterOwnByPeer("peer", "bob"));
+        EXPECT_EQ(5.0, world_state.GetCharacters()[0].physic().mass());
+    }
+
+} // namespace test.
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <filesystem>
+
+#include "Server/world_journal.h"
+#include <gtest/gtest.h>
+
+namespace test {
+
+    class WorldJournalTest : public testing::Test {
+    public:
+        WorldJournalTest() = default;
+        void SetUp() override;
+        void TearDown() override;
+
+    protected:
+        darwin::WorldState world_state_;
+        std::filesystem::path directory_ =
+            std::filesystem::temp_directory_path() /
+            "darwin_world_journal_test";
+    };
+
+} // namespace test.
@@ -0,0 +1,340 @@
+#include "world_replay_test.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <format>
+#include <fstream>
+#include <memory>
+#include <thread>
+
+#include "Common/vector.h"
+#include "Server/darwin_service_impl.h"
+#include "Server/world_recorder.h"
+
+namespace test {
+
+    namespace {
+
+        proto::RecordedEvent CreateEvent(
+            double time,
+            proto::RecordedEventEnum recorded_event_enum,
+            const std::string& peer)
+        {
+            proto::RecordedEvent event;
+            event.set_time(time);
+            event.set_recorded_event_enum(recorded_event_enum);
+            event.set_peer(peer);
+            return event;
+        }
+
+    }  // End namespace.
+
+    void WorldReplayTest::SetUp() {
+        std::filesystem::remove(filename_);
+        header_.set_version(darwin::WORLD_RECORDING_VERSION);
+        header_.set_random_seed(42);
+        header_.set_step_period(0.1);
+        header_.set_broadcast_period(0.1);
+        header_.set_upgrade_count(20);
+        header_.set_server_hit_detection(true);
+        auto* world = header_.mutable_world();
+        world->set_time(1.0);
+        *world->add_elements() = darwin::CreateBasicElement(
+            "ground",
+            proto::TYPE_GROUND,
+            darwin::CreateVector3(0.0, 0.0, 0.0),
+            1000.0,
+            100.0);
+        auto* player_parameter = world->mutable_player_parameter();
+        player_parameter->set_start_mass(10.0);
+        player_parameter->set_drop_height(5.0);
+        player_parameter->set_disconnection_timeout(10.0);
+        player_parameter->set_victory_size(1000.0);
+        auto* red = player_parameter->add_color_parameters();
+        red->set_name("red");
+        red->mutable_color()->CopyFrom(darwin::CreateVector3(1.0, 0.0, 0.0));
+        auto* blue = player_parameter->add_color_parameters();
+        blue->set_name("blue");
+        blue->mutable_color()->CopyFrom(
+            darwin::CreateVector3(0.0, 0.0, 1.0));
+        // Bob joins, moves and leaves between the steps.
+        auto create = CreateEvent(
+            1.05,
+            proto::RECORDED_EVENT_CREATE_CHARACTER,
+            "peer_bob");
+        create.mutable_create_character()->set_name("bob");
+        create.mutable_create_character()->mutable_color()->CopyFrom(
+            darwin::CreateVector3(1.0, 0.0, 0.0));
+        events_.push_back(create);
+        for (int i = 1; i <= 10; ++i) {
+            const double time = 1.0 + i * 0.1;
+            events_.push_back(
+                CreateEvent(time, proto::RECORDED_EVENT_STEP, {}));
+            auto report = CreateEvent(
+                time + 0.01,
+                proto::RECORDED_EVENT_PLAY_REPORT,
+                "peer_bob");
+            report.mutable_report()->set_name("bob");
+            report.mutable_report()->set_status_enum(
+                proto::STATUS_ON_GROUND);
+            report.mutable_report()->mutable_physic()->mutable_position()
+                ->CopyFrom(darwin::CreateVector3(0.0, 105.0, i * 0.5));
+            report.set_report_sequence(i);
+            events_.push_back(report);
+        }
+        events_.push_back(
+            CreateEvent(2.15, proto::RECORDED_EVENT_DISCONNECT, "peer_bob"));
+        events_.push_back(CreateEvent(2.2, proto::RECORDED_EVENT_STEP, {}));
+    }
+
+    void WorldReplayTest::RecordLiveSession(
+        darwin::WorldState& world_state,
+        bool report_hits)
+    {
+        // Players report from their threads while the tick runs.
+        constexpr int player_count = 4;
+        darwin::StartRecordedWorldState(world_state, header_);
+        darwin::DarwinServiceImpl service{ world_state };
+        service.SetTickPeriods(
+            header_.step_period(),
+            header_.broadcast_period(),
+            1);
+        darwin::WorldRecorder world_recorder(filename_, header_);
+        service.SetWorldRecorder(&world_recorder);
+        for (int i = 0; i < player_count; ++i) {
+            auto create = CreateEvent(
+                1.0,
+                proto::RECORDED_EVENT_CREATE_CHARACTER,
+                std::format("peer_{}", i));
+            create.mutable_create_character()->set_name(
+                std::format("player_{}", i));
+            create.mutable_create_character()->mutable_color()->CopyFrom(
+                darwin::CreateVector3(1.0, 0.0, 0.0));
+            service.ReplayEvent(create);
+        }
+        std::atomic<bool> is_running = true;
+        auto report_loop = [&](int i) {
+            const bool is_play = i % 2 == 1;
+            std::uint64_t sequence = 0;
+            while (is_running) {
+                ++sequence;
+                auto report = CreateEvent(
+                    0.0,
+                    is_play ?
+                        proto::RECORDED_EVENT_PLAY_REPORT :
+                        proto::RECORDED_EVENT_REPORT_IN_GAME,
+                    std::format("peer_{}", i));
+                auto* player_report = report.mutable_report();
+                player_report->set_name(std::format("player_{}", i));
+                player_report->set_status_enum(proto::STATUS_JUMPING);
+                player_report->mutable_physic()->mutable_position()
+                    ->CopyFrom(darwin::CreateVector3(i, 105.0, sequence));
+                if (report_hits) {
+                    // Everybody on the same upgrade.
+                    for (const auto& element :
+                        world_state.GetView()->GetElements())
+                    {
+                        if (element.type_enum() == proto::TYPE_UPGRADE) {
+                            player_report->mutable_physic()
+                                ->mutable_position()->CopyFrom(
+                                    element.physic().position());
+                            player_report->set_potential_hit(
+                                element.name());
+                            break;
+                        }
+                    }
+                }
+                if (is_play) {
+                    report.set_report_sequence(sequence);
+                }
+                service.ReplayEvent(report);
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            }
+        };
+        std::vector<std::thread> players;
+        for (int i = 0; i < player_count; ++i) {
+            players.emplace_back(report_loop, i);
+        }
+        for (int i = 1; i <= 30; ++i) {
+            service.TickStep(1.0 + i * 0.1);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        is_running = false;
+        for (auto& player : players) {
+            player.join();
+        }
+        service.ReplayEvent(
+            CreateEvent(4.1, proto::RECORDED_EVENT_DISCONNECT, "peer_0"));
+        service.TickStep(4.2);
+        service.SetWorldRecorder(nullptr);
+    }
+
+    void WorldReplayTest::TearDown() {
+        std::filesystem::remove(filename_);
+    }
+
+    TEST_F(WorldReplayTest, WorldReplayTestRecordAndLoad) {
+        {
+            darwin::WorldRecorder world_recorder(filename_, header_);
+            for (const auto& event : events_) {
+                world_recorder.Record(event);
+            }
+            EXPECT_EQ(events_.size(), world_recorder.GetRecordedCount());
+        }
+        // A torn frame at the end (crash while recording) is ignored.
+        {
+            std::ofstream ofs(filename_, std::ios::binary | std::ios::app);
+            const std::uint32_t size = 1000;
+            ofs.write(reinterpret_cast<const char*>(&size), sizeof(size));
+            ofs.write("torn", 4);
+        }
+        proto::RecordingHeader header;
+        std::vector<proto::RecordedEvent> events;
+        darwin::LoadWorldRecording(filename_, header, events);
+        EXPECT_EQ(header_.SerializeAsString(), header.SerializeAsString());
+        ASSERT_EQ(events_.size(), events.size());
+        for (std::size_t i = 0; i < events.size(); ++i) {
+            EXPECT_EQ(
+                events_[i].SerializeAsString(),
+                events[i].SerializeAsString());
+        }
+    }
+
+    TEST_F(WorldReplayTest, WorldReplayTestDeterministic) {
+        darwin::WorldState first_world_state;
+        const auto first = darwin::ReplayWorldRecording(
+            first_world_state,
+            header_,
+            events_);
+        EXPECT_EQ(11, first.step_count);
+        EXPECT_EQ(events_.size(), first.event_count);
+        EXPECT_EQ(2.2, first_world_state.GetLastUpdated());
+        EXPECT_FALSE(first_world_state.HasCharacter("bob"));
+        darwin::WorldState second_world_state;
+        const auto second = darwin::ReplayWorldRecording(
+            second_world_state,
+            header_,
+            events_);
+        EXPECT_EQ(first.world_hash, second.world_hash);
+        // The upgrades are elsewhere with another seed.
+        header_.set_random_seed(43);
+        darwin::WorldState other_world_state;
+        const auto other = darwin::ReplayWorldRecording(
+            other_world_state,
+            header_,
+            events_);
+        EXPECT_NE(first.world_hash, other.world_hash);
+    }
+
+    TEST_F(WorldReplayTest, WorldReplayTestLiveSession) {
+        darwin::WorldState world_state;
+        RecordLiveSession(world_state, false);
+        proto::RecordingHeader header;
+        std::vector<proto::RecordedEvent> events;
+        darwin::LoadWorldRecording(filename_, header, events);
+        darwin::WorldState replay_world_state;
+        const auto replay = darwin::ReplayWorldRecording(
+            replay_world_state,
+            header,
+            events);
+        EXPECT_EQ(31, replay.step_count);
+        // Reports were drained by most steps.
+        EXPECT_GT(replay.event_count, 100);
+        EXPECT_FALSE(replay_world_state.HasCharacter("player_0"));
+        EXPECT_TRUE(replay_world_state.HasCharacter("player_1"));
+        EXPECT_EQ(
+            darwin::HashWorldState(world_state),
+            replay.world_hash);
+    }
+
+    TEST_F(WorldReplayTest, WorldReplayTestLiveHits) {
+        // The players race for the same upgrades, the one that gets it
+        // depends on the order the hits are resolved.
+        header_.set_server_hit_detection(false);
+        header_.mutable_world()->mutable_player_parameter()
+            ->set_max_upgrade_grow(1000.0);
+        darwin::WorldState world_state;
+        RecordLiveSession(world_state, true);
+        double max_mass = 0.0;
+        for (const auto& character : world_state.GetCharacters()) {
+            max_mass = std::max(max_mass, character.physic().mass());
+        }
+        EXPECT_LT(10.0, max_mass);
+        proto::RecordingHeader header;
+        std::vector<proto::RecordedEvent> events;
+        darwin::LoadWorldRecording(filename_, header, events);
+        darwin::WorldState replay_world_state;
+        const auto replay = darwin::ReplayWorldRecording(
+            replay_world_state,
+            header,
+            events);
+        EXPECT_EQ(
+            darwin::HashWorldState(world_state),
+            replay.world_hash);
+    }
+
+    TEST_F(WorldReplayTest, WorldReplayTestRecorderChangesNothing) {
+        // A report checked against a view older than the one it is
+        // drained with, with and without a recorder.
+        std::vector<std::uint64_t> hashes;
+        for (const bool is_recorded : { false, true }) {
+            darwin::WorldState world_state;
+            darwin::StartRecordedWorldState(world_state, header_);
+            darwin::DarwinServiceImpl service{ world_state };
+            std::unique_ptr<darwin::WorldRecorder> world_recorder;
+            if (is_recorded) {
+                world_recorder = std::make_unique<darwin::WorldRecorder>(
+                    filename_,
+                    header_);
+                service.SetWorldRecorder(world_recorder.get());
+            }
+            auto create = CreateEvent(
+                1.0,
+                proto::RECORDED_EVENT_CREATE_CHARACTER,
+                "peer_bob");
+            create.mutable_create_character()->set_name("bob");
+            create.mutable_create_character()->mutable_color()->CopyFrom(
+                darwin::CreateVector3(1.0, 0.0, 0.0));
+            service.ReplayEvent(create);
+            service.TickStep(1.1);
+            auto character = world_state.GetCharacters().front();
+            auto report = CreateEvent(
+                0.0,
+                proto::RECORDED_EVENT_REPORT_IN_GAME,
+                "peer_bob");
+            report.mutable_report()->set_name("bob");
+            report.mutable_report()->set_status_enum(proto::STATUS_JUMPING);
+            report.mutable_report()->mutable_physic()->CopyFrom(
+                character.physic());
+            service.ReplayEvent(report);
+            // Changed by a step before the report is drained.
+            character.mutable_physic()->set_mass(20.0);
+            world_state.UpdateCharacter(
+                "bob",
+                character.status_enum(),
+                character.physic());
+            world_state.Update(1.15);
+            service.TickStep(1.2);
+            EXPECT_DOUBLE_EQ(
+                20.0 - header_.world().player_parameter().living_cost(),
+                world_state.GetCharacters().front().physic().mass());
+            service.SetWorldRecorder(nullptr);
+            hashes.push_back(darwin::HashWorldState(world_state));
+        }
+        EXPECT_EQ(hashes[0], hashes[1]);
+    }
+
+    TEST_F(WorldReplayTest, WorldReplayTestVersion) {
+        header_.set_version(darwin::WORLD_RECORDING_VERSION + 1);
+        {
+            darwin::WorldRecorder world_recorder(filename_, header_);
+        }
+        proto::RecordingHeader header;
+        std::vector<proto::RecordedEvent> events;
+        EXPECT_THROW(
+            darwin::LoadWorldRecording(filename_, header, events),
+            std::runtime_error);
+    }
+
+} // namespace test.
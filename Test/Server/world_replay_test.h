@@ -0,0 +1,29 @@
+#pragma once
+
+#include <filesystem>
+
+#include "Server/world_replay.h"
+#include <gtest/gtest.h>
+
+namespace test {
+
+    class WorldReplayTest : public testing::Test {
+    public:
+        WorldReplayTest() = default;
+        void SetUp() override;
+        void TearDown() override;
+        // Record a session where players report from their threads while
+        // the tick runs (and race for the same upgrades if report_hits).
+        void RecordLiveSession(
+            darwin::WorldState& world_state,
+            bool report_hits);
+
+    protected:
+        proto::RecordingHeader header_;
+        std::vector<proto::RecordedEvent> events_;
+        std::filesystem::path filename_ =
+            std::filesystem::temp_directory_path() /
+            "darwin_world_replay_test.bin";
+    };
+
+} // namespace test.
@@ -0,0 +1,124 @@
+#include "world_snapshot_test.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+
+#include "Common/stl_proto_wrapper.h"
+#include "Common/vector.h"
+
+namespace test {
+
+    void WorldSnapshotTest::PopulateWorldState() {
+        world_state_.AddElement(
+            darwin::CreateBasicElement(
+                "ground",
+                proto::TYPE_GROUND,
+                darwin::CreateVector3(0.0, 0.0, 0.0),
+                1000.0,
+                100.0));
+        auto element = darwin::CreateBasicElement(
+            "upgrade",
+            proto::TYPE_UPGRADE,
+            darwin::CreateVector3(4.0, 5.0, 6.0),
+            2.0,
+            2.0);
+        element.mutable_color()->CopyFrom(
+            darwin::CreateVector3(0.1, 0.2, 0.3));
+        world_state_.AddElement(element);
+        proto::PlayerParameter player_parameter;
+        player_parameter.set_start_mass(10.0);
+        player_parameter.set_victory_size(1000.0);
+        world_state_.SetPlayerParameter(player_parameter);
+        world_state_.Update(12.0);
+    }
+
+    void WorldSnapshotTest::TearDown() {
+        std::filesystem::remove(snapshot_filename_);
+        std::filesystem::remove(json_filename_);
+    }
+
+    TEST_F(WorldSnapshotTest, WorldSnapshotTestNoFile) {
+        darwin::WorldState world_state;
+        EXPECT_THROW(
+            darwin::LoadWorldStateFromSnapshot(
+                world_state,
+                snapshot_filename_),
+            std::exception);
+    }
+
+    TEST_F(WorldSnapshotTest, WorldSnapshotTestNotASnapshot) {
+        {
+            std::ofstream ofs(snapshot_filename_, std::ios::binary);
+            ofs << "this is not a snapshot, but it is long enough to have "
+                "a full header in it, or almost.";
+        }
+        darwin::WorldState world_state;
+        EXPECT_THROW(
+            darwin::LoadWorldStateFromSnapshot(
+                world_state,
+                snapshot_filename_),
+            std::runtime_error);
+    }
+
+    TEST_F(WorldSnapshotTest, WorldSnapshotTestHugeElementCount) {
+        PopulateWorldState();
+        darwin::SaveWorldStateToSnapshot(world_state_, snapshot_filename_);
+        {
+            // The sizes computed from this count wrap around to 0.
+            const std::uint64_t element_count = std::uint64_t{ 1 } << 61;
+            std::fstream fs(
+                snapshot_filename_,
+                std::ios::binary | std::ios::in | std::ios::out);
+            fs.seekp(offsetof(darwin::WorldSnapshotHeader, element_count));
+            fs.write(
+                reinterpret_cast<const char*>(&element_count),
+                sizeof(element_count));
+        }
+        darwin::WorldState world_state;
+        EXPECT_THROW(
+            darwin::LoadWorldStateFromSnapshot(
+                world_state,
+                snapshot_filename_),
+            std::runtime_error);
+    }
+
+    TEST_F(WorldSnapshotTest, WorldSnapshotTestSaveAndLoad) {
+        PopulateWorldState();
+        darwin::SaveWorldStateToSnapshot(world_state_, snapshot_filename_);
+        darwin::WorldState world_state;
+        darwin::LoadWorldStateFromSnapshot(world_state, snapshot_filename_);
+        EXPECT_EQ(12.0, world_state.GetLastUpdated());
+        EXPECT_EQ(
+            world_state_.GetPlayerParameter().SerializeAsString(),
+            world_state.GetPlayerParameter().SerializeAsString());
+        const auto expected = world_state_.GetElements();
+        const auto elements = world_state.GetElements();
+        ASSERT_EQ(expected.size(), elements.size());
+        for (std::size_t i = 0; i < expected.size(); ++i) {
+            EXPECT_EQ(
+                expected[i].SerializeAsString(),
+                elements[i].SerializeAsString());
+        }
+    }
+
+    TEST_F(WorldSnapshotTest, WorldSnapshotTestJsonRoundTrip) {
+        PopulateWorldState();
+        proto::WorldDatabase world;
+        world.set_time(world_state_.GetLastUpdated());
+        for (const auto& element : world_state_.GetElements()) {
+            *world.add_elements() = element;
+        }
+        world.mutable_player_parameter()->CopyFrom(
+            world_state_.GetPlayerParameter());
+        darwin::SaveProtoToJsonFile(world, json_filename_);
+        darwin::ConvertJsonToSnapshot(json_filename_, snapshot_filename_);
+        std::filesystem::remove(json_filename_);
+        darwin::ConvertSnapshotToJson(snapshot_filename_, json_filename_);
+        const auto converted =
+            darwin::LoadProtoFromJsonFile<proto::WorldDatabase>(
+                json_filename_);
+        EXPECT_EQ(world.SerializeAsString(), converted.SerializeAsString());
+    }
+
+} // namespace test.
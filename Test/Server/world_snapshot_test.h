@@ -0,0 +1,26 @@
+#pragma once
+
+#include <filesystem>
+
+#include "Server/world_snapshot.h"
+#include <gtest/gtest.h>
+
+namespace test {
+
+    class WorldSnapshotTest : public testing::Test {
+    public:
+        WorldSnapshotTest() = default;
+        void PopulateWorldState();
+        void TearDown() override;
+
+    protected:
+        darwin::WorldState world_state_;
+        std::filesystem::path snapshot_filename_ =
+            std::filesystem::temp_directory_path() /
+            "darwin_world_snapshot_test.bin";
+        std::filesystem::path json_filename_ =
+            std::filesystem::temp_directory_path() /
+            "darwin_world_snapshot_test.json";
+    };
+
+} // namespace test.
@@ -2,6 +2,7 @@
 
 #include "Common/convert_math.h"
 #include "Common/stl_proto_wrapper.h"
+#include "Common/update_merge.h"
 #include "Common/vector.h"
 
 namespace test {
@@ -148,4 +149,306 @@ namespace test {
         EXPECT_NEAR(height, 11.0, 0.01);
     }
 
+    TEST_F(WorldStateTest, WorldStateTestServerHitDetection) {
+        world_state_ = std::make_unique<darwin::WorldState>();
+        proto::PlayerParameter player_parameter;
+        player_parameter.set_victory_size(1'000.0);
+        player_parameter.set_max_upgrade_grow(100.0);
+        auto* color_parameter = player_parameter.add_color_parameters();
+        color_parameter->mutable_color()->CopyFrom(
+            darwin::CreateVector3(0.0, 1.0, 0.0));
+        world_state_->SetPlayerParameter(player_parameter);
+        world_state_->AddElement(
+            darwin::CreateBasicElement(
+                "ground",
+                proto::TYPE_GROUND,
+                darwin::CreateVector3(0.0, 0.0, 0.0),
+                1'000'000'000.0,
+                10.0));
+        auto upgrade = darwin::CreateBasicElement(
+            "upgrade",
+            proto::TYPE_UPGRADE,
+            darwin::CreateVector3(0.0, 0.0, 10.6),
+            1.0,
+            0.6);
+        upgrade.mutable_color()->CopyFrom(
+            darwin::CreateVector3(0.0, 1.0, 0.0));
+        world_state_->AddElement(upgrade);
+        auto character = darwin::CreateBasicCharacter(
+            "character",
+            darwin::CreateVector3(0.1, 0.0, 11.0),
+            10.0,
+            1.0);
+        character.mutable_color()->CopyFrom(
+            darwin::CreateVector3(1.0, 0.0, 0.0));
+        character.set_status_enum(proto::STATUS_JUMPING);
+        world_state_->AddCharacter(character);
+        world_state_->Update(1.0);
+        auto characters = world_state_->GetCharacters();
+        ASSERT_EQ(characters.size(), 1);
+        EXPECT_EQ(characters[0].physic().mass(), 11.0);
+        // The upgrade was eaten and a new one was spawned.
+        auto elements = world_state_->GetElements();
+        EXPECT_EQ(elements.size(), 2);
+        for (const auto& element : elements) {
+            EXPECT_NE(element.name(), "upgrade");
+        }
+    }
+
+    TEST_F(WorldStateTest, WorldStateTestReportedHits) {
+        world_state_ = std::make_unique<darwin::WorldState>();
+        world_state_->SetServerHitDetection(false);
+        proto::PlayerParameter player_parameter;
+        player_parameter.set_victory_size(1'000.0);
+        player_parameter.set_max_upgrade_grow(100.0);
+        auto* color_parameter = player_parameter.add_color_parameters();
+        color_parameter->mutable_color()->CopyFrom(
+            darwin::CreateVector3(0.0, 1.0, 0.0));
+        world_state_->SetPlayerParameter(player_parameter);
+        world_state_->AddElement(
+            darwin::CreateBasicElement(
+                "ground",
+                proto::TYPE_GROUND,
+                darwin::CreateVector3(0.0, 0.0, 0.0),
+                1'000'000'000.0,
+                10.0));
+        for (const std::string name : { "upgrade1", "upgrade2" }) {
+            auto upgrade = darwin::CreateBasicElement(
+                name,
+                proto::TYPE_UPGRADE,
+                darwin::CreateVector3(
+                    name == "upgrade1" ? 0.0 : 0.2,
+                    0.0,
+                    10.6),
+                1.0,
+                0.6);
+            upgrade.mutable_color()->CopyFrom(
+                darwin::CreateVector3(0.0, 1.0, 0.0));
+            world_state_->AddElement(upgrade);
+        }
+        auto character = darwin::CreateBasicCharacter(
+            "character",
+            darwin::CreateVector3(0.1, 0.0, 11.0),
+            10.0,
+            1.0);
+        character.mutable_color()->CopyFrom(
+            darwin::CreateVector3(1.0, 0.0, 0.0));
+        character.set_status_enum(proto::STATUS_JUMPING);
+        world_state_->AddCharacter(character);
+        world_state_->Update(1.0);
+        const auto view = world_state_->GetView();
+        const auto eater = view->FindHandle("character");
+        const auto upgrade1 = view->FindHandle("upgrade1");
+        const auto upgrade2 = view->FindHandle("upgrade2");
+        ASSERT_TRUE(eater && upgrade1 && upgrade2);
+        // Two hits of the same character, the first upgrade twice.
+        const std::vector<darwin::HitEvent> hits = {
+            { *eater, *upgrade1, 2 },
+            { *eater, *upgrade2, 1 },
+            { *eater, *upgrade1, 0 },
+        };
+        world_state_->SetCharacterHits(hits);
+        world_state_->Update(2.0);
+        auto characters = world_state_->GetCharacters();
+        ASSERT_EQ(characters.size(), 1);
+        EXPECT_EQ(characters[0].physic().mass(), 12.0);
+        auto elements = world_state_->GetElements();
+        EXPECT_EQ(elements.size(), 3);
+        for (const auto& element : elements) {
+            EXPECT_NE(element.name(), "upgrade1");
+            EXPECT_NE(element.name(), "upgrade2");
+        }
+        // The hits were consumed.
+        world_state_->Update(3.0);
+        EXPECT_EQ(world_state_->GetCharacters()[0].physic().mass(), 12.0);
+    }
+
+    TEST_F(WorldStateTest, WorldStateTestDeltaUpdate) {
+        world_state_ = std::make_unique<darwin::WorldState>();
+        proto::PlayerParameter player_parameter;
+        player_parameter.set_victory_size(1'000.0);
+        world_state_->SetPlayerParameter(player_parameter);
+        world_state_->AddElement(
+            darwin::CreateBasicElement(
+                "ground",
+                proto::TYPE_GROUND,
+                darwin::CreateVector3(0.0, 0.0, 0.0),
+                1'000'000'000.0,
+                10.0));
+        world_state_->AddElement(
+            darwin::CreateBasicElement(
+                "rock",
+                proto::TYPE_BROWN,
+                darwin::CreateVector3(0.0, 10.0, 0.0),
+                1.0,
+                1.0));
+        world_state_->AddCharacter(
+            darwin::CreateBasicCharacter(
+                "character1",
+                darwin::CreateVector3(0.0, 0.0, 11.0),
+                10.0,
+                1.0));
+        world_state_->AddCharacter(
+            darwin::CreateBasicCharacter(
+                "character2",
+                darwin::CreateVector3(0.0, 0.0, -11.0),
+                10.0,
+                1.0));
+        world_state_->Update(1.0);
+        std::map<std::string, proto::Element> elements;
+        std::map<std::string, proto::Character> characters;
+        proto::UpdateResponse full;
+        world_state_->FillUpdateResponse(full);
+        EXPECT_EQ(full.baseline_sequence(), 0);
+        darwin::MergeUpdateResponse(full, elements, characters);
+        const std::uint64_t baseline = full.sequence();
+        // Nothing changed, the delta is empty.
+        world_state_->Update(2.0);
+        proto::UpdateResponse empty;
+        world_state_->FillUpdateResponse(empty, baseline);
+        EXPECT_EQ(empty.baseline_sequence(), baseline);
+        EXPECT_EQ(empty.characters_size(), 0);
+        EXPECT_EQ(empty.elements_size(), 0);
+        // Move, remove and add.
+        proto::Physic physic;
+        physic.mutable_position()->CopyFrom(
+            darwin::CreateVector3(0.0, 11.0, 0.0));
+        physic.set_mass(12.0);
+        physic.set_radius(1.0);
+        world_state_->UpdateCharacter(
+            "character1",
+            proto::STATUS_JUMPING,
+            physic);
+        world_state_->RemoveCharacter("character2");
+        world_state_->AddElement(
+            darwin::CreateBasicElement(
+                "tree",
+                proto::TYPE_GREEN,
+                darwin::CreateVector3(10.0, 0.0, 0.0),
+                1.0,
+                1.0));
+        world_state_->Update(3.0);
+        proto::UpdateResponse delta;
+        world_state_->FillUpdateResponse(delta, baseline);
+        EXPECT_EQ(delta.characters_size(), 1);
+        EXPECT_EQ(delta.elements_size(), 1);
+        EXPECT_EQ(delta.removed_characters_size(), 1);
+        darwin::MergeUpdateResponse(delta, elements, characters);
+        // Merged delta is the same as a full update.
+        std::map<std::string, proto::Element> expected_elements;
+        std::map<std::string, proto::Character> expected_characters;
+        proto::UpdateResponse expected;
+        world_state_->FillUpdateResponse(expected);
+        darwin::MergeUpdateResponse(
+            expected,
+            expected_elements,
+            expected_characters);
+        ASSERT_EQ(elements.size(), expected_elements.size());
+        for (const auto& [name, element] : expected_elements) {
+            ASSERT_TRUE(elements.contains(name));
+            EXPECT_TRUE(darwin::operator==(elements.at(name), element));
+        }
+        ASSERT_EQ(characters.size(), expected_characters.size());
+        for (const auto& [name, character] : expected_characters) {
+            ASSERT_TRUE(characters.contains(name));
+            EXPECT_EQ(
+                characters.at(name).physic().mass(),
+                character.physic().mass());
+            EXPECT_EQ(
+                characters.at(name).status_enum(),
+                character.status_enum());
+            EXPECT_EQ(
+                characters.at(name).physic().position().y(),
+                character.physic().position().y());
+        }
+    }
+
+    TEST_F(WorldStateTest, WorldStateTestVisibleUpdate) {
+        world_state_ = std::make_unique<darwin::WorldState>();
+        proto::PlayerParameter player_parameter;
+        player_parameter.set_victory_size(1'000.0);
+        world_state_->SetPlayerParameter(player_parameter);
+        world_state_->AddElement(
+            darwin::CreateBasicElement(
+                "ground",
+                proto::TYPE_GROUND,
+                darwin::CreateVector3(0.0, 0.0, 0.0),
+                1'000'000'000.0,
+                10.0));
+        world_state_->AddElement(
+            darwin::CreateBasicElement(
+                "near",
+                proto::TYPE_BROWN,
+                darwin::CreateVector3(2.0, 0.0, 10.0),
+                1.0,
+                1.0));
+        world_state_->AddElement(
+            darwin::CreateBasicElement(
+                "far",
+                proto::TYPE_BROWN,
+                darwin::CreateVector3(0.0, 2.0, -10.0),
+                1.0,
+                1.0));
+        world_state_->AddCharacter(
+            darwin::CreateBasicCharacter(
+                "character1",
+                darwin::CreateVector3(0.0, 0.0, 11.0),
+                10.0,
+                1.0));
+        world_state_->AddCharacter(
+            darwin::CreateBasicCharacter(
+                "character2",
+                darwin::CreateVector3(0.0, 0.0, -11.0),
+                10.0,
+                1.0));
+        world_state_->Update(1.0);
+        const double angle = darwin::PI / 4.0;
+        // No character, no filter.
+        EXPECT_FALSE(world_state_->GetVisibleHandles("nobody", angle));
+        auto maybe_visible =
+            world_state_->GetVisibleHandles("character1", angle);
+        ASSERT_TRUE(maybe_visible);
+        proto::UpdateResponse full;
+        world_state_->FillVisibleUpdateResponse(full, *maybe_visible);
+        std::map<std::string, proto::Element> elements;
+        std::map<std::string, proto::Character> characters;
+        darwin::MergeUpdateResponse(full, elements, characters);
+        EXPECT_EQ(elements.size(), 2);
+        EXPECT_TRUE(elements.contains("ground"));
+        EXPECT_TRUE(elements.contains("near"));
+        ASSERT_EQ(characters.size(), 1);
+        EXPECT_TRUE(characters.contains("character1"));
+        // Move to the other side of the planet.
+        proto::Physic physic;
+        physic.mutable_position()->CopyFrom(
+            darwin::CreateVector3(0.0, 0.0, -11.0));
+        physic.set_mass(10.0);
+        physic.set_radius(1.0);
+        world_state_->UpdateCharacter(
+            "character1",
+            proto::STATUS_JUMPING,
+            physic);
+        world_state_->Update(2.0);
+        auto maybe_moved =
+            world_state_->GetVisibleHandles("character1", angle);
+        ASSERT_TRUE(maybe_moved);
+        proto::UpdateResponse delta;
+        world_state_->FillVisibleUpdateResponse(
+            delta,
+            *maybe_moved,
+            full.sequence(),
+            *maybe_visible);
+        EXPECT_EQ(delta.baseline_sequence(), full.sequence());
+        ASSERT_EQ(delta.removed_elements_size(), 1);
+        EXPECT_EQ(delta.removed_elements(0), "near");
+        darwin::MergeUpdateResponse(delta, elements, characters);
+        EXPECT_EQ(elements.size(), 2);
+        EXPECT_TRUE(elements.contains("ground"));
+        EXPECT_TRUE(elements.contains("far"));
+        EXPECT_EQ(characters.size(), 2);
+        EXPECT_TRUE(characters.contains("character2"));
+        ASSERT_TRUE(characters.contains("character1"));
+        EXPECT_EQ(characters.at("character1").physic().position().z(), -11.0);
+    }
+
 }  // namespace test.
\ No newline at end of file
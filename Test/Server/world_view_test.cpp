@@ -0,0 +1,236 @@
+#include "Test/Server/world_view_test.h"
+
+#include <atomic>
+#include <format>
+#include <set>
+#include <thread>
+
+#include "Common/stl_proto_wrapper.h"
+#include "Common/update_merge.h"
+#include "Common/vector.h"
+
+namespace test {
+
+    void WorldViewTest::SetUp() {
+        proto::PlayerParameter player_parameter;
+        player_parameter.set_start_mass(10.0);
+        player_parameter.set_drop_height(5.0);
+        player_parameter.set_disconnection_timeout(10.0);
+        player_parameter.set_victory_size(1000.0);
+        world_state_.SetPlayerParameter(player_parameter);
+        world_state_.AddElement(
+            darwin::CreateBasicElement(
+                "ground",
+                proto::TYPE_GROUND,
+                darwin::CreateVector3(0.0, 0.0, 0.0),
+                1000.0,
+                100.0));
+        world_state_.CreateCharacter(
+            "peer_alice",
+            "alice",
+            darwin::CreateVector3(1.0, 0.0, 0.0));
+        MoveCharacter(100.0, 1.0);
+    }
+
+    void WorldViewTest::MoveCharacter(double z, double time) {
+        proto::Physic physic;
+        physic.mutable_position()->CopyFrom(
+            darwin::CreateVector3(0.0, 0.0, z));
+        physic.set_mass(10.0);
+        physic.set_radius(1.0);
+        world_state_.UpdateCharacter("alice", proto::STATUS_JUMPING, physic);
+        world_state_.Update(time);
+    }
+
+    TEST_F(WorldViewTest, ViewIsImmutable) {
+        const auto view = world_state_.GetView();
+        EXPECT_EQ(1.0, view->GetTime());
+        EXPECT_EQ(10.0, view->GetPlayerParameter().start_mass());
+        MoveCharacter(101.0, 2.0);
+        // The old view is left as it was.
+        auto maybe_alice = view->GetCharacterOwnedByPeer("peer_alice", "alice");
+        ASSERT_TRUE(maybe_alice);
+        EXPECT_EQ(100.0, maybe_alice->physic().position().z());
+        const auto new_view = world_state_.GetView();
+        EXPECT_EQ(view->GetSequence() + 1, new_view->GetSequence());
+        maybe_alice = new_view->GetCharacterOwnedByPeer("peer_alice", "alice");
+        ASSERT_TRUE(maybe_alice);
+        EXPECT_EQ(101.0, maybe_alice->physic().position().z());
+        // Both describe the same elements.
+        EXPECT_EQ(1, view->GetElements().size());
+        EXPECT_EQ(1, new_view->GetElements().size());
+    }
+
+    TEST_F(WorldViewTest, OwnerPublishedByTick) {
+        world_state_.CreateCharacter(
+            "peer_bob",
+            "bob",
+            darwin::CreateVector3(0.0, 1.0, 0.0));
+        // The calls from the clients show at the next tick.
+        EXPECT_FALSE(
+            world_state_.GetView()->GetCharacterOwnedByPeer("peer_bob", "bob"));
+        world_state_.Update(2.0);
+        EXPECT_TRUE(
+            world_state_.GetView()->GetCharacterOwnedByPeer("peer_bob", "bob"));
+        world_state_.RemovePeer("peer_bob");
+        EXPECT_TRUE(
+            world_state_.GetView()->GetCharacterOwnedByPeer("peer_bob", "bob"));
+        world_state_.Update(3.0);
+        EXPECT_FALSE(
+            world_state_.GetView()->GetCharacterOwnedByPeer("peer_bob", "bob"));
+    }
+
+    TEST_F(WorldViewTest, ElementsFollowChanges) {
+        // Views held across the changes, the elements are patched in the
+        // copies that no view holds anymore.
+        std::vector<std::shared_ptr<const darwin::WorldView>> views;
+        std::vector<std::vector<proto::Element>> held;
+        for (int i = 0; i < 20; ++i) {
+            world_state_.AddElement(
+                darwin::CreateBasicElement(
+                    std::format("upgrade_{}", i),
+                    proto::TYPE_UPGRADE,
+                    darwin::CreateVector3(0.0, 101.0, i),
+                    1.0,
+                    1.0));
+            if (i % 3 == 0) {
+                world_state_.AddElement(
+                    darwin::CreateBasicElement(
+                        std::format("upgrade_{}", i / 2),
+                        proto::TYPE_UPGRADE,
+                        darwin::CreateVector3(1.0, 101.0, i),
+                        2.0,
+                        1.0));
+            }
+            if (i % 5 == 4) {
+                // Removed, the last row moves in its place.
+                proto::WorldJournalEntry entry;
+                entry.set_time(1.5 + i);
+                entry.add_removed_elements(std::format("upgrade_{}", i - 3));
+                world_state_.ApplyJournalEntry(entry);
+            }
+            world_state_.Update(2.0 + i);
+            const auto view = world_state_.GetView();
+            auto expected = world_state_.GetElements();
+            auto elements = view->GetElements();
+            ASSERT_EQ(expected.size(), elements.size());
+            for (std::size_t j = 0; j < elements.size(); ++j) {
+                EXPECT_EQ(
+                    expected[j].SerializeAsString(),
+                    elements[j].SerializeAsString());
+                EXPECT_TRUE(view->FindHandle(elements[j].name()));
+            }
+            if (i % 4 == 0) {
+                views.push_back(view);
+                held.push_back(view->GetElements());
+            }
+        }
+        // The held views didn't change.
+        for (std::size_t i = 0; i < views.size(); ++i) {
+            auto elements = views[i]->GetElements();
+            ASSERT_EQ(held[i].size(), elements.size());
+            for (std::size_t j = 0; j < elements.size(); ++j) {
+                EXPECT_EQ(
+                    held[i][j].SerializeAsString(),
+                    elements[j].SerializeAsString());
+            }
+        }
+    }
+
+    TEST_F(WorldViewTest, ViewsAreRecycled) {
+        std::set<const darwin::WorldView*> views;
+        for (int i = 0; i < 10; ++i) {
+            views.insert(world_state_.GetView().get());
+            MoveCharacter(100.0 + i, 2.0 + i);
+        }
+        // Nobody holds them, the same few views are reused.
+        EXPECT_LE(views.size(), 3);
+        // A held view is never reused.
+        const auto held = world_state_.GetView();
+        const std::uint64_t sequence = held->GetSequence();
+        for (int i = 0; i < 10; ++i) {
+            MoveCharacter(200.0 + i, 20.0 + i);
+        }
+        EXPECT_EQ(sequence, held->GetSequence());
+        EXPECT_EQ(109.0, held->GetCharacters().at(0).physic().position().z());
+    }
+
+    TEST_F(WorldViewTest, ReadWhileTicking) {
+        std::atomic<bool> done = false;
+        std::atomic<std::size_t> errors = 0;
+        std::thread reader([this, &done, &errors] {
+            std::uint64_t last_sequence = 0;
+            while (!done) {
+                const auto view = world_state_.GetView();
+                proto::UpdateResponse response;
+                view->FillUpdateResponse(response);
+                if (view->GetSequence() < last_sequence ||
+                    response.characters_size() != 1 ||
+                    response.elements_size() != 1)
+                {
+                    ++errors;
+                }
+                last_sequence = view->GetSequence();
+            }
+        });
+        for (int i = 0; i < 1'000; ++i) {
+            MoveCharacter(100.0 + (i % 10), 2.0 + i);
+        }
+        done = true;
+        reader.join();
+        EXPECT_EQ(0, errors);
+    }
+
+    TEST_F(WorldViewTest, UpdateByHandle) {
+        const auto by_handle = darwin::WireIdEnum::WIRE_ID_HANDLE;
+        proto::UpdateResponse full;
+        world_state_.GetView()->FillUpdateResponse(full, 0, by_handle);
+        ASSERT_EQ(1, full.characters_size());
+        EXPECT_EQ("alice", full.characters(0).name());
+        const std::uint32_t alice = full.characters(0).handle();
+        EXPECT_NE(0, alice);
+        std::map<std::uint32_t, std::string> names;
+        std::map<std::string, proto::Element> elements;
+        std::map<std::string, proto::Character> characters;
+        darwin::MergeUpdateResponse(full, names, elements, characters);
+        // Known entities come by handle only.
+        MoveCharacter(101.0, 2.0);
+        proto::UpdateResponse delta;
+        world_state_.GetView()->FillUpdateResponse(
+            delta,
+            full.sequence(),
+            by_handle);
+        ASSERT_EQ(1, delta.characters_size());
+        EXPECT_TRUE(delta.characters(0).name().empty());
+        EXPECT_EQ(alice, delta.characters(0).handle());
+        proto::UpdateResponse delta_by_name;
+        world_state_.GetView()->FillUpdateResponse(
+            delta_by_name,
+            full.sequence());
+        EXPECT_LT(delta.ByteSizeLong(), delta_by_name.ByteSizeLong());
+        darwin::MergeUpdateResponse(delta, names, elements, characters);
+        ASSERT_TRUE(characters.contains("alice"));
+        EXPECT_EQ(101.0, characters.at("alice").physic().position().z());
+        // A new entity is introduced by name, a removed one by handle.
+        world_state_.CreateCharacter(
+            "peer_bob",
+            "bob",
+            darwin::CreateVector3(0.0, 1.0, 0.0));
+        world_state_.RemovePeer("peer_alice");
+        world_state_.Update(3.0);
+        proto::UpdateResponse changes;
+        world_state_.GetView()->FillUpdateResponse(
+            changes,
+            delta.sequence(),
+            by_handle);
+        ASSERT_EQ(1, changes.removed_character_handles_size());
+        EXPECT_EQ(alice, changes.removed_character_handles(0));
+        EXPECT_EQ(0, changes.removed_characters_size());
+        darwin::MergeUpdateResponse(changes, names, elements, characters);
+        EXPECT_EQ(1, characters.size());
+        EXPECT_TRUE(characters.contains("bob"));
+        EXPECT_EQ(1, elements.size());
+        EXPECT_EQ(2, names.size());
+    }
+
+} // namespace test.
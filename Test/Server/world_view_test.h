@@ -0,0 +1,21 @@
+#pragma once
+
+#include "Server/world_state.h"
+#include "Server/world_view.h"
+#include <gtest/gtest.h>
+
+namespace test {
+
+    class WorldViewTest : public testing::Test {
+    public:
+        WorldViewTest() = default;
+        // A planet of radius 100 and one character (alice) on it.
+        void SetUp() override;
+        // Move alice to height z at time (a tick).
+        void MoveCharacter(double z, double time);
+
+    protected:
+        darwin::WorldState world_state_;
+    };
+
+} // namespace test.